@@ -0,0 +1,207 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/fmt/fmt-config-version.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-config.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets-release.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets.cmake"
+  "/root/miniconda/lib/cmake/spdlog/spdlogConfig.cmake"
+  "/root/miniconda/lib/cmake/spdlog/spdlogConfigTargets-release.cmake"
+  "/root/miniconda/lib/cmake/spdlog/spdlogConfigTargets.cmake"
+  "/root/miniconda/lib/cmake/spdlog/spdlogConfigVersion.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindFilesystem.cmake"
+  "/root/repo/cmake/Helper.cmake"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/include/api/wasmedge/int128.h"
+  "/root/repo/include/api/wasmedge/version.h.in"
+  "/root/repo/include/api/wasmedge/wasmedge.h"
+  "/root/repo/include/api/wasmedge/wasmedge_ast.h"
+  "/root/repo/include/api/wasmedge/wasmedge_basic.h"
+  "/root/repo/include/api/wasmedge/wasmedge_compiler.h"
+  "/root/repo/include/api/wasmedge/wasmedge_configure.h"
+  "/root/repo/include/api/wasmedge/wasmedge_context.h"
+  "/root/repo/include/api/wasmedge/wasmedge_deprecated.h"
+  "/root/repo/include/api/wasmedge/wasmedge_execution.h"
+  "/root/repo/include/api/wasmedge/wasmedge_experimental.h"
+  "/root/repo/include/api/wasmedge/wasmedge_instance.h"
+  "/root/repo/include/api/wasmedge/wasmedge_plugin.h"
+  "/root/repo/include/api/wasmedge/wasmedge_tools.h"
+  "/root/repo/include/api/wasmedge/wasmedge_value.h"
+  "/root/repo/include/api/wasmedge/wasmedge_vm.h"
+  "/root/repo/include/common/config.h.in"
+  "/root/repo/include/common/enum.inc"
+  "/root/repo/include/common/enum_configure.h"
+  "/root/repo/include/common/enum_errcode.h"
+  "/root/repo/include/common/enum_types.h"
+  "/root/repo/include/common/version.h.in"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/lib/aot/CMakeLists.txt"
+  "/root/repo/lib/api/CMakeLists.txt"
+  "/root/repo/lib/common/CMakeLists.txt"
+  "/root/repo/lib/driver/CMakeLists.txt"
+  "/root/repo/lib/executor/CMakeLists.txt"
+  "/root/repo/lib/host/CMakeLists.txt"
+  "/root/repo/lib/host/wasi/CMakeLists.txt"
+  "/root/repo/lib/llvm/CMakeLists.txt"
+  "/root/repo/lib/loader/CMakeLists.txt"
+  "/root/repo/lib/plugin/CMakeLists.txt"
+  "/root/repo/lib/plugin/wasi_logging/CMakeLists.txt"
+  "/root/repo/lib/po/CMakeLists.txt"
+  "/root/repo/lib/system/CMakeLists.txt"
+  "/root/repo/lib/validator/CMakeLists.txt"
+  "/root/repo/lib/vm/CMakeLists.txt"
+  "/root/repo/plugins/CMakeLists.txt"
+  "/root/repo/thirdparty/CMakeLists.txt"
+  "/root/repo/thirdparty/blake3/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/wasmedge/CMakeLists.txt"
+  "/usr/lib/llvm-14/cmake/AddLLVM.cmake"
+  "/usr/lib/llvm-14/cmake/DetermineGCCCompatible.cmake"
+  "/usr/lib/llvm-14/cmake/FindFFI.cmake"
+  "/usr/lib/llvm-14/cmake/FindTerminfo.cmake"
+  "/usr/lib/llvm-14/cmake/LLVM-Config.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfig.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfigVersion.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMDistributionSupport.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMProcessSources.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVM-Config.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports-release.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports.cmake"
+  "/usr/share/cmake-3.25/Modules/AddFileDependencies.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/api/wasmedge/int128.h"
+  "include/api/wasmedge/version.h"
+  "include/api/wasmedge/wasmedge.h"
+  "include/api/wasmedge/wasmedge_ast.h"
+  "include/api/wasmedge/wasmedge_basic.h"
+  "include/api/wasmedge/wasmedge_compiler.h"
+  "include/api/wasmedge/wasmedge_configure.h"
+  "include/api/wasmedge/wasmedge_context.h"
+  "include/api/wasmedge/wasmedge_deprecated.h"
+  "include/api/wasmedge/wasmedge_execution.h"
+  "include/api/wasmedge/wasmedge_experimental.h"
+  "include/api/wasmedge/wasmedge_instance.h"
+  "include/api/wasmedge/wasmedge_plugin.h"
+  "include/api/wasmedge/wasmedge_tools.h"
+  "include/api/wasmedge/wasmedge_value.h"
+  "include/api/wasmedge/wasmedge_vm.h"
+  "include/common/config.h"
+  "include/api/wasmedge/enum.inc"
+  "include/api/wasmedge/enum_configure.h"
+  "include/api/wasmedge/enum_errcode.h"
+  "include/api/wasmedge/enum_types.h"
+  "include/common/version.h"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/aot/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/llvm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/plugin/wasi_logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/po/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/validator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/executor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/host/wasi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/vm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/driver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/blake3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/wasmedge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "lib/aot/CMakeFiles/wasmedgeAOT.dir/DependInfo.cmake"
+  "lib/llvm/CMakeFiles/intrinsics_gen.dir/DependInfo.cmake"
+  "lib/llvm/CMakeFiles/omp_gen.dir/DependInfo.cmake"
+  "lib/llvm/CMakeFiles/acc_gen.dir/DependInfo.cmake"
+  "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/DependInfo.cmake"
+  "lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  "lib/plugin/CMakeFiles/wasmedgePlugin.dir/DependInfo.cmake"
+  "lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/DependInfo.cmake"
+  "lib/po/CMakeFiles/wasmedgePO.dir/DependInfo.cmake"
+  "lib/loader/CMakeFiles/wasmedgeLoaderFileMgr.dir/DependInfo.cmake"
+  "lib/loader/CMakeFiles/wasmedgeLoader.dir/DependInfo.cmake"
+  "lib/validator/CMakeFiles/wasmedgeValidator.dir/DependInfo.cmake"
+  "lib/executor/CMakeFiles/wasmedgeExecutor.dir/DependInfo.cmake"
+  "lib/host/wasi/CMakeFiles/wasmedgeHostModuleWasi.dir/DependInfo.cmake"
+  "lib/vm/CMakeFiles/wasmedgeVM.dir/DependInfo.cmake"
+  "lib/driver/CMakeFiles/wasmedgeDriver.dir/DependInfo.cmake"
+  "lib/api/CMakeFiles/wasmedgeCAPI.dir/DependInfo.cmake"
+  "lib/api/CMakeFiles/wasmedge_shared.dir/DependInfo.cmake"
+  "thirdparty/blake3/CMakeFiles/utilBlake3.dir/DependInfo.cmake"
+  "tools/wasmedge/CMakeFiles/wasmedgec.dir/DependInfo.cmake"
+  "tools/wasmedge/CMakeFiles/wasmedge.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/wasmedge_tools.h - WasmEdge C API ------------------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains functions for driving WasmEdge tools in the WasmEdge C
+/// API.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef WASMEDGE_C_API_TOOLS_H
+#define WASMEDGE_C_API_TOOLS_H
+
+#include "wasmedge/wasmedge_basic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// >>>>>>>> WasmEdge Driver functions >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(__WIN32__) ||                \
+    defined(__TOS_WIN__) || defined(__WINDOWS__)
+/// Convert UTF16 Args to UTF8 Args
+///
+/// This function is an argument converter for Windows platforms.
+/// The caller owns the vector and should call `WasmEdge_Driver_ArgvDelete` to
+/// destroy it.
+///
+/// \param Argc the argument count.
+/// \param Argv the argument vector.
+///
+/// \returns Allocated argument vector.
+WASMEDGE_CAPI_EXPORT extern const char **
+WasmEdge_Driver_ArgvCreate(int Argc,
+                           const wchar_t *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Deletion of the argument vector
+///
+/// \param Argv the argument vector.
+WASMEDGE_CAPI_EXPORT extern void
+WasmEdge_Driver_ArgvDelete(const char *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Set console output code page to UTF-8 on windows.
+WASMEDGE_CAPI_EXPORT extern void
+WasmEdge_Driver_SetConsoleOutputCPtoUTF8(void) WASMEDGE_CAPI_NOEXCEPT;
+#endif
+
+/// Entry point for the compiler tool.
+///
+/// This function provides an entry point to the WasmEdge AOT compiler tool with
+/// the command line arguments.
+///
+/// \param Argc the argument count.
+/// \param Argv the argument vector.
+///
+/// \returns the execution status.
+WASMEDGE_CAPI_EXPORT extern int
+WasmEdge_Driver_Compiler(int Argc, const char *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Entry point for the runtime tool.
+///
+/// This function provides an entry point to the WasmEdge runtime tool with the
+/// command line arguments.
+///
+/// \param Argc the argument count.
+/// \param Argv the argument vector.
+///
+/// \returns the execution status.
+WASMEDGE_CAPI_EXPORT extern int
+WasmEdge_Driver_Tool(int Argc, const char *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+
+#ifdef WASMEDGE_BUILD_WASI_NN_RPC
+/// Entry point for the WASI-NN RPC server tool.
+///
+/// This function provides an entry point to the WasmEdge WASI-NN RPC server
+/// tool with the command line arguments.
+///
+/// \param Argc the argument count.
+/// \param Argv the argument vector.
+///
+/// \returns the execution status.
+WASMEDGE_CAPI_EXPORT extern int
+WasmEdge_Driver_WasiNNRPCServer(int Argc,
+                                const char *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+#endif
+
+/// Entry point for the unified tool.
+///
+/// This function provides an entry point to the WasmEdge unified tool with the
+/// command line arguments.
+///
+/// \param Argc the argument count.
+/// \param Argv the argument vector.
+///
+/// \returns the execution status.
+WASMEDGE_CAPI_EXPORT extern int
+WasmEdge_Driver_UniTool(int Argc, const char *Argv[]) WASMEDGE_CAPI_NOEXCEPT;
+
+// <<<<<<<< WasmEdge Driver functions <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#ifdef __cplusplus
+} /// extern "C"
+#endif
+
+#endif /// WASMEDGE_C_API_TOOLS_H
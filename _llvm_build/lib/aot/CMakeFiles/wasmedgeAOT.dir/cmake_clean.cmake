@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeAOT.dir/blake3.cpp.o"
+  "CMakeFiles/wasmedgeAOT.dir/blake3.cpp.o.d"
+  "CMakeFiles/wasmedgeAOT.dir/cache.cpp.o"
+  "CMakeFiles/wasmedgeAOT.dir/cache.cpp.o.d"
+  "libwasmedgeAOT.a"
+  "libwasmedgeAOT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeAOT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeCAPI.dir/wasmedge.cpp.o"
+  "CMakeFiles/wasmedgeCAPI.dir/wasmedge.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeCAPI.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/api/wasmedge_compat.cpp" "lib/api/CMakeFiles/wasmedge_shared.dir/wasmedge_compat.cpp.o" "gcc" "lib/api/CMakeFiles/wasmedge_shared.dir/wasmedge_compat.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_llvm_build/lib/api/libwasmedge.so" "/root/repo/_llvm_build/lib/api/libwasmedge.so.0.1.1"
+  "/root/repo/_llvm_build/lib/api/libwasmedge.so.0" "/root/repo/_llvm_build/lib/api/libwasmedge.so.0.1.1"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/driver/CMakeFiles/wasmedgeDriver.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/vm/CMakeFiles/wasmedgeVM.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/plugin/CMakeFiles/wasmedgePlugin.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/po/CMakeFiles/wasmedgePO.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/validator/CMakeFiles/wasmedgeValidator.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/executor/CMakeFiles/wasmedgeExecutor.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/host/wasi/CMakeFiles/wasmedgeHostModuleWasi.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/llvm/CMakeFiles/wasmedgeLLVM.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoader.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/aot/CMakeFiles/wasmedgeAOT.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedge_shared.dir/wasmedge_compat.cpp.o"
+  "CMakeFiles/wasmedge_shared.dir/wasmedge_compat.cpp.o.d"
+  "libwasmedge.pdb"
+  "libwasmedge.so"
+  "libwasmedge.so.0"
+  "libwasmedge.so.0.1.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedge_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,147 @@
+# Install script for directory: /root/repo/lib/api
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "WasmEdge" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so.0.1.1"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so.0"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "\$ORIGIN")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_llvm_build/lib/api/libwasmedge.so.0.1.1"
+    "/root/repo/_llvm_build/lib/api/libwasmedge.so.0"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so.0.1.1"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so.0"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/usr/lib/llvm-14/lib:/root/miniconda/lib:"
+           NEW_RPATH "\$ORIGIN")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "WasmEdge" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so"
+         RPATH "\$ORIGIN")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_llvm_build/lib/api/libwasmedge.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so"
+         OLD_RPATH "/usr/lib/llvm-14/lib:/root/miniconda/lib:"
+         NEW_RPATH "\$ORIGIN")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libwasmedge.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/wasmedge" TYPE FILE FILES
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_ast.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_basic.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_compiler.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_configure.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_context.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_deprecated.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_execution.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_experimental.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_instance.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_plugin.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_tools.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_value.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_vm.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/version.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum.inc"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_configure.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_errcode.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_types.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/int128.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "WasmEdge" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/wasmedge" TYPE FILE FILES
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_ast.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_basic.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_compiler.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_configure.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_context.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_deprecated.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_execution.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_experimental.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_instance.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_plugin.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_tools.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_value.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/wasmedge_vm.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/version.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum.inc"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_configure.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_errcode.h"
+    "/root/repo/_llvm_build/lib/api/../../include/api/wasmedge/enum_types.h"
+    "/root/repo/lib/api/../../include/api/wasmedge/int128.h"
+    )
+endif()
+
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/common/errinfo.cpp" "lib/common/CMakeFiles/wasmedgeCommon.dir/errinfo.cpp.o" "gcc" "lib/common/CMakeFiles/wasmedgeCommon.dir/errinfo.cpp.o.d"
+  "/root/repo/lib/common/hash.cpp" "lib/common/CMakeFiles/wasmedgeCommon.dir/hash.cpp.o" "gcc" "lib/common/CMakeFiles/wasmedgeCommon.dir/hash.cpp.o.d"
+  "/root/repo/lib/common/hexstr.cpp" "lib/common/CMakeFiles/wasmedgeCommon.dir/hexstr.cpp.o" "gcc" "lib/common/CMakeFiles/wasmedgeCommon.dir/hexstr.cpp.o.d"
+  "/root/repo/lib/common/profile.cpp" "lib/common/CMakeFiles/wasmedgeCommon.dir/profile.cpp.o" "gcc" "lib/common/CMakeFiles/wasmedgeCommon.dir/profile.cpp.o.d"
+  "/root/repo/lib/common/spdlog.cpp" "lib/common/CMakeFiles/wasmedgeCommon.dir/spdlog.cpp.o" "gcc" "lib/common/CMakeFiles/wasmedgeCommon.dir/spdlog.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeCommon.dir/errinfo.cpp.o"
+  "CMakeFiles/wasmedgeCommon.dir/errinfo.cpp.o.d"
+  "CMakeFiles/wasmedgeCommon.dir/hash.cpp.o"
+  "CMakeFiles/wasmedgeCommon.dir/hash.cpp.o.d"
+  "CMakeFiles/wasmedgeCommon.dir/hexstr.cpp.o"
+  "CMakeFiles/wasmedgeCommon.dir/hexstr.cpp.o.d"
+  "CMakeFiles/wasmedgeCommon.dir/profile.cpp.o"
+  "CMakeFiles/wasmedgeCommon.dir/profile.cpp.o.d"
+  "CMakeFiles/wasmedgeCommon.dir/spdlog.cpp.o"
+  "CMakeFiles/wasmedgeCommon.dir/spdlog.cpp.o.d"
+  "libwasmedgeCommon.a"
+  "libwasmedgeCommon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeCommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/driver/compilerTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/compilerTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/compilerTool.cpp.o.d"
+  "/root/repo/lib/driver/fuzzPO.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/fuzzPO.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/fuzzPO.cpp.o.d"
+  "/root/repo/lib/driver/fuzzTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/fuzzTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/fuzzTool.cpp.o.d"
+  "/root/repo/lib/driver/instantiateTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/instantiateTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/instantiateTool.cpp.o.d"
+  "/root/repo/lib/driver/optimizeTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/optimizeTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/optimizeTool.cpp.o.d"
+  "/root/repo/lib/driver/optimizer.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/optimizer.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/optimizer.cpp.o.d"
+  "/root/repo/lib/driver/parseTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/parseTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/parseTool.cpp.o.d"
+  "/root/repo/lib/driver/runtimeTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/runtimeTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/runtimeTool.cpp.o.d"
+  "/root/repo/lib/driver/snapshotTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/snapshotTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/snapshotTool.cpp.o.d"
+  "/root/repo/lib/driver/toolConfig.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/toolConfig.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/toolConfig.cpp.o.d"
+  "/root/repo/lib/driver/uniTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/uniTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/uniTool.cpp.o.d"
+  "/root/repo/lib/driver/validateTool.cpp" "lib/driver/CMakeFiles/wasmedgeDriver.dir/validateTool.cpp.o" "gcc" "lib/driver/CMakeFiles/wasmedgeDriver.dir/validateTool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/vm/CMakeFiles/wasmedgeVM.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/plugin/CMakeFiles/wasmedgePlugin.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/po/CMakeFiles/wasmedgePO.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/validator/CMakeFiles/wasmedgeValidator.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/executor/CMakeFiles/wasmedgeExecutor.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/host/wasi/CMakeFiles/wasmedgeHostModuleWasi.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/llvm/CMakeFiles/wasmedgeLLVM.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoader.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/aot/CMakeFiles/wasmedgeAOT.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeDriver.dir/compilerTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/compilerTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/fuzzPO.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/fuzzPO.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/fuzzTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/fuzzTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/instantiateTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/instantiateTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/optimizeTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/optimizeTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/optimizer.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/optimizer.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/parseTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/parseTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/runtimeTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/runtimeTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/snapshotTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/snapshotTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/toolConfig.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/toolConfig.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/uniTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/uniTool.cpp.o.d"
+  "CMakeFiles/wasmedgeDriver.dir/validateTool.cpp.o"
+  "CMakeFiles/wasmedgeDriver.dir/validateTool.cpp.o.d"
+  "libwasmedgeDriver.a"
+  "libwasmedgeDriver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeDriver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
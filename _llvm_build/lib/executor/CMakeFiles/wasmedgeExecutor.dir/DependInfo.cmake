@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/executor/coredump.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/coredump.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/coredump.cpp.o.d"
+  "/root/repo/lib/executor/engine/controlInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/controlInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/controlInstr.cpp.o.d"
+  "/root/repo/lib/executor/engine/engine.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/engine.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/engine.cpp.o.d"
+  "/root/repo/lib/executor/engine/memoryInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/memoryInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/memoryInstr.cpp.o.d"
+  "/root/repo/lib/executor/engine/proxy.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/proxy.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/proxy.cpp.o.d"
+  "/root/repo/lib/executor/engine/refInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/refInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/refInstr.cpp.o.d"
+  "/root/repo/lib/executor/engine/tableInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/tableInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/tableInstr.cpp.o.d"
+  "/root/repo/lib/executor/engine/threadInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/threadInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/threadInstr.cpp.o.d"
+  "/root/repo/lib/executor/engine/variableInstr.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/variableInstr.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/engine/variableInstr.cpp.o.d"
+  "/root/repo/lib/executor/executor.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/executor.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/executor.cpp.o.d"
+  "/root/repo/lib/executor/helper.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/helper.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/helper.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_alias.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_alias.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_alias.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_canon.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_canon.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_canon.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_export.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_export.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_export.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_import.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_import.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_import.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_instance.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_instance.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_instance.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_module.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_module.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_module.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_start.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_start.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_start.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/component/component_type.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_type.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_type.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/data.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/data.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/data.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/elem.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/elem.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/elem.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/export.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/export.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/export.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/function.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/function.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/function.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/global.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/global.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/global.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/import.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/import.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/import.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/instancepre.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/instancepre.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/instancepre.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/memory.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/memory.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/memory.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/module.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/module.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/module.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/table.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/table.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/table.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/tag.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/tag.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/tag.cpp.o.d"
+  "/root/repo/lib/executor/instantiate/type.cpp" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/type.cpp.o" "gcc" "lib/executor/CMakeFiles/wasmedgeExecutor.dir/instantiate/type.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeExecutor.dir/coredump.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/coredump.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/controlInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/controlInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/engine.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/engine.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/memoryInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/memoryInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/proxy.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/proxy.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/refInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/refInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/tableInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/tableInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/threadInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/threadInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/variableInstr.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/engine/variableInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/executor.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/executor.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/helper.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/helper.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_alias.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_alias.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_canon.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_canon.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_export.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_export.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_import.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_import.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_instance.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_instance.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_module.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_module.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_start.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_start.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_type.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/component/component_type.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/data.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/data.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/elem.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/elem.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/export.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/export.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/function.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/function.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/global.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/global.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/import.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/import.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/instancepre.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/instancepre.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/memory.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/memory.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/module.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/module.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/table.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/table.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/tag.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/tag.cpp.o.d"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/type.cpp.o"
+  "CMakeFiles/wasmedgeExecutor.dir/instantiate/type.cpp.o.d"
+  "libwasmedgeExecutor.a"
+  "libwasmedgeExecutor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeExecutor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/clock-linux.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/clock-linux.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/environ-linux.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/environ-linux.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/environ.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/environ.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/inode-linux.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/inode-linux.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/vfs_io.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/vfs_io.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/vinode.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/vinode.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/wasifunc.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/wasifunc.cpp.o.d"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/wasimodule.cpp.o"
+  "CMakeFiles/wasmedgeHostModuleWasi.dir/wasimodule.cpp.o.d"
+  "libwasmedgeHostModuleWasi.a"
+  "libwasmedgeHostModuleWasi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeHostModuleWasi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/codegen.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/codegen.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/codegen.cpp.o.d"
+  "/root/repo/lib/llvm/compiler.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/context.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/context.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/context.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/function_compiler.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/function_compiler.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/function_compiler.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/memoryInstr.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/memoryInstr.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/memoryInstr.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/numericInstr.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/numericInstr.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/numericInstr.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/refInstr.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/refInstr.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/refInstr.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/threadInstr.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/threadInstr.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/threadInstr.cpp.o.d"
+  "/root/repo/lib/llvm/compiler/vectorInstr.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/vectorInstr.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/compiler/vectorInstr.cpp.o.d"
+  "/root/repo/lib/llvm/data.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/data.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/data.cpp.o.d"
+  "/root/repo/lib/llvm/jit.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/jit.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/jit.cpp.o.d"
+  "/root/repo/lib/llvm/lazyjit.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/lazyjit.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/lazyjit.cpp.o.d"
+  "/root/repo/lib/llvm/llvm.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/llvm.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/llvm.cpp.o.d"
+  "/root/repo/lib/llvm/objcache.cpp" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/objcache.cpp.o" "gcc" "lib/llvm/CMakeFiles/wasmedgeLLVM.dir/objcache.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/aot/CMakeFiles/wasmedgeAOT.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoader.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoaderFileMgr.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
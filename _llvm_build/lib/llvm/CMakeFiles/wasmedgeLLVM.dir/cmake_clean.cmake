@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeLLVM.dir/codegen.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/codegen.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/context.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/context.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/function_compiler.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/function_compiler.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/memoryInstr.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/memoryInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/numericInstr.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/numericInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/refInstr.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/refInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/threadInstr.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/threadInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/vectorInstr.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/compiler/vectorInstr.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/data.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/data.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/jit.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/jit.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/lazyjit.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/lazyjit.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/llvm.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/llvm.cpp.o.d"
+  "CMakeFiles/wasmedgeLLVM.dir/objcache.cpp.o"
+  "CMakeFiles/wasmedgeLLVM.dir/objcache.cpp.o.d"
+  "libwasmedgeLLVM.a"
+  "libwasmedgeLLVM.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeLLVM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
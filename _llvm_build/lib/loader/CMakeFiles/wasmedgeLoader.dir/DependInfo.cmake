@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/loader/ast/component/component.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_alias.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_alias.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_alias.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_canonical.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_canonical.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_canonical.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_declarator.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_declarator.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_declarator.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_descriptor.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_descriptor.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_descriptor.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_export.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_export.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_export.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_import.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_import.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_import.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_instance.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_instance.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_instance.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_section.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_section.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_section.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_sort.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_sort.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_sort.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_start.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_start.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_start.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_type.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_type.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_type.cpp.o.d"
+  "/root/repo/lib/loader/ast/component/component_valtype.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_valtype.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/component/component_valtype.cpp.o.d"
+  "/root/repo/lib/loader/ast/description.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/description.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/description.cpp.o.d"
+  "/root/repo/lib/loader/ast/expression.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/expression.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/expression.cpp.o.d"
+  "/root/repo/lib/loader/ast/instruction.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/instruction.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/instruction.cpp.o.d"
+  "/root/repo/lib/loader/ast/module.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/module.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/module.cpp.o.d"
+  "/root/repo/lib/loader/ast/section.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/section.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/section.cpp.o.d"
+  "/root/repo/lib/loader/ast/segment.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/segment.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/segment.cpp.o.d"
+  "/root/repo/lib/loader/ast/type.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/type.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/ast/type.cpp.o.d"
+  "/root/repo/lib/loader/loader.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/loader.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/loader.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_description.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_description.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_description.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_expression.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_expression.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_expression.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_instruction.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_instruction.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_instruction.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_module.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_module.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_module.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_section.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_section.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_section.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_segment.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_segment.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_segment.cpp.o.d"
+  "/root/repo/lib/loader/serialize/serial_type.cpp" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_type.cpp.o" "gcc" "lib/loader/CMakeFiles/wasmedgeLoader.dir/serialize/serial_type.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/loader/CMakeFiles/wasmedgeLoaderFileMgr.dir/DependInfo.cmake"
+  "/root/repo/_llvm_build/lib/system/CMakeFiles/wasmedgeSystem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
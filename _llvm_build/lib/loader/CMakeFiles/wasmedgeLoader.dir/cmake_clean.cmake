@@ -0,0 +1,65 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_alias.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_alias.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_canonical.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_canonical.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_declarator.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_declarator.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_descriptor.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_descriptor.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_export.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_export.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_import.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_import.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_instance.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_instance.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_section.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_section.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_sort.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_sort.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_start.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_start.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_type.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_type.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_valtype.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/component/component_valtype.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/description.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/description.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/expression.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/expression.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/instruction.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/instruction.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/module.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/module.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/section.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/section.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/segment.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/segment.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/ast/type.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/ast/type.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/loader.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/loader.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_description.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_description.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_expression.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_expression.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_instruction.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_instruction.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_module.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_module.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_section.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_section.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_segment.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_segment.cpp.o.d"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_type.cpp.o"
+  "CMakeFiles/wasmedgeLoader.dir/serialize/serial_type.cpp.o.d"
+  "libwasmedgeLoader.a"
+  "libwasmedgeLoader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeLoader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/aot_section.cpp.o"
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/aot_section.cpp.o.d"
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/filemgr.cpp.o"
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/filemgr.cpp.o.d"
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/shared_library.cpp.o"
+  "CMakeFiles/wasmedgeLoaderFileMgr.dir/shared_library.cpp.o.d"
+  "libwasmedgeLoaderFileMgr.a"
+  "libwasmedgeLoaderFileMgr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeLoaderFileMgr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgePlugin.dir/plugin.cpp.o"
+  "CMakeFiles/wasmedgePlugin.dir/plugin.cpp.o.d"
+  "libwasmedgePlugin.a"
+  "libwasmedgePlugin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgePlugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
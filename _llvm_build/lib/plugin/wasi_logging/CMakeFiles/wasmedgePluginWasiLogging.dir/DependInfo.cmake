@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/plugin/wasi_logging/func.cpp" "lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/func.cpp.o" "gcc" "lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/func.cpp.o.d"
+  "/root/repo/lib/plugin/wasi_logging/module.cpp" "lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/module.cpp.o" "gcc" "lib/plugin/wasi_logging/CMakeFiles/wasmedgePluginWasiLogging.dir/module.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
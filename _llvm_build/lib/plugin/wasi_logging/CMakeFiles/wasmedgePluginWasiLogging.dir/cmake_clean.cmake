@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgePluginWasiLogging.dir/func.cpp.o"
+  "CMakeFiles/wasmedgePluginWasiLogging.dir/func.cpp.o.d"
+  "CMakeFiles/wasmedgePluginWasiLogging.dir/module.cpp.o"
+  "CMakeFiles/wasmedgePluginWasiLogging.dir/module.cpp.o.d"
+  "libwasmedgePluginWasiLogging.a"
+  "libwasmedgePluginWasiLogging.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgePluginWasiLogging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
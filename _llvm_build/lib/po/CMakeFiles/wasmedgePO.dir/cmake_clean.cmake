@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgePO.dir/argument_parser.cpp.o"
+  "CMakeFiles/wasmedgePO.dir/argument_parser.cpp.o.d"
+  "libwasmedgePO.a"
+  "libwasmedgePO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgePO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
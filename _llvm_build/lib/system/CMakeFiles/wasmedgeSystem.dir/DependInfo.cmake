@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/system/allocator.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/allocator.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/allocator.cpp.o.d"
+  "/root/repo/lib/system/cpu.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/cpu.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/cpu.cpp.o.d"
+  "/root/repo/lib/system/fault.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/fault.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/fault.cpp.o.d"
+  "/root/repo/lib/system/fiber.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/fiber.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/fiber.cpp.o.d"
+  "/root/repo/lib/system/mmap.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/mmap.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/mmap.cpp.o.d"
+  "/root/repo/lib/system/path.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/path.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/path.cpp.o.d"
+  "/root/repo/lib/system/perfcounter.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/perfcounter.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/perfcounter.cpp.o.d"
+  "/root/repo/lib/system/stacktrace.cpp" "lib/system/CMakeFiles/wasmedgeSystem.dir/stacktrace.cpp.o" "gcc" "lib/system/CMakeFiles/wasmedgeSystem.dir/stacktrace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_llvm_build/lib/common/CMakeFiles/wasmedgeCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
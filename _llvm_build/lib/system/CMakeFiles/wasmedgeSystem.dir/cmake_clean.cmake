@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeSystem.dir/allocator.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/allocator.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/cpu.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/cpu.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/fault.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/fault.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/fiber.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/fiber.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/mmap.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/mmap.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/path.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/path.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/perfcounter.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/perfcounter.cpp.o.d"
+  "CMakeFiles/wasmedgeSystem.dir/stacktrace.cpp.o"
+  "CMakeFiles/wasmedgeSystem.dir/stacktrace.cpp.o.d"
+  "libwasmedgeSystem.a"
+  "libwasmedgeSystem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeSystem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
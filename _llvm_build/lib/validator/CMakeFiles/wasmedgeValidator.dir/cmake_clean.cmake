@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeValidator.dir/component_context.cpp.o"
+  "CMakeFiles/wasmedgeValidator.dir/component_context.cpp.o.d"
+  "CMakeFiles/wasmedgeValidator.dir/component_name.cpp.o"
+  "CMakeFiles/wasmedgeValidator.dir/component_name.cpp.o.d"
+  "CMakeFiles/wasmedgeValidator.dir/component_validator.cpp.o"
+  "CMakeFiles/wasmedgeValidator.dir/component_validator.cpp.o.d"
+  "CMakeFiles/wasmedgeValidator.dir/formchecker.cpp.o"
+  "CMakeFiles/wasmedgeValidator.dir/formchecker.cpp.o.d"
+  "CMakeFiles/wasmedgeValidator.dir/validator.cpp.o"
+  "CMakeFiles/wasmedgeValidator.dir/validator.cpp.o.d"
+  "libwasmedgeValidator.a"
+  "libwasmedgeValidator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeValidator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgeVM.dir/eventloop.cpp.o"
+  "CMakeFiles/wasmedgeVM.dir/eventloop.cpp.o.d"
+  "CMakeFiles/wasmedgeVM.dir/plugin_modules.cpp.o"
+  "CMakeFiles/wasmedgeVM.dir/plugin_modules.cpp.o.d"
+  "CMakeFiles/wasmedgeVM.dir/scheduler.cpp.o"
+  "CMakeFiles/wasmedgeVM.dir/scheduler.cpp.o.d"
+  "CMakeFiles/wasmedgeVM.dir/snapshot.cpp.o"
+  "CMakeFiles/wasmedgeVM.dir/snapshot.cpp.o.d"
+  "CMakeFiles/wasmedgeVM.dir/vm.cpp.o"
+  "CMakeFiles/wasmedgeVM.dir/vm.cpp.o.d"
+  "libwasmedgeVM.a"
+  "libwasmedgeVM.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgeVM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
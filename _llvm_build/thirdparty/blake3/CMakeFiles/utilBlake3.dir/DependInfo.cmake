@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/thirdparty/blake3/blake3_avx2_x86-64_unix.S" "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_avx2_x86-64_unix.S.o"
+  "/root/repo/thirdparty/blake3/blake3_avx512_x86-64_unix.S" "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_avx512_x86-64_unix.S.o"
+  "/root/repo/thirdparty/blake3/blake3_sse2_x86-64_unix.S" "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_sse2_x86-64_unix.S.o"
+  "/root/repo/thirdparty/blake3/blake3_sse41_x86-64_unix.S" "/root/repo/_llvm_build/thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_sse41_x86-64_unix.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "/root/repo/thirdparty/blake3"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/blake3/blake3.c" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3.c.o" "gcc" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3.c.o.d"
+  "/root/repo/thirdparty/blake3/blake3_dispatch.c" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_dispatch.c.o" "gcc" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_dispatch.c.o.d"
+  "/root/repo/thirdparty/blake3/blake3_portable.c" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_portable.c.o" "gcc" "thirdparty/blake3/CMakeFiles/utilBlake3.dir/blake3_portable.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
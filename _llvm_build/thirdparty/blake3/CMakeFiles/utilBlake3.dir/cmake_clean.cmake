@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utilBlake3.dir/blake3.c.o"
+  "CMakeFiles/utilBlake3.dir/blake3.c.o.d"
+  "CMakeFiles/utilBlake3.dir/blake3_avx2_x86-64_unix.S.o"
+  "CMakeFiles/utilBlake3.dir/blake3_avx512_x86-64_unix.S.o"
+  "CMakeFiles/utilBlake3.dir/blake3_dispatch.c.o"
+  "CMakeFiles/utilBlake3.dir/blake3_dispatch.c.o.d"
+  "CMakeFiles/utilBlake3.dir/blake3_portable.c.o"
+  "CMakeFiles/utilBlake3.dir/blake3_portable.c.o.d"
+  "CMakeFiles/utilBlake3.dir/blake3_sse2_x86-64_unix.S.o"
+  "CMakeFiles/utilBlake3.dir/blake3_sse41_x86-64_unix.S.o"
+  "libutilBlake3.a"
+  "libutilBlake3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C)
+  include(CMakeFiles/utilBlake3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
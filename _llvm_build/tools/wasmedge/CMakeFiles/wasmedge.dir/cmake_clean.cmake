@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedge.dir/wasmedge.cpp.o"
+  "CMakeFiles/wasmedge.dir/wasmedge.cpp.o.d"
+  "wasmedge"
+  "wasmedge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wasmedgec.dir/wasmedgec.cpp.o"
+  "CMakeFiles/wasmedgec.dir/wasmedgec.cpp.o.d"
+  "wasmedgec"
+  "wasmedgec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wasmedgec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -163,10 +163,12 @@ WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_ConfigureGetMaxMemoryPage(
 /// Set the run mode for module execution.
 ///
 /// Selects the engine used to execute a WebAssembly module: interpreter
-/// (default), JIT, or AOT. Only `WasmEdge_RunMode_AOT` will load AOT custom
-/// sections from universal WASM, or `dlopen` shared-library WASM artifacts;
-/// in the other modes, AOT data is ignored, and shared-library inputs are
-/// rejected.
+/// (default), JIT, lazy JIT, tiered, or AOT. The tiered mode starts in the
+/// interpreter and swaps in the JIT-compiled code of the module once its
+/// background compilation finishes. Only `WasmEdge_RunMode_AOT` will load
+/// AOT custom sections from universal WASM, or `dlopen` shared-library WASM
+/// artifacts; in the other modes, AOT data is ignored, and shared-library
+/// inputs are rejected.
 ///
 /// This function is thread-safe.
 ///
@@ -208,6 +210,43 @@ WASMEDGE_CAPI_EXPORT extern void WasmEdge_ConfigureSetAllowAFUNIX(
 WASMEDGE_CAPI_EXPORT extern bool WasmEdge_ConfigureIsAllowAFUNIX(
     const WasmEdge_ConfigureContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
 
+/// Set the option of enabling/disabling the on-disk cache of the machine code
+/// compiled in the JIT and lazy JIT run modes.
+///
+/// This function is thread-safe.
+///
+/// \param Cxt the WasmEdge_ConfigureContext to set the boolean value.
+/// \param EnableJITCache the boolean value to determine to enable the JIT
+/// cache or not.
+WASMEDGE_CAPI_EXPORT extern void WasmEdge_ConfigureSetEnableJITCache(
+    WasmEdge_ConfigureContext *Cxt,
+    const bool EnableJITCache) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the EnableJITCache option.
+///
+/// This function is thread-safe.
+///
+/// \param Cxt the WasmEdge_ConfigureContext to get the boolean value.
+///
+/// \returns the boolean value to determine to enable the JIT cache or not.
+WASMEDGE_CAPI_EXPORT extern bool WasmEdge_ConfigureIsEnableJITCache(
+    const WasmEdge_ConfigureContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Set the directory of the JIT cache.
+///
+/// An empty or NULL path selects the `jit` directory of the local AOT cache.
+///
+/// This function is thread-safe.
+///
+/// \param Cxt the WasmEdge_ConfigureContext to set the directory.
+/// \param Path the absolute path of the directory.
+///
+/// \returns WasmEdge_Result. Call `WasmEdge_ResultGetMessage` for the error
+/// message, which is the invalid path error for a relative path.
+WASMEDGE_CAPI_EXPORT extern WasmEdge_Result
+WasmEdge_ConfigureSetJITCacheDir(WasmEdge_ConfigureContext *Cxt,
+                                 const char *Path) WASMEDGE_CAPI_NOEXCEPT;
+
 /// Set the optimization level of the AOT compiler.
 ///
 /// This function is thread-safe.
@@ -383,6 +422,34 @@ WASMEDGE_CAPI_EXPORT extern void WasmEdge_ConfigureStatisticsSetTimeMeasuring(
 WASMEDGE_CAPI_EXPORT extern bool WasmEdge_ConfigureStatisticsIsTimeMeasuring(
     const WasmEdge_ConfigureContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
 
+/// Set the hardware performance counting option for the statistics.
+///
+/// When enabled, the cycles, instructions, cache misses, branch misses, and
+/// page faults of the executions and of each host function are read from the
+/// Linux perf_event interface. The counters read as zero when perf_event is
+/// not available.
+///
+/// This function is thread-safe.
+///
+/// \param Cxt the WasmEdge_ConfigureContext to set the boolean value.
+/// \param IsCount the boolean value to determine to record the hardware
+/// performance counters during execution or not.
+WASMEDGE_CAPI_EXPORT extern void
+WasmEdge_ConfigureStatisticsSetHardwareCounting(
+    WasmEdge_ConfigureContext *Cxt, const bool IsCount) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the hardware performance counting option for the statistics.
+///
+/// This function is thread-safe.
+///
+/// \param Cxt the WasmEdge_ConfigureContext to get the boolean value.
+///
+/// \returns the boolean value to determine to record the hardware performance
+/// counters during execution or not.
+WASMEDGE_CAPI_EXPORT extern bool
+WasmEdge_ConfigureStatisticsIsHardwareCounting(
+    const WasmEdge_ConfigureContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
 /// Deletion of the WasmEdge_ConfigureContext.
 ///
 /// After calling this function, the context will be destroyed and should
@@ -431,6 +498,49 @@ WASMEDGE_CAPI_EXPORT extern double WasmEdge_StatisticsGetInstrPerSecond(
 WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetTotalCost(
     const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
 
+/// Get the number of executions with recorded hardware performance counters.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+///
+/// \returns the number of counted executions.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetCountedInvocations(
+    const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get a hardware performance counter of the executions, excluding the host
+/// functions.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+/// \param Counter the hardware performance counter to get.
+///
+/// \returns the total counter value of the counted executions.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetWasmHardwareCounter(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_HardwareCounter Counter) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get a hardware performance counter of all host functions.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+/// \param Counter the hardware performance counter to get.
+///
+/// \returns the total counter value of the host function calls.
+WASMEDGE_CAPI_EXPORT extern uint64_t
+WasmEdge_StatisticsGetHostFuncHardwareCounter(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_HardwareCounter Counter) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get a hardware performance counter of a host function.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+/// \param Name the host function name in the `module::export` form.
+/// \param Counter the hardware performance counter to get.
+///
+/// \returns the total counter value of the calls of the host function, 0 if
+/// the host function is not found.
+WASMEDGE_CAPI_EXPORT extern uint64_t
+WasmEdge_StatisticsGetHostFuncHardwareCounterByName(
+    const WasmEdge_StatisticsContext *Cxt, const WasmEdge_String Name,
+    const enum WasmEdge_HardwareCounter Counter) WASMEDGE_CAPI_NOEXCEPT;
+
 /// Set the costs of instructions.
 ///
 /// \param Cxt the WasmEdge_StatisticsContext to set the cost table.
@@ -452,6 +562,87 @@ WASMEDGE_CAPI_EXPORT extern void
 WasmEdge_StatisticsSetCostLimit(WasmEdge_StatisticsContext *Cxt,
                                 const uint64_t Limit) WASMEDGE_CAPI_NOEXCEPT;
 
+/// Get the current memory usage of a category in bytes.
+///
+/// The memory allocated by the module instances instantiated with the
+/// statistics is charged to it until the module instances are deleted.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+/// \param Category the memory category to get.
+///
+/// \returns the bytes in use.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetMemoryUsage(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the peak memory usage of a category in bytes.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+/// \param Category the memory category to get.
+///
+/// \returns the peak bytes in use.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetMemoryPeak(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the current memory usage of all categories in bytes.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+///
+/// \returns the bytes in use.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetTotalMemoryUsage(
+    const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the peak memory usage of all categories in bytes.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+///
+/// \returns the peak bytes in use.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetTotalMemoryPeak(
+    const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the count of the JIT cache lookups which found the compiled code.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+///
+/// \returns the JIT cache hits.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetJITCacheHits(
+    const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Get the count of the JIT cache lookups which did not find the compiled
+/// code.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to get data.
+///
+/// \returns the JIT cache misses.
+WASMEDGE_CAPI_EXPORT extern uint64_t WasmEdge_StatisticsGetJITCacheMisses(
+    const WasmEdge_StatisticsContext *Cxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Set the memory limit of all categories in bytes.
+///
+/// The instantiation or the allocation exceeding the limit fails with the
+/// ErrCode::Value::MemoryLimitExceeded, and the `memory.grow` and `table.grow`
+/// instructions exceeding the limit return -1.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to set the limit.
+/// \param Limit the memory limit in bytes.
+WASMEDGE_CAPI_EXPORT extern void
+WasmEdge_StatisticsSetMemoryLimit(WasmEdge_StatisticsContext *Cxt,
+                                  const uint64_t Limit) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Set the memory limit of a category in bytes.
+///
+/// The stack is only sampled into the peaks after each execution, so the limit
+/// of the `WasmEdge_MemoryCategory_Stack` is ignored.
+///
+/// \param Cxt the WasmEdge_StatisticsContext to set the limit.
+/// \param Category the memory category to set.
+/// \param Limit the memory limit in bytes.
+WASMEDGE_CAPI_EXPORT extern void WasmEdge_StatisticsSetCategoryMemoryLimit(
+    WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category,
+    const uint64_t Limit) WASMEDGE_CAPI_NOEXCEPT;
+
 /// Clear all data in the WasmEdge_StatisticsContext.
 ///
 /// \param Cxt the WasmEdge_StatisticsContext to clear.
@@ -60,6 +60,9 @@ typedef struct WasmEdge_ValidatorContext WasmEdge_ValidatorContext;
 /// Opaque struct of WasmEdge executor.
 typedef struct WasmEdge_ExecutorContext WasmEdge_ExecutorContext;
 
+/// Opaque struct of WasmEdge pre-linked instantiation template.
+typedef struct WasmEdge_InstancePreContext WasmEdge_InstancePreContext;
+
 /// Opaque struct of WasmEdge store.
 typedef struct WasmEdge_StoreContext WasmEdge_StoreContext;
 
@@ -218,6 +218,61 @@ WASMEDGE_CAPI_EXPORT extern WasmEdge_Result WasmEdge_ExecutorRegister(
     WasmEdge_StoreContext *StoreCxt, const WasmEdge_ASTModuleContext *ASTCxt,
     WasmEdge_String ModuleName) WASMEDGE_CAPI_NOEXCEPT;
 
+/// Create a pre-linked instantiation template of an AST Module.
+///
+/// Resolve and type-check the imports of the AST Module against the store
+/// once, and compute the constant initialization expressions of the globals
+/// and the offsets of the element and data segments. The template can then be
+/// instantiated repeatedly by the `WasmEdge_ExecutorInstantiatePre` API. The
+/// caller owns the object and should call `WasmEdge_InstancePreDelete` to
+/// destroy it. The AST Module and the store SHOULD outlive the template.
+///
+/// \param Cxt the WasmEdge_ExecutorContext.
+/// \param [out] PreCxt the output WasmEdge_InstancePreContext if succeeded.
+/// \param StoreCxt the WasmEdge_StoreContext to link the imports.
+/// \param ASTCxt the WasmEdge AST Module context generated by loader or
+/// compiler.
+///
+/// \returns WasmEdge_Result. Call `WasmEdge_ResultGetMessage` for the error
+/// message.
+WASMEDGE_CAPI_EXPORT extern WasmEdge_Result WasmEdge_ExecutorCreateInstancePre(
+    WasmEdge_ExecutorContext *Cxt, WasmEdge_InstancePreContext **PreCxt,
+    WasmEdge_StoreContext *StoreCxt,
+    const WasmEdge_ASTModuleContext *ASTCxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Instantiate a module instance from a pre-linked instantiation template.
+///
+/// Same as `WasmEdge_ExecutorInstantiate` with the AST Module of the template,
+/// but links the imports resolved in the template directly. If a module
+/// instance was unregistered from the store after the template was created,
+/// or the store is not the one of the template, the imports will be resolved
+/// again. The caller owns the object and should call
+/// `WasmEdge_ModuleInstanceDelete` to destroy it.
+///
+/// \param Cxt the WasmEdge_ExecutorContext to instantiate the module.
+/// \param [out] ModuleCxt the output WasmEdge_ModuleInstanceContext if
+/// succeeded.
+/// \param StoreCxt the WasmEdge_StoreContext to link the imports.
+/// \param PreCxt the WasmEdge_InstancePreContext to instantiate.
+///
+/// \returns WasmEdge_Result. Call `WasmEdge_ResultGetMessage` for the error
+/// message.
+WASMEDGE_CAPI_EXPORT extern WasmEdge_Result WasmEdge_ExecutorInstantiatePre(
+    WasmEdge_ExecutorContext *Cxt, WasmEdge_ModuleInstanceContext **ModuleCxt,
+    WasmEdge_StoreContext *StoreCxt,
+    const WasmEdge_InstancePreContext *PreCxt) WASMEDGE_CAPI_NOEXCEPT;
+
+/// Deletion of the WasmEdge_InstancePreContext.
+///
+/// After calling this function, the context will be destroyed and should
+/// __NOT__ be used. The module instances instantiated from it are not
+/// affected.
+///
+/// \param Cxt the WasmEdge_InstancePreContext to destroy.
+WASMEDGE_CAPI_EXPORT extern void
+WasmEdge_InstancePreDelete(WasmEdge_InstancePreContext *Cxt)
+    WASMEDGE_CAPI_NOEXCEPT;
+
 /// Register a module instance in a store by exporting its module name.
 ///
 /// Register an existing module into the store with its module name.
@@ -90,6 +90,10 @@ public:
     IntrSymbol = std::move(S);
   }
 
+  /// Getter and setter for the size of the compiled code, 0 if unknown.
+  uint64_t getCodeSize() const noexcept { return CodeSize; }
+  void setCodeSize(uint64_t Size) noexcept { CodeSize = Size; }
+
   /// Getter and setter for validated flag.
   bool getIsValidated() const noexcept { return IsValidated; }
   void setIsValidated(bool V = true) noexcept { IsValidated = V; }
@@ -123,6 +127,7 @@ private:
   /// @{
   AOTSection AOTSec;
   Symbol<const Executable::IntrinsicsTable *> IntrSymbol;
+  uint64_t CodeSize = 0;
   /// @}
 
   /// \name Validated flag.
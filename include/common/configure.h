@@ -17,6 +17,7 @@
 #include "common/enum_ast.hpp"
 #include "common/enum_configure.hpp"
 #include "common/errcode.h"
+#include "common/filesystem.h"
 #include "common/hash.h"
 
 #include <atomic>
@@ -118,7 +119,9 @@ public:
         Mode(RHS.Mode.load(std::memory_order_relaxed)),
         EnableCoredump(RHS.EnableCoredump.load(std::memory_order_relaxed)),
         CoredumpWasmgdb(RHS.CoredumpWasmgdb.load(std::memory_order_relaxed)),
-        AllowAFUNIX(RHS.AllowAFUNIX.load(std::memory_order_relaxed)) {}
+        AllowAFUNIX(RHS.AllowAFUNIX.load(std::memory_order_relaxed)),
+        EnableJITCache(RHS.EnableJITCache.load(std::memory_order_relaxed)),
+        JITCacheDir(RHS.getJITCacheDir()) {}
 
   void setMaxMemoryPage(const uint64_t Page) noexcept {
     MaxMemPage.store(Page, std::memory_order_relaxed);
@@ -160,12 +163,39 @@ public:
     return AllowAFUNIX.load(std::memory_order_relaxed);
   }
 
+  void setEnableJITCache(bool IsEnableJITCache) noexcept {
+    EnableJITCache.store(IsEnableJITCache, std::memory_order_relaxed);
+  }
+
+  bool isEnableJITCache() const noexcept {
+    return EnableJITCache.load(std::memory_order_relaxed);
+  }
+
+  /// Set the directory of the JIT object cache. An empty path selects the
+  /// `jit` directory of the local AOT cache. A relative path is rejected.
+  Expect<void> setJITCacheDir(std::filesystem::path Dir) noexcept {
+    if (!Dir.empty() && !Dir.is_absolute()) {
+      return Unexpect(ErrCode::Value::IllegalPath);
+    }
+    std::unique_lock Lock(JITCacheDirMutex);
+    JITCacheDir = std::move(Dir);
+    return {};
+  }
+
+  std::filesystem::path getJITCacheDir() const noexcept {
+    std::shared_lock Lock(JITCacheDirMutex);
+    return JITCacheDir;
+  }
+
 private:
   std::atomic<uint64_t> MaxMemPage = 65536;
   std::atomic<RunMode> Mode = RunMode::Interpreter;
   std::atomic<bool> EnableCoredump = false;
   std::atomic<bool> CoredumpWasmgdb = false;
   std::atomic<bool> AllowAFUNIX = false;
+  std::atomic<bool> EnableJITCache = false;
+  mutable std::shared_mutex JITCacheDirMutex;
+  std::filesystem::path JITCacheDir;
 };
 
 class StatisticsConfigure {
@@ -174,7 +204,9 @@ public:
   StatisticsConfigure(const StatisticsConfigure &RHS) noexcept
       : InstrCounting(RHS.InstrCounting.load(std::memory_order_relaxed)),
         CostMeasuring(RHS.CostMeasuring.load(std::memory_order_relaxed)),
-        TimeMeasuring(RHS.TimeMeasuring.load(std::memory_order_relaxed)) {}
+        TimeMeasuring(RHS.TimeMeasuring.load(std::memory_order_relaxed)),
+        HardwareCounting(
+            RHS.HardwareCounting.load(std::memory_order_relaxed)) {}
 
   void setInstructionCounting(bool IsCount) noexcept {
     InstrCounting.store(IsCount, std::memory_order_relaxed);
@@ -200,6 +232,16 @@ public:
     return TimeMeasuring.load(std::memory_order_relaxed);
   }
 
+  /// Record the hardware performance counters of the executions and the host
+  /// functions. Only supported on Linux with perf_event access.
+  void setHardwareCounting(bool IsCount) noexcept {
+    HardwareCounting.store(IsCount, std::memory_order_relaxed);
+  }
+
+  bool isHardwareCounting() const noexcept {
+    return HardwareCounting.load(std::memory_order_relaxed);
+  }
+
   void setCostLimit(uint64_t Cost) noexcept {
     CostLimit.store(Cost, std::memory_order_relaxed);
   }
@@ -212,6 +254,7 @@ private:
   std::atomic<bool> InstrCounting = false;
   std::atomic<bool> CostMeasuring = false;
   std::atomic<bool> TimeMeasuring = false;
+  std::atomic<bool> HardwareCounting = false;
 
   std::atomic<uint64_t> CostLimit = std::numeric_limits<uint64_t>::max();
 };
@@ -78,4 +78,22 @@ enum WasmEdge_RunMode {
 #undef UseRunMode
 };
 
+/// Hardware performance counter C enumeration.
+enum WasmEdge_HardwareCounter {
+#define UseHardwareCounter
+#define Line(NAME) WasmEdge_HardwareCounter_##NAME,
+#include "enum.inc"
+#undef Line
+#undef UseHardwareCounter
+};
+
+/// Memory accounting category C enumeration.
+enum WasmEdge_MemoryCategory {
+#define UseMemoryCategory
+#define Line(NAME) WasmEdge_MemoryCategory_##NAME,
+#include "enum.inc"
+#undef Line
+#undef UseMemoryCategory
+};
+
 #endif // WASMEDGE_C_API_ENUM_CONFIGURE_H
@@ -74,4 +74,24 @@ enum class RunMode : uint8_t {
 #undef UseRunMode
 };
 
+/// Hardware performance counter C++ enumeration class.
+enum class HardwareCounter : uint8_t {
+#define UseHardwareCounter
+#define Line(NAME) NAME,
+#include "enum.inc"
+#undef Line
+#undef UseHardwareCounter
+  Max
+};
+
+/// Memory accounting category C++ enumeration class.
+enum class MemoryCategory : uint8_t {
+#define UseMemoryCategory
+#define Line(NAME) NAME,
+#include "enum.inc"
+#undef Line
+#undef UseMemoryCategory
+  Max
+};
+
 } // namespace WasmEdge
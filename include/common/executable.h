@@ -78,6 +78,7 @@ public:
     kThrow,
     kThrowRef,
     kCatchPop,
+    kCheckStop,
     kIntrinsicMax,
   };
   using IntrinsicsTable = void * [uint32_t(Intrinsics::kIntrinsicMax)];
@@ -89,6 +90,9 @@ public:
   virtual std::vector<Symbol<void>> getCodes(size_t Offset,
                                              size_t Size) noexcept = 0;
 
+  /// Get the bytes of the loaded code, 0 if unknown.
+  virtual uint64_t getCodeSize() const noexcept { return 0; }
+
 protected:
   template <typename T> Symbol<T> createSymbol(T *Pointer) const noexcept {
     return Symbol<T>(shared_from_this(), Pointer);
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/common/profile.h - Execution profile definition ----------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the execution profile class for the profile-guided
+/// optimization of the AOT compiler.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/errcode.h"
+#include "common/filesystem.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace WasmEdge {
+namespace Profile {
+
+/// Execution profile of a module.
+///
+/// Functions, branches, and call sites are identified by the bytecode offset
+/// of their first instruction, which is the same in the executor and in the
+/// compiler loading the same file. The profile also records a hash of the
+/// code of the module, so that a profile of another module is detected.
+///
+/// The counters are atomic and can be updated from several threads without
+/// locking. They must be created with the `add*` functions or by `load`
+/// before the counting starts; the counts of unknown offsets are dropped.
+class Profile {
+public:
+  /// Value of the indirect call target which is not a function of the
+  /// profiled module.
+  static inline constexpr const uint32_t kOtherTarget = UINT32_MAX;
+
+  /// Hash of the code of a module, folded from the offset and the opcode of
+  /// every instruction of the defined functions in order. The seed is fixed,
+  /// so the hash is stable across runs.
+  static uint64_t hashInstr(uint64_t Hash, uint32_t Offset,
+                            uint32_t OpCode) noexcept;
+
+  /// Setter and getter of the code hash of the profiled module.
+  void setModuleHash(uint64_t Hash) noexcept { ModuleHash = Hash; }
+  std::optional<uint64_t> getModuleHash() const noexcept { return ModuleHash; }
+
+  /// Create the counters of a function, a conditional branch, or an
+  /// indirect call site at the offset.
+  void addFunction(uint32_t Offset) { Calls.try_emplace(Offset); }
+  void addBranch(uint32_t Offset) { Branches.try_emplace(Offset); }
+  void addIndirectCall(uint32_t Offset) { IndirectCalls.try_emplace(Offset); }
+
+  /// Count an entry of the function whose body starts at the offset.
+  void countCall(uint32_t Offset) noexcept {
+    if (auto It = Calls.find(Offset); likely(It != Calls.end())) {
+      It->second.Count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Count an execution of the conditional branch at the offset.
+  void countBranch(uint32_t Offset, bool Taken) noexcept {
+    if (auto It = Branches.find(Offset); likely(It != Branches.end())) {
+      It->second.Count[Taken ? 0 : 1].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Count a call of the indirect call site at the offset to the function
+  /// whose body starts at \p Target, or to kOtherTarget.
+  void countIndirectCall(uint32_t Offset, uint32_t Target) noexcept {
+    if (auto It = IndirectCalls.find(Offset);
+        likely(It != IndirectCalls.end())) {
+      It->second.add(Target, 1);
+    }
+  }
+
+  /// Getter of the entry count of a function. Zero if never called.
+  uint64_t getCallCount(uint32_t Offset) const noexcept;
+
+  /// Getter of the taken and not taken counts of a branch.
+  std::optional<std::pair<uint64_t, uint64_t>>
+  getBranchCount(uint32_t Offset) const noexcept;
+
+  /// Getter of the target of the indirect call site which takes more than
+  /// half of its calls, and the count of the calls to it.
+  std::optional<std::pair<uint32_t, uint64_t>>
+  getIndirectCallTarget(uint32_t Offset) const noexcept;
+
+  /// Getter of the entry count from which a function is considered hot: the
+  /// smallest count among the most called functions that together make up
+  /// 90% of all the calls.
+  uint64_t getHotCallThreshold() const noexcept;
+
+  /// Check whether nothing has been counted.
+  bool empty() const noexcept;
+
+  /// Write the profile into the file.
+  Expect<void> save(const std::filesystem::path &Path) const noexcept;
+
+  /// Merge the profile in the file into this profile.
+  Expect<void> load(const std::filesystem::path &Path) noexcept;
+
+private:
+  struct CallCounter {
+    std::atomic_uint64_t Count = 0;
+  };
+  struct BranchCounter {
+    std::array<std::atomic_uint64_t, 2> Count = {};
+  };
+  /// Value profile of an indirect call site: the calls to the first targets
+  /// seen, and the calls to all the other targets.
+  struct IndirectCallCounter {
+    static inline constexpr const size_t kTargets = 4;
+    std::array<std::atomic_uint32_t, kTargets> Targets = {
+        kOtherTarget, kOtherTarget, kOtherTarget, kOtherTarget};
+    std::array<std::atomic_uint64_t, kTargets> Counts = {};
+    std::atomic_uint64_t Other = 0;
+    void add(uint32_t Target, uint64_t Count) noexcept;
+  };
+
+  std::optional<uint64_t> ModuleHash;
+  std::unordered_map<uint32_t, CallCounter> Calls;
+  std::unordered_map<uint32_t, BranchCounter> Branches;
+  std::unordered_map<uint32_t, IndirectCallCounter> IndirectCalls;
+};
+
+} // namespace Profile
+} // namespace WasmEdge
@@ -15,17 +15,156 @@
 
 #include "common/configure.h"
 #include "common/enum_ast.hpp"
+#include "common/enum_configure.hpp"
 #include "common/errcode.h"
 #include "common/span.h"
 #include "common/spdlog.h"
 #include "common/timer.h"
 
+#include <array>
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace WasmEdge {
 namespace Statistics {
 
+/// Values of the hardware performance counters, indexed by HardwareCounter.
+using HardwareCounterValues =
+    std::array<uint64_t, static_cast<size_t>(HardwareCounter::Max)>;
+
+/// Hardware performance counters recorded for a host function.
+struct HostFuncCounters {
+  std::string Name;
+  uint64_t Calls = 0;
+  HardwareCounterValues Values{};
+};
+
+/// Memory usage, peaks, and limits by category. The account is shared by the
+/// statistics and the module instances charged to it, so the charges of a
+/// module instance can be released after the statistics is destroyed.
+class MemoryAccount {
+public:
+  MemoryAccount() noexcept {
+    for (auto &Limit : Limits) {
+      Limit.store(UINT64_MAX, std::memory_order_relaxed);
+    }
+  }
+
+  /// Getter and setter for the memory limit of all categories in bytes.
+  void setLimit(uint64_t Lim) noexcept {
+    Limits[kTotal].store(Lim, std::memory_order_relaxed);
+  }
+  uint64_t getLimit() const noexcept {
+    return Limits[kTotal].load(std::memory_order_relaxed);
+  }
+
+  /// Getter and setter for the memory limit of a category in bytes. The
+  /// stack is only sampled into the peaks and never charged, so its limit
+  /// cannot be set.
+  void setLimit(MemoryCategory Category, uint64_t Lim) noexcept {
+    if (Category == MemoryCategory::Stack) {
+      return;
+    }
+    Limits[static_cast<size_t>(Category)].store(Lim,
+                                                std::memory_order_relaxed);
+  }
+  uint64_t getLimit(MemoryCategory Category) const noexcept {
+    return Limits[static_cast<size_t>(Category)].load(
+        std::memory_order_relaxed);
+  }
+
+  /// Getters for the current and the peak memory usage in bytes.
+  uint64_t getUsage(MemoryCategory Category) const noexcept {
+    return Usage[static_cast<size_t>(Category)].load(
+        std::memory_order_relaxed);
+  }
+  uint64_t getPeak(MemoryCategory Category) const noexcept {
+    return Peak[static_cast<size_t>(Category)].load(std::memory_order_relaxed);
+  }
+  uint64_t getTotalUsage() const noexcept {
+    return Usage[kTotal].load(std::memory_order_relaxed);
+  }
+  uint64_t getTotalPeak() const noexcept {
+    return Peak[kTotal].load(std::memory_order_relaxed);
+  }
+
+  /// Charge memory to a category, and return false without charging if the
+  /// category or the total limit is exceeded.
+  bool charge(MemoryCategory Category, uint64_t Bytes) noexcept {
+    const auto Index = static_cast<size_t>(Category);
+    if (unlikely(!add(Index, Bytes))) {
+      return false;
+    }
+    if (unlikely(!add(kTotal, Bytes))) {
+      Usage[Index].fetch_sub(Bytes, std::memory_order_relaxed);
+      return false;
+    }
+    updatePeak(Index, Usage[Index].load(std::memory_order_relaxed));
+    updatePeak(kTotal, Usage[kTotal].load(std::memory_order_relaxed));
+    return true;
+  }
+
+  /// Return the memory charged to a category.
+  void release(MemoryCategory Category, uint64_t Bytes) noexcept {
+    Usage[static_cast<size_t>(Category)].fetch_sub(Bytes,
+                                                   std::memory_order_relaxed);
+    Usage[kTotal].fetch_sub(Bytes, std::memory_order_relaxed);
+  }
+
+  /// Record memory used temporarily by a category into the peaks, without
+  /// charging it.
+  void sample(MemoryCategory Category, uint64_t Bytes) noexcept {
+    const auto Index = static_cast<size_t>(Category);
+    updatePeak(Index, Usage[Index].load(std::memory_order_relaxed) + Bytes);
+    updatePeak(kTotal, Usage[kTotal].load(std::memory_order_relaxed) + Bytes);
+  }
+
+  /// Restart the peaks from the memory still in use.
+  void resetPeaks() noexcept {
+    for (size_t I = 0; I < Usage.size(); ++I) {
+      Peak[I].store(Usage[I].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+    }
+  }
+
+private:
+  /// Index of the total of all categories in the arrays.
+  static inline constexpr size_t kTotal =
+      static_cast<size_t>(MemoryCategory::Max);
+  using Values = std::array<std::atomic_uint64_t, kTotal + 1>;
+
+  bool add(size_t Index, uint64_t Bytes) noexcept {
+    const uint64_t Limit = Limits[Index].load(std::memory_order_relaxed);
+    uint64_t Old = Usage[Index].load(std::memory_order_relaxed);
+    uint64_t New;
+    do {
+      if (unlikely(Bytes > Limit || Old > Limit - Bytes)) {
+        return false;
+      }
+      New = Old + Bytes;
+    } while (!Usage[Index].compare_exchange_weak(Old, New,
+                                                 std::memory_order_relaxed));
+    return true;
+  }
+
+  void updatePeak(size_t Index, uint64_t Value) noexcept {
+    uint64_t Old = Peak[Index].load(std::memory_order_relaxed);
+    while (Value > Old && !Peak[Index].compare_exchange_weak(
+                              Old, Value, std::memory_order_relaxed)) {
+    }
+  }
+
+  Values Usage{};
+  Values Peak{};
+  Values Limits{};
+};
+
 class Statistics {
 public:
   Statistics(const uint64_t Lim = UINT64_MAX)
@@ -112,11 +251,150 @@ public:
     return true;
   }
 
+  /// Getter of the memory account. The module instances charged to it share
+  /// its ownership, so it outlives this object while any of them is alive.
+  const std::shared_ptr<MemoryAccount> &getMemoryAccount() const noexcept {
+    return MemAccount;
+  }
+
+  /// Setters and getters of the memory limits and usage. See MemoryAccount.
+  void setMemoryLimit(uint64_t Lim) noexcept { MemAccount->setLimit(Lim); }
+  uint64_t getMemoryLimit() const noexcept { return MemAccount->getLimit(); }
+  void setMemoryLimit(MemoryCategory Category, uint64_t Lim) noexcept {
+    MemAccount->setLimit(Category, Lim);
+  }
+  uint64_t getMemoryLimit(MemoryCategory Category) const noexcept {
+    return MemAccount->getLimit(Category);
+  }
+  uint64_t getMemoryUsage(MemoryCategory Category) const noexcept {
+    return MemAccount->getUsage(Category);
+  }
+  uint64_t getMemoryPeak(MemoryCategory Category) const noexcept {
+    return MemAccount->getPeak(Category);
+  }
+  uint64_t getTotalMemoryUsage() const noexcept {
+    return MemAccount->getTotalUsage();
+  }
+  uint64_t getTotalMemoryPeak() const noexcept {
+    return MemAccount->getTotalPeak();
+  }
+  bool chargeMemory(MemoryCategory Category, uint64_t Bytes) noexcept {
+    return MemAccount->charge(Category, Bytes);
+  }
+  void releaseMemory(MemoryCategory Category, uint64_t Bytes) noexcept {
+    MemAccount->release(Category, Bytes);
+  }
+  void sampleMemory(MemoryCategory Category, uint64_t Bytes) noexcept {
+    MemAccount->sample(Category, Bytes);
+  }
+
+  /// Count a lookup in the JIT object cache as a hit or a miss.
+  void addJITCacheLookup(bool Hit) noexcept {
+    (Hit ? JITCacheHits : JITCacheMisses)
+        .fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Getter of the JIT object cache hits.
+  uint64_t getJITCacheHits() const noexcept {
+    return JITCacheHits.load(std::memory_order_relaxed);
+  }
+
+  /// Getter of the JIT object cache misses.
+  uint64_t getJITCacheMisses() const noexcept {
+    return JITCacheMisses.load(std::memory_order_relaxed);
+  }
+
   /// Clear measurement data for instructions.
   void clear() noexcept {
     TimeRecorder.reset();
     InstrCnt.store(0, std::memory_order_relaxed);
     CostSum.store(0, std::memory_order_relaxed);
+    JITCacheHits.store(0, std::memory_order_relaxed);
+    JITCacheMisses.store(0, std::memory_order_relaxed);
+    MemAccount->resetPeaks();
+    std::unique_lock Lock(CounterMutex);
+    Invocations = 0;
+    InvocationCounters.fill(0);
+    // The host function records stay, as the threads may hold pointers to
+    // them.
+    reset(HostCounters);
+    for (auto &Record : HostFuncRecords) {
+      Record.Calls.store(0, std::memory_order_relaxed);
+      reset(Record.Values);
+    }
+  }
+
+  /// Add the hardware counters of a function invocation, including the host
+  /// functions it called, from the values read at its start and stop.
+  void addInvocationCounters(const HardwareCounterValues &Start,
+                             const HardwareCounterValues &Stop) noexcept {
+    std::unique_lock Lock(CounterMutex);
+    ++Invocations;
+    accumulate(InvocationCounters, Start, Stop);
+  }
+
+  /// Add the hardware counters of a host function call. The host function is
+  /// identified by \p Func , and \p GetName is only called for its first
+  /// record. The records of the recently called host functions are cached
+  /// per thread, so a call usually only adds to atomic counters.
+  template <typename NameFuncT>
+  void addHostFuncCounters(const void *Func, NameFuncT &&GetName,
+                           const HardwareCounterValues &Start,
+                           const HardwareCounterValues &Stop) noexcept {
+    auto &Entry = HostFuncCache[(reinterpret_cast<uintptr_t>(Func) >> 4) %
+                                HostFuncCache.size()];
+    if (Entry.Owner != ID || Entry.Func != Func) {
+      std::unique_lock Lock(CounterMutex);
+      auto [It, Inserted] = HostFuncIndices.try_emplace(Func, nullptr);
+      if (Inserted) {
+        It->second = &HostFuncRecords.emplace_back();
+        It->second->Name = std::forward<NameFuncT>(GetName)();
+      }
+      Entry = {ID, Func, It->second};
+    }
+    Entry.Record->Calls.fetch_add(1, std::memory_order_relaxed);
+    for (size_t I = 0; I < Start.size(); ++I) {
+      const uint64_t Diff = Stop[I] - Start[I];
+      HostCounters[I].fetch_add(Diff, std::memory_order_relaxed);
+      Entry.Record->Values[I].fetch_add(Diff, std::memory_order_relaxed);
+    }
+  }
+
+  /// Getter for the number of invocations with hardware counters.
+  uint64_t getCountedInvocations() const noexcept {
+    std::shared_lock Lock(CounterMutex);
+    return Invocations;
+  }
+
+  /// Getter for the hardware counters of the invocations, excluding the host
+  /// functions.
+  HardwareCounterValues getWasmCounters() const noexcept {
+    std::shared_lock Lock(CounterMutex);
+    HardwareCounterValues Values;
+    for (size_t I = 0; I < Values.size(); ++I) {
+      // Host functions can be called outside any counted invocation.
+      const uint64_t Host = HostCounters[I].load(std::memory_order_relaxed);
+      Values[I] =
+          InvocationCounters[I] > Host ? InvocationCounters[I] - Host : 0;
+    }
+    return Values;
+  }
+
+  /// Getter for the hardware counters of all host functions.
+  HardwareCounterValues getHostFuncCounters() const noexcept {
+    return load(HostCounters);
+  }
+
+  /// Getter for the hardware counters of each called host function.
+  std::vector<HostFuncCounters> getHostFuncCounterRecords() const {
+    std::shared_lock Lock(CounterMutex);
+    std::vector<HostFuncCounters> Records;
+    for (const auto &Record : HostFuncRecords) {
+      if (const auto Calls = Record.Calls.load(std::memory_order_relaxed)) {
+        Records.push_back({Record.Name, Calls, load(Record.Values)});
+      }
+    }
+    return Records;
   }
 
   /// Start recording wasm time.
@@ -157,8 +435,10 @@ public:
       return std::chrono::nanoseconds(Duration).count();
     };
     const auto &StatConf = Conf.getStatisticsConfigure();
-    if (StatConf.isTimeMeasuring() || StatConf.isInstructionCounting() ||
-        StatConf.isCostMeasuring()) {
+    const bool Enabled =
+        StatConf.isTimeMeasuring() || StatConf.isInstructionCounting() ||
+        StatConf.isCostMeasuring() || StatConf.isHardwareCounting();
+    if (Enabled) {
       spdlog::info("====================  Statistics  ===================="sv);
     }
     if (StatConf.isTimeMeasuring()) {
@@ -174,6 +454,30 @@ public:
     if (StatConf.isCostMeasuring()) {
       spdlog::info(" Gas costs: {}"sv, getTotalCost());
     }
+    if (Enabled && getJITCacheHits() + getJITCacheMisses() > 0) {
+      spdlog::info(" JIT cache: {} hits, {} misses"sv, getJITCacheHits(),
+                   getJITCacheMisses());
+    }
+    if (Enabled && getTotalMemoryPeak() > 0) {
+      static constexpr std::array<std::string_view,
+                                  static_cast<size_t>(MemoryCategory::Max)>
+          Names{
+#define UseMemoryCategory
+#define Line(NAME) #NAME##sv,
+#include "enum.inc"
+#undef Line
+#undef UseMemoryCategory
+      };
+      spdlog::info(" Memory usage: {} bytes, peak {} bytes"sv,
+                   getTotalMemoryUsage(), getTotalMemoryPeak());
+      for (size_t I = 0; I < Names.size(); ++I) {
+        const auto Category = static_cast<MemoryCategory>(I);
+        if (const auto Peak = getMemoryPeak(Category)) {
+          spdlog::info("  {}: {} bytes, peak {} bytes"sv, Names[I],
+                       getMemoryUsage(Category), Peak);
+        }
+      }
+    }
     if (StatConf.isInstructionCounting() && StatConf.isTimeMeasuring()) {
       const double IPS = getInstrPerSecond();
       spdlog::info(" Instructions per second: {}"sv,
@@ -181,18 +485,108 @@ public:
                        ? static_cast<uint64_t>(IPS)
                        : std::numeric_limits<uint64_t>::max());
     }
-    if (StatConf.isTimeMeasuring() || StatConf.isInstructionCounting() ||
-        StatConf.isCostMeasuring()) {
+    if (StatConf.isHardwareCounting()) {
+      const auto Records = getHostFuncCounterRecords();
+      uint64_t HostCalls = 0;
+      for (const auto &Record : Records) {
+        HostCalls += Record.Calls;
+      }
+      dumpCounters(" Wasm"sv, getWasmCounters(), getCountedInvocations());
+      dumpCounters(" Host functions"sv, getHostFuncCounters(), HostCalls);
+      for (const auto &Record : Records) {
+        dumpCounters(fmt::format("  {}"sv, Record.Name), Record.Values,
+                     Record.Calls);
+      }
+    }
+    if (Enabled) {
       spdlog::info("=======================   End   ======================"sv);
     }
   }
 
 private:
+  using AtomicCounterValues =
+      std::array<std::atomic_uint64_t,
+                 static_cast<size_t>(HardwareCounter::Max)>;
+
+  /// Hardware counters of a host function. The records are never removed, so
+  /// the cached pointers stay valid.
+  struct HostFuncRecord {
+    std::string Name;
+    std::atomic_uint64_t Calls = 0;
+    AtomicCounterValues Values{};
+  };
+
+  /// Per-thread cache entry of a host function record. The entries are zero
+  /// initialized, and no object has the owner ID 0.
+  struct HostFuncCacheEntry {
+    uint64_t Owner;
+    const void *Func;
+    HostFuncRecord *Record;
+  };
+
+  static void reset(AtomicCounterValues &Values) noexcept {
+    for (auto &Value : Values) {
+      Value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  static HardwareCounterValues
+  load(const AtomicCounterValues &Values) noexcept {
+    HardwareCounterValues Result;
+    for (size_t I = 0; I < Result.size(); ++I) {
+      Result[I] = Values[I].load(std::memory_order_relaxed);
+    }
+    return Result;
+  }
+
+  static void accumulate(HardwareCounterValues &Sum,
+                         const HardwareCounterValues &Start,
+                         const HardwareCounterValues &Stop) noexcept {
+    for (size_t I = 0; I < Sum.size(); ++I) {
+      Sum[I] += Stop[I] - Start[I];
+    }
+  }
+
+  /// Log the counters with their averages over the calls.
+  static void dumpCounters(std::string_view Title,
+                           const HardwareCounterValues &Values,
+                           uint64_t Calls) noexcept {
+    using namespace std::literals;
+    const auto Avg = [Calls](uint64_t V) { return Calls ? V / Calls : 0; };
+    const auto Get = [&Values](HardwareCounter C) {
+      return Values[static_cast<size_t>(C)];
+    };
+    spdlog::info("{} ({} calls): cycles {}, instructions {}, cache misses {}, "
+                 "branch misses {}, page faults {}"sv,
+                 Title, Calls, Get(HardwareCounter::Cycles),
+                 Get(HardwareCounter::Instructions),
+                 Get(HardwareCounter::CacheMisses),
+                 Get(HardwareCounter::BranchMisses),
+                 Get(HardwareCounter::PageFaults));
+    spdlog::info("{} per call: cycles {}, instructions {}"sv, Title,
+                 Avg(Get(HardwareCounter::Cycles)),
+                 Avg(Get(HardwareCounter::Instructions)));
+  }
+
   std::vector<uint64_t> CostTab;
   std::atomic_uint64_t InstrCnt;
   uint64_t CostLimit;
   std::atomic_uint64_t CostSum;
+  std::atomic_uint64_t JITCacheHits{0};
+  std::atomic_uint64_t JITCacheMisses{0};
+  std::shared_ptr<MemoryAccount> MemAccount =
+      std::make_shared<MemoryAccount>();
   Timer::Timer TimeRecorder;
+  mutable std::shared_mutex CounterMutex;
+  uint64_t Invocations = 0;
+  HardwareCounterValues InvocationCounters{};
+  AtomicCounterValues HostCounters{};
+  std::unordered_map<const void *, HostFuncRecord *> HostFuncIndices;
+  std::deque<HostFuncRecord> HostFuncRecords;
+  /// Identifier of this object in the per-thread caches, which outlive it.
+  const uint64_t ID = NextID.fetch_add(1, std::memory_order_relaxed);
+  static inline std::atomic_uint64_t NextID = 1;
+  static inline thread_local std::array<HostFuncCacheEntry, 8> HostFuncCache;
 };
 
 } // namespace Statistics
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/common/workerpool.h - Shared worker threads --------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines the WorkerPool class, a fixed set of threads running
+/// parallel loops.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace WasmEdge {
+
+/// Fixed set of worker threads running parallel loops.
+///
+/// The number of threads does not grow with the concurrent callers. Every loop
+/// is also run by its calling thread, and the workers only help with the loops
+/// waiting in the queue, so a loop completes even when all workers are busy.
+class WorkerPool {
+public:
+  /// Start \p ThreadCount workers. Threads that cannot be started are
+  /// skipped, the loops then run on fewer threads.
+  explicit WorkerPool(size_t ThreadCount) noexcept {
+    try {
+      Threads.reserve(ThreadCount);
+      for (size_t I = 0; I < ThreadCount; ++I) {
+        Threads.emplace_back([this]() noexcept { work(); });
+      }
+    } catch (const std::exception &) {
+    }
+  }
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool() noexcept {
+    {
+      std::unique_lock Lock(Mutex);
+      Stopping = true;
+    }
+    QueueCond.notify_all();
+    for (auto &Thread : Threads) {
+      Thread.join();
+    }
+  }
+
+  /// The pool shared by the callers in this library, with one worker less
+  /// than the hardware threads, as the calling thread takes part in the loop.
+  static WorkerPool &shared() noexcept {
+    static WorkerPool Pool(
+        std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1);
+    return Pool;
+  }
+
+  /// Number of worker threads, not counting the calling thread.
+  size_t getThreadCount() const noexcept { return Threads.size(); }
+
+  /// Call \p Body with every index in [0, \p Count) and return after all the
+  /// calls are done. The calls may run concurrently and must not throw.
+  template <typename BodyT>
+  void parallelFor(size_t Count, BodyT &&Body) noexcept {
+    Loop L;
+    L.Count = Count;
+    L.Body = const_cast<void *>(static_cast<const void *>(&Body));
+    L.Call = [](void *Ptr, size_t I) noexcept {
+      (*static_cast<std::remove_reference_t<BodyT> *>(Ptr))(I);
+    };
+    const bool Shared = Count > 1 && !Threads.empty();
+    if (Shared) {
+      {
+        std::unique_lock Lock(Mutex);
+        Queue.push_back(&L);
+      }
+      QueueCond.notify_all();
+    }
+    run(L);
+    if (Shared) {
+      // No worker joins the loop after it leaves the queue, wait for the ones
+      // still running an index.
+      std::unique_lock Lock(Mutex);
+      if (auto It = std::find(Queue.begin(), Queue.end(), &L);
+          It != Queue.end()) {
+        Queue.erase(It);
+      }
+      DoneCond.wait(Lock, [&L]() { return L.Helpers == 0; });
+    }
+  }
+
+private:
+  struct Loop {
+    size_t Count;
+    void *Body;
+    void (*Call)(void *, size_t) noexcept;
+    std::atomic<size_t> Next = 0;
+    /// Workers running the loop, guarded by the mutex.
+    size_t Helpers = 0;
+  };
+
+  static void run(Loop &L) noexcept {
+    for (size_t I; (I = L.Next.fetch_add(1, std::memory_order_relaxed)) <
+                   L.Count;) {
+      L.Call(L.Body, I);
+    }
+  }
+
+  void work() noexcept {
+    std::unique_lock Lock(Mutex);
+    while (true) {
+      QueueCond.wait(Lock, [this]() { return Stopping || !Queue.empty(); });
+      if (Stopping) {
+        return;
+      }
+      Loop &L = *Queue.front();
+      if (L.Next.load(std::memory_order_relaxed) >= L.Count) {
+        // All the indices are taken, only the running calls are left.
+        Queue.pop_front();
+        continue;
+      }
+      ++L.Helpers;
+      Lock.unlock();
+      run(L);
+      Lock.lock();
+      if (--L.Helpers == 0) {
+        DoneCond.notify_all();
+      }
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable QueueCond;
+  std::condition_variable DoneCond;
+  std::deque<Loop *> Queue;
+  bool Stopping = false;
+  std::vector<std::thread> Threads;
+};
+
+} // namespace WasmEdge
@@ -40,7 +40,36 @@ struct DriverCompilerOptions : public DriverProposalOptions {
             "instruction counting, gas measuring, and execution time."sv)),
         PropOptimizationLevel(
             PO::Description("Optimization level, one of 0, 1, 2, 3, s, z."sv),
-            PO::DefaultValue(std::string("2"))) {}
+            PO::DefaultValue(std::string("2"))),
+        ProfileUse(PO::Description(
+                       "Optimize with the profile recorded by `wasmedge run "
+                       "--profile-generate`."sv),
+                   PO::MetaVar("PROFILE"sv), PO::DefaultValue(std::string())),
+        CPUVariants(
+            PO::Description(
+                "Also emit code for the CPU, one of x86-64-v2, x86-64-v3, "
+                "x86-64-v4, into the universal wasm. The loader uses the most "
+                "capable variant the running CPU supports, and the generic "
+                "code otherwise. Implies --generic-binary."sv),
+            PO::MetaVar("CPU"sv)),
+        Batch(PO::Description(
+            "Compile many modules in one run. WASM is a manifest listing one "
+            "input per line, optionally followed by a tab and the output, or "
+            "a directory whose .wasm files are all compiled. WASM_SO is the "
+            "output directory. Inputs unchanged since the last run with the "
+            "same options are skipped."sv)),
+        Jobs(PO::Description("Number of concurrent workers of --batch, "
+                             "default value is 0 for the number of CPUs."sv),
+             PO::MetaVar("JOBS"sv), PO::DefaultValue<uint32_t>(0)),
+        MemoryLimit(
+            PO::Description(
+                "Limitation of the address space (in MiB) of each --batch "
+                "worker, default value is 0 for no limitations."sv),
+            PO::MetaVar("MIB"sv), PO::DefaultValue<uint64_t>(0)),
+        Summary(PO::Description(
+                    "Write the JSON summary of --batch to the file, default "
+                    "is `wasmedgec-summary.json` in the output directory."sv),
+                PO::MetaVar("SUMMARY"sv), PO::DefaultValue(std::string())) {}
 
   PO::Option<std::string> WasmName;
   PO::Option<std::string> SoName;
@@ -52,6 +81,12 @@ struct DriverCompilerOptions : public DriverProposalOptions {
   PO::Option<PO::Toggle> ConfEnableTimeMeasuring;
   PO::Option<PO::Toggle> ConfEnableAllStatistics;
   PO::Option<std::string> PropOptimizationLevel;
+  PO::Option<std::string> ProfileUse;
+  PO::List<std::string> CPUVariants;
+  PO::Option<PO::Toggle> Batch;
+  PO::Option<uint32_t> Jobs;
+  PO::Option<uint64_t> MemoryLimit;
+  PO::Option<std::string> Summary;
 
   void addOptions(PO::ArgumentParser &Parser) noexcept {
     Parser.add_option(WasmName)
@@ -64,7 +99,13 @@ struct DriverCompilerOptions : public DriverProposalOptions {
         .add_option("enable-all-statistics"sv, ConfEnableAllStatistics)
         .add_option("generic-binary"sv, ConfGenericBinary);
     addProposalOptions(Parser);
-    Parser.add_option("optimize"sv, PropOptimizationLevel);
+    Parser.add_option("optimize"sv, PropOptimizationLevel)
+        .add_option("profile-use"sv, ProfileUse)
+        .add_option("cpu-variant"sv, CPUVariants)
+        .add_option("batch"sv, Batch)
+        .add_option("jobs"sv, Jobs)
+        .add_option("memory-limit"sv, MemoryLimit)
+        .add_option("summary"sv, Summary);
   }
 };
 
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/driver/optimizer.h - Module optimizer --------------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the dead code elimination and the cold code splitting of
+/// the `wasmedge optimize` tool, and the host module loading the split code.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "ast/module.h"
+#include "common/configure.h"
+#include "common/span.h"
+#include "runtime/hostfunc.h"
+#include "runtime/instance/module.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace WasmEdge {
+
+namespace Runtime {
+class StoreManager;
+} // namespace Runtime
+
+namespace Driver {
+
+/// Name of the host module providing the `load` function, which the primary
+/// module of a split calls before the first call into the secondary module.
+inline constexpr std::string_view kSplitModuleName = "wasmedge_split";
+/// Name the secondary module of a split imports the primary module from.
+inline constexpr std::string_view kSplitPrimaryName = "wasmedge_split.primary";
+
+/// Whole module dead code elimination and cold code splitting.
+///
+/// The module is modified in place. It must be valid before, and the results
+/// are only valid after a round trip through the serializer, as the indices
+/// resolved by the validator are not updated.
+class ModuleOptimizer {
+public:
+  struct Stats {
+    uint32_t RemovedFuncs = 0;
+    uint32_t RemovedImports = 0;
+    uint32_t RemovedExports = 0;
+    uint32_t StrippedElems = 0;
+    uint64_t StrippedDataBytes = 0;
+    uint32_t SplitFuncs = 0;
+  };
+
+  /// Remove the code and the data not reachable from the roots.
+  ///
+  /// The roots are the exported functions named in Entries, the start
+  /// function, and the functions in the tables in use. A table is in use if
+  /// it is imported, exported, or accessed by the reachable code. The
+  /// function exports not in Entries are removed, and empty Entries keep all
+  /// the exports. The passive segments not used by the reachable code are
+  /// emptied, as their indices are kept.
+  void eliminateDeadCode(AST::Module &Mod, Span<const std::string> Entries);
+
+  /// Move the functions not reachable through direct calls from the exported
+  /// functions named in HotEntries and the start function into Secondary.
+  ///
+  /// The moved functions are replaced by stubs calling through a new table,
+  /// which the secondary module fills when instantiated. Before the first call
+  /// through an empty slot, the stubs call the imported `load` function of
+  /// the `wasmedge_split` module, see SplitLoaderModule. The functions using
+  /// the passive segments stay in the module. Nothing is moved if there are
+  /// no cold functions, and Secondary is left untouched.
+  void splitColdCode(AST::Module &Mod, Span<const std::string> HotEntries,
+                     AST::Module &Secondary);
+
+  const Stats &getStats() const noexcept { return Stat; }
+
+private:
+  Stats Stat;
+};
+
+/// Host module loading the secondary module of a split module.
+///
+/// On the first call of its `load` function, the calling module is registered
+/// in the store as `wasmedge_split.primary`, and the secondary module is
+/// loaded, validated and instantiated against it.
+///
+/// The secondary module imports from the primary module, which imports from
+/// this module, so the secondary module must be unloaded before the primary
+/// module is destroyed.
+class SplitLoaderModule : public Runtime::Instance::ModuleInstance {
+public:
+  SplitLoaderModule(const Configure &Conf, Runtime::StoreManager &StoreMgr,
+                    std::filesystem::path Path);
+  ~SplitLoaderModule() noexcept override;
+
+  /// Check if the secondary module is loaded.
+  bool isLoaded() const noexcept;
+
+  /// Release the secondary module instance.
+  void unload() noexcept;
+
+private:
+  class Load : public Runtime::HostFunction<Load> {
+  public:
+    Load(SplitLoaderModule &M) : Parent(M) {}
+    Expect<void> body(const Runtime::CallingFrame &Frame);
+
+  private:
+    SplitLoaderModule &Parent;
+  };
+
+  const Configure Conf;
+  Runtime::StoreManager &StoreMgr;
+  const std::filesystem::path Path;
+  mutable std::mutex Mutex;
+  std::unique_ptr<AST::Module> Secondary;
+  std::unique_ptr<Runtime::Instance::ModuleInstance> SecondaryInst;
+};
+
+} // namespace Driver
+} // namespace WasmEdge
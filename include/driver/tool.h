@@ -52,6 +52,9 @@ struct DriverToolOptions : public DriverProposalOptions {
             "Enable generating code for counting gas burned during execution."sv)),
         ConfEnableTimeMeasuring(PO::Description(
             "Enable generating code for counting time during execution."sv)),
+        ConfEnableHardwareCounting(PO::Description(
+            "Enable recording hardware performance counters of executions and "
+            "host functions through Linux perf_event."sv)),
         ConfEnableAllStatistics(PO::Description(
             "Enable generating code for all statistics options include "
             "instruction counting, gas measuring, and execution time"sv)),
@@ -64,10 +67,18 @@ struct DriverToolOptions : public DriverProposalOptions {
         ConfForceInterpreter(
             PO::Description("Forcibly run WASM in interpreter mode."sv)),
         ConfRunMode(PO::Description("Set execution mode. Valid values: "
-                                    "interpreter, jit, aot, lazyjit. "
+                                    "interpreter, jit, aot, lazyjit, tiered. "
                                     "Default is interpreter."sv),
                     PO::MetaVar("MODE"sv), PO::DefaultValue(std::string())),
         ConfAFUNIX(PO::Description("Enable UNIX domain sockets"sv)),
+        ConfEnableJITCache(PO::Description(
+            "Cache the machine code of the JIT run modes on disk, so later "
+            "runs of the same module skip its compilation."sv)),
+        ConfJITCacheDir(
+            PO::Description(
+                "Absolute path of the directory of the JIT cache. Default is "
+                "the `jit` directory of the local AOT cache."sv),
+            PO::MetaVar("DIR"sv), PO::DefaultValue(std::string())),
         TimeLim(
             PO::Description(
                 "Limitation of maximum time(in milliseconds) for execution, "
@@ -96,7 +107,56 @@ struct DriverToolOptions : public DriverProposalOptions {
             PO::Description(
                 "Set logging level. Valid values: off, trace, debug, info, "
                 "warning, error, fatal. Default is info."sv),
-            PO::MetaVar("LEVEL"sv), PO::DefaultValue(std::string())) {}
+            PO::MetaVar("LEVEL"sv), PO::DefaultValue(std::string())),
+        Restore(PO::Description(
+                    "Restore the module state from a snapshot created by "
+                    "`wasmedge snapshot` before running. The initialization "
+                    "function `_initialize` is not called again."sv),
+                PO::MetaVar("SNAPSHOT"sv), PO::DefaultValue(std::string())),
+        ProfileGenerate(
+            PO::Description(
+                "Record the function calls and branches of the module into "
+                "the profile file for `wasmedgec --profile-use`, merged with "
+                "the existing records. Forces the interpreter mode."sv),
+            PO::MetaVar("PROFILE"sv), PO::DefaultValue(std::string())),
+        SplitModule(
+            PO::Description(
+                "Load the cold functions split out by `wasmedge optimize "
+                "--split-cold` from the given file on their first call."sv),
+            PO::MetaVar("WASM"sv), PO::DefaultValue(std::string())),
+        SnapshotName(PO::Description("Snapshot file"sv),
+                     PO::MetaVar("SNAPSHOT"sv)),
+        SnapshotInitFunc(
+            PO::Description(
+                "Function to run before taking the snapshot. Default is "
+                "`wizer.initialize`, or `_initialize` if the former is not "
+                "exported."sv),
+            PO::MetaVar("FUNCTION"sv), PO::DefaultValue(std::string())),
+        OptimizeOutput(PO::Description("Output wasm file"sv),
+                       PO::MetaVar("OUTPUT"sv)),
+        OptimizeEntries(
+            PO::Description(
+                "Exported function to keep. Each entry can be specified as "
+                "--entry `name`. The function exports not listed are removed, "
+                "and all the exports are kept if none is listed."sv),
+            PO::MetaVar("NAME"sv)),
+        OptimizeHot(
+            PO::Description(
+                "Exported function whose direct callees stay in the output "
+                "module with --split-cold. Each entry can be specified as "
+                "--hot `name`."sv),
+            PO::MetaVar("NAME"sv)),
+        OptimizeSplitCold(
+            PO::Description(
+                "Move the functions not called from the --hot entries into "
+                "the given secondary module, loaded by `wasmedge run "
+                "--split-module` on their first call."sv),
+            PO::MetaVar("WASM"sv), PO::DefaultValue(std::string())),
+        OptimizeRounds(
+            PO::Description(
+                "Number of the rounds to measure the original and the "
+                "optimized modules. Default is 3."sv),
+            PO::MetaVar("ROUNDS"sv), PO::DefaultValue<uint32_t>(3)) {}
 
   PO::Option<std::string> SoName;
   PO::List<std::string> Args;
@@ -107,6 +167,7 @@ struct DriverToolOptions : public DriverProposalOptions {
   PO::Option<PO::Toggle> ConfEnableInstructionCounting;
   PO::Option<PO::Toggle> ConfEnableGasMeasuring;
   PO::Option<PO::Toggle> ConfEnableTimeMeasuring;
+  PO::Option<PO::Toggle> ConfEnableHardwareCounting;
   PO::Option<PO::Toggle> ConfEnableAllStatistics;
   PO::Option<PO::Toggle> ConfEnableJIT;
   PO::Option<PO::Toggle> ConfEnableCoredump;
@@ -114,12 +175,24 @@ struct DriverToolOptions : public DriverProposalOptions {
   PO::Option<PO::Toggle> ConfForceInterpreter;
   PO::Option<std::string> ConfRunMode;
   PO::Option<PO::Toggle> ConfAFUNIX;
+  PO::Option<PO::Toggle> ConfEnableJITCache;
+  PO::Option<std::string> ConfJITCacheDir;
   PO::Option<uint64_t> TimeLim;
   PO::List<int> GasLim;
   PO::List<int> MemLim;
   PO::List<std::string> LinkedModules;
   PO::List<std::string> ForbiddenPlugins;
   PO::Option<std::string> LogLevel;
+  PO::Option<std::string> Restore;
+  PO::Option<std::string> ProfileGenerate;
+  PO::Option<std::string> SplitModule;
+  PO::Option<std::string> SnapshotName;
+  PO::Option<std::string> SnapshotInitFunc;
+  PO::Option<std::string> OptimizeOutput;
+  PO::List<std::string> OptimizeEntries;
+  PO::List<std::string> OptimizeHot;
+  PO::Option<std::string> OptimizeSplitCold;
+  PO::Option<uint32_t> OptimizeRounds;
 
 private:
   void addGlobalOptions(PO::ArgumentParser &Parser) noexcept {
@@ -154,6 +227,7 @@ public:
         .add_option("enable-instruction-count"sv, ConfEnableInstructionCounting)
         .add_option("enable-gas-measuring"sv, ConfEnableGasMeasuring)
         .add_option("enable-time-measuring"sv, ConfEnableTimeMeasuring)
+        .add_option("enable-hw-counters"sv, ConfEnableHardwareCounting)
         .add_option("enable-all-statistics"sv, ConfEnableAllStatistics)
         .add_option("enable-jit"sv, ConfEnableJIT)
         .add_option("enable-coredump"sv, ConfEnableCoredump)
@@ -161,9 +235,32 @@ public:
         .add_option("force-interpreter"sv, ConfForceInterpreter)
         .add_option("run-mode"sv, ConfRunMode)
         .add_option("allow-af-unix"sv, ConfAFUNIX)
+        .add_option("enable-jit-cache"sv, ConfEnableJITCache)
+        .add_option("jit-cache-dir"sv, ConfJITCacheDir)
         .add_option("time-limit"sv, TimeLim)
         .add_option("gas-limit"sv, GasLim)
-        .add_option("reactor"sv, Reactor);
+        .add_option("reactor"sv, Reactor)
+        .add_option("restore"sv, Restore)
+        .add_option("profile-generate"sv, ProfileGenerate)
+        .add_option("split-module"sv, SplitModule);
+  }
+
+  void addSnapshotOptions(PO::ArgumentParser &Parser) noexcept {
+    addLinkerOptions(Parser);
+
+    Parser.add_option(SnapshotName)
+        .add_option("init-func"sv, SnapshotInitFunc)
+        .add_option("run-mode"sv, ConfRunMode);
+  }
+
+  void addOptimizeOptions(PO::ArgumentParser &Parser) noexcept {
+    addParserOptions(Parser);
+
+    Parser.add_option(OptimizeOutput)
+        .add_option("entry"sv, OptimizeEntries)
+        .add_option("hot"sv, OptimizeHot)
+        .add_option("split-cold"sv, OptimizeSplitCold)
+        .add_option("rounds"sv, OptimizeRounds);
   }
 };
 Configure createConfigure(const struct DriverToolOptions &Opt) noexcept;
@@ -173,6 +270,8 @@ int Tool(struct DriverToolOptions &Opt) noexcept;
 int ParseTool(struct DriverToolOptions &Opt) noexcept;
 int ValidateTool(struct DriverToolOptions &Opt) noexcept;
 int InstantiateTool(struct DriverToolOptions &Opt) noexcept;
+int SnapshotTool(struct DriverToolOptions &Opt) noexcept;
+int OptimizeTool(struct DriverToolOptions &Opt) noexcept;
 
 } // namespace Driver
 } // namespace WasmEdge
@@ -20,8 +20,10 @@
 #include "common/configure.h"
 #include "common/defines.h"
 #include "common/errcode.h"
+#include "common/profile.h"
 #include "common/statistics.h"
 #include "common/types.h"
+#include "executor/instancepre.h"
 #include "runtime/callingframe.h"
 #include "runtime/instance/component/component.h"
 #include "runtime/instance/module.h"
@@ -44,6 +46,9 @@
 #include <vector>
 
 namespace WasmEdge {
+
+class Fault;
+
 namespace Executor {
 
 namespace {
@@ -144,10 +149,11 @@ private:
 class Executor {
 public:
   Executor(const Configure &Conf, Statistics::Statistics *S = nullptr) noexcept
-      : Conf(Conf) {
+      : Conf(Conf), MemAccount(S ? S->getMemoryAccount() : nullptr) {
     if (Conf.getStatisticsConfigure().isInstructionCounting() ||
         Conf.getStatisticsConfigure().isCostMeasuring() ||
-        Conf.getStatisticsConfigure().isTimeMeasuring()) {
+        Conf.getStatisticsConfigure().isTimeMeasuring() ||
+        Conf.getStatisticsConfigure().isHardwareCounting()) {
       Stat = S;
     } else {
       Stat = nullptr;
@@ -173,6 +179,22 @@ public:
   Expect<void> registerModule(Runtime::StoreManager &StoreMgr,
                               const Runtime::Instance::ModuleInstance &ModInst);
 
+  /// Resolve the imports of a WASM module against the store and create the
+  /// pre-linked instantiation template.
+  Expect<std::unique_ptr<InstancePre>>
+  createInstancePre(Runtime::StoreManager &StoreMgr, const AST::Module &Mod);
+
+  /// Instantiate a WASM module from the pre-linked instantiation template as
+  /// an anonymous module instance.
+  Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
+  instantiateModule(Runtime::StoreManager &StoreMgr, const InstancePre &Pre);
+
+  /// Instantiate a WASM module from the pre-linked instantiation template and
+  /// register it as a named module instance.
+  Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
+  registerModule(Runtime::StoreManager &StoreMgr, const InstancePre &Pre,
+                 std::string_view Name);
+
   /// Register an instantiated module under the given alias name.
   Expect<void> registerModule(Runtime::StoreManager &StoreMgr,
                               const Runtime::Instance::ModuleInstance &ModInst,
@@ -211,6 +233,18 @@ public:
     LazyCompilationHandler = std::move(Callback);
   }
 
+  /// Register a callback swapping in the code compiled in the background by
+  /// the tiered run mode. It runs on the executing thread at the next
+  /// function call after \c requestTierUp .
+  void registerTierUpCallback(std::function<void()> Callback) {
+    TierUpHandler = std::move(Callback);
+  }
+
+  /// Request the tier-up callback to run. This function is thread-safe.
+  void requestTierUp() noexcept {
+    TierUpRequested.store(true, std::memory_order_release);
+  }
+
   /// Invoke a WASM function by function instance.
   Expect<std::vector<std::pair<ValVariant, ValType>>>
   invoke(const Runtime::Instance::FunctionInstance *FuncInst,
@@ -235,10 +269,50 @@ public:
 
   /// Stop execution
   void stop() noexcept {
-    StopToken.store(1, std::memory_order_relaxed);
+    StopToken.store(kStopTokenStop, std::memory_order_relaxed);
     atomicNotifyAll();
   }
 
+  /// Request the running execution to call the yield handler at its next
+  /// interruption check. This function is thread-safe.
+  void requestYield() noexcept {
+    StopToken.fetch_or(kStopTokenYield, std::memory_order_relaxed);
+  }
+
+  /// Set the handler called when a yield is requested. The handler switches
+  /// away from the stack of the execution, and returns when the execution is
+  /// resumed on the same thread, because both the interpreter and the
+  /// compiled code keep addresses of thread local states across the switch.
+  /// Yield requests are ignored without a handler.
+  void setYieldHandler(std::function<void()> Handler) noexcept {
+    YieldHandler = std::move(Handler);
+  }
+
+  /// Start function of an asynchronous host operation. It starts the
+  /// operation, and the operation calls the completion callback once, on any
+  /// thread, when it completes.
+  using AsyncStart = std::function<void(std::function<void()> Done)>;
+
+  /// Wait in a host function for the operation started by the start function.
+  /// With an await handler, the execution is suspended and the thread is
+  /// released until the operation completes. Otherwise the thread blocks.
+  void awaitHost(AsyncStart Start) noexcept;
+
+  /// Set the handler called when a host function awaits an operation. The
+  /// handler switches away from the stack of the execution, starts the
+  /// operation after the switch, and returns when the execution is resumed on
+  /// the same thread after the completion.
+  void setAwaitHandler(std::function<void(AsyncStart)> Handler) noexcept {
+    AwaitHandler = std::move(Handler);
+  }
+
+  /// Record the function entries, the conditional branches, and the
+  /// call_indirect callees of the module instance into the profile when
+  /// interpreting. Set nullptr to stop. The profile must not be shared with
+  /// another module instance.
+  void setProfile(Profile::Profile *P,
+                  const Runtime::Instance::ModuleInstance *ModInst) noexcept;
+
 private:
   /// Run Wasm bytecode expression for initialization.
   Expect<void> runExpression(Runtime::StackManager &StackMgr,
@@ -254,12 +328,56 @@ private:
                        const AST::InstrView::iterator Start,
                        const AST::InstrView::iterator End);
 
+  /// Handle the nonzero stop token: interrupt or yield the execution.
+  Expect<void> handleStopToken(uint32_t Token) noexcept;
+
+  /// Suspend the execution through the yield handler.
+  void suspendExecution() noexcept;
+
+  /// \name Helper Functions for the memory accounting.
+  /// @{
+  /// Charge the memory allocated for the module instance instantiated from
+  /// the module.
+  Expect<void> chargeInstanceMemory(Runtime::Instance::ModuleInstance &ModInst,
+                                    const AST::Module &Mod) noexcept;
+  /// Attach the memory account to a registered host module instance, and
+  /// charge the memories and tables it owns.
+  Expect<void>
+  chargeHostModule(const Runtime::Instance::ModuleInstance &ModInst) noexcept;
+  /// Charge the growth to the executing module instance and grow the memory
+  /// instance. Return false if the limits are exceeded or the growth fails.
+  bool growMemory(const Runtime::Instance::ModuleInstance &ModInst,
+                  Runtime::Instance::MemoryInstance &MemInst,
+                  uint64_t Pages) noexcept;
+  /// Charge the growth to the executing module instance and grow the table
+  /// instance. Return false if the limits are exceeded or the growth fails.
+  bool growTable(const Runtime::Instance::ModuleInstance &ModInst,
+                 Runtime::Instance::TableInstance &TabInst, uint64_t Size,
+                 const RefVariant &Val) noexcept;
+  /// Charge a GC object allocation to the module instance.
+  Expect<void>
+  chargeGCMemory(const Runtime::Instance::ModuleInstance &ModInst,
+                 uint64_t Bytes) const noexcept;
+  /// @}
+
   /// \name Functions for instantiation.
   /// @{
   /// Instantiation of Module Instance.
   Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
   instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
-              std::optional<std::string_view> Name = std::nullopt);
+              std::optional<std::string_view> Name = std::nullopt,
+              const InstancePre *Pre = nullptr);
+
+  /// Link the resolved imports of the instantiation template. Returns false if
+  /// the template is not resolved against the store or is stale.
+  bool linkImports(const Runtime::StoreManager &StoreMgr,
+                   Runtime::Instance::ModuleInstance &ModInst,
+                   const InstancePre &Pre);
+
+  /// Instantiation of Defined Types, and assignment of the canonical type
+  /// IDs.
+  Expect<void> instantiate(Runtime::Instance::ModuleInstance &ModInst,
+                           const AST::TypeSection &TypeSec);
 
   /// Instantiation of Imports.
   Expect<void> instantiate(
@@ -289,21 +407,28 @@ private:
   /// Instantiation of Global Instances.
   Expect<void> instantiate(Runtime::StackManager &StackMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
-                           const AST::GlobalSection &GlobSec);
+                           const AST::GlobalSection &GlobSec,
+                           const InstancePre *Pre = nullptr);
 
   /// Instantiation of Element Instances.
   Expect<void> instantiate(Runtime::StackManager &StackMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
-                           const AST::ElementSection &ElemSec);
+                           const AST::ElementSection &ElemSec,
+                           const InstancePre *Pre = nullptr);
 
   /// Initialize table with Element Instances.
   Expect<void> initTable(Runtime::StackManager &StackMgr,
                          const AST::ElementSection &ElemSec);
 
+  /// Evaluate the initialization expression of an element.
+  Expect<RefVariant> runElemExpression(Runtime::StackManager &StackMgr,
+                                       const AST::Expression &Expr);
+
   /// Instantiation of Data Instances.
   Expect<void> instantiate(Runtime::StackManager &StackMgr,
                            Runtime::Instance::ModuleInstance &ModInst,
-                           const AST::DataSection &DataSec);
+                           const AST::DataSection &DataSec,
+                           const InstancePre *Pre = nullptr);
 
   /// Initialize memory with Data Instances.
   Expect<void> initMemory(Runtime::StackManager &StackMgr,
@@ -398,6 +523,29 @@ private:
                       Runtime::Instance::MemoryInstance *MemInst);
   /// @}
 
+  /// Helper function for recording a conditional branch into the profile.
+  void profileBranch(Runtime::StackManager &StackMgr,
+                     const AST::Instruction &Instr, bool Taken) noexcept {
+    if (unlikely(Prof != nullptr) && StackMgr.getModule() == ProfModInst) {
+      Prof->countBranch(Instr.getOffset(), Taken);
+    }
+  }
+
+  /// Helper function for recording the callee of a call_indirect into the
+  /// profile.
+  void profileIndirectCall(Runtime::StackManager &StackMgr,
+                           const AST::Instruction &Instr,
+                           const Runtime::Instance::FunctionInstance &Func)
+      noexcept {
+    if (unlikely(Prof != nullptr) && StackMgr.getModule() == ProfModInst) {
+      Prof->countIndirectCall(
+          Instr.getOffset(),
+          Func.getModule() == ProfModInst && Func.isWasmFunction()
+              ? Func.getInstrs().front().getOffset()
+              : Profile::Profile::kOtherTarget);
+    }
+  }
+
   /// \name Helper Functions for block controls.
   /// @{
   /// Helper function for calling functions. Return the continuation iterator.
@@ -409,6 +557,28 @@ private:
       bool IsNativeEntry = false,
       const Runtime::Instance::ModuleInstance *CallerModInst = nullptr);
 
+  /// Helper function for checking the callee type of call_indirect. Equal
+  /// canonical type IDs match without the structural subtype matching.
+  bool matchIndirectCallType(
+      const Runtime::Instance::ModuleInstance &ModInst, uint32_t TypeIdx,
+      const Runtime::Instance::FunctionInstance &FuncInst) const noexcept;
+
+  /// Helper function for running a host function with the args and the
+  /// returns in place. The args are cleaned in place. Charges the cost and
+  /// records the statistics of the call.
+  Expect<void>
+  runHostFunction(const Runtime::Instance::FunctionInstance &Func,
+                  const Runtime::Instance::ModuleInstance *ModInst,
+                  Span<ValVariant> Args, Span<ValVariant> Rets);
+
+  /// Helper function for calling a host function from compiled code. The
+  /// args and the returns are passed directly between the native buffers
+  /// and the host function, without going through the value stack.
+  Expect<void>
+  callHostFromCompiled(const Runtime::Instance::FunctionInstance &Func,
+                       const Runtime::Instance::ModuleInstance *ModInst,
+                       const ValVariant *Args, ValVariant *Rets) noexcept;
+
   /// Live module instances whose compiled code may be on the native stack at
   /// fault time: the current frame-stack modules plus every instance in a store
   /// reachable through their linked-module back-links. Rebuilt on each fault.
@@ -709,7 +879,8 @@ private:
                               Runtime::Instance::TableInstance &TabInst,
                               Runtime::Instance::ElementInstance &ElemInst,
                               const AST::Instruction &Instr);
-  Expect<void> runElemDropOp(Runtime::Instance::ElementInstance &ElemInst);
+  Expect<void> runElemDropOp(Runtime::StackManager &StackMgr,
+                             Runtime::Instance::ElementInstance &ElemInst);
   Expect<void> runTableCopyOp(Runtime::StackManager &StackMgr,
                               Runtime::Instance::TableInstance &TabInstDst,
                               Runtime::Instance::TableInstance &TabInstSrc,
@@ -738,7 +909,8 @@ private:
                                Runtime::Instance::MemoryInstance &MemInst,
                                Runtime::Instance::DataInstance &DataInst,
                                const AST::Instruction &Instr);
-  Expect<void> runDataDropOp(Runtime::Instance::DataInstance &DataInst);
+  Expect<void> runDataDropOp(Runtime::StackManager &StackMgr,
+                             Runtime::Instance::DataInstance &DataInst);
   Expect<void> runMemoryCopyOp(Runtime::StackManager &StackMgr,
                                Runtime::Instance::MemoryInstance &MemInstDst,
                                Runtime::Instance::MemoryInstance &MemInstSrc,
@@ -1156,6 +1328,8 @@ public:
                              const Runtime::Instance::ModuleInstance *ModInst,
                              ValVariant *Out, const uint32_t PopPayload,
                              const uint32_t NeedRef) noexcept;
+  Expect<void> proxyCheckStop(Runtime::StackManager &StackMgr,
+                              const uint32_t Token) noexcept;
   /// @}
 
   /// Callbacks for compiled modules
@@ -1228,6 +1402,20 @@ private:
     std::vector<ValVariant> Payload;
   };
 
+  /// Thread local states of a suspended execution, which are put aside while
+  /// other executions run on the thread.
+  struct SuspendedThreadLocal {
+    Executor *This;
+    Runtime::StackManager *CurrentStack;
+    ExecutorContext ExecutionContext;
+    PendingExnStruct PendingExn;
+    size_t StackTraceSize;
+    Fault *FaultHandlers;
+
+    void save() noexcept;
+    void restore() noexcept;
+  };
+
   /// Pointer to current object.
   static thread_local Executor *This;
   /// Stack passed into compiled functions
@@ -1244,8 +1432,20 @@ private:
   const Configure Conf;
   /// Executor statistics
   Statistics::Statistics *Stat;
-  /// Stop execution
+  /// Memory account, which does not depend on the enabled statistics
+  std::shared_ptr<Statistics::MemoryAccount> MemAccount;
+  /// Execution profile and the profiled module instance
+  Profile::Profile *Prof = nullptr;
+  const Runtime::Instance::ModuleInstance *ProfModInst = nullptr;
+  /// Stop execution. The stop bit interrupts the execution, and the yield bit
+  /// calls the yield handler.
+  static inline constexpr uint32_t kStopTokenStop = 1;
+  static inline constexpr uint32_t kStopTokenYield = 2;
   std::atomic_uint32_t StopToken = 0;
+  /// Handler of the yield requests
+  std::function<void()> YieldHandler;
+  /// Handler of the host functions awaiting operations
+  std::function<void(AsyncStart)> AwaitHandler;
   /// Memory instance this Executor is currently waiting on (for stop()).
   std::atomic<Runtime::Instance::MemoryInstance *> WaitingMemory = nullptr;
   /// Executor Host Function Handler
@@ -1253,6 +1453,9 @@ private:
   /// Callback for lazy function compilation
   std::function<Expect<void>(const Runtime::Instance::FunctionInstance *)>
       LazyCompilationHandler;
+  /// Callback for the tier-up of the tiered run mode and its request flag.
+  std::function<void()> TierUpHandler;
+  std::atomic_bool TierUpRequested = false;
 
   /// Helper function for triggering lazy compilation.
   /// XXX: Calling checkLazyCompilation in one thread while another thread calls
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/executor/instancepre.h - InstancePre class definition ----===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of the InstancePre class, which is the
+/// pre-linked instantiation template of a module.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "ast/module.h"
+#include "common/types.h"
+#include "runtime/instance/module.h"
+#include "runtime/storemgr.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace WasmEdge {
+namespace Executor {
+
+class Executor;
+
+/// Pre-linked instantiation template of a validated module.
+///
+/// The imports of the module are resolved and type-checked against a store
+/// once, and the values of the constant initialization expressions are
+/// computed once. Instantiating from the template links the resolved imports
+/// directly and skips these expressions. The AST module and the store must
+/// outlive this object. Once a module is unregistered from the store, the
+/// resolved imports are stale and the instantiation resolves them again.
+class InstancePre {
+public:
+  /// Getter of the AST module.
+  const AST::Module &getModule() const noexcept { return Mod; }
+
+  /// Getter of the store the imports are resolved against.
+  const Runtime::StoreManager &getStore() const noexcept { return Store; }
+
+private:
+  friend class Executor;
+
+  InstancePre(const AST::Module &M, const Runtime::StoreManager &S,
+              uint64_t Gen) noexcept
+      : Mod(M), Store(S), Generation(Gen) {}
+
+  /// \name Data of InstancePre.
+  /// @{
+  const AST::Module &Mod;
+  const Runtime::StoreManager &Store;
+  /// Generation of the store when the imports were resolved.
+  uint64_t Generation;
+  /// Resolved imports in the index spaces of each external type.
+  std::vector<Runtime::Instance::FunctionInstance *> Funcs;
+  std::vector<Runtime::Instance::TableInstance *> Tabs;
+  std::vector<Runtime::Instance::MemoryInstance *> Mems;
+  std::vector<Runtime::Instance::TagInstance *> Tags;
+  std::vector<Runtime::Instance::GlobalInstance *> Globs;
+  /// Module instances providing the imports.
+  std::vector<Runtime::Instance::ModuleInstance *> Providers;
+  const Runtime::Instance::ModuleInstance *WASIModule = nullptr;
+  /// Values of the initialization expressions of the global segments and the
+  /// offsets of the element and data segments. std::nullopt if the expression
+  /// is not a constant instruction.
+  std::vector<std::optional<ValVariant>> GlobalInits;
+  std::vector<std::optional<ValVariant>> ElemOffsets;
+  std::vector<std::optional<ValVariant>> DataOffsets;
+  /// @}
+};
+
+} // namespace Executor
+} // namespace WasmEdge
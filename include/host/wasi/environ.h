@@ -525,6 +525,7 @@ public:
     } else if (auto It2 = FdMap.find(To); It2 == FdMap.end()) {
       return WasiUnexpect(__WASI_ERRNO_BADF);
     } else {
+      close(It2->second);
       FdMap.erase(It2);
       auto Node = FdMap.extract(It);
       Node.key() = To;
@@ -1310,6 +1311,9 @@ Environ::acquirePoller(Span<__wasi_event_t> Events) noexcept {
 }
 
 inline void Environ::close(std::shared_ptr<VINode> Node) noexcept {
+  // The pollers in use are not in the pool, and look up the closed file
+  // descriptors on their next call instead.
+  VPoller::closed(*this, *Node);
   std::unique_lock Lock(PollerMutex);
   for (auto &Poller : PollerPool) {
     Poller.close(Node);
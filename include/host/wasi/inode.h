@@ -9,8 +9,11 @@
 #include "common/types.h"
 #include "host/wasi/error.h"
 #include "host/wasi/vfs.h"
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -798,6 +801,7 @@ public:
 
 private:
   friend class Poller;
+  friend class PollerContext;
 
 #if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
 public:
@@ -824,6 +828,11 @@ private:
 };
 
 class PollerContext;
+#if WASMEDGE_OS_LINUX
+inline namespace detail {
+class IOUring;
+}
+#endif
 class Poller
 #if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
     : public FdHolder
@@ -924,8 +933,13 @@ private:
   struct FdData {
     OptionalEvent *ReadEvent = nullptr;
     OptionalEvent *WriteEvent = nullptr;
+#if WASMEDGE_OS_LINUX
+    bool Edge = false;
+#endif
   };
   std::unordered_map<int, FdData> FdDatas;
+#endif
+#if WASMEDGE_OS_MACOS
   std::unordered_map<int, FdData> OldFdDatas;
 #endif
 
@@ -939,7 +953,6 @@ private:
 #endif
 
 #if WASMEDGE_OS_LINUX
-  friend class PollerContext;
   struct Timer : public FdHolder {
     Timer(const Timer &) = delete;
     Timer &operator=(const Timer &) = delete;
@@ -953,15 +966,98 @@ private:
                              __wasi_timestamp_t Precision,
                              __wasi_subclockflags_t Flags) noexcept;
 
+    void disarm() noexcept;
+
+    /// Consume the expirations, so the timer stays unreadable until it
+    /// expires again.
+    void drain() noexcept;
+
     __wasi_clockid_t Clock;
+    bool Armed = false;
 #if !__GLIBC_PREREQ(2, 8)
     FdHolder Notify;
     TimerHolder TimerId;
 #endif
   };
 
-  std::vector<Timer> Timers;
+  struct ClockEvent {
+    OptionalEvent *Event;
+    __wasi_clockid_t Clock;
+    __wasi_timestamp_t Deadline;
+  };
+
+  /// Forget the registrations and polls kept for the file descriptors closed
+  /// since the last call.
+  void dropClosedFds() noexcept;
+  /// Check if \p PollFd is the file descriptor of a clock timer.
+  bool isTimer(int PollFd) const noexcept;
+  /// Apply the difference between the current subscriptions and the
+  /// registrations kept from previous calls.
+  void updateRegistrations() noexcept;
+  /// Arm one timer per clock with the earliest deadline of its subscriptions.
+  void updateTimers() noexcept;
+  /// Mark the clock subscriptions whose deadline has passed.
+  void processClockEvents() noexcept;
+  /// Mark the subscriptions of \p EventFd which are satisfied by the events
+  /// of \p Ready, or drain the timer of \p EventFd.
+  void processFdEvent(int EventFd, uint32_t Ready) noexcept;
+  /// Check if some subscriptions have a result.
+  bool hasResult() const noexcept;
+
+  /// Event masks of the file descriptors registered in the epoll instance.
+  /// Registrations are kept alive across calls, and only changed ones are
+  /// passed to `epoll_ctl`.
+  std::unordered_map<int, uint32_t> Registered;
+  /// Count of the closed file descriptors seen by the last call.
+  uint64_t SeenClosedFds = 0;
+  /// One timer per clock, registered in the epoll instance once and re-armed
+  /// with the earliest deadline on each call.
+  std::unordered_map<__wasi_clockid_t, Timer> Timers;
+  std::vector<ClockEvent> ClockEvents;
   std::vector<struct epoll_event> EPollEvents;
+
+  /// Owner of the io_uring ring of the completion-based wait. It is only set
+  /// when WasmEdge is built with WASMEDGE_WASI_IO_URING and the kernel
+  /// supports it, the epoll instance is used otherwise.
+  struct RingHolder {
+    RingHolder(const RingHolder &) = delete;
+    RingHolder &operator=(const RingHolder &) = delete;
+    RingHolder(RingHolder &&RHS) noexcept {
+      using std::swap;
+      swap(Ring, RHS.Ring);
+      swap(Checked, RHS.Checked);
+    }
+    RingHolder &operator=(RingHolder &&RHS) noexcept {
+      using std::swap;
+      swap(Ring, RHS.Ring);
+      swap(Checked, RHS.Checked);
+      return *this;
+    }
+
+    constexpr RingHolder() = default;
+    ~RingHolder() noexcept { reset(); }
+    void reset() noexcept;
+
+    IOUring *Ring = nullptr;
+    /// The creation of the ring is only tried once.
+    bool Checked = false;
+  };
+  struct RingPoll {
+    uint64_t UserData;
+    uint32_t Mask;
+  };
+
+  /// Wait for the subscriptions with oneshot polls in the io_uring ring.
+  void waitRing() noexcept;
+
+  RingHolder Ring;
+  /// Polls queued in the ring and not completed yet. They are kept across
+  /// calls like the epoll registrations, only the completed ones are queued
+  /// again.
+  std::unordered_map<int, RingPoll> RingPolls;
+  /// Sequence number of the last queued poll, which tells the completions of
+  /// the cancelled polls apart.
+  uint32_t LastRingPoll = 0;
 #endif
 
 #if WASMEDGE_OS_MACOS
@@ -979,13 +1075,26 @@ private:
 class PollerContext {
 #if WASMEDGE_OS_LINUX
 public:
-  WasiExpect<Poller::Timer> acquireTimer(__wasi_clockid_t Clock) noexcept;
-  void releaseTimer(Poller::Timer &&) noexcept;
+  /// Record the closing of \p Node. The pollers in use drop the registrations
+  /// kept for its file descriptor number on their next call, as the number
+  /// may be reused by another file.
+  void closed(const INode &Node) noexcept;
 
 private:
-  std::mutex TimerMutex; ///< Protect TimerPool
-  std::unordered_map<__wasi_clockid_t, std::vector<Poller::Timer>> TimerPool;
+  friend class Poller;
+  /// Closes kept for the pollers in use, older ones are dropped.
+  static inline constexpr size_t kMaxClosedFds = 4096;
+  /// Count of the closed file descriptors, the pollers compare it with the
+  /// count seen by their last call before taking the lock.
+  std::atomic_uint64_t ClosedFdCount = 0;
+  std::mutex ClosedFdMutex; ///< Protect ClosedFds and FirstClosedFd
+  /// Numbers of the last closed file descriptors.
+  std::deque<int> ClosedFds;
+  /// Count of the closes before the first one in ClosedFds.
+  uint64_t FirstClosedFd = 0;
 #else
+public:
+  void closed(const INode &) noexcept {}
 #endif
 };
 
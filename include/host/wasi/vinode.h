@@ -813,6 +813,11 @@ public:
   void close(std::shared_ptr<VINode> Node) noexcept {
     Poller::close(Node->Node);
   }
+
+  /// Record the closing of \p Node for the pollers in use of \p Ctx.
+  static void closed(PollerContext &Ctx, const VINode &Node) noexcept {
+    Ctx.closed(Node.Node);
+  }
 };
 
 } // namespace WASI
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "common/errcode.h"
+#include "common/spdlog.h"
 #include "host/wasi/environ.h"
+#include "host/wasi/wasimodule.h"
 #include "runtime/callingframe.h"
 #include "runtime/hostfunc.h"
 
@@ -13,10 +15,42 @@ namespace Host {
 
 template <typename T> class Wasi : public Runtime::HostFunction<T> {
 public:
-  Wasi(WASI::Environ &HostEnv) : Runtime::HostFunction<T>(0), Env(HostEnv) {}
+  Wasi(WASI::Environ &HostEnv)
+      : Runtime::HostFunction<T>(0), BoundEnv(HostEnv) {}
+
+  /// Run the host function. A shared function run without its function
+  /// instance, which only happens when the body is run outside the executor,
+  /// has no environment and fails.
+  Expect<void> run(const Runtime::CallingFrame &Frame,
+                   Span<const ValVariant> Args,
+                   Span<ValVariant> Rets) override {
+    using namespace std::literals;
+    if (unlikely(isShared() && !WasiModule::resolveEnv(Frame))) {
+      spdlog::error("The shared WASI function is not called through the "
+                    "function instance of a WASI module."sv);
+      return Unexpect(ErrCode::Value::HostFuncError);
+    }
+    return Runtime::HostFunction<T>::run(Frame, Args, Rets);
+  }
 
 protected:
-  WASI::Environ &Env;
+  /// Get the environment of this call. The host functions of the shared WASI
+  /// template are bound to the unbound environment, and use the environment
+  /// of the WASI module owning the called function instance instead, which
+  /// run() has checked.
+  WASI::Environ &getEnv(const Runtime::CallingFrame &Frame) const noexcept {
+    if (likely(!isShared())) {
+      return BoundEnv;
+    }
+    return *WasiModule::resolveEnv(Frame);
+  }
+
+private:
+  bool isShared() const noexcept {
+    return &BoundEnv == &WasiModule::unboundEnv();
+  }
+
+  WASI::Environ &BoundEnv;
 };
 
 } // namespace Host
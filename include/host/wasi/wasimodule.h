@@ -4,15 +4,33 @@
 #pragma once
 
 #include "host/wasi/environ.h"
+#include "runtime/callingframe.h"
 #include "runtime/instance/module.h"
 
+#include <memory>
+
 namespace WasmEdge {
 namespace Host {
 
 class WasiModule : public Runtime::Instance::ModuleInstance {
 public:
+  /// Create the WASI module with the host functions bound to its environment.
   WasiModule();
 
+  /// Create the WASI module sharing the host function bodies of the immutable
+  /// WASI template. Only the function instances are allocated, and the shared
+  /// bodies find this environment through the module of the called function
+  /// instance.
+  static std::unique_ptr<WasiModule> createShared();
+
+  /// Get the placeholder environment which marks the host functions of the
+  /// WASI template as shared. It is never initialized nor used by a call.
+  static WASI::Environ &unboundEnv() noexcept;
+
+  /// Get the environment of the WASI module owning the called function
+  /// instance, or nullptr if there is none.
+  static WASI::Environ *resolveEnv(const Runtime::CallingFrame &Frame) noexcept;
+
   __wasi_exitcode_t getExitCode() const noexcept { return Env.getExitCode(); }
 
   void init(Span<const std::string> Dirs, const std::string &ProgramName,
@@ -36,6 +54,8 @@ public:
   const WASI::Environ *getEnv() const noexcept { return &Env; }
 
 private:
+  explicit WasiModule(const Runtime::Instance::ModuleInstance &Template);
+
   WASI::Environ Env;
 };
 
@@ -21,6 +21,8 @@
 #include "llvm/data.h"
 
 #include <mutex>
+#include <string>
+#include <string_view>
 
 namespace WasmEdge::LLVM {
 
@@ -31,8 +33,14 @@ public:
   Expect<void> codegen(Span<const Byte> WasmData, Data D,
                        std::filesystem::path OutputPath) noexcept;
 
+  /// Append the following code as the variant of the CPU target to the
+  /// universal wasm written before, instead of writing a new file. An empty
+  /// name resets to the default.
+  void setTargetCPU(std::string_view Name) noexcept { TargetCPU = Name; }
+
 private:
   const Configure Conf;
+  std::string TargetCPU;
 };
 
 } // namespace WasmEdge::LLVM
@@ -17,10 +17,14 @@
 #include "common/configure.h"
 #include "common/errcode.h"
 #include "common/filesystem.h"
+#include "common/profile.h"
 #include "common/span.h"
 #include "llvm/data.h"
+#include "system/cpu.h"
 
 #include <mutex>
+#include <optional>
+#include <string_view>
 
 namespace WasmEdge::LLVM {
 
@@ -34,6 +38,14 @@ public:
 
   Expect<void> checkConfigure() noexcept;
 
+  /// Set the execution profile for the profile-guided optimization. The
+  /// profile must outlive the compilation.
+  void setProfile(const Profile::Profile *P) noexcept { Prof = P; }
+
+  /// Compile for the CPU target of a code variant instead of the host or
+  /// generic CPU. An empty name resets to the default.
+  Expect<void> setTargetCPU(std::string_view Name) noexcept;
+
   /// Compile the whole module.
   Expect<Data> compile(const AST::Module &Module) noexcept;
 
@@ -72,6 +84,8 @@ private:
   std::mutex Mutex;
   CompileContext *Context;
   const Configure Conf;
+  const Profile::Profile *Prof = nullptr;
+  std::optional<CPU::Target> Target;
 };
 
 } // namespace WasmEdge::LLVM
@@ -19,7 +19,10 @@
 #include "common/executable.h"
 #include "common/span.h"
 #include "llvm/data.h"
+#include "llvm/objcache.h"
+
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace WasmEdge::LLVM {
@@ -56,9 +59,17 @@ private:
 
 class JIT {
 public:
-  JIT(const Configure &Conf) noexcept : Conf(Conf) {}
+  /// The optional object cache stores the machine code objects emitted by
+  /// \c load and \c add, and serves \c loadCached and \c addCached .
+  JIT(const Configure &Conf,
+      std::shared_ptr<const ObjectCache> Cache = {}) noexcept
+      : Conf(Conf), Cache(std::move(Cache)) {}
   Expect<std::shared_ptr<Executable>> load(Data D) noexcept;
 
+  /// Load the cached machine code object of the whole module. Returns
+  /// nullptr on a cache miss.
+  std::shared_ptr<Executable> loadCached() noexcept;
+
   /// Load for lazy JIT. The data is kept alive by the caller so following
   /// batches can reuse its thread-safe context.
   Expect<std::shared_ptr<Executable>> loadLazy(Data &D) noexcept;
@@ -68,10 +79,16 @@ public:
   add(JITLibrary &Lib, Data &D,
       Span<const uint32_t> GlobalFuncIndices) noexcept;
 
+  /// Adds the cached machine code object of a batch of functions and
+  /// resolves their symbols. Returns std::nullopt on a cache miss.
+  std::optional<std::vector<WasmFunctionCodeAddress>>
+  addCached(JITLibrary &Lib, Span<const uint32_t> GlobalFuncIndices) noexcept;
+
 private:
   Expect<std::shared_ptr<Executable>> loadImpl(Data &D, bool IsLazy) noexcept;
 
   const Configure Conf;
+  std::shared_ptr<const ObjectCache> Cache;
 };
 
 } // namespace WasmEdge::LLVM
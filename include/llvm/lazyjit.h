@@ -17,8 +17,10 @@
 
 #include "common/configure.h"
 #include "common/errcode.h"
+#include "common/statistics.h"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace WasmEdge {
@@ -53,9 +55,19 @@ namespace LLVM {
 /// 4. \c unregisterInstance drops the per-instance bindings but keeps the
 ///    module-level JIT state, so re-instantiating the same AST module
 ///    rebinds it and previously compiled functions stay compiled.
+///
+/// In the tiered run mode, \c registerInstance instead starts compiling all
+/// local functions of the module on a background thread, and the instance
+/// keeps running in the interpreter. When the compilation finishes, the tier
+/// up notifier is called from that thread, and the executing thread calls
+/// \c applyTierUp to upgrade the function instances. \c compileOnDemand
+/// never compiles in this mode.
 class LazyJITEngine {
 public:
-  LazyJITEngine(const Configure &Conf) noexcept;
+  /// The JIT cache lookups are counted into \p Stat if given, which must
+  /// outlive the engine.
+  LazyJITEngine(const Configure &Conf,
+                Statistics::Statistics *Stat = nullptr) noexcept;
   ~LazyJITEngine() noexcept;
   LazyJITEngine(const LazyJITEngine &) = delete;
   LazyJITEngine &operator=(const LazyJITEngine &) = delete;
@@ -82,6 +94,16 @@ public:
   Expect<void>
   compileOnDemand(const Runtime::Instance::FunctionInstance *FuncInst);
 
+  /// Set the callback called from the background thread when a compilation
+  /// of the tiered run mode finishes. It must be set before registering the
+  /// instances, and must only request the \c applyTierUp call.
+  void setTierUpNotifier(std::function<void()> Notifier) noexcept;
+
+  /// Upgrade the function instances to the finished background compilations
+  /// of the tiered run mode. The interpreted bodies are kept alive, so the
+  /// interpreter frames still running them return safely.
+  void applyTierUp() noexcept;
+
   /// Get the total number of lazily compiled functions.
   uint32_t compiledFunctionCount() const noexcept;
 
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/llvm/objcache.h - JIT object cache definition ------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines the disk-backed cache of the machine code objects
+/// emitted by the JIT engines.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "ast/module.h"
+#include "common/configure.h"
+#include "common/filesystem.h"
+#include "common/span.h"
+#include "common/statistics.h"
+#include "common/types.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace WasmEdge::LLVM {
+
+/// Lookup counters of the JIT object cache in this process.
+struct JITCacheStatistics {
+  uint64_t Hits = 0;
+  uint64_t Misses = 0;
+};
+
+JITCacheStatistics getJITCacheStatistics() noexcept;
+
+/// Cache of the machine code objects of the JIT engines, stored in the
+/// configured JIT cache directory, or else under the `jit` key of the local
+/// AOT cache.
+///
+/// An entry is keyed by the BLAKE3 hash of the serialized module, the
+/// compiler and statistics configuration, the target CPU name and features,
+/// and for the lazy JIT the function indices of the compiled batch.
+class ObjectCache {
+public:
+  /// Create the cache of the module. The cache is disabled when it is not
+  /// enabled in the configuration, or when the module cannot be serialized
+  /// into its key. The lookups are also counted into \p Stat if given.
+  ObjectCache(const Configure &Conf, const AST::Module &Module,
+              Statistics::Statistics *Stat = nullptr) noexcept;
+
+  bool enabled() const noexcept { return ModuleHash.has_value(); }
+
+  /// Get the path of the object of the \p Kind part of the module, or of the
+  /// batch of functions. Returns an empty path when no cache directory is
+  /// available.
+  std::filesystem::path
+  getPath(std::string_view Kind,
+          Span<const uint32_t> FuncIndices = {}) const noexcept;
+
+  /// Check whether the object exists, and count the lookup as a hit or miss.
+  bool lookup(const std::filesystem::path &Path) const noexcept;
+
+  /// Write the object into the cache. Failures are only logged.
+  void store(const std::filesystem::path &Path,
+             Span<const char> Object) const noexcept;
+
+  /// Remove an object which cannot be loaded.
+  void evict(const std::filesystem::path &Path) const noexcept;
+
+private:
+  std::optional<std::array<Byte, 32>> ModuleHash;
+  std::filesystem::path Dir;
+  Statistics::Statistics *Stat;
+};
+
+} // namespace WasmEdge::LLVM
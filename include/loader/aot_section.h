@@ -59,6 +59,8 @@ public:
     return Result;
   }
 
+  uint64_t getCodeSize() const noexcept override { return BinarySize; }
+
   std::vector<Symbol<void>> getCodes(size_t, size_t) noexcept override {
     std::vector<Symbol<void>> Result;
     if (Binary) {
@@ -8,11 +8,14 @@
 
 #include "common/hexstr.h"
 #include "common/spdlog.h"
+#include "po/option.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -20,6 +23,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <vector>
 
 namespace WasmEdge {
 namespace Host {
@@ -34,13 +38,13 @@ public:
     if (!StdoutLogger) {
       StdoutLogger = spdlog::stdout_color_mt("wasi_logging_stdout"s);
       StdoutLogger->set_level(spdlog::level::trace);
-      StdoutLogger->set_pattern(DefFormat);
+      StdoutLogger->set_pattern(std::string(DefFormat));
     }
     StderrLogger = spdlog::get("wasi_logging_stderr"s);
     if (!StderrLogger) {
       StderrLogger = spdlog::stderr_color_mt("wasi_logging_stderr"s);
       StderrLogger->set_level(spdlog::level::trace);
-      StderrLogger->set_pattern(DefFormat);
+      StderrLogger->set_pattern(std::string(DefFormat));
     }
 
     std::random_device RandDev;
@@ -54,6 +58,11 @@ public:
     } while (RegisteredID.find(InstanceID) != RegisteredID.cend());
     LogRegName = "wasi_logging_file_" + convertUIntToHexStr(InstanceID);
     RegisteredID.insert(InstanceID);
+    Lock.unlock();
+
+    if (AsyncMode.value()) {
+      enableAsync(QueueSize.value(), DropOnFull.value());
+    }
   }
 
   ~LogEnv() noexcept {
@@ -64,6 +73,59 @@ public:
       spdlog::drop(LogRegName);
     }
     RegisteredID.erase(InstanceID);
+    Lock.unlock();
+    // Write out the queued records before the loggers are released.
+    StdoutLogger.reset();
+    StderrLogger.reset();
+    FileLogger.reset();
+    ThreadPool.reset();
+  }
+
+  /// Switch the loggers to the asynchronous mode. The guest thread only
+  /// copies the record into a queue of \p QueueSize records, and a
+  /// background thread formats and writes the records in order. When the
+  /// queue is full, the guest thread waits for the writer, or the oldest
+  /// record is dropped if \p DropOldest is set.
+  void enableAsync(size_t QueueSize, bool DropOldest) {
+    using namespace std::literals;
+    ThreadPool = std::make_shared<spdlog::details::thread_pool>(
+        std::max<size_t>(QueueSize, 1), 1);
+    OverflowPolicy = DropOldest ? spdlog::async_overflow_policy::overrun_oldest
+                                : spdlog::async_overflow_policy::block;
+    // The records share the sinks and the pattern of the synchronous loggers.
+    StdoutLogger =
+        makeAsyncLogger("wasi_logging_stdout"s, StdoutLogger->sinks());
+    StderrLogger =
+        makeAsyncLogger("wasi_logging_stderr"s, StderrLogger->sinks());
+  }
+
+  bool isAsync() const noexcept { return ThreadPool != nullptr; }
+
+  /// Getter of the number of records dropped on a full queue.
+  size_t getDroppedCount() const noexcept {
+    return ThreadPool ? ThreadPool->overrun_counter() : 0;
+  }
+
+  /// Getter of the number of records waiting in the queue.
+  size_t getPendingCount() const noexcept {
+    return ThreadPool ? ThreadPool->queue_size() : 0;
+  }
+
+  /// Open the log file and replace the file logger. Throws spdlog::spdlog_ex
+  /// if the file cannot be opened.
+  void openLogFile(std::string_view Name) {
+    spdlog::drop(LogRegName);
+    if (ThreadPool) {
+      FileLogger = makeAsyncLogger(
+          LogRegName, {std::make_shared<spdlog::sinks::basic_file_sink_mt>(
+                          std::string(Name))});
+      spdlog::register_logger(FileLogger);
+    } else {
+      FileLogger = spdlog::basic_logger_mt(LogRegName, std::string(Name));
+      FileLogger->set_level(spdlog::level::trace);
+      FileLogger->set_pattern(std::string(DefFormat));
+    }
+    setLogFileName(Name);
   }
 
   std::string_view getLogFileName() const noexcept { return LogFileName; }
@@ -77,12 +139,29 @@ public:
 
   static std::mutex Mutex;
   static std::unordered_set<uint64_t> RegisteredID;
-  static const std::string DefFormat;
+  static constexpr std::string_view DefFormat =
+      "[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] %v";
+  static PO::Option<PO::Toggle> AsyncMode;
+  static PO::Option<uint32_t> QueueSize;
+  static PO::Option<PO::Toggle> DropOnFull;
   std::shared_ptr<spdlog::logger> StdoutLogger;
   std::shared_ptr<spdlog::logger> StderrLogger;
   std::shared_ptr<spdlog::logger> FileLogger;
 
 private:
+  std::shared_ptr<spdlog::logger>
+  makeAsyncLogger(std::string Name, std::vector<spdlog::sink_ptr> Sinks) {
+    auto Logger = std::make_shared<spdlog::async_logger>(
+        std::move(Name), Sinks.begin(), Sinks.end(), ThreadPool,
+        OverflowPolicy);
+    Logger->set_level(spdlog::level::trace);
+    Logger->set_pattern(std::string(DefFormat));
+    return Logger;
+  }
+
+  std::shared_ptr<spdlog::details::thread_pool> ThreadPool;
+  spdlog::async_overflow_policy OverflowPolicy =
+      spdlog::async_overflow_policy::block;
   std::string LogFileName;
   std::string LogRegName;
   uint64_t InstanceID;
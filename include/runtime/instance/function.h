@@ -38,7 +38,8 @@ public:
   /// Move constructor.
   FunctionInstance(FunctionInstance &&Inst) noexcept
       : CompositeBase(Inst.ModInst, Inst.TypeIdx),
-        CompiledCode(Inst.CompiledCode), FuncType(Inst.FuncType),
+        CompiledCode(Inst.CompiledCode),
+        CanonicalTypeID(Inst.CanonicalTypeID), FuncType(Inst.FuncType),
         Data(std::move(Inst.Data)) {
     assuming(ModInst);
   }
@@ -63,14 +64,22 @@ public:
   FunctionInstance(const ModuleInstance *Mod, const uint32_t TIdx,
                    std::unique_ptr<HostFunctionBase> &&Func) noexcept
       : CompositeBase(Mod, TIdx), FuncType(Func->getFuncType()),
-        Data(std::in_place_type_t<std::unique_ptr<HostFunctionBase>>(),
+        Data(std::in_place_type_t<std::shared_ptr<HostFunctionBase>>(),
              std::move(Func)) {
     assuming(ModInst);
   }
   FunctionInstance(std::unique_ptr<HostFunctionBase> &&Func) noexcept
       : CompositeBase(), FuncType(Func->getFuncType()),
-        Data(std::in_place_type_t<std::unique_ptr<HostFunctionBase>>(),
+        Data(std::in_place_type_t<std::shared_ptr<HostFunctionBase>>(),
              std::move(Func)) {}
+  /// Constructor for host function sharing its body with other instances.
+  FunctionInstance(const ModuleInstance *Mod, const uint32_t TIdx,
+                   std::shared_ptr<HostFunctionBase> Func) noexcept
+      : CompositeBase(Mod, TIdx), FuncType(Func->getFuncType()),
+        Data(std::in_place_type_t<std::shared_ptr<HostFunctionBase>>(),
+             std::move(Func)) {
+    assuming(ModInst);
+  }
 
   /// Check whether this is a native wasm function.
   bool isWasmFunction() const noexcept {
@@ -84,12 +93,16 @@ public:
 
   /// Check whether this is a host function.
   bool isHostFunction() const noexcept {
-    return std::holds_alternative<std::unique_ptr<HostFunctionBase>>(Data);
+    return std::holds_alternative<std::shared_ptr<HostFunctionBase>>(Data);
   }
 
   /// Getter for function type.
   const AST::FunctionType &getFuncType() const noexcept { return FuncType; }
 
+  /// Getter for the canonical type ID, or 0 if it is not assigned. Functions
+  /// with the same nonzero ID have equivalent types.
+  uint32_t getCanonicalTypeID() const noexcept { return CanonicalTypeID; }
+
   /// Getter for function local variables.
   Span<const std::pair<uint32_t, ValType>> getLocals() const noexcept {
     return std::get_if<WasmFunction>(&Data)->Locals;
@@ -116,7 +129,7 @@ public:
 
   /// Getter for host function.
   HostFunctionBase &getHostFunc() const noexcept {
-    return *std::get_if<std::unique_ptr<HostFunctionBase>>(&Data)->get();
+    return *std::get_if<std::shared_ptr<HostFunctionBase>>(&Data)->get();
   }
 
   /// Field offsets read inline by the AOT/JIT compiler for the call_indirect
@@ -134,6 +147,9 @@ public:
   static constexpr uint64_t getCompiledCodeOffset() noexcept {
     return offsetof(FunctionInstance, CompiledCode);
   }
+  static constexpr uint64_t getCanonicalTypeIDOffset() noexcept {
+    return offsetof(FunctionInstance, CanonicalTypeID);
+  }
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
@@ -150,7 +166,21 @@ public:
     return true;
   }
 
+  /// Upgrade from WasmFunction to CompiledFunction, moving the instructions
+  /// into \p Retired instead of destroying them. Interpreter frames still
+  /// running this function stay valid as long as \p Retired is alive.
+  bool unsafeUpgradeToCompiled(Symbol<CompiledFunction> Sym,
+                               AST::InstrVec &Retired) noexcept {
+    if (!isWasmFunction()) {
+      return false;
+    }
+    Retired = std::move(std::get<WasmFunction>(Data).Instrs);
+    return unsafeUpgradeToCompiled(std::move(Sym));
+  }
+
 private:
+  friend class ModuleInstance;
+
   struct WasmFunction {
     const std::vector<std::pair<uint32_t, ValType>> Locals;
     const uint32_t LocalNum;
@@ -175,9 +205,12 @@ private:
   /// Compiled code pointer, read inline at getCompiledCodeOffset() by the
   /// call_indirect fast path.
   void *CompiledCode = nullptr;
+  /// Canonical type ID, assigned by the module instance when the function is
+  /// added, and read inline by the call_indirect fast path.
+  uint32_t CanonicalTypeID = 0;
   const AST::FunctionType &FuncType;
   std::variant<WasmFunction, Symbol<CompiledFunction>,
-               std::unique_ptr<HostFunctionBase>>
+               std::shared_ptr<HostFunctionBase>>
       Data;
   /// @}
 };
@@ -16,6 +16,7 @@
 #include "ast/component/component.h"
 #include "ast/module.h"
 #include "common/errcode.h"
+#include "common/statistics.h"
 #include "runtime/hostfunc.h"
 #include "runtime/instance/array.h"
 #include "runtime/instance/data.h"
@@ -29,6 +30,7 @@
 #include "runtime/instance/table.h"
 #include "runtime/instance/tag.h"
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <functional>
@@ -48,6 +50,10 @@ namespace Executor {
 class Executor;
 }
 
+namespace VM {
+class Snapshot;
+}
+
 namespace Runtime {
 
 class StoreManager;
@@ -97,6 +103,10 @@ public:
       HostDataFinalizer(HostData);
     }
     releaseProviders();
+    releaseMemoryAccount();
+    if (CanonicalTypeIDsReleaser) {
+      CanonicalTypeIDsReleaser();
+    }
   }
 
   void terminate() noexcept {
@@ -286,10 +296,112 @@ public:
     return std::forward<CallbackT>(CallBack)(ExpGlobals);
   }
 
+  /// Offset of the module context, read inline by the AOT/JIT compiler to
+  /// call a function of another module on the call_indirect fast path.
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+  static constexpr uint64_t getModuleContextOffset() noexcept {
+    return offsetof(ModuleInstance, ModCtx);
+  }
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+  /// Set the account which the memory used by this instance is charged to.
+  /// The account is shared, so it outlives the statistics owning it while
+  /// this instance is alive.
+  void setMemoryAccount(
+      std::shared_ptr<Statistics::MemoryAccount> Account) noexcept {
+    MemAccount = std::move(Account);
+  }
+  const std::shared_ptr<Statistics::MemoryAccount> &
+  getMemoryAccount() const noexcept {
+    return MemAccount;
+  }
+
+  /// Attach the account to a host module instance created without one, and
+  /// charge the memories and tables it owns. An instance already attached
+  /// keeps its account. Return false if the limits are exceeded.
+  bool attachMemoryAccount(
+      std::shared_ptr<Statistics::MemoryAccount> Account) const noexcept {
+    std::unique_lock Lock(Mutex);
+    if (MemAccount || !Account) {
+      return true;
+    }
+    uint64_t MemBytes = 0;
+    for (const auto &MemInst : OwnedMemInsts) {
+      MemBytes += MemInst->getSize();
+    }
+    uint64_t TabBytes = 0;
+    for (const auto &TabInst : OwnedTabInsts) {
+      TabBytes += TabInst->getSize() * sizeof(RefVariant);
+    }
+    if (unlikely(!Account->charge(MemoryCategory::LinearMemory, MemBytes))) {
+      return false;
+    }
+    if (unlikely(!Account->charge(MemoryCategory::Table, TabBytes))) {
+      Account->release(MemoryCategory::LinearMemory, MemBytes);
+      return false;
+    }
+    MemCharged[static_cast<size_t>(MemoryCategory::LinearMemory)].fetch_add(
+        MemBytes, std::memory_order_relaxed);
+    MemCharged[static_cast<size_t>(MemoryCategory::Table)].fetch_add(
+        TabBytes, std::memory_order_relaxed);
+    MemAccount = std::move(Account);
+    return true;
+  }
+
+  /// Charge memory of a category to the memory account, and return false if
+  /// the limits of the account are exceeded. The charged memory is released
+  /// when this instance is destroyed.
+  bool chargeMemory(MemoryCategory Category, uint64_t Bytes) const noexcept {
+    if (MemAccount == nullptr || Bytes == 0) {
+      return true;
+    }
+    if (unlikely(!MemAccount->charge(Category, Bytes))) {
+      return false;
+    }
+    MemCharged[static_cast<size_t>(Category)].fetch_add(
+        Bytes, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// Release memory charged before this instance is destroyed.
+  void releaseMemory(MemoryCategory Category, uint64_t Bytes) const noexcept {
+    if (MemAccount == nullptr || Bytes == 0) {
+      return;
+    }
+    MemCharged[static_cast<size_t>(Category)].fetch_sub(
+        Bytes, std::memory_order_relaxed);
+    MemAccount->release(Category, Bytes);
+  }
+
 protected:
   friend class Executor::Executor;
   friend class ComponentInstance;
   friend class Runtime::CallingFrame;
+  friend class VM::Snapshot;
+
+  /// Add the exported host functions of an immutable template module
+  /// instance. This module instance creates its own function instances, which
+  /// share the host function bodies and the defined types of the template.
+  void shareHostFuncs(const ModuleInstance &Template) {
+    std::unique_lock Lock(Mutex);
+    std::shared_lock TemplateLock(Template.Mutex);
+    assuming(Types.empty() && Template.OwnedTypes.empty() &&
+             Template.isInstantiateFinalized());
+    // The types keep the indices the template assigned to them.
+    Types = Template.Types;
+    for (const auto &[Name, Func] : Template.ExpFuncs) {
+      unsafeAddHostInstance(
+          Name, OwnedFuncInsts, FuncInsts, ExpFuncs,
+          std::make_unique<FunctionInstance>(
+              this, Func->getTypeIndex(),
+              std::get<std::shared_ptr<HostFunctionBase>>(Func->Data)));
+    }
+  }
 
   /// Create and copy the defined type to this module instance.
   void addDefinedType(const AST::SubType &SType) {
@@ -298,11 +410,25 @@ protected:
     Types.push_back(OwnedTypes.back().get());
   }
 
+  /// Set the canonical type IDs of the defined types, and the function to
+  /// release them when this instance is destroyed. Must be called before the
+  /// functions are added.
+  void setCanonicalTypeIDs(std::vector<uint32_t> IDs,
+                           std::function<void()> Releaser) {
+    std::unique_lock Lock(Mutex);
+    CanonicalTypeIDs = std::move(IDs);
+    CanonicalTypeIDsReleaser = std::move(Releaser);
+  }
+
   /// Create and add instances to this module instance.
-  template <typename... Args> void addFunc(Args &&...Values) {
+  template <typename... Args>
+  void addFunc(const uint32_t TypeIdx, Args &&...Values) {
     std::unique_lock Lock(Mutex);
-    unsafeAddInstance(OwnedFuncInsts, FuncInsts, this,
+    unsafeAddInstance(OwnedFuncInsts, FuncInsts, this, TypeIdx,
                       std::forward<Args>(Values)...);
+    if (TypeIdx < CanonicalTypeIDs.size()) {
+      OwnedFuncInsts.back()->CanonicalTypeID = CanonicalTypeIDs[TypeIdx];
+    }
   }
   template <typename... Args> void addTable(Args &&...Values) {
     std::unique_lock Lock(Mutex);
@@ -408,6 +534,12 @@ protected:
   const AST::SubType *unsafeGetType(uint32_t Idx) const noexcept {
     return Types[Idx];
   }
+
+  /// Get the canonical ID of the defined type, or 0 if it is not assigned.
+  uint32_t getCanonicalTypeID(uint32_t Idx) const noexcept {
+    return Idx < CanonicalTypeIDs.size() ? CanonicalTypeIDs[Idx] : 0;
+  }
+
   Expect<FunctionInstance *> getFunc(uint32_t Idx) const noexcept {
     std::shared_lock Lock(Mutex);
     if (Idx >= FuncInsts.size()) {
@@ -602,11 +734,12 @@ protected:
     ValVariant *const *Globals;
     const void *ModuleInst;
     void *const *Tags;
+    const uint32_t *CanonicalTypeIDs;
   };
 
   /// Compiled code reads this struct by field index through the mirrored ModCtx
   /// type built in lib/llvm/compiler/context.cpp. Keep both in the same order.
-  static_assert(sizeof(ModuleContext) == 7 * sizeof(void *));
+  static_assert(sizeof(ModuleContext) == 8 * sizeof(void *));
   static_assert(offsetof(ModuleContext, Memories) == 0 * sizeof(void *));
   static_assert(offsetof(ModuleContext, MemorySizes) == 1 * sizeof(void *));
   static_assert(offsetof(ModuleContext, TableRefs) == 2 * sizeof(void *));
@@ -614,6 +747,8 @@ protected:
   static_assert(offsetof(ModuleContext, Globals) == 4 * sizeof(void *));
   static_assert(offsetof(ModuleContext, ModuleInst) == 5 * sizeof(void *));
   static_assert(offsetof(ModuleContext, Tags) == 6 * sizeof(void *));
+  static_assert(offsetof(ModuleContext, CanonicalTypeIDs) ==
+                7 * sizeof(void *));
 
   ModuleContext ModCtx{};
 
@@ -628,6 +763,7 @@ protected:
     ModCtx.Globals = GlobalPtrs.data();
     ModCtx.ModuleInst = this;
     ModCtx.Tags = reinterpret_cast<void *const *>(TagInsts.data());
+    ModCtx.CanonicalTypeIDs = CanonicalTypeIDs.data();
   }
 
   friend class Runtime::StoreManager;
@@ -683,6 +819,16 @@ protected:
     Provs.clear();
   }
 
+  void releaseMemoryAccount() noexcept {
+    if (MemAccount == nullptr) {
+      return;
+    }
+    for (size_t I = 0; I < MemCharged.size(); ++I) {
+      MemAccount->release(static_cast<MemoryCategory>(I),
+                          MemCharged[I].load(std::memory_order_relaxed));
+    }
+  }
+
   void releaseProviders() noexcept {
     std::unordered_set<ModuleInstance *> ProvidersToRelease;
     takeProviders(ProvidersToRelease);
@@ -710,6 +856,9 @@ protected:
   /// Defined types.
   std::vector<const AST::SubType *> Types;
   std::vector<std::unique_ptr<const AST::SubType>> OwnedTypes;
+  /// Canonical type IDs of the defined types, indexed by the type index.
+  std::vector<uint32_t> CanonicalTypeIDs;
+  std::function<void()> CanonicalTypeIDsReleaser;
 
   /// Owned instances in this module.
   std::vector<std::unique_ptr<FunctionInstance>> OwnedFuncInsts;
@@ -745,6 +894,13 @@ protected:
   /// Start function instance.
   const FunctionInstance *StartFunc = nullptr;
 
+  /// Memory account and the memory charged to it by category. The account
+  /// of a host module instance is attached on its registration.
+  mutable std::shared_ptr<Statistics::MemoryAccount> MemAccount;
+  mutable std::array<std::atomic_uint64_t,
+                     static_cast<size_t>(MemoryCategory::Max)>
+      MemCharged{};
+
   /// Imported WASI module instance during instantiation.
   const ModuleInstance *WASIModInst = nullptr;
 
@@ -16,7 +16,10 @@
 #include "ast/instruction.h"
 #include "runtime/instance/module.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace WasmEdge {
@@ -35,19 +38,31 @@ public:
     Span<const AST::Instruction::CatchDescriptor> CatchClause;
   };
 
+  /// Call frame. The frames are fixed-size and trivially copyable: the
+  /// handlers of all frames share one stack, and a frame only records the
+  /// position where its handlers begin.
   struct Frame {
     Frame() = delete;
     Frame(const Instance::ModuleInstance *Mod, AST::InstrView::iterator FromIt,
-          uint32_t L, uint32_t A, uint32_t V, bool E) noexcept
-        : Module(Mod), From(FromIt), Locals(L), Arity(A), VPos(V),
+          uint32_t L, uint32_t A, uint32_t V, uint32_t H, bool E) noexcept
+        : Module(Mod), From(FromIt), Locals(L), Arity(A), VPos(V), HPos(H),
           NativeEntry(E) {}
     const Instance::ModuleInstance *Module;
     AST::InstrView::iterator From;
     uint32_t Locals;
     uint32_t Arity;
     uint32_t VPos;
+    uint32_t HPos;
     bool NativeEntry;
-    std::vector<Handler> HandlerStack;
+  };
+  static_assert(std::is_trivially_copyable_v<Frame> &&
+                std::is_trivially_destructible_v<Frame>);
+
+  /// Inline cache entry of the call_indirect type check: the callee passed
+  /// the type check of the call site.
+  struct CallIndirectCacheEntry {
+    const AST::Instruction *Instr = nullptr;
+    const Instance::FunctionInstance *Func = nullptr;
   };
 
   /// Stack manager provides the stack control for Wasm execution with VALIDATED
@@ -56,9 +71,18 @@ public:
   StackManager() noexcept {
     ValueStack.reserve(2048U);
     FrameStack.reserve(16U);
+    HandlerStack.reserve(16U);
   }
   ~StackManager() = default;
 
+  /// Getter for the bytes allocated by the stacks.
+  uint64_t getMemorySize() const noexcept {
+    return ValueStack.capacity() * sizeof(Value) +
+           FrameStack.capacity() * sizeof(Frame) +
+           HandlerStack.capacity() * sizeof(Handler) +
+           CallIndirectCache.capacity() * sizeof(CallIndirectCacheEntry);
+  }
+
   /// Getter for stack size.
   size_t size() const noexcept { return ValueStack.size(); }
 
@@ -81,6 +105,12 @@ public:
     ValueStack.push_back(std::forward<T>(Val));
   }
 
+  /// Push N zero values to the stack. A zeroed entry is the zero of every
+  /// number and vector type.
+  void pushZeros(uint32_t N) {
+    ValueStack.insert(ValueStack.end(), N, Value(uint128_t(0U)));
+  }
+
   /// Push a vector of values to the stack.
   void pushValVec(const std::vector<Value> &ValVec) {
     ValueStack.insert(ValueStack.end(), ValVec.begin(), ValVec.end());
@@ -105,6 +135,10 @@ public:
   /// Push a new frame entry to the stack. Set `IsNativeEntry` for the frames
   /// entered from the native code, which the exception handler walk never
   /// crosses; tail calls inherit the flag from the replaced frame.
+  ///
+  /// The arguments on the stack top become the first locals of the frame in
+  /// place. A tail call moves the arguments over the locals of the replaced
+  /// frame instead.
   void pushFrame(const Instance::ModuleInstance *Module,
                  AST::InstrView::iterator From, uint32_t LocalNum = 0,
                  uint32_t Arity = 0, bool IsTailCall = false,
@@ -112,33 +146,30 @@ public:
     if (!IsTailCall) {
       FrameStack.emplace_back(Module, From, LocalNum, Arity,
                               static_cast<uint32_t>(ValueStack.size()),
+                              static_cast<uint32_t>(HandlerStack.size()),
                               IsNativeEntry);
     } else {
       assuming(!FrameStack.empty());
-      assuming(FrameStack.back().VPos >= FrameStack.back().Locals);
-      assuming(FrameStack.back().VPos - FrameStack.back().Locals <=
-               ValueStack.size() - LocalNum);
-      ValueStack.erase(ValueStack.begin() + FrameStack.back().VPos -
-                           FrameStack.back().Locals,
-                       ValueStack.end() - LocalNum);
-      FrameStack.back().Module = Module;
-      FrameStack.back().Locals = LocalNum;
-      FrameStack.back().Arity = Arity;
-      FrameStack.back().VPos = static_cast<uint32_t>(ValueStack.size());
-      FrameStack.back().HandlerStack.clear();
+      auto &Top = FrameStack.back();
+      assuming(Top.VPos >= Top.Locals);
+      moveTopTo(Top.VPos - Top.Locals, LocalNum);
+      truncateHandlers(Top.HPos);
+      Top.Module = Module;
+      Top.Locals = LocalNum;
+      Top.Arity = Arity;
+      Top.VPos = static_cast<uint32_t>(ValueStack.size());
     }
   }
 
-  /// Unsafe pop top frame.
+  /// Unsafe pop top frame. Only the returned values are moved over the
+  /// locals of the frame.
   AST::InstrView::iterator popFrame() noexcept {
     assuming(!FrameStack.empty());
-    assuming(FrameStack.back().VPos >= FrameStack.back().Locals);
-    assuming(FrameStack.back().VPos - FrameStack.back().Locals <=
-             ValueStack.size() - FrameStack.back().Arity);
-    ValueStack.erase(ValueStack.begin() + FrameStack.back().VPos -
-                         FrameStack.back().Locals,
-                     ValueStack.end() - FrameStack.back().Arity);
-    auto From = FrameStack.back().From;
+    const auto &Top = FrameStack.back();
+    assuming(Top.VPos >= Top.Locals);
+    moveTopTo(Top.VPos - Top.Locals, Top.Arity);
+    truncateHandlers(Top.HPos);
+    auto From = Top.From;
     FrameStack.pop_back();
     return From;
   }
@@ -156,7 +187,7 @@ public:
   pushHandler(AST::InstrView::iterator TryIt, uint32_t BlockParamNum,
               Span<const AST::Instruction::CatchDescriptor> Catch) noexcept {
     assuming(!FrameStack.empty());
-    FrameStack.back().HandlerStack.emplace_back(
+    HandlerStack.emplace_back(
         TryIt, static_cast<uint32_t>(ValueStack.size()) - BlockParamNum, Catch);
   }
 
@@ -165,9 +196,9 @@ public:
   std::optional<Handler> popTopHandler(uint32_t AssocValSize) noexcept {
     while (!FrameStack.empty()) {
       auto &Frame = FrameStack.back();
-      if (!Frame.HandlerStack.empty()) {
-        auto TopHandler = std::move(Frame.HandlerStack.back());
-        Frame.HandlerStack.pop_back();
+      if (HandlerStack.size() > Frame.HPos) {
+        auto TopHandler = std::move(HandlerStack.back());
+        HandlerStack.pop_back();
         assuming(TopHandler.VPos <= ValueStack.size() - AssocValSize);
         ValueStack.erase(ValueStack.begin() + TopHandler.VPos,
                          ValueStack.end() - AssocValSize);
@@ -188,8 +219,8 @@ public:
     // inactive handlers are still on top: a handler buried under a later
     // try_table is indistinguishable from an active one here, so branchToLabel
     // cleans up before any new handler can be pushed over the stale ones.
-    auto &HandlerStack = FrameStack.back().HandlerStack;
-    while (!HandlerStack.empty()) {
+    const uint32_t HPos = FrameStack.back().HPos;
+    while (HandlerStack.size() > HPos) {
       auto &Handler = HandlerStack.back();
       if (PC < Handler.Try ||
           PC > Handler.Try + Handler.Try->getTryCatch().JumpEnd) {
@@ -218,7 +249,7 @@ public:
       return popFrame();
     }
     if (PC->isTryBlockLast()) {
-      FrameStack.back().HandlerStack.pop_back();
+      HandlerStack.pop_back();
     }
     return PC;
   }
@@ -231,17 +262,58 @@ public:
     return FrameStack.back().Module;
   }
 
+  /// Getter of the call_indirect inline cache entry of the call site and the
+  /// callee. Different callees of a call site use different entries, so the
+  /// polymorphic call sites are also cached. The cache lives as long as this
+  /// stack manager, during which the module instances in the frames are kept.
+  CallIndirectCacheEntry &
+  getCallIndirectCache(const AST::Instruction *Instr,
+                       const Instance::FunctionInstance *Func) {
+    if (unlikely(CallIndirectCache.empty())) {
+      CallIndirectCache.resize(UINT32_C(1) << kCallIndirectCacheBits);
+    }
+    const uint64_t Key =
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Instr)) ^
+         (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Func)) >> 4)) *
+        UINT64_C(0x9e3779b97f4a7c15);
+    return CallIndirectCache[Key >> (64 - kCallIndirectCacheBits)];
+  }
+
   /// Reset stack.
   void reset() noexcept {
     ValueStack.clear();
     FrameStack.clear();
+    HandlerStack.clear();
+    CallIndirectCache.clear();
   }
 
 private:
+  /// Move the top N values down to the position Pos and drop the values
+  /// between.
+  void moveTopTo(uint32_t Pos, uint32_t N) noexcept {
+    assuming(Pos <= ValueStack.size() - N);
+    const auto Dst = ValueStack.begin() + Pos;
+    const auto Src = ValueStack.end() - N;
+    if (Dst != Src) {
+      std::copy(Src, ValueStack.end(), Dst);
+      ValueStack.erase(Dst + N, ValueStack.end());
+    }
+  }
+
+  /// Drop the handlers from the position Pos.
+  void truncateHandlers(uint32_t Pos) noexcept {
+    assuming(Pos <= HandlerStack.size());
+    HandlerStack.erase(HandlerStack.begin() + Pos, HandlerStack.end());
+  }
+
+  static inline constexpr const uint32_t kCallIndirectCacheBits = 7;
+
   /// \name Data of the stack manager.
   /// @{
   std::vector<Value> ValueStack;
   std::vector<Frame> FrameStack;
+  std::vector<Handler> HandlerStack;
+  std::vector<CallIndirectCacheEntry> CallIndirectCache;
   /// @}
 };
 
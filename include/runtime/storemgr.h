@@ -70,6 +70,15 @@ public:
         Name, [](const Instance::ModuleInstance *Found) { return Found; });
   }
 
+  /// Run Callback with the generation of the registered modules while holding
+  /// the shared lock. The generation changes when a module is unregistered, so
+  /// the module instances found under the same generation are still alive.
+  template <typename CallbackT>
+  auto withGenerationLocked(CallbackT &&Callback) const {
+    std::shared_lock Lock(Mutex);
+    return std::forward<CallbackT>(Callback)(Generation);
+  }
+
   /// Find component by name.
   const Instance::ComponentInstance *
   findComponent(std::string_view Name) const {
@@ -88,6 +97,7 @@ public:
           ->unlinkStore(this, Name);
     }
     NamedMod.clear();
+    ++Generation;
     NamedComp.clear();
   }
 
@@ -114,6 +124,7 @@ public:
                       // store.
                       std::unique_lock CallbackLock(Key.first->Mutex);
                       (Key.first->NamedMod).erase(Key.second);
+                      ++(Key.first->Generation);
                     });
     return {};
   }
@@ -128,6 +139,7 @@ public:
     (const_cast<Instance::ModuleInstance *>(Iter->second))
         ->unlinkStore(this, Name);
     NamedMod.erase(Iter);
+    ++Generation;
     return {};
   }
 
@@ -161,6 +173,8 @@ private:
 
   /// \name Module name mapping.
   std::map<std::string, const Instance::ModuleInstance *, std::less<>> NamedMod;
+  /// \name Generation of the module name mapping, increased on removal.
+  uint64_t Generation = 0;
   /// \name Component name mapping.
   std::map<std::string, const Instance::ComponentInstance *, std::less<>>
       NamedComp;
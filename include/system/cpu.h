@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/system/cpu.h - CPU feature detection ---------------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the CPU targets of the multi-ISA AOT code variants and
+/// their detection on the running host.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/span.h"
+
+#include <optional>
+#include <string_view>
+
+namespace WasmEdge {
+
+class CPU {
+public:
+  /// CPU target of an AOT code variant.
+  struct Target {
+    /// LLVM CPU name, also used in the custom section name of the variant.
+    std::string_view Name;
+    /// LLVM subtarget features implied by the CPU.
+    std::string_view Features;
+  };
+
+  /// Known targets of the host architecture, ordered from the least to the
+  /// most capable.
+  static Span<const Target> targets() noexcept;
+
+  /// Find the known target of the CPU name.
+  static std::optional<Target> find(std::string_view Name) noexcept;
+
+  /// Check whether the running CPU can execute code compiled for the target.
+  static bool supports(std::string_view Name) noexcept;
+};
+
+} // namespace WasmEdge
@@ -28,6 +28,10 @@ public:
 
   [[noreturn]] static void emitFault(ErrCode Error);
 
+  /// Detach the fault handlers of the calling thread and attach the given
+  /// ones instead, for executions which switch stacks between threads.
+  static Fault *swapHandlers(Fault *Handlers) noexcept;
+
   std::jmp_buf &buffer() noexcept { return Buffer; }
 
   Span<void *const> stacktrace() const noexcept {
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/system/fiber.h - Stackful coroutines ---------------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the fiber, an execution stack which can be suspended
+/// and later resumed.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace WasmEdge {
+
+class Fiber {
+public:
+  /// Default stack size. The stack is reserved but only committed on use.
+  static inline constexpr size_t kDefaultStackSize = size_t(8) << 20;
+
+  /// Create a fiber running the entry function on its own stack. The entry
+  /// function must not throw.
+  Fiber(std::function<void()> Entry,
+        size_t StackSize = kDefaultStackSize) noexcept;
+  ~Fiber() noexcept;
+  Fiber(const Fiber &) = delete;
+  Fiber &operator=(const Fiber &) = delete;
+
+  /// Check whether fibers are supported on this platform and the stack was
+  /// allocated.
+  bool valid() const noexcept;
+
+  /// Check whether the entry function has returned.
+  bool finished() const noexcept;
+
+  /// Switch to the fiber, and return when it suspends or finishes. The code
+  /// running on the fiber must not rely on its thread-local storage if the
+  /// fiber is resumed on another thread.
+  void resume() noexcept;
+
+  /// Switch from the running fiber back to the caller of its resume().
+  static void suspend() noexcept;
+
+  /// Get the fiber running on the calling thread, or nullptr.
+  static Fiber *current() noexcept;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> Data;
+};
+
+} // namespace WasmEdge
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/system/perfcounter.h - Hardware performance counters -----===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the reader of the hardware performance counters of the
+/// calling thread.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/statistics.h"
+
+namespace WasmEdge {
+
+class PerfCounter {
+public:
+  /// Read the hardware performance counters of the calling thread.
+  ///
+  /// The counters are opened through the Linux perf_event interface on the
+  /// first read in each thread, and count the user mode of that thread only.
+  /// Counters which cannot be opened read as zero. Returns false when no
+  /// counter is available, such as on other platforms.
+  static bool read(Statistics::HardwareCounterValues &Values) noexcept;
+};
+
+} // namespace WasmEdge
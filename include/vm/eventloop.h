@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/vm/eventloop.h - Event loop of suspendable executions ----===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of the event loop multiplexing the
+/// executions suspended in asynchronous host functions on one thread.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/errcode.h"
+#include "common/span.h"
+#include "common/types.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace WasmEdge {
+namespace VM {
+
+class VM;
+
+/// Event loop running many executions on the thread calling run().
+///
+/// Every execution runs on its own stack. When a host function awaits an
+/// operation through Executor::awaitHost(), the execution is suspended, the
+/// loop runs the other ready executions, and the execution is resumed on the
+/// loop thread when the operation completes. So one thread serves many
+/// executions waiting for I/O, without a thread per call.
+///
+/// The executions of the same VM interleave at the awaits. The VM must not be
+/// modified, and must not be executed outside the loop, while its executions
+/// are pending. On platforms without the fibers, the host functions block the
+/// loop thread instead.
+class EventLoop {
+public:
+  using Result = Expect<std::vector<std::pair<ValVariant, ValType>>>;
+
+  EventLoop();
+  /// Interrupt and drain the pending executions.
+  ~EventLoop() noexcept;
+  EventLoop(const EventLoop &) = delete;
+  EventLoop &operator=(const EventLoop &) = delete;
+
+  /// Spawn the execution of a function exported by the active module of the
+  /// VM. This function is thread-safe, and the execution starts in run().
+  std::future<Result> spawn(VM &TargetVM, std::string_view Func,
+                            Span<const ValVariant> Params = {},
+                            Span<const ValType> ParamTypes = {});
+
+  /// Run the executions on the calling thread until all of them complete.
+  void run();
+
+  /// Get the number of the executions not completed yet.
+  size_t getPendingCount() const;
+
+private:
+  struct Task;
+
+  /// Resume or start the task, and handle its completion or its await.
+  void step(Task &T);
+
+  mutable std::mutex Mutex;
+  std::condition_variable CV;
+  /// Tasks spawned and not completed.
+  std::unordered_map<Task *, std::unique_ptr<Task>> Tasks;
+  /// Tasks ready to start or resume.
+  std::deque<Task *> Ready;
+};
+
+} // namespace VM
+} // namespace WasmEdge
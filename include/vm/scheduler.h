@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/vm/scheduler.h - Multi-tenant execution scheduler --------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of the scheduler running the executions
+/// of many VMs in time slices on a pool of worker threads.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/errcode.h"
+#include "common/span.h"
+#include "common/types.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace WasmEdge {
+namespace VM {
+
+class VM;
+
+/// Cooperative scheduler of the executions of many VMs.
+///
+/// Executions are submitted as tasks of tenants. Every task runs on its own
+/// stack, and the running task is asked to yield through the interruption
+/// mechanism of its executor when its time slice expires, so the task parks
+/// at its next interruption check in the interpreter, or in the compiled code
+/// built with the interruptible option, and is resumed later. The worker
+/// threads pick the tenant with the least run time weighted by its shares, so
+/// the tenants get the workers in proportion to their shares.
+///
+/// The tasks of a tenant run one at a time in the submission order, and a VM
+/// must only be used by one tenant and not be modified while its tasks are
+/// pending. A started task is always resumed on the worker thread it started
+/// on, while a task not started yet is taken by any idle worker. Host
+/// functions and the compiled code without the interruptible option cannot
+/// yield, and run to the next interruption check.
+class Scheduler {
+public:
+  using Result = Expect<std::vector<std::pair<ValVariant, ValType>>>;
+
+  /// Default shares of a tenant.
+  static inline constexpr uint32_t kDefaultShares = 1024;
+
+  /// Scheduling statistics of a tenant.
+  struct TenantStatistics {
+    /// Number of the submitted and the completed tasks.
+    uint64_t Submitted = 0;
+    uint64_t Completed = 0;
+    /// Number of the time slices run, and the slices ended by a yield.
+    uint64_t Slices = 0;
+    uint64_t Yields = 0;
+    /// Time the tasks ran on the workers.
+    std::chrono::nanoseconds RunTime{0};
+    /// Total and maximum time the tasks waited for a worker when ready.
+    std::chrono::nanoseconds QueueTime{0};
+    std::chrono::nanoseconds MaxQueueTime{0};
+  };
+
+  /// Create the scheduler with the number of workers, 0 for the number of
+  /// CPUs, and the time slice.
+  Scheduler(uint32_t WorkerCount = 0,
+            std::chrono::microseconds Slice = std::chrono::milliseconds(10));
+  /// Interrupt the pending tasks, and wait for the workers to exit.
+  ~Scheduler() noexcept;
+  Scheduler(const Scheduler &) = delete;
+  Scheduler &operator=(const Scheduler &) = delete;
+
+  /// Add a tenant with the shares, and return its ID.
+  uint32_t addTenant(uint32_t Shares = kDefaultShares);
+
+  /// Change the shares of a tenant.
+  void setShares(uint32_t Tenant, uint32_t Shares);
+
+  /// Park a tenant: its running task yields, and its tasks are not scheduled
+  /// until the tenant is unparked.
+  void park(uint32_t Tenant);
+  void unpark(uint32_t Tenant);
+
+  /// Submit the execution of a function exported by the active module of the
+  /// VM as a task of the tenant.
+  std::future<Result> submit(uint32_t Tenant, VM &TargetVM,
+                             std::string_view Func,
+                             Span<const ValVariant> Params = {},
+                             Span<const ValType> ParamTypes = {});
+
+  /// Get the scheduling statistics of a tenant.
+  TenantStatistics getStatistics(uint32_t Tenant) const;
+
+private:
+  struct Task;
+  struct Tenant;
+
+  /// Main loop of the worker threads.
+  void runWorker(uint32_t Index);
+  /// Main loop of the thread requesting the expired slices to yield.
+  void runTicker();
+  /// Pick the runnable tenant with the least virtual runtime for the worker,
+  /// or nullptr. Called under the lock.
+  Tenant *pickTenant(uint32_t Worker);
+  /// Put the tenant into the ready queue if it has a runnable task. Called
+  /// under the lock.
+  void enqueue(Tenant &T);
+
+  const std::chrono::microseconds Slice;
+  mutable std::mutex Mutex;
+  std::condition_variable WorkerCV;
+  std::condition_variable TickerCV;
+  std::vector<std::unique_ptr<Tenant>> Tenants;
+  /// Ready tenants ordered by their virtual runtime.
+  std::set<std::pair<uint64_t, uint32_t>> Ready;
+  /// Virtual runtime of the last picked tenant. Tenants becoming ready start
+  /// from it, so an idle tenant does not get a burst of the workers.
+  uint64_t MinVRuntime = 0;
+  /// Tenant running on each worker, or nullptr.
+  std::vector<Tenant *> Running;
+  bool Stopping = false;
+  std::vector<std::thread> Workers;
+  std::thread Ticker;
+};
+
+} // namespace VM
+} // namespace WasmEdge
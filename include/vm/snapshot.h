@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+//===-- wasmedge/vm/snapshot.h - Module instance snapshot -----------------===//
+//
+// Part of the WasmEdge Project.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of the snapshot of an instantiated
+/// module state.
+///
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common/errcode.h"
+#include "common/filesystem.h"
+#include "runtime/instance/module.h"
+
+namespace WasmEdge {
+namespace VM {
+
+/// Snapshot of the mutable state of an instantiated module.
+///
+/// A snapshot holds the linear memories, the tables, and the mutable globals
+/// in the index space of a module instance, so that a new instance of the
+/// same module can continue from that state instead of running its
+/// initialization again. Code is not part of the snapshot: the restored
+/// instance keeps the functions of the module it was instantiated from,
+/// including the AOT or JIT code, and the module layout is checked against a
+/// fingerprint on restore. Function references are stored as function
+/// indices. Other references, such as GC objects, exceptions, and external
+/// references, cannot be stored.
+///
+/// Memory contents are stored page aligned, so on POSIX hosts they are mapped
+/// copy-on-write from the file and only the touched pages are read. Shared
+/// memories are copied instead.
+class Snapshot {
+public:
+  /// Write the state of the module instance into the file.
+  static Expect<void> save(const Runtime::Instance::ModuleInstance &ModInst,
+                           const std::filesystem::path &Path) noexcept;
+
+  /// Restore the state of the module instance from the file. The file is
+  /// checked completely before the instance is changed, so a truncated or
+  /// malformed snapshot leaves the instance as it was.
+  static Expect<void> restore(Runtime::Instance::ModuleInstance &ModInst,
+                              const std::filesystem::path &Path) noexcept;
+
+private:
+  /// Hash of the module index space layout. A snapshot can only be restored
+  /// onto an instance with the same layout.
+  static uint64_t
+  fingerprint(const Runtime::Instance::ModuleInstance &ModInst) noexcept;
+
+  /// Check that a restored reference fits a table or global of type \p Exp
+  /// of the module instance.
+  static bool matchRef(const Runtime::Instance::ModuleInstance &ModInst,
+                       const ValType &Exp, const RefVariant &Ref) noexcept;
+};
+
+} // namespace VM
+} // namespace WasmEdge
@@ -51,6 +51,13 @@ public:
   VM(const Configure &Conf);
   VM(const Configure &Conf, Runtime::StoreManager &S);
   ~VM() {
+#ifdef WASMEDGE_USE_LLVM
+    // Join the background compilations of the tiered run mode, whose
+    // notifier references the executor.
+    if (LazyEngine) {
+      LazyEngine->clear();
+    }
+#endif
     if (ActiveModInst) {
       auto *RawMod = ActiveModInst.release();
       if (RawMod) {
@@ -248,6 +255,19 @@ public:
                         Span<const ComponentValVariant> Params = {},
                         Span<const ComponentValType> ParamTypes = {});
 
+  /// Save the state of the instantiated module into a snapshot file.
+  Expect<void> saveSnapshot(const std::filesystem::path &Path) const {
+    std::shared_lock Lock(Mutex);
+    return unsafeSaveSnapshot(Path);
+  }
+
+  /// Restore the state of the instantiated module from a snapshot file taken
+  /// from the same module.
+  Expect<void> restoreSnapshot(const std::filesystem::path &Path) {
+    std::unique_lock Lock(Mutex);
+    return unsafeRestoreSnapshot(Path);
+  }
+
   /// Stop execution
   void stop() noexcept { ExecutorEngine.stop(); }
 
@@ -375,6 +395,9 @@ private:
   /// back to the interpreter; without LLVM support this only logs a warning.
   Expect<void> unsafeLoadJITExecutable();
 
+  Expect<void> unsafeSaveSnapshot(const std::filesystem::path &Path) const;
+  Expect<void> unsafeRestoreSnapshot(const std::filesystem::path &Path);
+
   Expect<std::vector<std::pair<ValVariant, ValType>>>
   unsafeExecute(std::string_view Func, Span<const ValVariant> Params = {},
                 Span<const ValType> ParamTypes = {});
@@ -455,8 +478,8 @@ private:
   Loader::Loader LoaderEngine;
   Validator::Validator ValidatorEngine;
 #ifdef WASMEDGE_USE_LLVM
-  /// Lazy JIT engine. Created only when the run mode is LazyJIT. Declared
-  /// before the executor so it outlives the executor-registered lazy
+  /// Lazy JIT engine. Created only when the run mode is LazyJIT or Tiered.
+  /// Declared before the executor so it outlives the executor-registered lazy
   /// compilation callback that references it.
   std::unique_ptr<LLVM::LazyJITEngine> LazyEngine;
 #endif
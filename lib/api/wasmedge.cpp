@@ -90,6 +90,9 @@ struct WasmEdge_ValidatorContext {};
 // WasmEdge_ExecutorContext implementation.
 struct WasmEdge_ExecutorContext {};
 
+// WasmEdge_InstancePreContext implementation.
+struct WasmEdge_InstancePreContext {};
+
 // WasmEdge_StoreContext implementation.
 struct WasmEdge_StoreContext {};
 
@@ -374,6 +377,7 @@ CONVTO(Store, Runtime::StoreManager, Store, )
 CONVTO(Loader, Loader::Loader, Loader, )
 CONVTO(Validator, Validator::Validator, Validator, )
 CONVTO(Executor, Executor::Executor, Executor, )
+CONVTO(InstPre, Executor::InstancePre, InstancePre, )
 CONVTO(Mod, Runtime::Instance::ModuleInstance, ModuleInstance, )
 CONVTO(Mod, Runtime::Instance::ModuleInstance, ModuleInstance, const)
 CONVTO(Func, Runtime::Instance::FunctionInstance, FunctionInstance, )
@@ -413,6 +417,8 @@ CONVFROM(Store, Runtime::StoreManager, Store, const)
 CONVFROM(Loader, Loader::Loader, Loader, )
 CONVFROM(Validator, Validator::Validator, Validator, )
 CONVFROM(Executor, Executor::Executor, Executor, )
+CONVFROM(InstPre, Executor::InstancePre, InstancePre, )
+CONVFROM(InstPre, Executor::InstancePre, InstancePre, const)
 CONVFROM(Mod, Runtime::Instance::ModuleInstance, ModuleInstance, )
 CONVFROM(Mod, Runtime::Instance::ModuleInstance, ModuleInstance, const)
 CONVFROM(Func, Runtime::Instance::FunctionInstance, FunctionInstance, )
@@ -1032,6 +1038,33 @@ WasmEdge_ConfigureIsAllowAFUNIX(const WasmEdge_ConfigureContext *Cxt) noexcept {
   return false;
 }
 
+WASMEDGE_CAPI_EXPORT void
+WasmEdge_ConfigureSetEnableJITCache(WasmEdge_ConfigureContext *Cxt,
+                                    const bool EnableJITCache) noexcept {
+  if (Cxt) {
+    Cxt->Conf.getRuntimeConfigure().setEnableJITCache(EnableJITCache);
+  }
+}
+
+WASMEDGE_CAPI_EXPORT bool WasmEdge_ConfigureIsEnableJITCache(
+    const WasmEdge_ConfigureContext *Cxt) noexcept {
+  if (Cxt) {
+    return Cxt->Conf.getRuntimeConfigure().isEnableJITCache();
+  }
+  return false;
+}
+
+WASMEDGE_CAPI_EXPORT WasmEdge_Result
+WasmEdge_ConfigureSetJITCacheDir(WasmEdge_ConfigureContext *Cxt,
+                                 const char *Path) noexcept {
+  return wrap(
+      [&]() {
+        return Cxt->Conf.getRuntimeConfigure().setJITCacheDir(
+            Path ? std::filesystem::u8path(Path) : std::filesystem::path());
+      },
+      EmptyThen, Cxt);
+}
+
 WASMEDGE_CAPI_EXPORT bool WasmEdge_ConfigureIsForceInterpreter(
     const WasmEdge_ConfigureContext *Cxt) noexcept {
   if (Cxt) {
@@ -1173,6 +1206,21 @@ WASMEDGE_CAPI_EXPORT bool WasmEdge_ConfigureStatisticsIsTimeMeasuring(
   return false;
 }
 
+WASMEDGE_CAPI_EXPORT void WasmEdge_ConfigureStatisticsSetHardwareCounting(
+    WasmEdge_ConfigureContext *Cxt, const bool IsCount) noexcept {
+  if (Cxt) {
+    Cxt->Conf.getStatisticsConfigure().setHardwareCounting(IsCount);
+  }
+}
+
+WASMEDGE_CAPI_EXPORT bool WasmEdge_ConfigureStatisticsIsHardwareCounting(
+    const WasmEdge_ConfigureContext *Cxt) noexcept {
+  if (Cxt) {
+    return Cxt->Conf.getStatisticsConfigure().isHardwareCounting();
+  }
+  return false;
+}
+
 WASMEDGE_CAPI_EXPORT void
 WasmEdge_ConfigureDelete(WasmEdge_ConfigureContext *Cxt) noexcept {
   delete Cxt;
@@ -1216,6 +1264,53 @@ WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetTotalCost(
   return 0;
 }
 
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetCountedInvocations(
+    const WasmEdge_StatisticsContext *Cxt) noexcept {
+  if (Cxt) {
+    return fromStatCxt(Cxt)->getCountedInvocations();
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetWasmHardwareCounter(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_HardwareCounter Counter) noexcept {
+  if (Cxt && static_cast<uint32_t>(Counter) <
+                 static_cast<uint32_t>(WasmEdge::HardwareCounter::Max)) {
+    return fromStatCxt(Cxt)->getWasmCounters()[Counter];
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetHostFuncHardwareCounter(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_HardwareCounter Counter) noexcept {
+  if (Cxt && static_cast<uint32_t>(Counter) <
+                 static_cast<uint32_t>(WasmEdge::HardwareCounter::Max)) {
+    return fromStatCxt(Cxt)->getHostFuncCounters()[Counter];
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t
+WasmEdge_StatisticsGetHostFuncHardwareCounterByName(
+    const WasmEdge_StatisticsContext *Cxt, const WasmEdge_String Name,
+    const enum WasmEdge_HardwareCounter Counter) noexcept {
+  if (Cxt && static_cast<uint32_t>(Counter) <
+                 static_cast<uint32_t>(WasmEdge::HardwareCounter::Max)) {
+    try {
+      for (const auto &Record : fromStatCxt(Cxt)->getHostFuncCounterRecords()) {
+        if (Record.Name == genStrView(Name)) {
+          return Record.Values[Counter];
+        }
+      }
+    } catch (...) {
+      handleCAPIError();
+    }
+  }
+  return 0;
+}
+
 WASMEDGE_CAPI_EXPORT void
 WasmEdge_StatisticsSetCostTable(WasmEdge_StatisticsContext *Cxt,
                                 uint64_t *CostArr,
@@ -1233,6 +1328,79 @@ WasmEdge_StatisticsSetCostLimit(WasmEdge_StatisticsContext *Cxt,
   }
 }
 
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetMemoryUsage(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category) noexcept {
+  if (Cxt && static_cast<uint32_t>(Category) <
+                 static_cast<uint32_t>(WasmEdge::MemoryCategory::Max)) {
+    return fromStatCxt(Cxt)->getMemoryUsage(
+        static_cast<WasmEdge::MemoryCategory>(Category));
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetMemoryPeak(
+    const WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category) noexcept {
+  if (Cxt && static_cast<uint32_t>(Category) <
+                 static_cast<uint32_t>(WasmEdge::MemoryCategory::Max)) {
+    return fromStatCxt(Cxt)->getMemoryPeak(
+        static_cast<WasmEdge::MemoryCategory>(Category));
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetTotalMemoryUsage(
+    const WasmEdge_StatisticsContext *Cxt) noexcept {
+  if (Cxt) {
+    return fromStatCxt(Cxt)->getTotalMemoryUsage();
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetTotalMemoryPeak(
+    const WasmEdge_StatisticsContext *Cxt) noexcept {
+  if (Cxt) {
+    return fromStatCxt(Cxt)->getTotalMemoryPeak();
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetJITCacheHits(
+    const WasmEdge_StatisticsContext *Cxt) noexcept {
+  if (Cxt) {
+    return fromStatCxt(Cxt)->getJITCacheHits();
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT uint64_t WasmEdge_StatisticsGetJITCacheMisses(
+    const WasmEdge_StatisticsContext *Cxt) noexcept {
+  if (Cxt) {
+    return fromStatCxt(Cxt)->getJITCacheMisses();
+  }
+  return 0;
+}
+
+WASMEDGE_CAPI_EXPORT void
+WasmEdge_StatisticsSetMemoryLimit(WasmEdge_StatisticsContext *Cxt,
+                                  const uint64_t Limit) noexcept {
+  if (Cxt) {
+    fromStatCxt(Cxt)->setMemoryLimit(Limit);
+  }
+}
+
+WASMEDGE_CAPI_EXPORT void WasmEdge_StatisticsSetCategoryMemoryLimit(
+    WasmEdge_StatisticsContext *Cxt,
+    const enum WasmEdge_MemoryCategory Category,
+    const uint64_t Limit) noexcept {
+  if (Cxt && static_cast<uint32_t>(Category) <
+                 static_cast<uint32_t>(WasmEdge::MemoryCategory::Max)) {
+    fromStatCxt(Cxt)->setMemoryLimit(
+        static_cast<WasmEdge::MemoryCategory>(Category), Limit);
+  }
+}
+
 WASMEDGE_CAPI_EXPORT void
 WasmEdge_StatisticsClear(WasmEdge_StatisticsContext *Cxt) noexcept {
   if (Cxt) {
@@ -2155,6 +2323,37 @@ WASMEDGE_CAPI_EXPORT WasmEdge_Result WasmEdge_ExecutorRegister(
       ModuleCxt, StoreCxt, ASTCxt);
 }
 
+WASMEDGE_CAPI_EXPORT WasmEdge_Result WasmEdge_ExecutorCreateInstancePre(
+    WasmEdge_ExecutorContext *Cxt, WasmEdge_InstancePreContext **PreCxt,
+    WasmEdge_StoreContext *StoreCxt,
+    const WasmEdge_ASTModuleContext *ASTCxt) noexcept {
+  return wrap(
+      [&]() {
+        return fromExecutorCxt(Cxt)->createInstancePre(*fromStoreCxt(StoreCxt),
+                                                       *fromASTModCxt(ASTCxt));
+      },
+      [&](auto &&Res) { *PreCxt = toInstPreCxt((*Res).release()); }, Cxt,
+      PreCxt, StoreCxt, ASTCxt);
+}
+
+WASMEDGE_CAPI_EXPORT WasmEdge_Result WasmEdge_ExecutorInstantiatePre(
+    WasmEdge_ExecutorContext *Cxt, WasmEdge_ModuleInstanceContext **ModuleCxt,
+    WasmEdge_StoreContext *StoreCxt,
+    const WasmEdge_InstancePreContext *PreCxt) noexcept {
+  return wrap(
+      [&]() {
+        return fromExecutorCxt(Cxt)->instantiateModule(*fromStoreCxt(StoreCxt),
+                                                       *fromInstPreCxt(PreCxt));
+      },
+      [&](auto &&Res) { *ModuleCxt = toModCxt((*Res).release()); }, Cxt,
+      ModuleCxt, StoreCxt, PreCxt);
+}
+
+WASMEDGE_CAPI_EXPORT void
+WasmEdge_InstancePreDelete(WasmEdge_InstancePreContext *Cxt) noexcept {
+  delete fromInstPreCxt(Cxt);
+}
+
 WASMEDGE_CAPI_EXPORT WasmEdge_Result WasmEdge_ExecutorRegisterImport(
     WasmEdge_ExecutorContext *Cxt, WasmEdge_StoreContext *StoreCxt,
     const WasmEdge_ModuleInstanceContext *ImportCxt) noexcept {
@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/profile.h"
+#include "common/hash.h"
+#include "common/spdlog.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace Profile {
+
+namespace {
+// The profile is a text file:
+//   wasmedge-profile 2
+//   module <hash>
+//   call <offset> <count>
+//   branch <offset> <taken> <not taken>
+//   indirect <offset> <other count> <target count> (<target> <count>)...
+constexpr const std::string_view kMagic = "wasmedge-profile"sv;
+constexpr const uint32_t kVersion = 2;
+} // namespace
+
+uint64_t Profile::hashInstr(uint64_t Hash, uint32_t Offset,
+                            uint32_t OpCode) noexcept {
+  return Hash::rapidMix(Hash ^ (static_cast<uint64_t>(Offset) << 32 | OpCode),
+                        UINT64_C(0x8bb84b93962eacc9));
+}
+
+void Profile::IndirectCallCounter::add(uint32_t Target,
+                                       uint64_t Count) noexcept {
+  if (Target != kOtherTarget) {
+    for (size_t I = 0; I < kTargets; ++I) {
+      uint32_t Expected = kOtherTarget;
+      if (Targets[I].load(std::memory_order_relaxed) == Target ||
+          Targets[I].compare_exchange_strong(Expected, Target,
+                                             std::memory_order_relaxed) ||
+          Expected == Target) {
+        Counts[I].fetch_add(Count, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+  Other.fetch_add(Count, std::memory_order_relaxed);
+}
+
+uint64_t Profile::getCallCount(uint32_t Offset) const noexcept {
+  if (auto It = Calls.find(Offset); It != Calls.end()) {
+    return It->second.Count.load(std::memory_order_relaxed);
+  }
+  return 0;
+}
+
+std::optional<std::pair<uint64_t, uint64_t>>
+Profile::getBranchCount(uint32_t Offset) const noexcept {
+  if (auto It = Branches.find(Offset); It != Branches.end()) {
+    const auto &Count = It->second.Count;
+    const uint64_t Taken = Count[0].load(std::memory_order_relaxed);
+    const uint64_t NotTaken = Count[1].load(std::memory_order_relaxed);
+    if (Taken != 0 || NotTaken != 0) {
+      return std::make_pair(Taken, NotTaken);
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<std::pair<uint32_t, uint64_t>>
+Profile::getIndirectCallTarget(uint32_t Offset) const noexcept {
+  auto It = IndirectCalls.find(Offset);
+  if (It == IndirectCalls.end()) {
+    return std::nullopt;
+  }
+  const auto &Site = It->second;
+  uint64_t Total = Site.Other.load(std::memory_order_relaxed);
+  uint32_t Target = kOtherTarget;
+  uint64_t Max = 0;
+  for (size_t I = 0; I < IndirectCallCounter::kTargets; ++I) {
+    const uint64_t Count = Site.Counts[I].load(std::memory_order_relaxed);
+    Total += Count;
+    if (Count > Max) {
+      Max = Count;
+      Target = Site.Targets[I].load(std::memory_order_relaxed);
+    }
+  }
+  if (Target == kOtherTarget || Max <= Total / 2) {
+    return std::nullopt;
+  }
+  return std::make_pair(Target, Max);
+}
+
+uint64_t Profile::getHotCallThreshold() const noexcept {
+  std::vector<uint64_t> Counts;
+  uint64_t Total = 0;
+  Counts.reserve(Calls.size());
+  for (const auto &[Offset, Counter] : Calls) {
+    const uint64_t Count = Counter.Count.load(std::memory_order_relaxed);
+    if (Count != 0) {
+      Counts.push_back(Count);
+      Total += Count;
+    }
+  }
+  std::sort(Counts.begin(), Counts.end(), std::greater<>());
+  uint64_t Sum = 0;
+  for (const auto Count : Counts) {
+    Sum += Count;
+    if (Sum >= Total / 10 * 9) {
+      return Count;
+    }
+  }
+  return UINT64_MAX;
+}
+
+bool Profile::empty() const noexcept {
+  for (const auto &[Offset, Counter] : Calls) {
+    if (Counter.Count.load(std::memory_order_relaxed) != 0) {
+      return false;
+    }
+  }
+  for (const auto &[Offset, Counter] : Branches) {
+    if (Counter.Count[0].load(std::memory_order_relaxed) != 0 ||
+        Counter.Count[1].load(std::memory_order_relaxed) != 0) {
+      return false;
+    }
+  }
+  for (const auto &[Offset, Counter] : IndirectCalls) {
+    if (Counter.Other.load(std::memory_order_relaxed) != 0) {
+      return false;
+    }
+    for (const auto &Count : Counter.Counts) {
+      if (Count.load(std::memory_order_relaxed) != 0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+Expect<void> Profile::save(const std::filesystem::path &Path) const noexcept {
+  std::ofstream File(Path, std::ios::out | std::ios::trunc);
+  if (!File) {
+    spdlog::error("Profile: cannot open {} for writing."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+
+  File << kMagic << ' ' << kVersion << '\n';
+  if (ModuleHash) {
+    File << "module " << *ModuleHash << '\n';
+  }
+  for (const auto &[Offset, Counter] : Calls) {
+    if (const uint64_t Count = Counter.Count.load(std::memory_order_relaxed);
+        Count != 0) {
+      File << "call " << Offset << ' ' << Count << '\n';
+    }
+  }
+  for (const auto &[Offset, Counter] : Branches) {
+    const uint64_t Taken = Counter.Count[0].load(std::memory_order_relaxed);
+    const uint64_t NotTaken = Counter.Count[1].load(std::memory_order_relaxed);
+    if (Taken != 0 || NotTaken != 0) {
+      File << "branch " << Offset << ' ' << Taken << ' ' << NotTaken << '\n';
+    }
+  }
+  for (const auto &[Offset, Counter] : IndirectCalls) {
+    std::vector<std::pair<uint32_t, uint64_t>> Targets;
+    for (size_t I = 0; I < IndirectCallCounter::kTargets; ++I) {
+      const uint64_t Count = Counter.Counts[I].load(std::memory_order_relaxed);
+      if (Count != 0) {
+        Targets.emplace_back(Counter.Targets[I].load(std::memory_order_relaxed),
+                             Count);
+      }
+    }
+    const uint64_t Other = Counter.Other.load(std::memory_order_relaxed);
+    if (Targets.empty() && Other == 0) {
+      continue;
+    }
+    File << "indirect " << Offset << ' ' << Other << ' ' << Targets.size();
+    for (const auto &[Target, Count] : Targets) {
+      File << ' ' << Target << ' ' << Count;
+    }
+    File << '\n';
+  }
+  if (!File.flush()) {
+    spdlog::error("Profile: failed to write {}."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+  return {};
+}
+
+Expect<void> Profile::load(const std::filesystem::path &Path) noexcept {
+  std::ifstream File(Path);
+  if (!File) {
+    spdlog::error("Profile: cannot open {}."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+
+  auto Malformed = [&]() {
+    spdlog::error("Profile: {} is malformed."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::MalformedMagic);
+  };
+
+  std::string Magic;
+  uint32_t Version = 0;
+  if (!(File >> Magic >> Version) || Magic != kMagic) {
+    return Malformed();
+  }
+  if (Version != kVersion) {
+    spdlog::error("Profile: unsupported version {} of {}."sv, Version,
+                  Path.u8string());
+    return Unexpect(ErrCode::Value::MalformedVersion);
+  }
+
+  std::string Kind;
+  while (File >> Kind) {
+    if (Kind == "module"sv) {
+      uint64_t Hash = 0;
+      if (!(File >> Hash)) {
+        return Malformed();
+      }
+      if (ModuleHash && *ModuleHash != Hash) {
+        spdlog::error("Profile: {} was recorded from another module."sv,
+                      Path.u8string());
+        return Unexpect(ErrCode::Value::IllegalPath);
+      }
+      ModuleHash = Hash;
+    } else if (Kind == "call"sv) {
+      uint32_t Offset = 0;
+      uint64_t Count = 0;
+      if (!(File >> Offset >> Count)) {
+        return Malformed();
+      }
+      Calls[Offset].Count.fetch_add(Count, std::memory_order_relaxed);
+    } else if (Kind == "branch"sv) {
+      uint32_t Offset = 0;
+      uint64_t Taken = 0, NotTaken = 0;
+      if (!(File >> Offset >> Taken >> NotTaken)) {
+        return Malformed();
+      }
+      auto &Count = Branches[Offset].Count;
+      Count[0].fetch_add(Taken, std::memory_order_relaxed);
+      Count[1].fetch_add(NotTaken, std::memory_order_relaxed);
+    } else if (Kind == "indirect"sv) {
+      uint32_t Offset = 0;
+      uint64_t Other = 0, Size = 0;
+      if (!(File >> Offset >> Other >> Size) ||
+          Size > IndirectCallCounter::kTargets) {
+        return Malformed();
+      }
+      auto &Site = IndirectCalls[Offset];
+      Site.add(kOtherTarget, Other);
+      for (uint64_t I = 0; I < Size; ++I) {
+        uint32_t Target = 0;
+        uint64_t Count = 0;
+        if (!(File >> Target >> Count)) {
+          return Malformed();
+        }
+        Site.add(Target, Count);
+      }
+    } else {
+      return Malformed();
+    }
+  }
+  if (!File.eof()) {
+    return Malformed();
+  }
+  return {};
+}
+
+} // namespace Profile
+} // namespace WasmEdge
@@ -4,31 +4,65 @@
 #include "common/configure.h"
 #include "common/defines.h"
 #include "common/filesystem.h"
+#include "common/hash.h"
 #include "common/version.h"
 #include "driver/compiler.h"
 #include "driver/options.h"
 #include "loader/loader.h"
+#include "system/cpu.h"
 #include "validator/validator.h"
 #include "llvm/codegen.h"
 #include "llvm/compiler.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
+#include <cerrno>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace WasmEdge {
 namespace Driver {
 
-int Compiler([[maybe_unused]] struct DriverCompilerOptions &Opt) noexcept {
-  using namespace std::literals;
+#ifdef WASMEDGE_USE_LLVM
+namespace {
 
-  std::ios::sync_with_stdio(false);
-  Log::setInfoLoggingLevel();
+using namespace std::literals;
 
-#ifdef WASMEDGE_USE_LLVM
+/// Stages of the compilation of one module. The failed stage is also the
+/// exit status of a batch worker.
+enum class Stage : int {
+  Done = 0,
+  Load,
+  Parse,
+  Validate,
+  Configure,
+  Profile,
+  Compile,
+  CodeGen,
+};
+
+constexpr std::array<std::string_view, 8> kStageNames = {
+    ""sv,         "load"sv,    "parse"sv,   "validate"sv,
+    "configure"sv, "profile"sv, "compile"sv, "codegen"sv};
 
+Configure createCompilerConfigure(DriverCompilerOptions &Opt) noexcept {
   Configure Conf = createProposalConfigure(Opt);
 
   if (Opt.PropOptimizationLevel.value() == "0") {
@@ -55,28 +89,45 @@ int Compiler([[maybe_unused]] struct DriverCompilerOptions &Opt) noexcept {
   // (the AOT compiler needs the parsed instructions, not AOT symbols).
   Conf.getRuntimeConfigure().setRunMode(WasmEdge::RunMode::Interpreter);
 
-  std::filesystem::path InputPath =
-      std::filesystem::absolute(std::filesystem::u8path(Opt.WasmName.value()));
-  std::filesystem::path OutputPath =
-      std::filesystem::absolute(std::filesystem::u8path(Opt.SoName.value()));
-  Loader::Loader Loader(Conf);
-
-  std::vector<Byte> Data;
-  if (auto Res = Loader.loadFile(InputPath)) {
-    Data = std::move(*Res);
+  if (Opt.ConfDumpIR.value()) {
+    Conf.getCompilerConfigure().setDumpIR(true);
+  }
+  if (Opt.ConfInterruptible.value()) {
+    Conf.getCompilerConfigure().setInterruptible(true);
+  }
+  if (Opt.ConfEnableAllStatistics.value()) {
+    Conf.getStatisticsConfigure().setInstructionCounting(true);
+    Conf.getStatisticsConfigure().setCostMeasuring(true);
+    Conf.getStatisticsConfigure().setTimeMeasuring(true);
   } else {
-    const auto Err = static_cast<uint32_t>(Res.error());
-    spdlog::error("Load failed. Error code: {}"sv, Err);
-    return EXIT_FAILURE;
+    if (Opt.ConfEnableInstructionCounting.value()) {
+      Conf.getStatisticsConfigure().setInstructionCounting(true);
+    }
+    if (Opt.ConfEnableGasMeasuring.value()) {
+      Conf.getStatisticsConfigure().setCostMeasuring(true);
+    }
+    if (Opt.ConfEnableTimeMeasuring.value()) {
+      Conf.getStatisticsConfigure().setTimeMeasuring(true);
+    }
   }
+  if (Opt.ConfGenericBinary.value() || !Opt.CPUVariants.value().empty()) {
+    Conf.getCompilerConfigure().setGenericBinary(true);
+  }
+  return Conf;
+}
 
+/// Compile the module in the data to the output path.
+Stage compileModule(Configure Conf, DriverCompilerOptions &Opt,
+                    Span<const Byte> Data,
+                    const std::filesystem::path &OutputPath) noexcept {
+  Loader::Loader Loader(Conf);
   std::unique_ptr<AST::Module> Module;
   if (auto Res = Loader.parseModule(Data)) {
     Module = std::move(*Res);
   } else {
     const auto Err = static_cast<uint32_t>(Res.error());
     spdlog::error("Parse Module failed. Error code: {}"sv, Err);
-    return EXIT_FAILURE;
+    return Stage::Parse;
   }
 
   {
@@ -84,58 +135,511 @@ int Compiler([[maybe_unused]] struct DriverCompilerOptions &Opt) noexcept {
     if (auto Res = ValidatorEngine.validate(*Module); !Res) {
       const auto Err = static_cast<uint32_t>(Res.error());
       spdlog::error("Validate Module failed. Error code: {}"sv, Err);
-      return EXIT_FAILURE;
+      return Stage::Validate;
     }
   }
 
-  {
-    if (Opt.ConfDumpIR.value()) {
-      Conf.getCompilerConfigure().setDumpIR(true);
+  if (OutputPath.extension().u8string() == WASMEDGE_LIB_EXTENSION) {
+    Conf.getCompilerConfigure().setOutputFormat(
+        CompilerConfigure::OutputFormat::Native);
+  }
+  if (!Opt.CPUVariants.value().empty() &&
+      Conf.getCompilerConfigure().getOutputFormat() !=
+          CompilerConfigure::OutputFormat::Wasm) {
+    spdlog::error("--cpu-variant requires the universal wasm output."sv);
+    return Stage::Configure;
+  }
+  // Check all the variants before any code is written.
+  for (const auto &CPUName : Opt.CPUVariants.value()) {
+    if (!CPU::find(CPUName)) {
+      spdlog::error("Unknown --cpu-variant {} for the host architecture."sv,
+                    CPUName);
+      return Stage::Configure;
     }
-    if (Opt.ConfInterruptible.value()) {
-      Conf.getCompilerConfigure().setInterruptible(true);
+  }
+  LLVM::Compiler Compiler(Conf);
+  if (auto Res = Compiler.checkConfigure(); !Res) {
+    const auto Err = static_cast<uint32_t>(Res.error());
+    spdlog::error("Compiler Configure failed. Error code: {}"sv, Err);
+    return Stage::Configure;
+  }
+  Profile::Profile Prof;
+  if (!Opt.ProfileUse.value().empty()) {
+    if (auto Res = Prof.load(std::filesystem::u8path(Opt.ProfileUse.value()));
+        !Res) {
+      const auto Err = static_cast<uint32_t>(Res.error());
+      spdlog::error("Load profile failed. Error code: {}"sv, Err);
+      return Stage::Profile;
     }
-    if (Opt.ConfEnableAllStatistics.value()) {
-      Conf.getStatisticsConfigure().setInstructionCounting(true);
-      Conf.getStatisticsConfigure().setCostMeasuring(true);
-      Conf.getStatisticsConfigure().setTimeMeasuring(true);
-    } else {
-      if (Opt.ConfEnableInstructionCounting.value()) {
-        Conf.getStatisticsConfigure().setInstructionCounting(true);
+    Compiler.setProfile(&Prof);
+  }
+  LLVM::CodeGen CodeGen(Conf);
+  if (auto Res = Compiler.compile(*Module); !Res) {
+    const auto Err = static_cast<uint32_t>(Res.error());
+    spdlog::error("Compilation failed. Error code: {}"sv, Err);
+    return Stage::Compile;
+  } else if (auto Res2 = CodeGen.codegen(Data, std::move(*Res), OutputPath);
+             !Res2) {
+    const auto Err = static_cast<uint32_t>(Res2.error());
+    spdlog::error("Code Generation failed. Error code: {}"sv, Err);
+    return Stage::CodeGen;
+  }
+  for (const auto &CPUName : Opt.CPUVariants.value()) {
+    if (auto Res = Compiler.setTargetCPU(CPUName); !Res) {
+      return Stage::Configure;
+    }
+    CodeGen.setTargetCPU(CPUName);
+    if (auto Res = Compiler.compile(*Module); !Res) {
+      const auto Err = static_cast<uint32_t>(Res.error());
+      spdlog::error("Compilation for {} failed. Error code: {}"sv, CPUName,
+                    Err);
+      return Stage::Compile;
+    } else if (auto Res2 = CodeGen.codegen(Data, std::move(*Res), OutputPath);
+               !Res2) {
+      const auto Err = static_cast<uint32_t>(Res2.error());
+      spdlog::error("Code Generation for {} failed. Error code: {}"sv,
+                    CPUName, Err);
+      return Stage::CodeGen;
+    }
+  }
+  return Stage::Done;
+}
+
+/// One module of a batch compilation.
+struct BatchJob {
+  enum class Status { Pending, Compiled, Skipped, Failed };
+  std::filesystem::path Input;
+  std::filesystem::path Output;
+  /// Hash of the input content and the compilation options.
+  uint64_t Key = 0;
+  Status State = Status::Pending;
+  std::string Error;
+  std::chrono::steady_clock::time_point Start;
+  uint64_t TimeMs = 0;
+  /// Peak resident memory of the worker in KiB, or 0 if unknown.
+  uint64_t PeakMemoryKiB = 0;
+};
+
+constexpr std::string_view kCacheFileName = ".wasmedgec-cache"sv;
+constexpr std::string_view kSummaryFileName = "wasmedgec-summary.json"sv;
+
+uint64_t hashBytes(Span<const Byte> Data) noexcept {
+  return Hash::Hash::rapidHash(cxx20::as_bytes(Data));
+}
+
+/// Hash of everything besides the input which changes the compiled output.
+uint64_t hashOptions(const Configure &Conf,
+                     DriverCompilerOptions &Opt) noexcept {
+  std::string Fingerprint(kVersionString);
+  Fingerprint += '\n';
+  for (uint8_t I = 0; I < static_cast<uint8_t>(Proposal::Max); ++I) {
+    Fingerprint += Conf.hasProposal(static_cast<Proposal>(I)) ? '1' : '0';
+  }
+  Fingerprint += '\n';
+  for (const bool Toggle :
+       {Opt.ConfGenericBinary.value(), Opt.ConfDumpIR.value(),
+        Opt.ConfInterruptible.value(),
+        Opt.ConfEnableInstructionCounting.value(),
+        Opt.ConfEnableGasMeasuring.value(),
+        Opt.ConfEnableTimeMeasuring.value(),
+        Opt.ConfEnableAllStatistics.value()}) {
+    Fingerprint += Toggle ? '1' : '0';
+  }
+  Fingerprint += '\n';
+  Fingerprint += Opt.PropOptimizationLevel.value();
+  for (const auto &CPUName : Opt.CPUVariants.value()) {
+    Fingerprint += '\n';
+    Fingerprint += CPUName;
+  }
+  if (!Opt.ProfileUse.value().empty()) {
+    std::ifstream File(std::filesystem::u8path(Opt.ProfileUse.value()),
+                       std::ios::binary);
+    Fingerprint.append(std::istreambuf_iterator<char>(File),
+                       std::istreambuf_iterator<char>());
+  }
+  return Hash::Hash{}(Fingerprint);
+}
+
+/// Collect the modules to compile from the manifest or the directory.
+bool collectBatchJobs(const std::filesystem::path &InputPath,
+                      const std::filesystem::path &OutputDir,
+                      std::vector<BatchJob> &Jobs) noexcept {
+  auto DefaultOutput = [&](const std::filesystem::path &Relative) {
+    auto Output = OutputDir / Relative;
+    Output.replace_extension(WASMEDGE_LIB_EXTENSION);
+    return Output;
+  };
+
+  std::error_code EC;
+  if (std::filesystem::is_directory(InputPath, EC)) {
+    for (std::filesystem::recursive_directory_iterator It(InputPath, EC), End;
+         !EC && It != End; It.increment(EC)) {
+      if (It->is_regular_file(EC) && It->path().extension() == ".wasm"sv) {
+        BatchJob Job;
+        Job.Input = It->path();
+        Job.Output =
+            DefaultOutput(std::filesystem::relative(It->path(), InputPath));
+        Jobs.push_back(std::move(Job));
       }
-      if (Opt.ConfEnableGasMeasuring.value()) {
-        Conf.getStatisticsConfigure().setCostMeasuring(true);
+    }
+    if (EC) {
+      spdlog::error("Read directory {} failed: {}"sv, InputPath.u8string(),
+                    EC.message());
+      return false;
+    }
+    // Directory iteration has no specified order.
+    std::sort(Jobs.begin(), Jobs.end(),
+              [](const BatchJob &LHS, const BatchJob &RHS) {
+                return LHS.Input < RHS.Input;
+              });
+    return true;
+  }
+
+  std::ifstream Manifest(InputPath);
+  if (!Manifest) {
+    spdlog::error("Open manifest {} failed."sv, InputPath.u8string());
+    return false;
+  }
+  // Relative inputs are relative to the manifest, and relative outputs to the
+  // output directory.
+  const auto BaseDir = InputPath.parent_path();
+  std::string Line;
+  while (std::getline(Manifest, Line)) {
+    if (!Line.empty() && Line.back() == '\r') {
+      Line.pop_back();
+    }
+    if (Line.empty() || Line.front() == '#') {
+      continue;
+    }
+    BatchJob Job;
+    const auto Tab = Line.find('\t');
+    Job.Input = BaseDir / std::filesystem::u8path(Line.substr(0, Tab));
+    if (Tab != std::string::npos) {
+      Job.Output = OutputDir / std::filesystem::u8path(Line.substr(Tab + 1));
+    } else {
+      Job.Output = DefaultOutput(Job.Input.filename());
+    }
+    Jobs.push_back(std::move(Job));
+  }
+  // The default outputs only keep the file names, so inputs of the same name
+  // in different directories would overwrite each other.
+  std::map<std::filesystem::path, const BatchJob *> Outputs;
+  for (const auto &Job : Jobs) {
+    const auto [It, Inserted] =
+        Outputs.try_emplace(Job.Output.lexically_normal(), &Job);
+    if (!Inserted) {
+      spdlog::error("Manifest inputs {} and {} have the same output {}, give "
+                    "one of them an explicit output path."sv,
+                    It->second->Input.u8string(), Job.Input.u8string(),
+                    Job.Output.u8string());
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Map from the output paths to the keys of their last compilation.
+using BatchCache = std::map<std::string, uint64_t>;
+
+BatchCache loadBatchCache(const std::filesystem::path &Path) noexcept {
+  BatchCache Cache;
+  std::ifstream File(Path);
+  std::string Line;
+  while (std::getline(File, Line)) {
+    const auto Tab = Line.find('\t');
+    if (Tab == std::string::npos) {
+      continue;
+    }
+    Cache[Line.substr(Tab + 1)] =
+        std::strtoull(Line.substr(0, Tab).c_str(), nullptr, 16);
+  }
+  return Cache;
+}
+
+void saveBatchCache(const std::filesystem::path &Path,
+                    const BatchCache &Cache) noexcept {
+  std::ofstream File(Path, std::ios::trunc);
+  for (const auto &[Output, Key] : Cache) {
+    File << fmt::format("{:016x}\t{}\n"sv, Key, Output);
+  }
+}
+
+std::string escapeJSON(std::string_view Str) {
+  std::string Result;
+  Result.reserve(Str.size());
+  for (const char C : Str) {
+    switch (C) {
+    case '"':
+      Result += "\\\""sv;
+      break;
+    case '\\':
+      Result += "\\\\"sv;
+      break;
+    default:
+      if (static_cast<unsigned char>(C) < 0x20) {
+        Result += fmt::format("\\u{:04x}"sv, static_cast<unsigned>(C));
+      } else {
+        Result += C;
       }
-      if (Opt.ConfEnableTimeMeasuring.value()) {
-        Conf.getStatisticsConfigure().setTimeMeasuring(true);
+      break;
+    }
+  }
+  return Result;
+}
+
+bool writeBatchSummary(const std::filesystem::path &Path,
+                       Span<const BatchJob> Jobs) noexcept {
+  std::array<size_t, 4> Counts = {};
+  std::string JSON = "{\n  \"modules\": ["s;
+  for (size_t I = 0; I < Jobs.size(); ++I) {
+    const auto &Job = Jobs[I];
+    constexpr std::array<std::string_view, 4> kStatusNames = {
+        "pending"sv, "compiled"sv, "skipped"sv, "failed"sv};
+    const auto State = static_cast<size_t>(Job.State);
+    ++Counts[State];
+    JSON += fmt::format(
+        "{}\n    {{\"input\": \"{}\", \"output\": \"{}\", \"status\": \"{}\", "
+        "\"error\": \"{}\", \"time_ms\": {}, \"peak_memory_kib\": {}}}"sv,
+        I == 0 ? ""sv : ","sv, escapeJSON(Job.Input.u8string()),
+        escapeJSON(Job.Output.u8string()), kStatusNames[State],
+        escapeJSON(Job.Error), Job.TimeMs, Job.PeakMemoryKiB);
+  }
+  JSON += fmt::format("\n  ],\n  \"compiled\": {},\n  \"skipped\": {},\n  "
+                      "\"failed\": {}\n}}\n"sv,
+                      Counts[1], Counts[2], Counts[3]);
+  std::ofstream File(Path, std::ios::trunc);
+  File << JSON;
+  return static_cast<bool>(File);
+}
+
+/// Run the LLVM one-time initialization before forking the workers, so each
+/// worker starts from the initialized state instead of repeating it.
+void warmUpCompiler(const Configure &Conf) noexcept {
+  static constexpr std::array<Byte, 8> kEmptyModule = {
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00};
+  Loader::Loader Loader(Conf);
+  Validator::Validator ValidatorEngine(Conf);
+  if (auto Module = Loader.parseModule(kEmptyModule);
+      Module && ValidatorEngine.validate(**Module)) {
+    LLVM::Compiler Compiler(Conf);
+    [[maybe_unused]] auto Res = Compiler.compile(**Module);
+  }
+}
+
+int BatchCompiler(DriverCompilerOptions &Opt) noexcept {
+  const Configure Conf = createCompilerConfigure(Opt);
+  const auto InputPath =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.WasmName.value()));
+  const auto OutputDir =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.SoName.value()));
+
+  std::vector<BatchJob> Jobs;
+  if (!collectBatchJobs(InputPath, OutputDir, Jobs)) {
+    return EXIT_FAILURE;
+  }
+  std::error_code EC;
+  std::filesystem::create_directories(OutputDir, EC);
+  if (EC) {
+    spdlog::error("Create directory {} failed: {}"sv, OutputDir.u8string(),
+                  EC.message());
+    return EXIT_FAILURE;
+  }
+
+  const auto CachePath = OutputDir / kCacheFileName;
+  BatchCache Cache = loadBatchCache(CachePath);
+  const uint64_t OptionsKey = hashOptions(Conf, Opt);
+  uint32_t Workers = Opt.Jobs.value();
+  if (Workers == 0) {
+    Workers = std::max(1U, std::thread::hardware_concurrency());
+  }
+  Loader::Loader Loader(Conf);
+
+  // Read the input and check whether it needs to be compiled.
+  auto Prepare = [&](BatchJob &Job, std::vector<Byte> &Data) {
+    std::filesystem::create_directories(Job.Output.parent_path(), EC);
+    if (auto Res = Loader.loadFile(Job.Input)) {
+      Data = std::move(*Res);
+    } else {
+      Job.State = BatchJob::Status::Failed;
+      Job.Error = kStageNames[static_cast<int>(Stage::Load)];
+      return false;
+    }
+    Job.Key = Hash::rapidMix(hashBytes(Data), OptionsKey);
+    if (const auto It = Cache.find(Job.Output.u8string());
+        It != Cache.end() && It->second == Job.Key &&
+        std::filesystem::exists(Job.Output, EC)) {
+      Job.State = BatchJob::Status::Skipped;
+      return false;
+    }
+    Job.Start = std::chrono::steady_clock::now();
+    return true;
+  };
+  auto Finish = [&](BatchJob &Job, Stage Result) {
+    Job.TimeMs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - Job.Start)
+            .count());
+    if (Result == Stage::Done) {
+      Job.State = BatchJob::Status::Compiled;
+    } else {
+      Job.State = BatchJob::Status::Failed;
+      if (Job.Error.empty()) {
+        Job.Error = kStageNames[static_cast<int>(Result)];
       }
     }
-    if (Opt.ConfGenericBinary.value()) {
-      Conf.getCompilerConfigure().setGenericBinary(true);
+  };
+
+#if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
+  // Every module is compiled in a forked worker process, which shares the
+  // initialized LLVM state of this process, is confined by the memory limit,
+  // and reports its exact peak memory. A crashed worker only fails its module.
+  warmUpCompiler(Conf);
+  std::fflush(nullptr);
+  std::unordered_map<pid_t, size_t> Running;
+  size_t Next = 0;
+  while (Next < Jobs.size() || !Running.empty()) {
+    while (Running.size() < Workers && Next < Jobs.size()) {
+      const size_t Index = Next++;
+      auto &Job = Jobs[Index];
+      std::vector<Byte> Data;
+      if (!Prepare(Job, Data)) {
+        continue;
+      }
+      const pid_t Pid = ::fork();
+      if (Pid == 0) {
+        if (const uint64_t Limit = Opt.MemoryLimit.value(); Limit > 0) {
+          struct rlimit RLimit;
+          RLimit.rlim_cur = RLimit.rlim_max =
+              static_cast<rlim_t>(Limit) * 1024 * 1024;
+          ::setrlimit(RLIMIT_AS, &RLimit);
+        }
+        const auto Result = compileModule(Conf, Opt, Data, Job.Output);
+        spdlog::default_logger()->flush();
+        std::fflush(nullptr);
+        ::_exit(static_cast<int>(Result));
+      } else if (Pid < 0) {
+        spdlog::error("Fork worker failed: {}"sv, std::strerror(errno));
+        Job.State = BatchJob::Status::Failed;
+        Job.Error = "fork"s;
+        continue;
+      }
+      Running.emplace(Pid, Index);
     }
-    if (OutputPath.extension().u8string() == WASMEDGE_LIB_EXTENSION) {
-      Conf.getCompilerConfigure().setOutputFormat(
-          CompilerConfigure::OutputFormat::Native);
+    if (Running.empty()) {
+      continue;
     }
-    LLVM::Compiler Compiler(Conf);
-    if (auto Res = Compiler.checkConfigure(); !Res) {
-      const auto Err = static_cast<uint32_t>(Res.error());
-      spdlog::error("Compiler Configure failed. Error code: {}"sv, Err);
+
+    int Status = 0;
+    struct rusage Usage = {};
+    const pid_t Pid = ::wait4(-1, &Status, 0, &Usage);
+    if (Pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      spdlog::error("Wait worker failed: {}"sv, std::strerror(errno));
       return EXIT_FAILURE;
     }
-    LLVM::CodeGen CodeGen(Conf);
-    if (auto Res = Compiler.compile(*Module); !Res) {
-      const auto Err = static_cast<uint32_t>(Res.error());
-      spdlog::error("Compilation failed. Error code: {}"sv, Err);
-      return EXIT_FAILURE;
-    } else if (auto Res2 = CodeGen.codegen(Data, std::move(*Res), OutputPath);
-               !Res2) {
-      const auto Err = static_cast<uint32_t>(Res2.error());
-      spdlog::error("Code Generation failed. Error code: {}"sv, Err);
-      return EXIT_FAILURE;
+    const auto It = Running.find(Pid);
+    if (It == Running.end()) {
+      continue;
+    }
+    auto &Job = Jobs[It->second];
+    Running.erase(It);
+#if WASMEDGE_OS_MACOS
+    Job.PeakMemoryKiB = static_cast<uint64_t>(Usage.ru_maxrss) / 1024;
+#else
+    Job.PeakMemoryKiB = static_cast<uint64_t>(Usage.ru_maxrss);
+#endif
+    Stage Result = Stage::Compile;
+    if (WIFEXITED(Status)) {
+      const int Code = WEXITSTATUS(Status);
+      if (Code >= 0 && Code < static_cast<int>(kStageNames.size())) {
+        Result = static_cast<Stage>(Code);
+      }
+    } else if (WIFSIGNALED(Status)) {
+      Job.Error = fmt::format("signal {}"sv, WTERMSIG(Status));
+    }
+    Finish(Job, Result);
+  }
+#else
+  // Without fork, the modules are compiled one by one in this process, and
+  // neither the memory limit nor the peak memory is supported.
+  if (Workers > 1 || Opt.MemoryLimit.value() > 0) {
+    spdlog::warn("--jobs and --memory-limit are not supported on this "
+                 "platform."sv);
+  }
+  for (auto &Job : Jobs) {
+    std::vector<Byte> Data;
+    if (Prepare(Job, Data)) {
+      Finish(Job, compileModule(Conf, Opt, Data, Job.Output));
+    }
+  }
+#endif
+
+  bool Failed = false;
+  for (const auto &Job : Jobs) {
+    const auto Output = Job.Output.u8string();
+    switch (Job.State) {
+    case BatchJob::Status::Compiled:
+    case BatchJob::Status::Skipped:
+      Cache[Output] = Job.Key;
+      break;
+    default:
+      Cache.erase(Output);
+      Failed = true;
+      spdlog::error("Batch compile {} failed at {}."sv, Job.Input.u8string(),
+                    Job.Error);
+      break;
     }
   }
+  saveBatchCache(CachePath, Cache);
+
+  const auto SummaryPath =
+      Opt.Summary.value().empty()
+          ? OutputDir / kSummaryFileName
+          : std::filesystem::absolute(
+                std::filesystem::u8path(Opt.Summary.value()));
+  if (!writeBatchSummary(SummaryPath, Jobs)) {
+    spdlog::error("Write summary {} failed."sv, SummaryPath.u8string());
+    return EXIT_FAILURE;
+  }
+  return Failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+} // namespace
+#endif
+
+int Compiler([[maybe_unused]] struct DriverCompilerOptions &Opt) noexcept {
+  using namespace std::literals;
+
+  std::ios::sync_with_stdio(false);
+  Log::setInfoLoggingLevel();
+
+#ifdef WASMEDGE_USE_LLVM
+
+  if (Opt.Batch.value()) {
+    return BatchCompiler(Opt);
+  }
+
+  Configure Conf = createCompilerConfigure(Opt);
+  std::filesystem::path InputPath =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.WasmName.value()));
+  std::filesystem::path OutputPath =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.SoName.value()));
+  Loader::Loader Loader(Conf);
+
+  std::vector<Byte> Data;
+  if (auto Res = Loader.loadFile(InputPath)) {
+    Data = std::move(*Res);
+  } else {
+    const auto Err = static_cast<uint32_t>(Res.error());
+    spdlog::error("Load failed. Error code: {}"sv, Err);
+    return EXIT_FAILURE;
+  }
 
+  if (compileModule(Conf, Opt, Data, OutputPath) != Stage::Done) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 #else
   spdlog::error("Compilation is not supported!"sv);
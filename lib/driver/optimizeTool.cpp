@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/defines.h"
+#include "common/filesystem.h"
+#include "common/spdlog.h"
+#include "driver/optimizer.h"
+#include "driver/tool.h"
+#include "loader/loader.h"
+#include "validator/validator.h"
+#ifdef WASMEDGE_USE_LLVM
+#include "llvm/compiler.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if WASMEDGE_OS_LINUX
+#include <unistd.h>
+#endif
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace Driver {
+
+namespace {
+
+/// Costs of a module, measured from its binary.
+struct ModuleCost {
+  uint64_t Size = 0;
+  uint64_t Funcs = 0;
+  std::chrono::microseconds Load{};
+  std::chrono::microseconds Validate{};
+  std::chrono::microseconds Compile{};
+  uint64_t ResidentBytes = 0;
+};
+
+/// Get the resident set size of the process, or 0 if unknown.
+uint64_t getResidentBytes() noexcept {
+#if WASMEDGE_OS_LINUX
+  std::ifstream Statm("/proc/self/statm");
+  uint64_t Total = 0, Resident = 0;
+  if (Statm >> Total >> Resident) {
+    return Resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return 0;
+}
+
+/// Load, validate and, with the LLVM backend, compile the module the given
+/// times, and take the shortest durations. The resident set growth is
+/// measured in the first round, while the results are alive.
+std::optional<ModuleCost> measureModule(const Configure &Conf,
+                                        Span<const Byte> Code,
+                                        uint32_t Rounds) {
+  using Clock = std::chrono::steady_clock;
+  auto Elapsed = [](Clock::time_point Begin) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                                 Begin);
+  };
+  ModuleCost Cost;
+  Cost.Size = Code.size();
+  for (uint32_t Round = 0; Round < Rounds; ++Round) {
+    const uint64_t ResidentBefore = getResidentBytes();
+    Loader::Loader LoaderEngine(Conf);
+    Validator::Validator ValidatorEngine(Conf);
+    auto Begin = Clock::now();
+    auto Mod = LoaderEngine.parseModule(Code);
+    if (!Mod) {
+      return std::nullopt;
+    }
+    const auto Load = Elapsed(Begin);
+    Begin = Clock::now();
+    if (!ValidatorEngine.validate(**Mod)) {
+      return std::nullopt;
+    }
+    const auto Validate = Elapsed(Begin);
+    std::chrono::microseconds Compile{};
+#ifdef WASMEDGE_USE_LLVM
+    LLVM::Compiler Compiler(Conf);
+    Begin = Clock::now();
+    auto Data = Compiler.compile(**Mod);
+    if (!Data) {
+      return std::nullopt;
+    }
+    Compile = Elapsed(Begin);
+#endif
+    if (Round == 0) {
+      Cost.Funcs = (*Mod)->getImportFuncCount() +
+                   (*Mod)->getFunctionSection().getContent().size();
+      Cost.Load = Load;
+      Cost.Validate = Validate;
+      Cost.Compile = Compile;
+      const uint64_t ResidentAfter = getResidentBytes();
+      Cost.ResidentBytes =
+          ResidentAfter > ResidentBefore ? ResidentAfter - ResidentBefore : 0;
+    } else {
+      Cost.Load = std::min(Cost.Load, Load);
+      Cost.Validate = std::min(Cost.Validate, Validate);
+      Cost.Compile = std::min(Cost.Compile, Compile);
+    }
+  }
+  return Cost;
+}
+
+bool writeFile(const std::filesystem::path &Path, Span<const Byte> Data) {
+  std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+  File.write(reinterpret_cast<const char *>(Data.data()),
+             static_cast<std::streamsize>(Data.size()));
+  if (!File) {
+    spdlog::error("Failed to write {}."sv, Path.u8string());
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int OptimizeTool(struct DriverToolOptions &Opt) noexcept {
+  std::ios::sync_with_stdio(false);
+
+  const Configure Conf = createConfigure(Opt);
+  if (Opt.SoName.value().empty() || Opt.OptimizeOutput.value().empty()) {
+    spdlog::error("Both the input and the output wasm files are required."sv);
+    return EXIT_FAILURE;
+  }
+  const bool Split = !Opt.OptimizeSplitCold.value().empty();
+  if (Split && Opt.OptimizeHot.value().empty()) {
+    spdlog::error("--split-cold requires the hot entries given by --hot."sv);
+    return EXIT_FAILURE;
+  }
+  const auto InputPath =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.SoName.value()));
+  const auto OutputPath = std::filesystem::absolute(
+      std::filesystem::u8path(Opt.OptimizeOutput.value()));
+
+  Loader::Loader LoaderEngine(Conf);
+  Validator::Validator ValidatorEngine(Conf);
+  auto Input = LoaderEngine.loadFile(InputPath);
+  if (!Input) {
+    return EXIT_FAILURE;
+  }
+  auto Mod = LoaderEngine.parseModule(*Input);
+  if (!Mod) {
+    return EXIT_FAILURE;
+  }
+  if (!ValidatorEngine.validate(**Mod)) {
+    return EXIT_FAILURE;
+  }
+
+  // The entries must be exported functions.
+  for (const auto *Names : {&Opt.OptimizeEntries.value(),
+                            &Opt.OptimizeHot.value()}) {
+    for (const auto &Name : *Names) {
+      const auto &Exports = (*Mod)->getExportSection().getContent();
+      if (std::none_of(Exports.begin(), Exports.end(),
+                       [&Name](const AST::ExportDesc &Desc) {
+                         return Desc.getExternalType() ==
+                                    ExternalType::Function &&
+                                Desc.getExternalName() == Name;
+                       })) {
+        spdlog::error("Function \"{}\" is not exported."sv, Name);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  ModuleOptimizer Optimizer;
+  Optimizer.eliminateDeadCode(**Mod, Opt.OptimizeEntries.value());
+  AST::Module Secondary;
+  if (Split) {
+    Optimizer.splitColdCode(**Mod, Opt.OptimizeHot.value(), Secondary);
+  }
+  const auto &Stat = Optimizer.getStats();
+
+  // Write the modules only if they round trip to valid modules.
+  auto Serialize = [&](const AST::Module &Out) -> std::vector<Byte> {
+    auto Code = LoaderEngine.serializeModule(Out);
+    if (!Code) {
+      return {};
+    }
+    auto Parsed = LoaderEngine.parseModule(*Code);
+    if (!Parsed || !ValidatorEngine.validate(**Parsed)) {
+      spdlog::error("The optimized module is invalid."sv);
+      return {};
+    }
+    return std::move(*Code);
+  };
+  const auto Output = Serialize(**Mod);
+  if (Output.empty() || !writeFile(OutputPath, Output)) {
+    return EXIT_FAILURE;
+  }
+  if (Split && Stat.SplitFuncs > 0) {
+    const auto SecondaryPath = std::filesystem::absolute(
+        std::filesystem::u8path(Opt.OptimizeSplitCold.value()));
+    const auto Cold = Serialize(Secondary);
+    if (Cold.empty() || !writeFile(SecondaryPath, Cold)) {
+      return EXIT_FAILURE;
+    }
+    fmt::print("Moved {} cold functions into {}. Run with `--split-module {}` "
+               "to load them on the first use.\n"sv,
+               Stat.SplitFuncs, SecondaryPath.u8string(),
+               SecondaryPath.u8string());
+  } else if (Split) {
+    spdlog::warn("No cold functions to split."sv);
+  }
+
+  fmt::print("Removed {} functions, {} imported functions and {} exports, "
+             "stripped {} element entries and {} passive data bytes.\n"sv,
+             Stat.RemovedFuncs, Stat.RemovedImports, Stat.RemovedExports,
+             Stat.StrippedElems, Stat.StrippedDataBytes);
+
+  // Report the savings. The optimized module is measured first, so the
+  // memory the allocator keeps for the original module does not favor it.
+  const uint32_t Rounds = Opt.OptimizeRounds.value();
+  const auto After = measureModule(Conf, Output, Rounds);
+  const auto Before = measureModule(Conf, *Input, Rounds);
+  if (!After || !Before) {
+    return EXIT_FAILURE;
+  }
+  auto Row = [](std::string_view Name, uint64_t B, uint64_t A) {
+    const double Saved = B > 0 ? 100.0 * (static_cast<double>(B) -
+                                          static_cast<double>(A)) /
+                                     static_cast<double>(B)
+                               : 0.0;
+    fmt::print("{:<16}{:>14}{:>14}{:>9.1f}%\n"sv, Name, B, A, Saved);
+  };
+  fmt::print("{:<16}{:>14}{:>14}{:>10}\n"sv, ""sv, "original"sv,
+             "optimized"sv, "saved"sv);
+  Row("size (bytes)"sv, Before->Size, After->Size);
+  Row("functions"sv, Before->Funcs, After->Funcs);
+  Row("load (us)"sv, static_cast<uint64_t>(Before->Load.count()),
+      static_cast<uint64_t>(After->Load.count()));
+  Row("validate (us)"sv, static_cast<uint64_t>(Before->Validate.count()),
+      static_cast<uint64_t>(After->Validate.count()));
+#ifdef WASMEDGE_USE_LLVM
+  Row("compile (us)"sv, static_cast<uint64_t>(Before->Compile.count()),
+      static_cast<uint64_t>(After->Compile.count()));
+#endif
+  if (Before->ResidentBytes > 0) {
+    Row("RSS (KiB)"sv, Before->ResidentBytes / 1024,
+        After->ResidentBytes / 1024);
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace Driver
+} // namespace WasmEdge
@@ -0,0 +1,802 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "driver/optimizer.h"
+
+#include "common/spdlog.h"
+#include "executor/executor.h"
+#include "loader/loader.h"
+#include "runtime/callingframe.h"
+#include "runtime/storemgr.h"
+#include "validator/validator.h"
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace Driver {
+
+namespace {
+
+constexpr uint32_t kNoIndex = UINT32_MAX;
+
+/// Check if the instruction calls or references a function.
+bool isFuncUse(OpCode Code) noexcept {
+  return Code == OpCode::Call || Code == OpCode::Return_call ||
+         Code == OpCode::Ref__func;
+}
+
+/// Check if the instruction uses an element or a data segment.
+bool isSegmentUse(OpCode Code) noexcept {
+  switch (Code) {
+  case OpCode::Table__init:
+  case OpCode::Elem__drop:
+  case OpCode::Memory__init:
+  case OpCode::Data__drop:
+  case OpCode::Array__new_data:
+  case OpCode::Array__new_elem:
+  case OpCode::Array__init_data:
+  case OpCode::Array__init_elem:
+    return true;
+  default:
+    return false;
+  }
+}
+
+AST::Instruction makeInstr(OpCode Code, uint32_t Target = 0,
+                           uint32_t Source = 0) {
+  AST::Instruction Instr(Code);
+  Instr.getTargetIndex() = Target;
+  Instr.getSourceIndex() = Source;
+  return Instr;
+}
+
+AST::Instruction makeI32Const(uint32_t Val) {
+  AST::Instruction Instr(OpCode::I32__const);
+  Instr.setNum(Val);
+  return Instr;
+}
+
+AST::Expression makeExpr(std::initializer_list<AST::Instruction> Instrs) {
+  AST::Expression Expr;
+  Expr.getInstrs().assign(Instrs.begin(), Instrs.end());
+  Expr.getInstrs().emplace_back(OpCode::End);
+  return Expr;
+}
+
+uint32_t countImports(const AST::Module &Mod, ExternalType Type) {
+  return static_cast<uint32_t>(std::count_if(
+      Mod.getImportSection().getContent().begin(),
+      Mod.getImportSection().getContent().end(),
+      [Type](const AST::ImportDesc &Desc) {
+        return Desc.getExternalType() == Type;
+      }));
+}
+
+bool isNamed(Span<const std::string> Names, std::string_view Name) {
+  return std::find(Names.begin(), Names.end(), Name) != Names.end();
+}
+
+/// Call the function on every constant expression of the module.
+template <typename FuncT>
+void forEachConstExpr(AST::Module &Mod, FuncT &&Func) {
+  for (auto &Seg : Mod.getTableSection().getContent()) {
+    Func(Seg.getExpr());
+  }
+  for (auto &Seg : Mod.getGlobalSection().getContent()) {
+    Func(Seg.getExpr());
+  }
+  for (auto &Seg : Mod.getElementSection().getContent()) {
+    Func(Seg.getExpr());
+    for (auto &Expr : Seg.getInitExprs()) {
+      Func(Expr);
+    }
+  }
+  for (auto &Seg : Mod.getDataSection().getContent()) {
+    Func(Seg.getExpr());
+  }
+}
+
+/// Replace the function indices of the module with their entries in Map.
+void remapFuncs(AST::Module &Mod, Span<const uint32_t> Map) {
+  auto Remap = [Map](AST::InstrVec &Instrs) {
+    for (auto &Instr : Instrs) {
+      if (isFuncUse(Instr.getOpCode())) {
+        Instr.getTargetIndex() = Map[Instr.getTargetIndex()];
+      }
+    }
+  };
+  for (auto &Code : Mod.getCodeSection().getContent()) {
+    Remap(Code.getExpr().getInstrs());
+  }
+  forEachConstExpr(
+      Mod, [&Remap](AST::Expression &Expr) { Remap(Expr.getInstrs()); });
+  for (auto &Desc : Mod.getExportSection().getContent()) {
+    if (Desc.getExternalType() == ExternalType::Function) {
+      Desc.setExternalIndex(Map[Desc.getExternalIndex()]);
+    }
+  }
+  if (auto Start = Mod.getStartSection().getContent()) {
+    Mod.getStartSection().setContent(Map[*Start]);
+  }
+}
+
+/// Drop the custom sections describing the functions by their indices, and
+/// the compiled code, which are stale once the functions change.
+void dropStaleSections(AST::Module &Mod) {
+  auto &Sections = Mod.getCustomSections();
+  Sections.erase(std::remove_if(Sections.begin(), Sections.end(),
+                                [](const AST::CustomSection &Sec) {
+                                  return Sec.getName() == "name"sv ||
+                                         Sec.getName().substr(0, 8) ==
+                                             "wasmedge"sv;
+                                }),
+                 Sections.end());
+}
+
+/// The serializer writes the sections in the order of their offsets in the
+/// input. Keep the existing sections in place, and put the sections added to
+/// the module after their predecessors in the standard order.
+void orderSections(AST::Module &Mod) {
+  constexpr uint64_t kScale = 16;
+  for (auto &Sec : Mod.getCustomSections()) {
+    Sec.setStartOffset(Sec.getStartOffset() * kScale);
+  }
+  const std::array<AST::Section *, 13> Sections = {
+      &Mod.getTypeSection(),     &Mod.getImportSection(),
+      &Mod.getFunctionSection(), &Mod.getTableSection(),
+      &Mod.getMemorySection(),   &Mod.getTagSection(),
+      &Mod.getGlobalSection(),   &Mod.getExportSection(),
+      &Mod.getStartSection(),    &Mod.getElementSection(),
+      &Mod.getDataCountSection(), &Mod.getCodeSection(),
+      &Mod.getDataSection()};
+  uint64_t Offset = 0;
+  for (auto *Sec : Sections) {
+    if (Sec->getStartOffset() != 0) {
+      Offset = Sec->getStartOffset() * kScale;
+    } else {
+      ++Offset;
+    }
+    Sec->setStartOffset(Offset);
+  }
+}
+
+/// Functions, tables and segments reachable from the marked roots.
+class Reachability {
+public:
+  Reachability(AST::Module &M)
+      : Mod(M), ImportFuncs(M.getImportFuncCount()),
+        Funcs(ImportFuncs + M.getFunctionSection().getContent().size()),
+        Tables(countImports(M, ExternalType::Table) +
+               M.getTableSection().getContent().size()),
+        Elems(M.getElementSection().getContent().size()),
+        Datas(M.getDataSection().getContent().size()) {}
+
+  void markFunc(uint32_t Idx) {
+    if (!Funcs[Idx]) {
+      Funcs[Idx] = true;
+      Work.push_back(Idx);
+    }
+  }
+  void markTable(uint32_t Idx) {
+    if (!Tables[Idx]) {
+      Tables[Idx] = true;
+      const auto &Segs = Mod.getElementSection().getContent();
+      for (uint32_t I = 0; I < Segs.size(); ++I) {
+        if (Segs[I].getMode() == AST::ElementSegment::ElemMode::Active &&
+            Segs[I].getIdx() == Idx) {
+          markElem(I);
+        }
+      }
+    }
+  }
+  void markElem(uint32_t Idx) {
+    if (!Elems[Idx]) {
+      Elems[Idx] = true;
+      for (const auto &Expr :
+           Mod.getElementSection().getContent()[Idx].getInitExprs()) {
+        markExpr(Expr);
+      }
+    }
+  }
+  void markExpr(const AST::Expression &Expr) {
+    for (const auto &Instr : Expr.getInstrs()) {
+      if (Instr.getOpCode() == OpCode::Ref__func) {
+        markFunc(Instr.getTargetIndex());
+      }
+    }
+  }
+
+  /// Mark everything reachable from the marked functions. With DirectOnly,
+  /// only the calls and the function references are followed.
+  void propagate(bool DirectOnly) {
+    while (!Work.empty()) {
+      const uint32_t Idx = Work.back();
+      Work.pop_back();
+      if (Idx < ImportFuncs) {
+        continue;
+      }
+      const auto &Code = Mod.getCodeSection().getContent()[Idx - ImportFuncs];
+      for (const auto &Instr : Code.getExpr().getInstrs()) {
+        if (isFuncUse(Instr.getOpCode())) {
+          markFunc(Instr.getTargetIndex());
+        } else if (!DirectOnly) {
+          markUses(Instr);
+        }
+      }
+    }
+  }
+
+  bool isFunc(uint32_t Idx) const noexcept { return Funcs[Idx]; }
+  bool isTable(uint32_t Idx) const noexcept { return Tables[Idx]; }
+  bool isElem(uint32_t Idx) const noexcept { return Elems[Idx]; }
+  bool isData(uint32_t Idx) const noexcept { return Datas[Idx]; }
+
+private:
+  void markUses(const AST::Instruction &Instr) {
+    switch (Instr.getOpCode()) {
+    case OpCode::Call_indirect:
+    case OpCode::Return_call_indirect:
+      markTable(Instr.getSourceIndex());
+      break;
+    case OpCode::Table__get:
+    case OpCode::Table__set:
+    case OpCode::Table__size:
+    case OpCode::Table__grow:
+    case OpCode::Table__fill:
+      markTable(Instr.getTargetIndex());
+      break;
+    case OpCode::Table__copy:
+      markTable(Instr.getTargetIndex());
+      markTable(Instr.getSourceIndex());
+      break;
+    case OpCode::Table__init:
+      markTable(Instr.getTargetIndex());
+      markElem(Instr.getSourceIndex());
+      break;
+    case OpCode::Array__new_elem:
+    case OpCode::Array__init_elem:
+      markElem(Instr.getSourceIndex());
+      break;
+    case OpCode::Memory__init:
+    case OpCode::Array__new_data:
+    case OpCode::Array__init_data:
+      Datas[Instr.getSourceIndex()] = true;
+      break;
+    default:
+      break;
+    }
+  }
+
+  AST::Module &Mod;
+  const uint32_t ImportFuncs;
+  std::vector<bool> Funcs;
+  std::vector<bool> Tables;
+  std::vector<bool> Elems;
+  std::vector<bool> Datas;
+  std::vector<uint32_t> Work;
+};
+
+} // namespace
+
+void ModuleOptimizer::eliminateDeadCode(AST::Module &Mod,
+                                        Span<const std::string> Entries) {
+  auto &Exports = Mod.getExportSection().getContent();
+  if (!Entries.empty()) {
+    const auto It = std::remove_if(
+        Exports.begin(), Exports.end(), [Entries](const AST::ExportDesc &Desc) {
+          return Desc.getExternalType() == ExternalType::Function &&
+                 !isNamed(Entries, Desc.getExternalName());
+        });
+    Stat.RemovedExports +=
+        static_cast<uint32_t>(std::distance(It, Exports.end()));
+    Exports.erase(It, Exports.end());
+  }
+
+  // Mark the roots. The functions in the tables shared with the host or other
+  // modules, and in the segments which cannot hold null references, are kept.
+  // The function index segments have non-nullable types, which are relaxed
+  // below if their tables can hold null references.
+  Reachability Reach(Mod);
+  for (const auto &Desc : Exports) {
+    if (Desc.getExternalType() == ExternalType::Function) {
+      Reach.markFunc(Desc.getExternalIndex());
+    } else if (Desc.getExternalType() == ExternalType::Table) {
+      Reach.markTable(Desc.getExternalIndex());
+    }
+  }
+  const uint32_t ImportTables = countImports(Mod, ExternalType::Table);
+  for (uint32_t I = 0; I < ImportTables; ++I) {
+    Reach.markTable(I);
+  }
+  if (auto Start = Mod.getStartSection().getContent()) {
+    Reach.markFunc(*Start);
+  }
+  for (const auto &Seg : Mod.getTableSection().getContent()) {
+    Reach.markExpr(Seg.getExpr());
+  }
+  for (const auto &Seg : Mod.getGlobalSection().getContent()) {
+    Reach.markExpr(Seg.getExpr());
+  }
+  const auto &Tables = Mod.getTableSection().getContent();
+  auto CanHoldNull = [&](const AST::ElementSegment &Seg) {
+    const uint32_t Idx = Seg.getIdx();
+    return Seg.getRefType().isNullableRefType() ||
+           (Idx >= ImportTables &&
+            Tables[Idx - ImportTables]
+                .getTableType()
+                .getRefType()
+                .isNullableRefType());
+  };
+  auto &Elems = Mod.getElementSection().getContent();
+  for (uint32_t I = 0; I < Elems.size(); ++I) {
+    if (Elems[I].getMode() == AST::ElementSegment::ElemMode::Active &&
+        !CanHoldNull(Elems[I])) {
+      Reach.markElem(I);
+    }
+  }
+  Reach.propagate(false);
+
+  // Strip the references to the removed functions from the segments.
+  auto HasDeadRef = [&Reach](const AST::Expression &Expr) {
+    return std::any_of(Expr.getInstrs().begin(), Expr.getInstrs().end(),
+                       [&Reach](const AST::Instruction &Instr) {
+                         return Instr.getOpCode() == OpCode::Ref__func &&
+                                !Reach.isFunc(Instr.getTargetIndex());
+                       });
+  };
+  for (uint32_t I = 0; I < Elems.size(); ++I) {
+    auto &Seg = Elems[I];
+    auto &Exprs = Seg.getInitExprs();
+    switch (Seg.getMode()) {
+    case AST::ElementSegment::ElemMode::Active:
+      // The segment initializes a table not in use, so only its size matters.
+      if (!Reach.isElem(I)) {
+        for (auto &Expr : Exprs) {
+          if (HasDeadRef(Expr)) {
+            Seg.setRefType(Seg.getRefType().getNullableRef());
+            AST::Instruction Null(OpCode::Ref__null);
+            Null.setValType(Seg.getRefType());
+            Expr = makeExpr({std::move(Null)});
+            ++Stat.StrippedElems;
+          }
+        }
+      }
+      break;
+    case AST::ElementSegment::ElemMode::Passive:
+      if (!Reach.isElem(I)) {
+        Stat.StrippedElems += static_cast<uint32_t>(Exprs.size());
+        Exprs.clear();
+      }
+      break;
+    case AST::ElementSegment::ElemMode::Declarative: {
+      const auto It = std::remove_if(Exprs.begin(), Exprs.end(), HasDeadRef);
+      Stat.StrippedElems +=
+          static_cast<uint32_t>(std::distance(It, Exprs.end()));
+      Exprs.erase(It, Exprs.end());
+      break;
+    }
+    default:
+      assumingUnreachable();
+    }
+  }
+  // A ref.func in a function body needs its function declared outside the
+  // function bodies. Declare the kept functions which lost their only
+  // declaration, such as a removed export, in a declarative segment.
+  const uint32_t ImportFuncs = Mod.getImportFuncCount();
+  auto &Codes = Mod.getCodeSection().getContent();
+  {
+    std::vector<bool> IsDeclared(ImportFuncs + Codes.size(), false);
+    auto Declare = [&IsDeclared](const AST::Expression &Expr) {
+      for (const auto &Instr : Expr.getInstrs()) {
+        if (Instr.getOpCode() == OpCode::Ref__func) {
+          IsDeclared[Instr.getTargetIndex()] = true;
+        }
+      }
+    };
+    for (const auto &Desc : Exports) {
+      if (Desc.getExternalType() == ExternalType::Function) {
+        IsDeclared[Desc.getExternalIndex()] = true;
+      }
+    }
+    forEachConstExpr(Mod, Declare);
+    std::vector<uint32_t> Undeclared;
+    for (uint32_t I = 0; I < Codes.size(); ++I) {
+      if (!Reach.isFunc(ImportFuncs + I)) {
+        continue;
+      }
+      for (const auto &Instr : Codes[I].getExpr().getInstrs()) {
+        if (Instr.getOpCode() == OpCode::Ref__func &&
+            !IsDeclared[Instr.getTargetIndex()]) {
+          IsDeclared[Instr.getTargetIndex()] = true;
+          Undeclared.push_back(Instr.getTargetIndex());
+        }
+      }
+    }
+    if (!Undeclared.empty()) {
+      std::sort(Undeclared.begin(), Undeclared.end());
+      auto &Decl = Elems.emplace_back();
+      Decl.setMode(AST::ElementSegment::ElemMode::Declarative);
+      for (const auto Idx : Undeclared) {
+        Decl.getInitExprs().push_back(
+            makeExpr({makeInstr(OpCode::Ref__func, Idx)}));
+      }
+      // The element section may be new.
+      orderSections(Mod);
+    }
+  }
+
+  auto &Datas = Mod.getDataSection().getContent();
+  for (uint32_t I = 0; I < Datas.size(); ++I) {
+    if (Datas[I].getMode() == AST::DataSegment::DataMode::Passive &&
+        !Reach.isData(I)) {
+      Stat.StrippedDataBytes += Datas[I].getData().size();
+      Datas[I].getData().clear();
+    }
+  }
+
+  // Remove the functions and the imported functions, and renumber the rest.
+  auto &FuncTypes = Mod.getFunctionSection().getContent();
+  std::vector<uint32_t> Map(ImportFuncs + FuncTypes.size(), kNoIndex);
+  uint32_t Next = 0;
+  uint32_t FuncIdx = 0;
+  auto &Imports = Mod.getImportSection().getContent();
+  const auto ImportEnd =
+      std::remove_if(Imports.begin(), Imports.end(),
+                     [&](const AST::ImportDesc &Desc) {
+                       if (Desc.getExternalType() != ExternalType::Function) {
+                         return false;
+                       }
+                       const uint32_t Idx = FuncIdx++;
+                       if (!Reach.isFunc(Idx)) {
+                         return true;
+                       }
+                       Map[Idx] = Next++;
+                       return false;
+                     });
+  Stat.RemovedImports +=
+      static_cast<uint32_t>(std::distance(ImportEnd, Imports.end()));
+  Imports.erase(ImportEnd, Imports.end());
+  uint32_t Kept = 0;
+  for (uint32_t I = 0; I < FuncTypes.size(); ++I) {
+    if (!Reach.isFunc(ImportFuncs + I)) {
+      continue;
+    }
+    Map[ImportFuncs + I] = Next++;
+    if (Kept != I) {
+      FuncTypes[Kept] = FuncTypes[I];
+      Codes[Kept] = std::move(Codes[I]);
+    }
+    ++Kept;
+  }
+  Stat.RemovedFuncs += static_cast<uint32_t>(FuncTypes.size()) - Kept;
+  FuncTypes.resize(Kept);
+  Codes.resize(Kept);
+  remapFuncs(Mod, Map);
+  dropStaleSections(Mod);
+}
+
+void ModuleOptimizer::splitColdCode(AST::Module &Mod,
+                                    Span<const std::string> HotEntries,
+                                    AST::Module &Secondary) {
+  const uint32_t ImportFuncs = Mod.getImportFuncCount();
+  auto &FuncTypes = Mod.getFunctionSection().getContent();
+  auto &Codes = Mod.getCodeSection().getContent();
+  auto &Exports = Mod.getExportSection().getContent();
+  const uint32_t FuncCount =
+      ImportFuncs + static_cast<uint32_t>(FuncTypes.size());
+
+  // The functions reachable through direct calls from the hot entries stay.
+  // The table entries and the indirect calls are not followed, as the stubs
+  // of the cold functions stay in the tables.
+  Reachability Hot(Mod);
+  for (const auto &Desc : Exports) {
+    if (Desc.getExternalType() == ExternalType::Function &&
+        isNamed(HotEntries, Desc.getExternalName())) {
+      Hot.markFunc(Desc.getExternalIndex());
+    }
+  }
+  if (auto Start = Mod.getStartSection().getContent()) {
+    Hot.markFunc(*Start);
+  }
+  for (const auto &Seg : Mod.getGlobalSection().getContent()) {
+    Hot.markExpr(Seg.getExpr());
+  }
+  for (const auto &Seg : Mod.getTableSection().getContent()) {
+    Hot.markExpr(Seg.getExpr());
+  }
+  Hot.propagate(true);
+
+  // The segments cannot be shared, so their users stay.
+  std::vector<uint32_t> Cold;
+  for (uint32_t Idx = ImportFuncs; Idx < FuncCount; ++Idx) {
+    const auto &Instrs = Codes[Idx - ImportFuncs].getExpr().getInstrs();
+    if (!Hot.isFunc(Idx) &&
+        std::none_of(Instrs.begin(), Instrs.end(),
+                     [](const AST::Instruction &Instr) {
+                       return isSegmentUse(Instr.getOpCode());
+                     })) {
+      Cold.push_back(Idx);
+    }
+  }
+  if (Cold.empty()) {
+    return;
+  }
+  const uint32_t ColdCount = static_cast<uint32_t>(Cold.size());
+
+  // The load function needs a function type without parameters and results.
+  auto &Types = Mod.getTypeSection().getContent();
+  uint32_t LoadType = 0;
+  while (LoadType < Types.size()) {
+    const auto &SType = Types[LoadType];
+    if (!SType.getRecursiveInfo().has_value() &&
+        SType.getSuperTypeIndices().empty() &&
+        SType.getCompositeType().isFunc() &&
+        SType.getCompositeType().getFuncType().getParamTypes().empty() &&
+        SType.getCompositeType().getFuncType().getReturnTypes().empty()) {
+      break;
+    }
+    ++LoadType;
+  }
+  if (LoadType == Types.size()) {
+    Types.emplace_back(AST::FunctionType());
+  }
+
+  // Collect the types of the functions, tables, memories, globals and tags
+  // of the module, which the secondary module imports in the same order.
+  std::vector<uint32_t> FuncTypeIdx;
+  std::vector<AST::TableType> TableTypes;
+  std::vector<AST::MemoryType> MemTypes;
+  std::vector<AST::GlobalType> GlobTypes;
+  std::vector<AST::TagType> TagTypes;
+  for (const auto &Desc : Mod.getImportSection().getContent()) {
+    switch (Desc.getExternalType()) {
+    case ExternalType::Function:
+      FuncTypeIdx.push_back(Desc.getExternalFuncTypeIdx());
+      break;
+    case ExternalType::Table:
+      TableTypes.push_back(Desc.getExternalTableType());
+      break;
+    case ExternalType::Memory:
+      MemTypes.push_back(Desc.getExternalMemoryType());
+      break;
+    case ExternalType::Global:
+      GlobTypes.push_back(Desc.getExternalGlobalType());
+      break;
+    case ExternalType::Tag:
+      TagTypes.push_back(Desc.getExternalTagType());
+      break;
+    default:
+      break;
+    }
+  }
+  FuncTypeIdx.insert(FuncTypeIdx.end(), FuncTypes.begin(), FuncTypes.end());
+  for (const auto &Seg : Mod.getTableSection().getContent()) {
+    TableTypes.push_back(Seg.getTableType());
+  }
+  for (const auto &MType : Mod.getMemorySection().getContent()) {
+    MemTypes.push_back(MType);
+  }
+  for (const auto &Seg : Mod.getGlobalSection().getContent()) {
+    GlobTypes.push_back(Seg.getGlobalType());
+  }
+  for (const auto &TgType : Mod.getTagSection().getContent()) {
+    TagTypes.push_back(TgType);
+  }
+  const auto SplitTable = static_cast<uint32_t>(TableTypes.size());
+
+  // Index the functions in the secondary module: first the functions of this
+  // module used by the cold functions, then the cold functions.
+  std::vector<bool> IsCold(FuncCount);
+  for (const auto Idx : Cold) {
+    IsCold[Idx] = true;
+  }
+  std::vector<uint32_t> SecondaryIdx(FuncCount, kNoIndex);
+  std::vector<uint32_t> Linked;
+  for (const auto Idx : Cold) {
+    for (const auto &Instr : Codes[Idx - ImportFuncs].getExpr().getInstrs()) {
+      const uint32_t Target = Instr.getTargetIndex();
+      if (isFuncUse(Instr.getOpCode()) && !IsCold[Target] &&
+          SecondaryIdx[Target] == kNoIndex) {
+        SecondaryIdx[Target] = static_cast<uint32_t>(Linked.size());
+        Linked.push_back(Target);
+      }
+    }
+  }
+  const auto LinkedCount = static_cast<uint32_t>(Linked.size());
+  for (uint32_t K = 0; K < ColdCount; ++K) {
+    SecondaryIdx[Cold[K]] = LinkedCount + K;
+  }
+
+  // Move the cold functions into the secondary module.
+  Secondary.getMagic() = Mod.getMagic();
+  Secondary.getVersion() = Mod.getVersion();
+  Secondary.getTypeSection().getContent() = Types;
+  std::vector<uint32_t> Declared;
+  for (const auto Idx : Cold) {
+    Secondary.getFunctionSection().getContent().push_back(
+        FuncTypes[Idx - ImportFuncs]);
+    auto &Orig = Codes[Idx - ImportFuncs];
+    auto &Code = Secondary.getCodeSection().getContent().emplace_back();
+    Code.getLocals() = Orig.getLocals();
+    Code.getExpr().getInstrs() = Orig.getExpr().getInstrs();
+    for (auto &Instr : Code.getExpr().getInstrs()) {
+      if (isFuncUse(Instr.getOpCode())) {
+        Instr.getTargetIndex() = SecondaryIdx[Instr.getTargetIndex()];
+        if (Instr.getOpCode() == OpCode::Ref__func &&
+            Instr.getTargetIndex() < LinkedCount) {
+          Declared.push_back(Instr.getTargetIndex());
+        }
+      }
+    }
+  }
+  {
+    // Fill the split table, and declare the referenced imported functions.
+    auto &Elems = Secondary.getElementSection().getContent();
+    auto &Fill = Elems.emplace_back();
+    Fill.setIdx(SplitTable);
+    Fill.getExpr() = makeExpr({makeI32Const(0)});
+    for (uint32_t K = 0; K < ColdCount; ++K) {
+      Fill.getInitExprs().push_back(
+          makeExpr({makeInstr(OpCode::Ref__func, LinkedCount + K)}));
+    }
+    if (!Declared.empty()) {
+      std::sort(Declared.begin(), Declared.end());
+      Declared.erase(std::unique(Declared.begin(), Declared.end()),
+                     Declared.end());
+      auto &Decl = Elems.emplace_back();
+      Decl.setMode(AST::ElementSegment::ElemMode::Declarative);
+      for (const auto Idx : Declared) {
+        Decl.getInitExprs().push_back(
+            makeExpr({makeInstr(OpCode::Ref__func, Idx)}));
+      }
+    }
+  }
+
+  // Insert the load function after the imported functions.
+  std::vector<uint32_t> Map(FuncCount);
+  for (uint32_t Idx = 0; Idx < FuncCount; ++Idx) {
+    Map[Idx] = Idx < ImportFuncs ? Idx : Idx + 1;
+  }
+  remapFuncs(Mod, Map);
+  {
+    auto &Load = Mod.getImportSection().getContent().emplace_back();
+    Load.setModuleName(kSplitModuleName);
+    Load.setExternalName("load"sv);
+    Load.setExternalType(ExternalType::Function);
+    Load.setExternalFuncTypeIdx(LoadType);
+  }
+
+  // Replace the cold functions with the stubs loading the secondary module on
+  // the first call, and calling through the split table.
+  for (uint32_t K = 0; K < ColdCount; ++K) {
+    auto &Code = Codes[Cold[K] - ImportFuncs];
+    const uint32_t TypeIdx = FuncTypes[Cold[K] - ImportFuncs];
+    const auto &FuncType = Types[TypeIdx].getCompositeType().getFuncType();
+    AST::Instruction If(OpCode::If);
+    If.getBlockType().setEmpty();
+    auto &Instrs = Code.getExpr().getInstrs();
+    Instrs = {makeI32Const(K),
+              makeInstr(OpCode::Table__get, SplitTable),
+              makeInstr(OpCode::Ref__is_null),
+              std::move(If),
+              makeInstr(OpCode::Call, ImportFuncs),
+              makeInstr(OpCode::End)};
+    for (uint32_t I = 0; I < FuncType.getParamTypes().size(); ++I) {
+      Instrs.push_back(makeInstr(OpCode::Local__get, I));
+    }
+    Instrs.push_back(makeI32Const(K));
+    Instrs.push_back(makeInstr(OpCode::Call_indirect, TypeIdx, SplitTable));
+    Instrs.push_back(makeInstr(OpCode::End));
+    Code.getLocals().clear();
+  }
+
+  // Export everything the secondary module uses, and import it there.
+  auto Link = [&](ExternalType Type, std::string_view Kind,
+                  uint32_t Idx) -> AST::ImportDesc & {
+    auto Name = fmt::format("{}.{}.{}"sv, kSplitModuleName, Kind, Idx);
+    auto &Exp = Exports.emplace_back();
+    Exp.setExternalType(Type);
+    Exp.setExternalName(Name);
+    Exp.setExternalIndex(Idx);
+    auto &Imp = Secondary.getImportSection().getContent().emplace_back();
+    Imp.setModuleName(kSplitPrimaryName);
+    Imp.setExternalType(Type);
+    Imp.setExternalName(Name);
+    return Imp;
+  };
+  for (const auto Idx : Linked) {
+    Link(ExternalType::Function, "func"sv, Map[Idx])
+        .setExternalFuncTypeIdx(FuncTypeIdx[Idx]);
+  }
+  for (uint32_t I = 0; I < TableTypes.size(); ++I) {
+    Link(ExternalType::Table, "table"sv, I).getExternalTableType() =
+        TableTypes[I];
+  }
+  Link(ExternalType::Table, "table"sv, SplitTable).getExternalTableType() =
+      AST::TableType(TypeCode::FuncRef, ColdCount, ColdCount);
+  for (uint32_t I = 0; I < MemTypes.size(); ++I) {
+    Link(ExternalType::Memory, "memory"sv, I).getExternalMemoryType() =
+        MemTypes[I];
+  }
+  for (uint32_t I = 0; I < GlobTypes.size(); ++I) {
+    Link(ExternalType::Global, "global"sv, I).getExternalGlobalType() =
+        GlobTypes[I];
+  }
+  for (uint32_t I = 0; I < TagTypes.size(); ++I) {
+    Link(ExternalType::Tag, "tag"sv, I).getExternalTagType() = TagTypes[I];
+  }
+  Mod.getTableSection().getContent().emplace_back().getTableType() =
+      AST::TableType(TypeCode::FuncRef, ColdCount, ColdCount);
+
+  orderSections(Mod);
+  orderSections(Secondary);
+  dropStaleSections(Mod);
+  Stat.SplitFuncs += ColdCount;
+}
+
+SplitLoaderModule::SplitLoaderModule(const Configure &C,
+                                     Runtime::StoreManager &S,
+                                     std::filesystem::path P)
+    : ModuleInstance(kSplitModuleName), Conf(C), StoreMgr(S),
+      Path(std::move(P)) {
+  addHostFunc("load"sv, std::make_unique<Load>(*this));
+}
+
+SplitLoaderModule::~SplitLoaderModule() noexcept { unload(); }
+
+bool SplitLoaderModule::isLoaded() const noexcept {
+  std::unique_lock Lock(Mutex);
+  return SecondaryInst != nullptr;
+}
+
+void SplitLoaderModule::unload() noexcept {
+  std::unique_lock Lock(Mutex);
+  if (auto *Inst = SecondaryInst.release()) {
+    Inst->terminate();
+  }
+}
+
+Expect<void>
+SplitLoaderModule::Load::body(const Runtime::CallingFrame &Frame) {
+  std::unique_lock Lock(Parent.Mutex);
+  if (Parent.SecondaryInst) {
+    return {};
+  }
+  auto *Exec = Frame.getExecutor();
+  const auto *ModInst = Frame.getModule();
+  if (unlikely(!Exec || !ModInst)) {
+    return Unexpect(ErrCode::Value::HostFuncError);
+  }
+  auto ReportError = [this](auto E) {
+    spdlog::error("Failed to load the split module from {}."sv,
+                  Parent.Path.u8string());
+    return E;
+  };
+
+  Loader::Loader LoaderEngine(Parent.Conf);
+  Validator::Validator ValidatorEngine(Parent.Conf);
+  EXPECTED_TRY(auto Mod,
+               LoaderEngine.parseModule(Parent.Path).map_error(ReportError));
+  EXPECTED_TRY(ValidatorEngine.validate(*Mod).map_error(ReportError));
+  if (!Parent.StoreMgr.findModule(kSplitPrimaryName)) {
+    EXPECTED_TRY(
+        Exec->registerModule(Parent.StoreMgr, *ModInst, kSplitPrimaryName)
+            .map_error(ReportError));
+  }
+  EXPECTED_TRY(auto Inst, Exec->instantiateModule(Parent.StoreMgr, *Mod)
+                              .map_error(ReportError));
+  Parent.Secondary = std::move(Mod);
+  Parent.SecondaryInst = std::move(Inst);
+  return {};
+}
+
+} // namespace Driver
+} // namespace WasmEdge
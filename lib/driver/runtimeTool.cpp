@@ -3,10 +3,13 @@
 
 #include "common/configure.h"
 #include "common/filesystem.h"
+#include "common/profile.h"
 #include "common/spdlog.h"
 #include "common/types.h"
 #include "common/version.h"
+#include "driver/optimizer.h"
 #include "driver/tool.h"
+#include "experimental/scope.hpp"
 #include "host/wasi/wasimodule.h"
 #include "vm/vm.h"
 
@@ -43,6 +46,9 @@ std::optional<RunMode> parseRunModeArg(std::string_view S) noexcept {
   if (Lower == "lazyjit") {
     return RunMode::LazyJIT;
   }
+  if (Lower == "tiered") {
+    return RunMode::Tiered;
+  }
   return std::nullopt;
 }
 
@@ -395,6 +401,9 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
       Conf.getStatisticsConfigure().setTimeMeasuring(true);
     }
   }
+  if (Opt.ConfEnableHardwareCounting.value()) {
+    Conf.getStatisticsConfigure().setHardwareCounting(true);
+  }
   // Determine the effective run mode.
   // Precedence: --run-mode > deprecated --enable-jit / --force-interpreter.
   RunMode RunModeFromFlag = RunMode::Interpreter;
@@ -407,7 +416,7 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
       RunModeFromFlag = *Mode;
     } else {
       spdlog::warn("Unknown --run-mode value: \"{}\"; using interpreter. "
-                   "Valid values: interpreter, jit, aot, lazyjit."sv,
+                   "Valid values: interpreter, jit, aot, lazyjit, tiered."sv,
                    Opt.ConfRunMode.value());
       RunModeFromFlag = RunMode::Interpreter;
     }
@@ -419,6 +428,12 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
                  "--run-mode=interpreter instead."sv);
     RunModeFromFlag = RunMode::Interpreter;
   }
+  if (!Opt.ProfileGenerate.value().empty() &&
+      RunModeFromFlag != RunMode::Interpreter) {
+    spdlog::warn("--profile-generate records in the interpreter, ignoring the "
+                 "requested run mode."sv);
+    RunModeFromFlag = RunMode::Interpreter;
+  }
   Conf.getRuntimeConfigure().setRunMode(RunModeFromFlag);
   if (RunModeFromFlag == RunMode::JIT || RunModeFromFlag == RunMode::LazyJIT) {
     Conf.getCompilerConfigure().setOptimizationLevel(
@@ -433,6 +448,16 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
   if (Opt.ConfAFUNIX.value()) {
     Conf.getRuntimeConfigure().setAllowAFUNIX(true);
   }
+  if (Opt.ConfEnableJITCache.value()) {
+    Conf.getRuntimeConfigure().setEnableJITCache(true);
+  }
+  if (!Opt.ConfJITCacheDir.value().empty() &&
+      !Conf.getRuntimeConfigure().setJITCacheDir(
+          std::filesystem::u8path(Opt.ConfJITCacheDir.value()))) {
+    spdlog::error("--jit-cache-dir must be an absolute path: \"{}\""sv,
+                  Opt.ConfJITCacheDir.value());
+    return EXIT_FAILURE;
+  }
 
   Conf.addHostRegistration(HostRegistration::Wasi);
   const auto InputPath =
@@ -460,6 +485,26 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
     }
   }
 
+  // Provide the loader of the cold functions split out of the module. The
+  // loader is pinned by the module importing it, so it is terminated instead
+  // of deleted, after the split module it instantiated is released.
+  SplitLoaderModule *SplitLoader = nullptr;
+  cxx20::scope_exit UnloadSplit([&]() noexcept {
+    if (SplitLoader) {
+      SplitLoader->unload();
+      SplitLoader->terminate();
+    }
+  });
+  if (!Opt.SplitModule.value().empty()) {
+    SplitLoader = new SplitLoaderModule(
+        Conf, VM.getStoreManager(),
+        std::filesystem::absolute(
+            std::filesystem::u8path(Opt.SplitModule.value())));
+    if (auto Result = VM.registerModule(*SplitLoader); !Result) {
+      return EXIT_FAILURE;
+    }
+  }
+
   // Load, validate, and instantiate WASM or Component.
   if (auto Result = VM.loadWasm(InputPath.u8string()); !Result) {
     return EXIT_FAILURE;
@@ -470,6 +515,42 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
   if (auto Result = VM.instantiate(); !Result) {
     return EXIT_FAILURE;
   }
+  const bool Restored = !Opt.Restore.value().empty();
+  if (Restored) {
+    const auto SnapshotPath = std::filesystem::absolute(
+        std::filesystem::u8path(Opt.Restore.value()));
+    if (auto Result = VM.restoreSnapshot(SnapshotPath); !Result) {
+      spdlog::error("Failed to restore snapshot from: {}"sv,
+                    SnapshotPath.u8string());
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Record the execution profile, merged with the one of the previous runs,
+  // and write it out however the run ends.
+  Profile::Profile Prof;
+  const bool Profiling = !Opt.ProfileGenerate.value().empty();
+  const auto ProfilePath =
+      Profiling ? std::filesystem::absolute(
+                      std::filesystem::u8path(Opt.ProfileGenerate.value()))
+                : std::filesystem::path();
+  if (Profiling) {
+    VM.getExecutor().setProfile(&Prof, VM.getActiveModule());
+    if (std::error_code EC; std::filesystem::exists(ProfilePath, EC)) {
+      if (auto Result = Prof.load(ProfilePath); !Result) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  cxx20::scope_exit SaveProfile([&]() noexcept {
+    if (!Profiling) {
+      return;
+    }
+    VM.getExecutor().setProfile(nullptr, nullptr);
+    if (auto Result = Prof.save(ProfilePath); !Result) {
+      spdlog::error("Failed to save profile to: {}"sv, ProfilePath.u8string());
+    }
+  });
 
   auto HasValidCommandModStartFunc = [&]() {
     bool HasStart = false;
@@ -561,8 +642,9 @@ int Tool(struct DriverToolOptions &Opt) noexcept {
       }
 
       // If the initialize function was found and is not being called
-      // explicitly, invoke it first.
-      if (HasInit && FuncName != InitFunc) {
+      // explicitly, invoke it first. A restored snapshot is already
+      // initialized.
+      if (HasInit && FuncName != InitFunc && !Restored) {
         auto AsyncResult = VM.asyncExecute(InitFunc);
         if (Timeout.has_value()) {
           if (!AsyncResult.waitUntil(*Timeout)) {
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/filesystem.h"
+#include "common/spdlog.h"
+#include "driver/tool.h"
+#include "host/wasi/wasimodule.h"
+#include "vm/vm.h"
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace Driver {
+
+int SnapshotTool(struct DriverToolOptions &Opt) noexcept {
+  std::ios::sync_with_stdio(false);
+
+  Configure Conf = createConfigure(Opt);
+
+  if (Opt.MemLim.value().size() > 0) {
+    Conf.getRuntimeConfigure().setMaxMemoryPage(
+        static_cast<uint32_t>(Opt.MemLim.value().back()));
+  }
+  if (!Opt.ConfRunMode.value().empty()) {
+    if (auto Mode = parseRunModeArg(Opt.ConfRunMode.value())) {
+      Conf.getRuntimeConfigure().setRunMode(*Mode);
+    } else {
+      spdlog::error("Unknown --run-mode value: \"{}\". Valid values: "
+                    "interpreter, jit, aot, lazyjit."sv,
+                    Opt.ConfRunMode.value());
+      return EXIT_FAILURE;
+    }
+  }
+
+  Conf.addHostRegistration(HostRegistration::Wasi);
+
+  if (Opt.SoName.value().empty() || Opt.SnapshotName.value().empty()) {
+    spdlog::error("Both the input wasm file and the snapshot file are "
+                  "required."sv);
+    return EXIT_FAILURE;
+  }
+  const auto InputPath =
+      std::filesystem::absolute(std::filesystem::u8path(Opt.SoName.value()));
+  const auto SnapshotPath = std::filesystem::absolute(
+      std::filesystem::u8path(Opt.SnapshotName.value()));
+
+  VM::VM VM(Conf);
+  Host::WasiModule *WasiMod = dynamic_cast<Host::WasiModule *>(
+      VM.getImportModule(HostRegistration::Wasi));
+
+  for (const auto &ModEntry : Opt.LinkedModules.value()) {
+    auto Pos = ModEntry.find(':');
+    if (Pos == std::string::npos) {
+      spdlog::error("Invalid --module format: \"{}\". Expected name:path."sv,
+                    ModEntry);
+      return EXIT_FAILURE;
+    }
+    auto Name = ModEntry.substr(0, Pos);
+    auto Path = std::filesystem::absolute(
+        std::filesystem::u8path(ModEntry.substr(Pos + 1)));
+    if (auto Result = VM.registerModule(Name, Path); !Result) {
+      spdlog::error("Failed to register module \"{}\" from: {}"sv, Name,
+                    Path.u8string());
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (auto Result = VM.loadWasm(InputPath.u8string()); !Result) {
+    return EXIT_FAILURE;
+  }
+  if (auto Result = VM.validate(); !Result) {
+    return EXIT_FAILURE;
+  }
+  if (auto Result = VM.instantiate(); !Result) {
+    return EXIT_FAILURE;
+  }
+  if (!VM.holdsModule()) {
+    spdlog::error("Only core wasm modules can be snapshotted."sv);
+    return EXIT_FAILURE;
+  }
+
+  // Find the initialization function, which takes and returns nothing.
+  std::string InitFunc = Opt.SnapshotInitFunc.value();
+  auto IsValidInit = [&](std::string_view Name) {
+    for (const auto &[FuncName, Type] : VM.getFunctionList()) {
+      if (FuncName == Name) {
+        return Type.getParamTypes().empty() && Type.getReturnTypes().empty();
+      }
+    }
+    return false;
+  };
+  if (InitFunc.empty()) {
+    for (auto Name : {"wizer.initialize"sv, "_initialize"sv}) {
+      if (IsValidInit(Name)) {
+        InitFunc = Name;
+        break;
+      }
+    }
+    if (InitFunc.empty()) {
+      spdlog::error("No initialization function found, use --init-func to "
+                    "specify one."sv);
+      return EXIT_FAILURE;
+    }
+  } else if (!IsValidInit(InitFunc)) {
+    spdlog::error("Function \"{}\" is not exported or is not a function "
+                  "without parameters and results."sv,
+                  InitFunc);
+    return EXIT_FAILURE;
+  }
+
+  WasiMod->init(Opt.Dir.value(),
+                InputPath.filename()
+                    .replace_extension(std::filesystem::u8path("wasm"sv))
+                    .u8string(),
+                {}, Opt.Env.value());
+
+  if (auto Result = VM.execute(InitFunc); !Result) {
+    return EXIT_FAILURE;
+  }
+  if (auto Result = VM.saveSnapshot(SnapshotPath); !Result) {
+    return EXIT_FAILURE;
+  }
+
+  spdlog::info("Snapshot written to {}."sv, SnapshotPath.u8string());
+  return EXIT_SUCCESS;
+}
+
+} // namespace Driver
+} // namespace WasmEdge
@@ -29,11 +29,17 @@ int UniTool(int Argc, const char *Argv[], const ToolType ToolSelect) noexcept {
       PO::Description("Wasmedge instantiate tool subcommand"sv));
   PO::SubCommand ValidateSubCommand(
       PO::Description("Wasmedge validate tool subcommand"sv));
+  PO::SubCommand SnapshotSubCommand(
+      PO::Description("Wasmedge snapshot tool subcommand"sv));
+  PO::SubCommand OptimizeSubCommand(
+      PO::Description("Wasmedge optimize tool subcommand"sv));
   struct DriverToolOptions ToolOptions;
   struct DriverCompilerOptions CompilerOptions;
   struct DriverToolOptions ParseOptions;
   struct DriverToolOptions InstantiateOptions;
   struct DriverToolOptions ValidateOptions;
+  struct DriverToolOptions SnapshotOptions;
+  struct DriverToolOptions OptimizeOptions;
 
   // Construct Parser Subcommands and Options
   if (ToolSelect == ToolType::All) {
@@ -54,6 +60,12 @@ int UniTool(int Argc, const char *Argv[], const ToolType ToolSelect) noexcept {
     Parser.begin_subcommand(ValidateSubCommand, "validate"sv);
     ValidateOptions.addParserOptions(Parser);
     Parser.end_subcommand();
+    Parser.begin_subcommand(SnapshotSubCommand, "snapshot"sv);
+    SnapshotOptions.addSnapshotOptions(Parser);
+    Parser.end_subcommand();
+    Parser.begin_subcommand(OptimizeSubCommand, "optimize"sv);
+    OptimizeOptions.addOptimizeOptions(Parser);
+    Parser.end_subcommand();
   } else if (ToolSelect == ToolType::Tool) {
     ToolOptions.addOptions(Parser);
   } else if (ToolSelect == ToolType::Compiler) {
@@ -98,7 +110,9 @@ int UniTool(int Argc, const char *Argv[], const ToolType ToolSelect) noexcept {
 
   if (ToolSelect == ToolType::All) {
     if (!ParseSubCommand.is_selected() && !ValidateSubCommand.is_selected() &&
-        !InstantiateSubCommand.is_selected()) {
+        !InstantiateSubCommand.is_selected() &&
+        !SnapshotSubCommand.is_selected() &&
+        !OptimizeSubCommand.is_selected()) {
       ApplyLogLevel(ToolOptions.LogLevel.value());
     }
   } else if (ToolSelect == ToolType::Tool) {
@@ -121,6 +135,10 @@ int UniTool(int Argc, const char *Argv[], const ToolType ToolSelect) noexcept {
   } else if (InstantiateSubCommand.is_selected() ||
              ToolSelect == ToolType::Instantiate) {
     return InstantiateTool(InstantiateOptions);
+  } else if (SnapshotSubCommand.is_selected()) {
+    return SnapshotTool(SnapshotOptions);
+  } else if (OptimizeSubCommand.is_selected()) {
+    return OptimizeTool(OptimizeOptions);
   } else {
     return Tool(ToolOptions);
   }
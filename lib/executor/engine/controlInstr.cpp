@@ -13,6 +13,7 @@ Expect<void> Executor::runIfElseOp(Runtime::StackManager &StackMgr,
                                    AST::InstrView::iterator &PC) noexcept {
   // Get condition.
   uint32_t Cond = StackMgr.pop().get<uint32_t>();
+  profileBranch(StackMgr, Instr, Cond != 0);
 
   // If non-zero, run if-statement; else, run else-statement.
   if (Cond == 0) {
@@ -67,7 +68,9 @@ Expect<void> Executor::runBrOp(Runtime::StackManager &StackMgr,
 Expect<void> Executor::runBrIfOp(Runtime::StackManager &StackMgr,
                                  const AST::Instruction &Instr,
                                  AST::InstrView::iterator &PC) noexcept {
-  if (StackMgr.pop().get<uint32_t>() != 0) {
+  const bool Taken = StackMgr.pop().get<uint32_t>() != 0;
+  profileBranch(StackMgr, Instr, Taken);
+  if (Taken) {
     return runBrOp(StackMgr, Instr, PC);
   }
   return {};
@@ -147,9 +150,9 @@ Expect<void> Executor::runBrOnCastOp(Runtime::StackManager &StackMgr,
 Expect<void> Executor::runReturnOp(Runtime::StackManager &StackMgr,
                                    AST::InstrView::iterator &PC) noexcept {
   // Check stop token
-  if (unlikely(StopToken.exchange(0, std::memory_order_relaxed))) {
-    spdlog::error(ErrCode::Value::Interrupted);
-    return Unexpect(ErrCode::Value::Interrupted);
+  if (const uint32_t Token = StopToken.exchange(0, std::memory_order_relaxed);
+      unlikely(Token != 0)) {
+    EXPECTED_TRY(handleStopToken(Token));
   }
   PC = StackMgr.popFrame();
   return {};
@@ -224,31 +227,25 @@ Expect<void> Executor::runCallIndirectOp(Runtime::StackManager &StackMgr,
     return Unexpect(ErrCode::Value::UninitializedElement);
   }
 
-  // Check function type.
-  bool IsMatch = false;
-  if (FuncInst->getModule()) {
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), *ExpDefType.getTypeIndex(),
-        FuncInst->getModule()->getTypeList(), FuncInst->getTypeIndex());
-  } else {
-    // Independent host module instance case. Matching the composite type
-    // directly.
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), ExpDefType.getCompositeType(),
-        FuncInst->getHostFunc().getDefinedType().getCompositeType());
-  }
-  if (!IsMatch) {
-    auto &ExpFuncType = ExpDefType.getCompositeType().getFuncType();
-    auto &GotFuncType = FuncInst->getFuncType();
-    spdlog::error(ErrCode::Value::IndirectCallTypeMismatch);
-    spdlog::error(ErrInfo::InfoInstruction(Instr.getOpCode(), Instr.getOffset(),
-                                           {Idx},
-                                           {ValTypeFromType<uint32_t>()}));
-    spdlog::error(ErrInfo::InfoMismatch(
-        ExpFuncType.getParamTypes(), ExpFuncType.getReturnTypes(),
-        GotFuncType.getParamTypes(), GotFuncType.getReturnTypes()));
-    return Unexpect(ErrCode::Value::IndirectCallTypeMismatch);
+  // Check function type. The result only depends on the call site and the
+  // callee read from the table, so skip the check if it has passed before.
+  auto &Cache = StackMgr.getCallIndirectCache(&Instr, FuncInst);
+  if (Cache.Instr != &Instr || Cache.Func != FuncInst) {
+    if (!matchIndirectCallType(*ModInst, Instr.getTargetIndex(), *FuncInst)) {
+      auto &ExpFuncType = ExpDefType.getCompositeType().getFuncType();
+      auto &GotFuncType = FuncInst->getFuncType();
+      spdlog::error(ErrCode::Value::IndirectCallTypeMismatch);
+      spdlog::error(ErrInfo::InfoInstruction(
+          Instr.getOpCode(), Instr.getOffset(), {Idx},
+          {ValTypeFromType<uint32_t>()}));
+      spdlog::error(ErrInfo::InfoMismatch(
+          ExpFuncType.getParamTypes(), ExpFuncType.getReturnTypes(),
+          GotFuncType.getParamTypes(), GotFuncType.getReturnTypes()));
+      return Unexpect(ErrCode::Value::IndirectCallTypeMismatch);
+    }
+    Cache = {&Instr, FuncInst};
   }
+  profileIndirectCall(StackMgr, Instr, *FuncInst);
 
   // Enter the function.
   EXPECTED_TRY(auto NextPC,
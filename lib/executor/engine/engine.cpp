@@ -4,6 +4,7 @@
 #include "common/endian.h"
 #include "executor/coredump.h"
 #include "executor/executor.h"
+#include "system/perfcounter.h"
 #include "system/stacktrace.h"
 
 #include <array>
@@ -28,6 +29,11 @@ Executor::runFunction(Runtime::StackManager &StackMgr,
   if (Stat && Conf.getStatisticsConfigure().isTimeMeasuring()) {
     Stat->startRecordWasm();
   }
+  // Read the hardware counters at the start.
+  Statistics::HardwareCounterValues HwStart;
+  const bool HwCounting = Stat &&
+                          Conf.getStatisticsConfigure().isHardwareCounting() &&
+                          PerfCounter::read(HwStart);
 
   // Clear any trace from a previous execution; its entries may reference
   // modules that have since been freed.
@@ -51,15 +57,17 @@ Executor::runFunction(Runtime::StackManager &StackMgr,
     }
   }
 
-  // Enter and execute function.
+  // Enter and execute function. The instructions are fetched once, because
+  // the function may be upgraded to compiled mode when entering it.
+  const auto Instrs = Func.getInstrs();
   Expect<void> Res =
-      enterFunction(StackMgr, Func, Func.getInstrs().end(), false, true)
+      enterFunction(StackMgr, Func, Instrs.end(), false, true)
           .and_then([&](AST::InstrView::iterator StartIt) {
             // If not terminated, execute the instructions in interpreter mode.
             // For the entered AOT or host functions, `StartIt` is equal to
             // the end of instruction list, therefore the execution will return
             // immediately.
-            return execute(StackMgr, StartIt, Func.getInstrs().end());
+            return execute(StackMgr, StartIt, Instrs.end());
           });
 
   if (unlikely(!Res && Res.error() == ErrCode::Value::PendingException)) {
@@ -80,6 +88,12 @@ Executor::runFunction(Runtime::StackManager &StackMgr,
   if (Stat && Conf.getStatisticsConfigure().isTimeMeasuring()) {
     Stat->stopRecordWasm();
   }
+  if (HwCounting) {
+    Statistics::HardwareCounterValues HwStop;
+    if (PerfCounter::read(HwStop)) {
+      Stat->addInvocationCounters(HwStart, HwStop);
+    }
+  }
 
   // If statistics are enabled, dump them here.
   if (Stat) {
@@ -319,6 +333,7 @@ Expect<void> Executor::execute(Runtime::StackManager &StackMgr,
           Instr);
     case OpCode::Elem__drop:
       return runElemDropOp(
+          StackMgr,
           *getElemInstByIdx(StackMgr.getModule(), Instr.getTargetIndex()));
     case OpCode::Table__copy:
       return runTableCopyOp(
@@ -470,6 +485,7 @@ Expect<void> Executor::execute(Runtime::StackManager &StackMgr,
           Instr);
     case OpCode::Data__drop:
       return runDataDropOp(
+          StackMgr,
           *getDataInstByIdx(StackMgr.getModule(), Instr.getTargetIndex()));
     case OpCode::Memory__copy:
       return runMemoryCopyOp(
@@ -24,7 +24,7 @@ Executor::runMemoryGrowOp(Runtime::StackManager &StackMgr,
 
   // Grow the page and push the result.
   const uint64_t CurrPageSize = MemInst.getPageSize();
-  if (MemInst.growPage(N)) {
+  if (growMemory(*StackMgr.getModule(), MemInst, N)) {
     StackMgr.push(emplaceAddr(CurrPageSize, AddrType));
   } else {
     StackMgr.push(emplaceAddr(static_cast<uint64_t>(-1), AddrType));
@@ -53,8 +53,11 @@ Expect<void> Executor::runMemoryInitOp(
 }
 
 Expect<void>
-Executor::runDataDropOp(Runtime::Instance::DataInstance &DataInst) {
-  // Clear data instance.
+Executor::runDataDropOp(Runtime::StackManager &StackMgr,
+                        Runtime::Instance::DataInstance &DataInst) {
+  // Clear data instance, and release its data charged at instantiation.
+  StackMgr.getModule()->releaseMemory(MemoryCategory::Segment,
+                                      DataInst.getData().size());
   DataInst.clear();
   return {};
 }
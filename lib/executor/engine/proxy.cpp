@@ -4,7 +4,10 @@
 #include "executor/executor.h"
 #include "system/fault.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <vector>
 
 namespace WasmEdge {
 namespace Executor {
@@ -131,6 +134,7 @@ const Executable::IntrinsicsTable Executor::Intrinsics = {
     ENTRY(kThrow, proxyThrow),
     ENTRY(kThrowRef, proxyThrowRef),
     ENTRY(kCatchPop, proxyCatchPop),
+    ENTRY(kCheckStop, proxyCheckStop),
 #undef ENTRY
 };
 
@@ -138,6 +142,42 @@ const Executable::IntrinsicsTable Executor::Intrinsics = {
 #pragma clang diagnostic pop
 #endif
 
+Expect<void> Executor::callHostFromCompiled(
+    const Runtime::Instance::FunctionInstance &Func,
+    const Runtime::Instance::ModuleInstance *ModInst, const ValVariant *Args,
+    ValVariant *Rets) noexcept {
+  // Check whether interruption occurred.
+  if (const uint32_t Token = StopToken.exchange(0, std::memory_order_relaxed);
+      unlikely(Token != 0)) {
+    EXPECTED_TRY(handleStopToken(Token));
+  }
+
+  // The args are cleaned in place, so copy them out of the caller's buffer.
+  // Most host functions take few args, which fit on the native stack.
+  const auto &FuncType = Func.getFuncType();
+  const uint32_t ParamsSize =
+      static_cast<uint32_t>(FuncType.getParamTypes().size());
+  const uint32_t ReturnsSize =
+      static_cast<uint32_t>(FuncType.getReturnTypes().size());
+  std::array<ValVariant, 8> SmallArgs;
+  std::vector<ValVariant> LargeArgs;
+  Span<ValVariant> HostArgs;
+  if (ParamsSize <= SmallArgs.size()) {
+    HostArgs = Span<ValVariant>(SmallArgs.data(), ParamsSize);
+  } else {
+    LargeArgs.resize(ParamsSize);
+    HostArgs = LargeArgs;
+  }
+  std::copy_n(Args, ParamsSize, HostArgs.begin());
+
+  auto Res = runHostFunction(Func, ModInst, HostArgs,
+                             Span<ValVariant>(Rets, ReturnsSize));
+  if (unlikely(!Res) && Res.error() == ErrCode::Value::PendingException) {
+    return {};
+  }
+  return Res;
+}
+
 Expect<void> Executor::proxyTrap(Runtime::StackManager &,
                                  const uint32_t Code) noexcept {
   return Unexpect(static_cast<ErrCategory>(Code >> 24), Code);
@@ -151,6 +191,10 @@ Executor::proxyCall(Runtime::StackManager &StackMgr,
   const auto *FuncInst = getFuncInstByIdx(ModInst, FuncIdx);
   assuming(FuncInst);
   EXPECTED_TRY(checkLazyCompilation(FuncInst));
+  if (FuncInst->isHostFunction()) {
+    return callHostFromCompiled(*FuncInst, ModInst, Args, Rets);
+  }
+
   const auto &FuncType = FuncInst->getFuncType();
   const uint32_t ParamsSize =
       static_cast<uint32_t>(FuncType.getParamTypes().size());
@@ -188,28 +232,19 @@ Executor::proxyCallIndirect(Runtime::StackManager &StackMgr,
   }
 
   assuming(ModInst);
-  const auto &ExpDefType = *ModInst->unsafeGetType(FuncTypeIdx);
   const auto *FuncInst = retrieveFuncRef(*Ref);
   assuming(FuncInst);
 
   EXPECTED_TRY(checkLazyCompilation(FuncInst));
 
-  bool IsMatch = false;
-  if (FuncInst->getModule()) {
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), *ExpDefType.getTypeIndex(),
-        FuncInst->getModule()->getTypeList(), FuncInst->getTypeIndex());
-  } else {
-    // Independent host module instance case. Matching the composite type
-    // directly.
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), ExpDefType.getCompositeType(),
-        FuncInst->getHostFunc().getDefinedType().getCompositeType());
-  }
-  if (!IsMatch) {
+  if (!matchIndirectCallType(*ModInst, FuncTypeIdx, *FuncInst)) {
     return Unexpect(ErrCode::Value::IndirectCallTypeMismatch);
   }
 
+  if (FuncInst->isHostFunction()) {
+    return callHostFromCompiled(*FuncInst, ModInst, Args, Rets);
+  }
+
   const auto &FuncType = FuncInst->getFuncType();
   const uint32_t ParamsSize =
       static_cast<uint32_t>(FuncType.getParamTypes().size());
@@ -239,6 +274,10 @@ Executor::proxyCallRef(Runtime::StackManager &StackMgr,
 
   EXPECTED_TRY(checkLazyCompilation(FuncInst));
 
+  if (FuncInst->isHostFunction()) {
+    return callHostFromCompiled(*FuncInst, ModInst, Args, Rets);
+  }
+
   const auto &FuncType = FuncInst->getFuncType();
   const uint32_t ParamsSize =
       static_cast<uint32_t>(FuncType.getParamTypes().size());
@@ -457,6 +496,8 @@ Executor::proxyElemDrop(Runtime::StackManager &,
                         const uint32_t ElemIdx) noexcept {
   auto *ElemInst = getElemInstByIdx(ModInst, ElemIdx);
   assuming(ElemInst);
+  ModInst->releaseMemory(MemoryCategory::Segment,
+                         ElemInst->getRefs().size() * sizeof(RefVariant));
   ElemInst->clear();
   return {};
 }
@@ -483,7 +524,7 @@ Executor::proxyTableGrow(Runtime::StackManager &,
   assuming(TabInst);
   const auto AddrType = TabInst->getTableType().getLimit().getAddrType();
   const uint64_t CurrTableSize = TabInst->getSize();
-  if (likely(TabInst->growTable(NewSize, Val))) {
+  if (likely(growTable(*ModInst, *TabInst, NewSize, Val))) {
     return CurrTableSize;
   } else {
     switch (AddrType) {
@@ -515,7 +556,7 @@ Executor::proxyMemGrow(Runtime::StackManager &,
   assuming(MemInst);
   const auto AddrType = MemInst->getMemoryType().getLimit().getAddrType();
   const uint64_t CurrPageSize = MemInst->getPageSize();
-  if (MemInst->growPage(NewSize)) {
+  if (growMemory(*ModInst, *MemInst, NewSize)) {
     return CurrPageSize;
   } else {
     switch (AddrType) {
@@ -546,6 +587,7 @@ Executor::proxyDataDrop(Runtime::StackManager &,
                         const uint32_t DataIdx) noexcept {
   auto *DataInst = getDataInstByIdx(ModInst, DataIdx);
   assuming(DataInst);
+  ModInst->releaseMemory(MemoryCategory::Segment, DataInst->getData().size());
   DataInst->clear();
   return {};
 }
@@ -617,32 +659,13 @@ Expect<void *> Executor::proxyTableGetFuncSymbol(
     return Unexpect(ErrCode::Value::UninitializedElement);
   }
 
-  const auto &ExpDefType = *ModInst->unsafeGetType(FuncTypeIdx);
   const auto *FuncInst = retrieveFuncRef(*Ref);
   assuming(FuncInst);
-  bool IsMatch = false;
-  // Check if the function type matches the expected type.
-  if (FuncInst->getModule() == ModInst &&
-      *ExpDefType.getTypeIndex() == FuncInst->getTypeIndex()) {
-    // Fast path: If the function instance is in the same module instance, we
-    // can bypass the expensive structural type matching (O(N)) by checking the
-    // type index directly (O(1)).
-    IsMatch = true;
-  } else if (FuncInst->getModule()) {
-    // If the type index is not the same, we still need to check the type
-    // structure. This is because the type alias may have different type
-    // indices but the same type structure.
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), *ExpDefType.getTypeIndex(),
-        FuncInst->getModule()->getTypeList(), FuncInst->getTypeIndex());
-  } else {
-    // Independent host module instance case. Matching the composite type
-    // directly.
-    IsMatch = AST::TypeMatcher::matchType(
-        ModInst->getTypeList(), ExpDefType.getCompositeType(),
-        FuncInst->getHostFunc().getDefinedType().getCompositeType());
-  }
-  if (!IsMatch) {
+  // Check if the function type matches the expected type. The same type
+  // index in the same module needs no lookup at all.
+  if ((FuncInst->getModule() != ModInst ||
+       FuncTypeIdx != FuncInst->getTypeIndex()) &&
+      !matchIndirectCallType(*ModInst, FuncTypeIdx, *FuncInst)) {
     return Unexpect(ErrCode::Value::IndirectCallTypeMismatch);
   }
 
@@ -755,5 +778,10 @@ Executor::proxyCatchPop(Runtime::StackManager &,
   return {};
 }
 
+Expect<void> Executor::proxyCheckStop(Runtime::StackManager &,
+                                      const uint32_t Token) noexcept {
+  return handleStopToken(Token);
+}
+
 } // namespace Executor
 } // namespace WasmEdge
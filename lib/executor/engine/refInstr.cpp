@@ -425,6 +425,9 @@ Executor::structNew(const Runtime::Instance::ModuleInstance *ModInstArg,
   /// This may be changed after applying the garbage collection mechanism.
   const auto &CompType = getCompositeTypeByIdx(ModInstArg, TypeIdx);
   uint32_t N = static_cast<uint32_t>(CompType.getFieldTypes().size());
+  EXPECTED_TRY(chargeGCMemory(*ModInstArg,
+                              sizeof(Runtime::Instance::StructInstance) +
+                                  uint64_t(N) * sizeof(ValVariant)));
   auto *ModInst = const_cast<Runtime::Instance::ModuleInstance *>(ModInstArg);
   std::vector<ValVariant> Vals(N);
   for (uint32_t I = 0; I < N; I++) {
@@ -475,6 +478,9 @@ Executor::arrayNew(const Runtime::Instance::ModuleInstance *ModInstArg,
   /// instance because they refer to the defined types of the module instances.
   /// This may be changed after applying the garbage collection mechanism.
   const auto &VType = getArrayStorageTypeByIdx(ModInstArg, TypeIdx);
+  EXPECTED_TRY(chargeGCMemory(*ModInstArg,
+                              sizeof(Runtime::Instance::ArrayInstance) +
+                                  uint64_t(Length) * sizeof(ValVariant)));
   WasmEdge::Runtime::Instance::ArrayInstance *Inst = nullptr;
   auto *ModInst = const_cast<Runtime::Instance::ModuleInstance *>(ModInstArg);
   if (Args.size() == 0) {
@@ -508,6 +514,9 @@ Executor::arrayNewData(const Runtime::Instance::ModuleInstance *ModInstArg,
       DataInst->getData().size()) {
     return Unexpect(ErrCode::Value::MemoryOutOfBounds);
   }
+  EXPECTED_TRY(chargeGCMemory(*ModInstArg,
+                              sizeof(Runtime::Instance::ArrayInstance) +
+                                  uint64_t(Length) * sizeof(ValVariant)));
   auto *ModInst = const_cast<Runtime::Instance::ModuleInstance *>(ModInstArg);
   std::vector<ValVariant> Args;
   Args.reserve(Length);
@@ -533,6 +542,9 @@ Executor::arrayNewElem(const Runtime::Instance::ModuleInstance *ModInstArg,
       ElemSrc.size()) {
     return Unexpect(ErrCode::Value::TableOutOfBounds);
   }
+  EXPECTED_TRY(chargeGCMemory(*ModInstArg,
+                              sizeof(Runtime::Instance::ArrayInstance) +
+                                  uint64_t(Length) * sizeof(ValVariant)));
   std::vector<ValVariant> Refs(ElemSrc.begin() + Start,
                                ElemSrc.begin() + Start + Length);
   auto *ModInst = const_cast<Runtime::Instance::ModuleInstance *>(ModInstArg);
@@ -69,8 +69,12 @@ Executor::runTableInitOp(Runtime::StackManager &StackMgr,
 }
 
 Expect<void>
-Executor::runElemDropOp(Runtime::Instance::ElementInstance &ElemInst) {
-  // Clear element instance.
+Executor::runElemDropOp(Runtime::StackManager &StackMgr,
+                        Runtime::Instance::ElementInstance &ElemInst) {
+  // Clear element instance, and release its references charged at
+  // instantiation.
+  StackMgr.getModule()->releaseMemory(
+      MemoryCategory::Segment, ElemInst.getRefs().size() * sizeof(RefVariant));
   ElemInst.clear();
   return {};
 }
@@ -108,7 +112,7 @@ Executor::runTableGrowOp(Runtime::StackManager &StackMgr,
 
   // Grow size and push result.
   const uint64_t CurrSize = TabInst.getSize();
-  if (TabInst.growTable(N, Ref)) {
+  if (growTable(*StackMgr.getModule(), TabInst, N, Ref)) {
     StackMgr.push(emplaceAddr(CurrSize, AddrType));
   } else {
     StackMgr.push(emplaceAddr(static_cast<uint64_t>(-1), AddrType));
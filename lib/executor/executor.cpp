@@ -79,10 +79,39 @@ Executor::registerModule(Runtime::StoreManager &StoreMgr,
   });
 }
 
+/// Instantiate a WASM Module from the template. See
+/// "include/executor/executor.h".
+Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
+Executor::instantiateModule(Runtime::StoreManager &StoreMgr,
+                            const InstancePre &Pre) {
+  return instantiate(StoreMgr, Pre.getModule(), std::nullopt, &Pre)
+      .map_error([this](auto E) {
+        if (Stat) {
+          Stat->dumpToLog(Conf);
+        }
+        return E;
+      });
+}
+
+/// Register a named WASM module from the template. See
+/// "include/executor/executor.h".
+Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
+Executor::registerModule(Runtime::StoreManager &StoreMgr,
+                         const InstancePre &Pre, std::string_view Name) {
+  return instantiate(StoreMgr, Pre.getModule(), Name, &Pre)
+      .map_error([this](auto E) {
+        if (Stat) {
+          Stat->dumpToLog(Conf);
+        }
+        return E;
+      });
+}
+
 /// Register an instantiated module. See "include/executor/executor.h".
 Expect<void>
 Executor::registerModule(Runtime::StoreManager &StoreMgr,
                          const Runtime::Instance::ModuleInstance &ModInst) {
+  EXPECTED_TRY(chargeHostModule(ModInst));
   return StoreMgr.registerModule(&ModInst).map_error([](auto E) {
     spdlog::error(E);
     spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
@@ -95,6 +124,7 @@ Expect<void>
 Executor::registerModule(Runtime::StoreManager &StoreMgr,
                          const Runtime::Instance::ModuleInstance &ModInst,
                          std::string_view Name) {
+  EXPECTED_TRY(chargeHostModule(ModInst));
   return StoreMgr.registerModule(&ModInst, Name).map_error([](auto E) {
     spdlog::error(E);
     spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
@@ -144,6 +174,43 @@ Expect<void> Executor::registerPostHostFunction(
   return {};
 }
 
+/// Set the execution profile. See "include/executor/executor.h".
+void Executor::setProfile(
+    Profile::Profile *P,
+    const Runtime::Instance::ModuleInstance *ModInst) noexcept {
+  Prof = P;
+  ProfModInst = ModInst;
+  if (P == nullptr || ModInst == nullptr) {
+    return;
+  }
+  // Create the counters of the defined functions and hash their code for the
+  // compiler to check the profile with.
+  uint64_t Hash = 0;
+  for (const auto *Func : ModInst->getFunctionInstances()) {
+    if (Func->getModule() != ModInst || !Func->isWasmFunction()) {
+      continue;
+    }
+    const auto Instrs = Func->getInstrs();
+    P->addFunction(Instrs.front().getOffset());
+    for (const auto &Instr : Instrs) {
+      Hash = Profile::Profile::hashInstr(
+          Hash, Instr.getOffset(), static_cast<uint32_t>(Instr.getOpCode()));
+      switch (Instr.getOpCode()) {
+      case OpCode::If:
+      case OpCode::Br_if:
+        P->addBranch(Instr.getOffset());
+        break;
+      case OpCode::Call_indirect:
+        P->addIndirectCall(Instr.getOffset());
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  P->setModuleHash(Hash);
+}
+
 /// Invoke function. See "include/executor/executor.h".
 Expect<std::vector<std::pair<ValVariant, ValType>>>
 Executor::invoke(const Runtime::Instance::FunctionInstance *FuncInst,
@@ -190,7 +257,13 @@ Executor::invoke(const Runtime::Instance::FunctionInstance *FuncInst,
   Runtime::StackManager StackMgr;
 
   // Call runFunction.
-  EXPECTED_TRY(runFunction(StackMgr, *FuncInst, Params).map_error([](auto E) {
+  auto Res = runFunction(StackMgr, *FuncInst, Params);
+  // The stacks only live during the invocation, so only their peak is
+  // recorded.
+  if (MemAccount) {
+    MemAccount->sample(MemoryCategory::Stack, StackMgr.getMemorySize());
+  }
+  EXPECTED_TRY(std::move(Res).map_error([](auto E) {
     if (E != ErrCode::Value::Terminated) {
       dumpStackTrace(
           Span<const StackTraceEntry>{StackTrace}.first(StackTraceSize));
@@ -6,17 +6,50 @@
 #include "common/spdlog.h"
 #include "runtime/storemgr.h"
 #include "system/fault.h"
+#include "system/perfcounter.h"
 #include "system/stacktrace.h"
 
 #include <cstdint>
+#include <future>
+#include <memory>
+#include <numeric>
 #include <shared_mutex>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+using namespace std::literals;
+
 namespace WasmEdge {
 namespace Executor {
 
+namespace {
+/// Get the name of a host function from its module and export names.
+std::string
+getHostFuncName(const Runtime::Instance::FunctionInstance &Func) noexcept {
+  const auto *ModInst = Func.getModule();
+  if (ModInst == nullptr) {
+    return "<anonymous>"s;
+  }
+  std::string Name(ModInst->getModuleName());
+  Name += "::"sv;
+  const bool Found = ModInst->getFuncExports([&](const auto &FuncExports) {
+    for (const auto &[ExportName, Inst] : FuncExports) {
+      if (Inst == &Func) {
+        Name += ExportName;
+        return true;
+      }
+    }
+    return false;
+  });
+  if (!Found) {
+    Name += "<anonymous>"sv;
+  }
+  return Name;
+}
+} // namespace
+
 Executor::SavedThreadLocal::SavedThreadLocal(
     Executor &Ex, Runtime::StackManager &StackMgr,
     [[maybe_unused]] const Runtime::Instance::FunctionInstance &Func) noexcept {
@@ -45,6 +78,254 @@ Executor::SavedThreadLocal::~SavedThreadLocal() noexcept {
   This = SavedThis;
 }
 
+void Executor::SuspendedThreadLocal::save() noexcept {
+  This = std::exchange(Executor::This, nullptr);
+  CurrentStack = std::exchange(Executor::CurrentStack, nullptr);
+  ExecutionContext = std::exchange(Executor::ExecutionContext, {});
+  PendingExn = std::exchange(Executor::PendingExn, {});
+  StackTraceSize = std::exchange(Executor::StackTraceSize, 0);
+  FaultHandlers = Fault::swapHandlers(nullptr);
+}
+
+void Executor::SuspendedThreadLocal::restore() noexcept {
+  Executor::This = This;
+  Executor::CurrentStack = CurrentStack;
+  Executor::ExecutionContext = ExecutionContext;
+  Executor::PendingExn = std::move(PendingExn);
+  Executor::StackTraceSize = StackTraceSize;
+  Fault::swapHandlers(FaultHandlers);
+}
+
+Expect<void> Executor::handleStopToken(uint32_t Token) noexcept {
+  if (Token & kStopTokenStop) {
+    spdlog::error(ErrCode::Value::Interrupted);
+    return Unexpect(ErrCode::Value::Interrupted);
+  }
+  if ((Token & kStopTokenYield) && YieldHandler) {
+    suspendExecution();
+  }
+  return {};
+}
+
+void Executor::suspendExecution() noexcept {
+  // Other executions may run on this thread before the resumption, so the
+  // thread local states are put aside meanwhile.
+  SuspendedThreadLocal Saved;
+  Saved.save();
+  YieldHandler();
+  Saved.restore();
+}
+
+void Executor::awaitHost(AsyncStart Start) noexcept {
+  if (!AwaitHandler) {
+    // The promise is shared, as the callback may still be running when the
+    // waiting returns.
+    auto Promise = std::make_shared<std::promise<void>>();
+    auto Future = Promise->get_future();
+    Start([Promise]() { Promise->set_value(); });
+    Future.wait();
+    return;
+  }
+  // The handler may be replaced while the execution is suspended in it.
+  auto Handler = AwaitHandler;
+  SuspendedThreadLocal Saved;
+  Saved.save();
+  Handler(std::move(Start));
+  Saved.restore();
+}
+
+Expect<void>
+Executor::chargeInstanceMemory(Runtime::Instance::ModuleInstance &ModInst,
+                               const AST::Module &Mod) noexcept {
+  // Only the passive segments are kept after the instantiation. The active
+  // and declarative ones are dropped by the table and memory initialization
+  // without releasing any charge, so they are not charged here.
+  uint64_t SegmentBytes = 0;
+  const auto &ElemSegs = Mod.getElementSection().getContent();
+  for (size_t I = 0; I < ElemSegs.size(); ++I) {
+    if (ElemSegs[I].getMode() == AST::ElementSegment::ElemMode::Passive) {
+      SegmentBytes +=
+          ModInst.OwnedElemInsts[I]->getRefs().size() * sizeof(RefVariant);
+    }
+  }
+  const auto &DataSegs = Mod.getDataSection().getContent();
+  for (size_t I = 0; I < DataSegs.size(); ++I) {
+    if (DataSegs[I].getMode() == AST::DataSegment::DataMode::Passive) {
+      SegmentBytes += ModInst.OwnedDataInsts[I]->getData().size();
+    }
+  }
+  const std::pair<MemoryCategory, uint64_t> Charges[] = {
+      {MemoryCategory::LinearMemory,
+       std::accumulate(ModInst.OwnedMemInsts.begin(),
+                       ModInst.OwnedMemInsts.end(), uint64_t(0),
+                       [](uint64_t Sum, const auto &MemInst) {
+                         return Sum + MemInst->getSize();
+                       })},
+      {MemoryCategory::Table,
+       std::accumulate(ModInst.OwnedTabInsts.begin(),
+                       ModInst.OwnedTabInsts.end(), uint64_t(0),
+                       [](uint64_t Sum, const auto &TabInst) {
+                         return Sum + TabInst->getSize() * sizeof(RefVariant);
+                       })},
+      {MemoryCategory::Segment, SegmentBytes},
+      {MemoryCategory::Code, Mod.getCodeSize()},
+  };
+  for (const auto &[Category, Bytes] : Charges) {
+    if (unlikely(!ModInst.chargeMemory(Category, Bytes))) {
+      spdlog::error(ErrCode::Value::MemoryLimitExceeded);
+      return Unexpect(ErrCode::Value::MemoryLimitExceeded);
+    }
+  }
+  return {};
+}
+
+Expect<void> Executor::chargeHostModule(
+    const Runtime::Instance::ModuleInstance &ModInst) noexcept {
+  if (unlikely(!ModInst.attachMemoryAccount(MemAccount))) {
+    spdlog::error(ErrCode::Value::MemoryLimitExceeded);
+    spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
+    return Unexpect(ErrCode::Value::MemoryLimitExceeded);
+  }
+  return {};
+}
+
+bool Executor::growMemory(const Runtime::Instance::ModuleInstance &ModInst,
+                          Runtime::Instance::MemoryInstance &MemInst,
+                          uint64_t Pages) noexcept {
+  using Runtime::Instance::MemoryInstance;
+  if (unlikely(Pages > UINT64_MAX / MemoryInstance::kPageSize)) {
+    return false;
+  }
+  const uint64_t Bytes = Pages * MemoryInstance::kPageSize;
+  if (unlikely(!ModInst.chargeMemory(MemoryCategory::LinearMemory, Bytes))) {
+    return false;
+  }
+  if (unlikely(!MemInst.growPage(Pages))) {
+    ModInst.releaseMemory(MemoryCategory::LinearMemory, Bytes);
+    return false;
+  }
+  return true;
+}
+
+bool Executor::growTable(const Runtime::Instance::ModuleInstance &ModInst,
+                         Runtime::Instance::TableInstance &TabInst,
+                         uint64_t Size, const RefVariant &Val) noexcept {
+  if (unlikely(Size > UINT64_MAX / sizeof(RefVariant))) {
+    return false;
+  }
+  const uint64_t Bytes = Size * sizeof(RefVariant);
+  if (unlikely(!ModInst.chargeMemory(MemoryCategory::Table, Bytes))) {
+    return false;
+  }
+  if (unlikely(!TabInst.growTable(Size, Val))) {
+    ModInst.releaseMemory(MemoryCategory::Table, Bytes);
+    return false;
+  }
+  return true;
+}
+
+Expect<void>
+Executor::chargeGCMemory(const Runtime::Instance::ModuleInstance &ModInst,
+                         uint64_t Bytes) const noexcept {
+  // The GC objects live as long as the module instance owning them.
+  if (unlikely(!ModInst.chargeMemory(MemoryCategory::GC, Bytes))) {
+    spdlog::error(ErrCode::Value::MemoryLimitExceeded);
+    return Unexpect(ErrCode::Value::MemoryLimitExceeded);
+  }
+  return {};
+}
+
+bool Executor::matchIndirectCallType(
+    const Runtime::Instance::ModuleInstance &ModInst, uint32_t TypeIdx,
+    const Runtime::Instance::FunctionInstance &FuncInst) const noexcept {
+  // The canonical type IDs are equal if and only if the types are equivalent.
+  // A mismatch may still be a subtype, or a host function without an ID.
+  const uint32_t ExpID = ModInst.getCanonicalTypeID(TypeIdx);
+  if (likely(ExpID != 0 && ExpID == FuncInst.getCanonicalTypeID())) {
+    return true;
+  }
+  const auto &ExpDefType = *ModInst.unsafeGetType(TypeIdx);
+  if (FuncInst.getModule()) {
+    return AST::TypeMatcher::matchType(
+        ModInst.getTypeList(), *ExpDefType.getTypeIndex(),
+        FuncInst.getModule()->getTypeList(), FuncInst.getTypeIndex());
+  }
+  // Independent host module instance case. Matching the composite type
+  // directly.
+  return AST::TypeMatcher::matchType(
+      ModInst.getTypeList(), ExpDefType.getCompositeType(),
+      FuncInst.getHostFunc().getDefinedType().getCompositeType());
+}
+
+Expect<void>
+Executor::runHostFunction(const Runtime::Instance::FunctionInstance &Func,
+                          const Runtime::Instance::ModuleInstance *ModInst,
+                          Span<ValVariant> Args, Span<ValVariant> Rets) {
+  auto &HostFunc = Func.getHostFunc();
+  const auto &FuncType = Func.getFuncType();
+
+  // Finalize the host module on its first host-function invocation, after
+  // which adding host instances to it is rejected.
+  if (const auto *HostModInst = Func.getModule()) {
+    HostModInst->finalizeInstantiation();
+  }
+  Runtime::CallingFrame CallFrame(this, ModInst, &Func);
+
+  // Do the statistics if the statistics turned on.
+  if (Stat) {
+    // Check host function cost.
+    if (unlikely(!Stat->addCost(HostFunc.getCost()))) {
+      spdlog::error(ErrCode::Value::CostLimitExceeded);
+      return Unexpect(ErrCode::Value::CostLimitExceeded);
+    }
+    // Start recording time of running host function.
+    Stat->stopRecordWasm();
+    Stat->startRecordHost();
+  }
+  Statistics::HardwareCounterValues HwStart;
+  const bool HwCounting = Stat &&
+                          Conf.getStatisticsConfigure().isHardwareCounting() &&
+                          PerfCounter::read(HwStart);
+
+  // Call pre-host-function
+  HostFuncHelper.invokePreHostFunc();
+
+  // Run host function.
+  for (uint32_t I = 0; I < Args.size(); I++) {
+    // For the number type cases of the arguments, the unused bits should be
+    // erased due to the security issue.
+    cleanNumericVal(Args[I], FuncType.getParamTypes()[I]);
+  }
+  auto Ret = HostFunc.run(CallFrame, Args, Rets);
+
+  // Call post-host-function
+  HostFuncHelper.invokePostHostFunc();
+
+  // Do the statistics if the statistics turned on.
+  if (HwCounting) {
+    Statistics::HardwareCounterValues HwStop;
+    if (PerfCounter::read(HwStop)) {
+      Stat->addHostFuncCounters(
+          &Func, [&Func]() { return getHostFuncName(Func); }, HwStart, HwStop);
+    }
+  }
+  if (Stat) {
+    // Stop recording time of running host function.
+    Stat->stopRecordHost();
+    Stat->startRecordWasm();
+  }
+
+  // Check the host function execution status.
+  if (!Ret) {
+    if (Ret.error() == ErrCode::Value::HostFuncError ||
+        Ret.error().getCategory() != ErrCategory::WASM) {
+      spdlog::error(Ret.error());
+    }
+    return Unexpect(Ret);
+  }
+  return {};
+}
+
 Expect<AST::InstrView::iterator> Executor::enterFunction(
     Runtime::StackManager &StackMgr,
     const Runtime::Instance::FunctionInstance &Func,
@@ -53,9 +334,17 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
   // RetIt: the return position when the entered function returns.
 
   // Check whether interruption occurred.
-  if (unlikely(StopToken.exchange(0, std::memory_order_relaxed))) {
-    spdlog::error(ErrCode::Value::Interrupted);
-    return Unexpect(ErrCode::Value::Interrupted);
+  if (const uint32_t Token = StopToken.exchange(0, std::memory_order_relaxed);
+      unlikely(Token != 0)) {
+    EXPECTED_TRY(handleStopToken(Token));
+  }
+
+  // Swap in the background-compiled code before entering the function, so
+  // that the function itself already runs in compiled mode.
+  if (unlikely(TierUpRequested.load(std::memory_order_relaxed)) &&
+      TierUpRequested.exchange(false, std::memory_order_acquire) &&
+      TierUpHandler) {
+    TierUpHandler();
   }
 
   // Get the function type for the parameter and return counts.
@@ -73,13 +362,6 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
 
   if (Func.isHostFunction()) {
     // Host function case: Push args and call function.
-    auto &HostFunc = Func.getHostFunc();
-
-    // Finalize the host module on its first host-function invocation, after
-    // which adding host instances to it is rejected.
-    if (const auto *HostModInst = Func.getModule()) {
-      HostModInst->finalizeInstantiation();
-    }
 
     // Generate CallingFrame from current frame.
     // The module instance will be nullptr if current frame is a dummy frame.
@@ -91,7 +373,6 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
     if (ModInst == nullptr) {
       ModInst = Func.getModule();
     }
-    Runtime::CallingFrame CallFrame(this, ModInst);
 
     // Push frame.
     StackMgr.pushFrame(Func.getModule(), // Module instance
@@ -102,54 +383,12 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
                        IsNativeEntry     // For native entry
     );
 
-    // Do the statistics if the statistics turned on.
-    if (Stat) {
-      // Check host function cost.
-      if (unlikely(!Stat->addCost(HostFunc.getCost()))) {
-        spdlog::error(ErrCode::Value::CostLimitExceeded);
-        return Unexpect(ErrCode::Value::CostLimitExceeded);
-      }
-      // Start recording time of running host function.
-      Stat->stopRecordWasm();
-      Stat->startRecordHost();
-    }
-
-    // Call pre-host-function
-    HostFuncHelper.invokePreHostFunc();
-
-    // Run host function.
-    Span<ValVariant> Args = StackMgr.getTopSpan(ArgsN);
-    for (uint32_t I = 0; I < ArgsN; I++) {
-      // For the number type cases of the arguments, the unused bits should be
-      // erased due to the security issue.
-      cleanNumericVal(Args[I], FuncType.getParamTypes()[I]);
-    }
-    std::vector<ValVariant> Rets(RetsN);
-    auto Ret = HostFunc.run(CallFrame, std::move(Args), Rets);
-
-    // Call post-host-function
-    HostFuncHelper.invokePostHostFunc();
-
-    // Do the statistics if the statistics turned on.
-    if (Stat) {
-      // Stop recording time of running host function.
-      Stat->stopRecordHost();
-      Stat->startRecordWasm();
-    }
-
-    // Check the host function execution status.
-    if (!Ret) {
-      if (Ret.error() == ErrCode::Value::HostFuncError ||
-          Ret.error().getCategory() != ErrCategory::WASM) {
-        spdlog::error(Ret.error());
-      }
-      return Unexpect(Ret);
-    }
-
-    // Push returns back to the stack.
-    for (auto &R : Rets) {
-      StackMgr.push(std::move(R));
-    }
+    // Reserve the returns on the stack above the args, so the host function
+    // writes them in place.
+    StackMgr.pushZeros(RetsN);
+    Span<ValVariant> ArgsRets = StackMgr.getTopSpan(ArgsN + RetsN);
+    EXPECTED_TRY(runHostFunction(Func, ModInst, ArgsRets.first(ArgsN),
+                                 ArgsRets.last(RetsN)));
 
     // A tail call pops the replaced caller's frame, whose `From` is one before
     // its resume point, so step it forward one instruction for `runCallOp`.
@@ -250,6 +489,9 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
     return IsTailCall ? Continuation + 1 : Continuation;
   } else {
     // WASM interpreter case: Jump to the start of the function body.
+    if (unlikely(Prof != nullptr) && Func.getModule() == ProfModInst) {
+      Prof->countCall(Instrs.front().getOffset());
+    }
 
     // Push local variables into the stack.
     for (auto &Def : Func.getLocals()) {
@@ -266,10 +508,13 @@ Expect<AST::InstrView::iterator> Executor::enterFunction(
         for (uint32_t I = 0; I < Def.first; I++) {
           StackMgr.push(InitVal);
         }
-      } else {
+      } else if (Def.second.isRefType()) {
         for (uint32_t I = 0; I < Def.first; I++) {
           StackMgr.push(ValueFromType(Def.second));
         }
+      } else {
+        // The number and vector locals are zeroed entries.
+        StackMgr.pushZeros(Def.first);
       }
     }
 
@@ -341,9 +586,9 @@ Executor::branchToLabel(Runtime::StackManager &StackMgr,
                         const AST::Instruction::JumpDescriptor &JumpDesc,
                         AST::InstrView::iterator &PC) noexcept {
   // Check the stop token.
-  if (unlikely(StopToken.exchange(0, std::memory_order_relaxed))) {
-    spdlog::error(ErrCode::Value::Interrupted);
-    return Unexpect(ErrCode::Value::Interrupted);
+  if (const uint32_t Token = StopToken.exchange(0, std::memory_order_relaxed);
+      unlikely(Token != 0)) {
+    EXPECTED_TRY(handleStopToken(Token));
   }
 
   StackMgr.eraseValueStack(JumpDesc.StackEraseBegin, JumpDesc.StackEraseEnd);
@@ -32,12 +32,6 @@ Executor::instantiate(Runtime::Instance::ComponentImportManager &ImportMgr,
   std::unique_ptr<Runtime::Instance::ModuleInstance> ModInst =
       std::make_unique<Runtime::Instance::ModuleInstance>("");
 
-  // Instantiate Function Types in Module Instance. (TypeSec)
-  for (auto &SubType : Mod.getTypeSection().getContent()) {
-    // Copy defined types to module instance.
-    ModInst->addDefinedType(SubType);
-  }
-
   auto ReportError = [](ASTNodeAttr Attr) {
     return [Attr](auto E) {
       spdlog::error(ErrInfo::InfoAST(Attr));
@@ -46,6 +40,10 @@ Executor::instantiate(Runtime::Instance::ComponentImportManager &ImportMgr,
     };
   };
 
+  // Instantiate Function Types in Module Instance. (TypeSec)
+  EXPECTED_TRY(instantiate(*ModInst, Mod.getTypeSection())
+                   .map_error(ReportError(ASTNodeAttr::Sec_Type)));
+
   // Instantiate ImportSection and do import matching. (ImportSec)
   const AST::ImportSection &ImportSec = Mod.getImportSection();
   EXPECTED_TRY(instantiate(
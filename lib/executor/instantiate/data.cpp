@@ -6,6 +6,7 @@
 #include "common/errinfo.h"
 #include "common/spdlog.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace WasmEdge {
@@ -14,27 +15,36 @@ namespace Executor {
 // Instantiate data instance. See "include/executor/executor.h".
 Expect<void> Executor::instantiate(Runtime::StackManager &StackMgr,
                                    Runtime::Instance::ModuleInstance &ModInst,
-                                   const AST::DataSection &DataSec) {
+                                   const AST::DataSection &DataSec,
+                                   const InstancePre *Pre) {
   // A frame with the current module has been pushed into the stack outside.
 
   // Iterate through the data segments to instantiate data instances.
-  for (const auto &DataSeg : DataSec.getContent()) {
+  for (size_t I = 0; I < DataSec.getContent().size(); ++I) {
+    const auto &DataSeg = DataSec.getContent()[I];
     uint64_t Offset = 0;
     // Initialize memory if the data mode is active.
     if (DataSeg.getMode() == AST::DataSegment::DataMode::Active) {
-      // Run the initialization expression.
-      EXPECTED_TRY(runExpression(StackMgr, DataSeg.getExpr().getInstrs())
-                       .map_error([](auto E) {
-                         spdlog::error(
-                             ErrInfo::InfoAST(ASTNodeAttr::Expression));
-                         spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Data));
-                         return E;
-                       }));
+      ValVariant OffsetValue;
+      if (Pre && Pre->DataOffsets[I]) {
+        // Use the constant offset computed in the instantiation template.
+        OffsetValue = *Pre->DataOffsets[I];
+      } else {
+        // Run the initialization expression.
+        EXPECTED_TRY(
+            runExpression(StackMgr, DataSeg.getExpr().getInstrs())
+                .map_error([](auto E) {
+                  spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
+                  spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Data));
+                  return E;
+                }));
+        OffsetValue = StackMgr.pop();
+      }
       // Get memory instance and address type.
       // Memory64 proposal is checked in validation phase.
       auto *MemInst = getMemInstByIdx(StackMgr.getModule(), DataSeg.getIdx());
       assuming(MemInst);
-      Offset = extractAddr(StackMgr.pop(),
+      Offset = extractAddr(OffsetValue,
                            MemInst->getMemoryType().getLimit().getAddrType());
 
       // Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
@@ -6,48 +6,84 @@
 #include "common/errinfo.h"
 #include "common/spdlog.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 namespace WasmEdge {
 namespace Executor {
 
+// Evaluate an element expression. See "include/executor/executor.h".
+Expect<RefVariant>
+Executor::runElemExpression(Runtime::StackManager &StackMgr,
+                            const AST::Expression &Expr) {
+  const auto Instrs = Expr.getInstrs();
+  if (!Stat && Instrs.size() == 2 && Instrs[1].getOpCode() == OpCode::End) {
+    // The function indices and the null references are the most of the
+    // elements. Push them directly instead of running the engine loop.
+    switch (Instrs[0].getOpCode()) {
+    case OpCode::Ref__func:
+      EXPECTED_TRY(runRefFuncOp(StackMgr, Instrs[0].getTargetIndex()));
+      return StackMgr.pop().get<RefVariant>();
+    case OpCode::Ref__null:
+      EXPECTED_TRY(runRefNullOp(StackMgr, Instrs[0].getValType()));
+      return StackMgr.pop().get<RefVariant>();
+    default:
+      break;
+    }
+  }
+  EXPECTED_TRY(runExpression(StackMgr, Instrs).map_error([](auto E) {
+    spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
+    spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
+    return E;
+  }));
+  return StackMgr.pop().get<RefVariant>();
+}
+
 // Instantiate element instance. See "include/executor/executor.h".
 Expect<void> Executor::instantiate(Runtime::StackManager &StackMgr,
                                    Runtime::Instance::ModuleInstance &ModInst,
-                                   const AST::ElementSection &ElemSec) {
+                                   const AST::ElementSection &ElemSec,
+                                   const InstancePre *Pre) {
   // A frame with the current module has been pushed into the stack outside.
 
   // Iterate through the element segments to instantiate element instances.
-  for (const auto &ElemSeg : ElemSec.getContent()) {
+  for (size_t I = 0; I < ElemSec.getContent().size(); ++I) {
+    const auto &ElemSeg = ElemSec.getContent()[I];
     std::vector<RefVariant> InitVals;
-    for (const auto &Expr : ElemSeg.getInitExprs()) {
-      // Run init expr of every elements and get the result reference.
-      EXPECTED_TRY(
-          runExpression(StackMgr, Expr.getInstrs()).map_error([](auto E) {
-            spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
-            spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
-            return E;
-          }));
-      // Pop result from the stack.
-      InitVals.push_back(StackMgr.pop().get<RefVariant>());
+    if (ElemSeg.getMode() == AST::ElementSegment::ElemMode::Passive) {
+      // Run init expr of every elements and get the result reference. The
+      // active segments are evaluated into the tables directly when
+      // initializing them, and the declarative segments are dropped.
+      InitVals.reserve(ElemSeg.getInitExprs().size());
+      for (const auto &Expr : ElemSeg.getInitExprs()) {
+        EXPECTED_TRY(auto Ref, runElemExpression(StackMgr, Expr));
+        InitVals.push_back(Ref);
+      }
     }
 
     uint64_t Offset = 0;
     if (ElemSeg.getMode() == AST::ElementSegment::ElemMode::Active) {
-      // Run the initialization expression.
-      EXPECTED_TRY(
-          runExpression(StackMgr, ElemSeg.getExpr().getInstrs())
-              .map_error([](auto E) {
-                spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
-                spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
-                return E;
-              }));
+      ValVariant OffsetValue;
+      if (Pre && Pre->ElemOffsets[I]) {
+        // Use the constant offset computed in the instantiation template.
+        OffsetValue = *Pre->ElemOffsets[I];
+      } else {
+        // Run the initialization expression.
+        EXPECTED_TRY(
+            runExpression(StackMgr, ElemSeg.getExpr().getInstrs())
+                .map_error([](auto E) {
+                  spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
+                  spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
+                  return E;
+                }));
+        OffsetValue = StackMgr.pop();
+      }
       // Get table instance and address type.
       // Memory64 proposal is checked in validation phase.
       auto *TabInst = getTabInstByIdx(StackMgr.getModule(), ElemSeg.getIdx());
       assuming(TabInst);
-      Offset = extractAddr(StackMgr.pop(),
+      Offset = extractAddr(OffsetValue,
                            TabInst->getTableType().getLimit().getAddrType());
 
       // Check boundary unless ReferenceTypes or BulkMemoryOperations proposal
@@ -55,7 +91,8 @@ Expect<void> Executor::instantiate(Runtime::StackManager &StackMgr,
       if (unlikely(!Conf.hasProposal(Proposal::ReferenceTypes) &&
                    !Conf.hasProposal(Proposal::BulkMemoryOperations))) {
         // Check elements fits.
-        if (!TabInst->checkAccessBound(Offset, InitVals.size())) {
+        if (!TabInst->checkAccessBound(Offset,
+                                       ElemSeg.getInitExprs().size())) {
           spdlog::error(ErrCode::Value::ElemSegDoesNotFit);
           spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
           return Unexpect(ErrCode::Value::ElemSegDoesNotFit);
@@ -74,6 +111,7 @@ Expect<void> Executor::initTable(Runtime::StackManager &StackMgr,
                                  const AST::ElementSection &ElemSec) {
   // Initialize tables.
   uint32_t Idx = 0;
+  std::vector<RefVariant> InitVals;
   for (const auto &ElemSeg : ElemSec.getContent()) {
     // Element index is checked in validation phase.
     auto *ElemInst = getElemInstByIdx(StackMgr.getModule(), Idx);
@@ -83,18 +121,26 @@ Expect<void> Executor::initTable(Runtime::StackManager &StackMgr,
       auto *TabInst = getTabInstByIdx(StackMgr.getModule(), ElemSeg.getIdx());
       assuming(TabInst);
       const uint64_t Off = ElemInst->getOffset();
+      const auto &Exprs = ElemSeg.getInitExprs();
 
-      // Replace table[Off : Off + n] with elem[0 : n].
-      EXPECTED_TRY(
-          TabInst
-              ->setRefs(ElemInst->getRefs(), Off, 0, ElemInst->getRefs().size())
-              .map_error([](auto E) {
-                spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
-                return E;
-              }));
+      // Check the boundary before evaluating the elements, as table.init
+      // traps without writing anything.
+      if (!TabInst->checkAccessBound(Off, Exprs.size())) {
+        spdlog::error(ErrCode::Value::TableOutOfBounds);
+        spdlog::error(ErrInfo::InfoBoundary(Off, Exprs.size(),
+                                            TabInst->getSize()));
+        spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Seg_Element));
+        return Unexpect(ErrCode::Value::TableOutOfBounds);
+      }
 
-      // Drop the element instance.
-      ElemInst->clear();
+      // Replace table[Off : Off + n] with elem[0 : n]. The element instance
+      // is created empty, as it is dropped right after.
+      InitVals.clear();
+      for (const auto &Expr : Exprs) {
+        EXPECTED_TRY(auto Ref, runElemExpression(StackMgr, Expr));
+        InitVals.push_back(Ref);
+      }
+      EXPECTED_TRY(TabInst->setRefs(InitVals, Off, 0, InitVals.size()));
 
       // Operation above is equal to the following instruction sequence:
       //   expr(init) -> i32.const off
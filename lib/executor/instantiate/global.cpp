@@ -3,6 +3,7 @@
 
 #include "executor/executor.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace WasmEdge {
@@ -11,7 +12,8 @@ namespace Executor {
 // Instantiate global instance. See "include/executor/executor.h".
 Expect<void> Executor::instantiate(Runtime::StackManager &StackMgr,
                                    Runtime::Instance::ModuleInstance &ModInst,
-                                   const AST::GlobalSection &GlobSec) {
+                                   const AST::GlobalSection &GlobSec,
+                                   const InstancePre *Pre) {
   // A frame with the temporary module is pushed onto the stack by the caller.
 
   // Prepare pointers for compiled functions.
@@ -25,16 +27,24 @@ Expect<void> Executor::instantiate(Runtime::StackManager &StackMgr,
 
   // Iterate through the global segments to instantiate and initialize global
   // instances.
-  for (const auto &GlobSeg : GlobSec.getContent()) {
-    // Run the initialization expression.
-    EXPECTED_TRY(runExpression(StackMgr, GlobSeg.getExpr().getInstrs())
-                     .map_error([](auto E) {
-                       spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Expression));
-                       return E;
-                     }));
-
-    // Pop result from the stack.
-    ValVariant InitValue = StackMgr.pop();
+  for (size_t I = 0; I < GlobSec.getContent().size(); ++I) {
+    const auto &GlobSeg = GlobSec.getContent()[I];
+    ValVariant InitValue;
+    if (Pre && Pre->GlobalInits[I]) {
+      // Use the constant value computed in the instantiation template.
+      InitValue = *Pre->GlobalInits[I];
+    } else {
+      // Run the initialization expression.
+      EXPECTED_TRY(runExpression(StackMgr, GlobSeg.getExpr().getInstrs())
+                       .map_error([](auto E) {
+                         spdlog::error(
+                             ErrInfo::InfoAST(ASTNodeAttr::Expression));
+                         return E;
+                       }));
+
+      // Pop result from the stack.
+      InitValue = StackMgr.pop();
+    }
 
     // Create and add the global instance to the module instance.
     ModInst.addGlobal(GlobSeg.getGlobalType(), InitValue);
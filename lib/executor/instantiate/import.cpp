@@ -158,10 +158,13 @@ Expect<void> Executor::instantiate(
       // Import matching.
       auto *ImpInst = ImpModInst->findFuncExports(ExtName);
       // External function type should match the import function type in
-      // description.
-
+      // description. The type index of the function refers to the module
+      // defining it, which is not the exporting module for re-exported
+      // functions.
+      const auto *ImpDefModInst =
+          ImpInst->getModule() ? ImpInst->getModule() : ImpModInst;
       if (!AST::TypeMatcher::matchType(ModInst.getTypeList(), TypeIdx,
-                                       ImpModInst->getTypeList(),
+                                       ImpDefModInst->getTypeList(),
                                        ImpInst->getTypeIndex())) {
         const auto &ExpDefType = **ModInst.getType(TypeIdx);
         bool IsMatchV2 = false;
@@ -194,7 +197,7 @@ Expect<void> Executor::instantiate(
                   ImpModInst->findFuncExports(std::string(*Iter) + "_v2");
               if (ImpInstV2 != nullptr &&
                   AST::TypeMatcher::matchType(ModInst.getTypeList(), TypeIdx,
-                                              ImpModInst->getTypeList(),
+                                              ImpDefModInst->getTypeList(),
                                               ImpInstV2->getTypeIndex())) {
                 // Try to match the new version
                 ImpInst = ImpInstV2;
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "executor/executor.h"
+
+#include "common/errinfo.h"
+#include "common/spdlog.h"
+
+#include <cstdint>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace Executor {
+
+namespace {
+/// Get the value of an expression consisting of a single numeric constant
+/// instruction.
+std::optional<ValVariant> getConstValue(const AST::Expression &Expr) noexcept {
+  const auto Instrs = Expr.getInstrs();
+  if (Instrs.size() != 2 || Instrs[1].getOpCode() != OpCode::End) {
+    return std::nullopt;
+  }
+  switch (Instrs[0].getOpCode()) {
+  case OpCode::I32__const:
+  case OpCode::I64__const:
+  case OpCode::F32__const:
+  case OpCode::F64__const:
+  case OpCode::V128__const:
+    return Instrs[0].getNum();
+  default:
+    return std::nullopt;
+  }
+}
+} // namespace
+
+// Create the instantiation template. See "include/executor/executor.h".
+Expect<std::unique_ptr<InstancePre>>
+Executor::createInstancePre(Runtime::StoreManager &StoreMgr,
+                            const AST::Module &Mod) {
+  // Check that the module is validated.
+  if (unlikely(!Mod.getIsValidated())) {
+    spdlog::error(ErrCode::Value::NotValidated);
+    spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
+    return Unexpect(ErrCode::Value::NotValidated);
+  }
+
+  // Read the generation before resolving, so that a module unregistered
+  // during the resolution makes the template stale.
+  const uint64_t Generation =
+      StoreMgr.withGenerationLocked([](uint64_t Gen) { return Gen; });
+  std::unique_ptr<InstancePre> Pre(new InstancePre(Mod, StoreMgr, Generation));
+
+  // Resolve and match the imports into a temporary module instance. The
+  // temporary instance pins the providers during the resolution only, the
+  // template itself does not own them.
+  Runtime::Instance::ModuleInstance Temp("");
+  for (auto &SubType : Mod.getTypeSection().getContent()) {
+    Temp.addDefinedType(SubType);
+  }
+  EXPECTED_TRY(
+      instantiate(
+          [&StoreMgr, &Temp](std::string_view ModName)
+              -> const Runtime::Instance::ModuleInstance * {
+            using Runtime::Instance::ModuleInstance;
+            return StoreMgr.withModuleLocked(
+                ModName, [&Temp](const ModuleInstance *Found) {
+                  if (Found) {
+                    Temp.addDependency(*const_cast<ModuleInstance *>(Found));
+                  }
+                  return Found;
+                });
+          },
+          Temp, Mod.getImportSection())
+          .map_error([](auto E) {
+            spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Sec_Import));
+            spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
+            return E;
+          }));
+  Pre->Providers.assign(Temp.Providers.begin(), Temp.Providers.end());
+  Pre->Funcs = Temp.FuncInsts;
+  Pre->Tabs = Temp.TabInsts;
+  Pre->Mems = Temp.MemInsts;
+  Pre->Tags = Temp.TagInsts;
+  Pre->Globs = Temp.GlobInsts;
+  Pre->WASIModule = Temp.getWASIModule();
+
+  // Compute the constant initialization expressions.
+  for (const auto &GlobSeg : Mod.getGlobalSection().getContent()) {
+    Pre->GlobalInits.push_back(getConstValue(GlobSeg.getExpr()));
+  }
+  for (const auto &ElemSeg : Mod.getElementSection().getContent()) {
+    if (ElemSeg.getMode() == AST::ElementSegment::ElemMode::Active) {
+      Pre->ElemOffsets.push_back(getConstValue(ElemSeg.getExpr()));
+    } else {
+      Pre->ElemOffsets.push_back(std::nullopt);
+    }
+  }
+  for (const auto &DataSeg : Mod.getDataSection().getContent()) {
+    if (DataSeg.getMode() == AST::DataSegment::DataMode::Active) {
+      Pre->DataOffsets.push_back(getConstValue(DataSeg.getExpr()));
+    } else {
+      Pre->DataOffsets.push_back(std::nullopt);
+    }
+  }
+  return Pre;
+}
+
+// Link the imports of the template. See "include/executor/executor.h".
+bool Executor::linkImports(const Runtime::StoreManager &StoreMgr,
+                           Runtime::Instance::ModuleInstance &ModInst,
+                           const InstancePre &Pre) {
+  if (&Pre.Store != &StoreMgr) {
+    return false;
+  }
+  // Pin the providers while no module can be unregistered from the store.
+  const bool Linked = StoreMgr.withGenerationLocked([&](uint64_t Gen) {
+    if (Gen != Pre.Generation) {
+      return false;
+    }
+    for (auto *Provider : Pre.Providers) {
+      ModInst.addDependency(*Provider);
+    }
+    return true;
+  });
+  if (!Linked) {
+    spdlog::debug("Instantiation template is stale, resolve imports again."sv);
+    return false;
+  }
+  for (auto *Inst : Pre.Funcs) {
+    ModInst.importFunction(Inst);
+  }
+  for (auto *Inst : Pre.Tabs) {
+    ModInst.importTable(Inst);
+  }
+  for (auto *Inst : Pre.Mems) {
+    ModInst.importMemory(Inst);
+  }
+  for (auto *Inst : Pre.Tags) {
+    ModInst.importTag(Inst);
+  }
+  for (auto *Inst : Pre.Globs) {
+    ModInst.importGlobal(Inst);
+  }
+  if (Pre.WASIModule) {
+    ModInst.setWASIModule(Pre.WASIModule);
+  }
+  return true;
+}
+
+} // namespace Executor
+} // namespace WasmEdge
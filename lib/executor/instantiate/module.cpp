@@ -15,7 +15,8 @@ namespace Executor {
 // Instantiate module instance. See "include/executor/Executor.h".
 Expect<std::unique_ptr<Runtime::Instance::ModuleInstance>>
 Executor::instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
-                      std::optional<std::string_view> Name) {
+                      std::optional<std::string_view> Name,
+                      const InstancePre *Pre) {
   // Check that the module is validated.
   if (unlikely(!Mod.getIsValidated())) {
     spdlog::error(ErrCode::Value::NotValidated);
@@ -43,12 +44,7 @@ Executor::instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
   } else {
     ModInst = std::make_unique<Runtime::Instance::ModuleInstance>("");
   }
-
-  // Instantiate Function Types in Module Instance. (TypeSec)
-  for (auto &SubType : Mod.getTypeSection().getContent()) {
-    // Copy defined types to module instance.
-    ModInst->addDefinedType(SubType);
-  }
+  ModInst->setMemoryAccount(MemAccount);
 
   auto ReportModuleError = [&StoreMgr, &ModInst](auto E) {
     spdlog::error(ErrInfo::InfoAST(ASTNodeAttr::Module));
@@ -65,25 +61,33 @@ Executor::instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
     };
   };
 
+  // Instantiate Function Types in Module Instance. (TypeSec)
+  EXPECTED_TRY(instantiate(*ModInst, Mod.getTypeSection())
+                   .map_error(ReportError(ASTNodeAttr::Sec_Type)));
+
   // Instantiate ImportSection and do import matching. (ImportSec)
+  // The imports resolved in the instantiation template are linked directly.
   const AST::ImportSection &ImportSec = Mod.getImportSection();
-  EXPECTED_TRY(instantiate(
-                   [&StoreMgr, &ModInst](std::string_view ModName)
-                       -> const WasmEdge::Runtime::Instance::ModuleInstance * {
-                     using WasmEdge::Runtime::Instance::ModuleInstance;
-                     return StoreMgr.withModuleLocked(
-                         ModName,
-                         [&ModInst](const ModuleInstance *Found)
-                             -> const ModuleInstance * {
-                           if (Found) {
-                             ModInst->addDependency(
-                                 *const_cast<ModuleInstance *>(Found));
-                           }
-                           return Found;
-                         });
-                   },
-                   *ModInst, ImportSec)
-                   .map_error(ReportError(ASTNodeAttr::Sec_Import)));
+  if (Pre == nullptr || !linkImports(StoreMgr, *ModInst, *Pre)) {
+    EXPECTED_TRY(
+        instantiate(
+            [&StoreMgr, &ModInst](std::string_view ModName)
+                -> const WasmEdge::Runtime::Instance::ModuleInstance * {
+              using WasmEdge::Runtime::Instance::ModuleInstance;
+              return StoreMgr.withModuleLocked(
+                  ModName,
+                  [&ModInst](const ModuleInstance *Found)
+                      -> const ModuleInstance * {
+                    if (Found) {
+                      ModInst->addDependency(
+                          *const_cast<ModuleInstance *>(Found));
+                    }
+                    return Found;
+                  });
+            },
+            *ModInst, ImportSec)
+            .map_error(ReportError(ASTNodeAttr::Sec_Import)));
+  }
 
   // Instantiate Functions in module. (FunctionSec, CodeSec)
   const AST::FunctionSection &FuncSec = Mod.getFunctionSection();
@@ -106,7 +110,7 @@ Executor::instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
 
   // Instantiate GlobalSection (GlobalSec)
   const AST::GlobalSection &GlobSec = Mod.getGlobalSection();
-  EXPECTED_TRY(instantiate(StackMgr, *ModInst, GlobSec)
+  EXPECTED_TRY(instantiate(StackMgr, *ModInst, GlobSec, Pre)
                    .map_error(ReportError(ASTNodeAttr::Sec_Global)));
 
   // Instantiate TableSection (TableSec)
@@ -121,14 +125,18 @@ Executor::instantiate(Runtime::StoreManager &StoreMgr, const AST::Module &Mod,
 
   // Instantiate ElementSection (ElemSec)
   const AST::ElementSection &ElemSec = Mod.getElementSection();
-  EXPECTED_TRY(instantiate(StackMgr, *ModInst, ElemSec)
+  EXPECTED_TRY(instantiate(StackMgr, *ModInst, ElemSec, Pre)
                    .map_error(ReportError(ASTNodeAttr::Sec_Element)));
 
   // Instantiate DataSection (DataSec)
   const AST::DataSection &DataSec = Mod.getDataSection();
-  EXPECTED_TRY(instantiate(StackMgr, *ModInst, DataSec)
+  EXPECTED_TRY(instantiate(StackMgr, *ModInst, DataSec, Pre)
                    .map_error(ReportError(ASTNodeAttr::Sec_Data)));
 
+  // Charge the memory of the instances to the statistics.
+  EXPECTED_TRY(
+      chargeInstanceMemory(*ModInst, Mod).map_error(ReportModuleError));
+
   // Initialize table instances
   EXPECTED_TRY(initTable(StackMgr, ElemSec)
                    .map_error(ReportError(ASTNodeAttr::Sec_Element)));
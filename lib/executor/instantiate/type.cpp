@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "executor/executor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace WasmEdge {
+namespace Executor {
+
+namespace {
+
+/// Process-wide registry of the canonical type IDs. Two defined types get the
+/// same ID if and only if they are equivalent under the iso-recursive type
+/// equality, so the IDs can be compared across modules and stores. The IDs of
+/// a recursive type group are consecutive, and they start from 1 because 0
+/// means no ID assigned. The groups are reference counted by the module
+/// instances, and the IDs of a released group are reused for new groups.
+class TypeRegistry {
+public:
+  static TypeRegistry &instance() noexcept {
+    static TypeRegistry Registry;
+    return Registry;
+  }
+
+  /// Get the first ID of the recursive type group of the key and take a
+  /// reference of it, or nothing if the IDs are exhausted.
+  std::optional<uint32_t> acquire(std::vector<uint64_t> &&Key,
+                                  uint32_t GroupSize) {
+    std::unique_lock Lock(Mutex);
+    auto It = Groups.find(Key);
+    if (It != Groups.end()) {
+      ++It->second.RefCount;
+      return It->second.First;
+    }
+    uint32_t First;
+    if (auto Free = FreeRanges.find(GroupSize);
+        Free != FreeRanges.end() && !Free->second.empty()) {
+      First = Free->second.back();
+      Free->second.pop_back();
+    } else if (NextID + GroupSize <= UINT64_C(1) + UINT32_MAX) {
+      First = static_cast<uint32_t>(NextID);
+      NextID += GroupSize;
+    } else {
+      return std::nullopt;
+    }
+    It = Groups.try_emplace(std::move(Key), Group{First, GroupSize, 1}).first;
+    Firsts.emplace(First, It);
+    return First;
+  }
+
+  /// Release the references of the groups by their first IDs.
+  void release(Span<const uint32_t> GroupFirsts) noexcept {
+    std::unique_lock Lock(Mutex);
+    for (const auto First : GroupFirsts) {
+      const auto It = Firsts.find(First);
+      assuming(It != Firsts.end());
+      auto &G = It->second->second;
+      if (--G.RefCount == 0) {
+        FreeRanges[G.Size].push_back(First);
+        Groups.erase(It->second);
+        Firsts.erase(It);
+      }
+    }
+  }
+
+private:
+  struct Group {
+    uint32_t First;
+    uint32_t Size;
+    uint64_t RefCount;
+  };
+  using GroupMap = std::map<std::vector<uint64_t>, Group>;
+
+  std::mutex Mutex;
+  GroupMap Groups;
+  /// The groups by their first IDs.
+  std::unordered_map<uint32_t, GroupMap::iterator> Firsts;
+  /// The first IDs of the released ranges by their sizes.
+  std::unordered_map<uint32_t, std::vector<uint32_t>> FreeRanges;
+  uint64_t NextID = 1;
+};
+
+/// Serialize a recursive type group into a key independent of the module. The
+/// type indices inside the group are encoded relative to the group, and the
+/// ones outside by their canonical IDs.
+class GroupEncoder {
+public:
+  GroupEncoder(Span<const uint32_t> IDs, uint32_t Start,
+               uint32_t Size) noexcept
+      : IDs(IDs), Start(Start), Size(Size) {}
+
+  std::vector<uint64_t> encode(Span<const AST::SubType *const> Types) {
+    Key.push_back(Size);
+    for (uint32_t I = Start; I < Start + Size; ++I) {
+      const auto &SType = *Types[I];
+      Key.push_back(SType.isFinal());
+      Key.push_back(SType.getSuperTypeIndices().size());
+      for (const auto Idx : SType.getSuperTypeIndices()) {
+        encodeIndex(Idx);
+      }
+      const auto &CompType = SType.getCompositeType();
+      Key.push_back(static_cast<uint64_t>(CompType.getContentTypeCode()));
+      if (CompType.isFunc()) {
+        const auto &FuncType = CompType.getFuncType();
+        Key.push_back(FuncType.getParamTypes().size());
+        for (const auto &VType : FuncType.getParamTypes()) {
+          encodeValType(VType);
+        }
+        Key.push_back(FuncType.getReturnTypes().size());
+        for (const auto &VType : FuncType.getReturnTypes()) {
+          encodeValType(VType);
+        }
+      } else {
+        Key.push_back(CompType.getFieldTypes().size());
+        for (const auto &FType : CompType.getFieldTypes()) {
+          Key.push_back(static_cast<uint64_t>(FType.getValMut()));
+          encodeValType(FType.getStorageType());
+        }
+      }
+    }
+    return std::move(Key);
+  }
+
+private:
+  void encodeIndex(uint32_t Idx) {
+    if (Idx >= Start && Idx < Start + Size) {
+      Key.push_back(1);
+      Key.push_back(Idx - Start);
+    } else {
+      // A validated module only refers to the earlier groups.
+      assuming(Idx < Start);
+      Key.push_back(2);
+      Key.push_back(IDs[Idx]);
+    }
+  }
+
+  void encodeValType(const ValType &VType) {
+    Key.push_back(static_cast<uint64_t>(VType.getCode()) << 8 |
+                  static_cast<uint64_t>(VType.getHeapTypeCode()));
+    if (VType.getHeapTypeCode() == TypeCode::TypeIndex) {
+      encodeIndex(VType.getTypeIndex());
+    }
+  }
+
+  Span<const uint32_t> IDs;
+  const uint32_t Start;
+  const uint32_t Size;
+  std::vector<uint64_t> Key;
+};
+
+} // namespace
+
+// Instantiate the defined types. See "include/executor/executor.h".
+Expect<void> Executor::instantiate(Runtime::Instance::ModuleInstance &ModInst,
+                                   const AST::TypeSection &TypeSec) {
+  for (auto &SubType : TypeSec.getContent()) {
+    // Copy defined types to module instance.
+    ModInst.addDefinedType(SubType);
+  }
+
+  // Assign the canonical type IDs group by group. A type not in an explicit
+  // recursive type group is a group of itself.
+  const auto Types = ModInst.getTypeList();
+  std::vector<uint32_t> IDs(Types.size(), 0);
+  std::vector<uint32_t> GroupFirsts;
+  auto &Registry = TypeRegistry::instance();
+  for (uint32_t Start = 0; Start < Types.size();) {
+    uint32_t Size = 1;
+    if (const auto Info = Types[Start]->getRecursiveInfo()) {
+      Size = std::clamp(Info->RecTypeSize, UINT32_C(1),
+                        static_cast<uint32_t>(Types.size()) - Start);
+    }
+    const auto First = Registry.acquire(
+        GroupEncoder(IDs, Start, Size).encode(Types), Size);
+    if (unlikely(!First)) {
+      Registry.release(GroupFirsts);
+      spdlog::error(ErrCode::Value::TypeIDsExhausted);
+      return Unexpect(ErrCode::Value::TypeIDsExhausted);
+    }
+    GroupFirsts.push_back(*First);
+    for (uint32_t I = 0; I < Size; ++I) {
+      IDs[Start + I] = *First + I;
+    }
+    Start += Size;
+  }
+  // The module instance releases the groups when it is destroyed.
+  ModInst.setCanonicalTypeIDs(
+      std::move(IDs), [&Registry, GroupFirsts = std::move(GroupFirsts)]() {
+        Registry.release(GroupFirsts);
+      });
+  return {};
+}
+
+} // namespace Executor
+} // namespace WasmEdge
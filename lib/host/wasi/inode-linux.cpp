@@ -11,11 +11,16 @@
 #include "host/wasi/inode.h"
 #include "host/wasi/vfs.h"
 #include "linux.h"
+#if WASMEDGE_WASI_IO_URING
+#include "iouring.h"
+#endif
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <new>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -28,6 +33,12 @@ namespace WASI {
 
 namespace {
 
+#if WASMEDGE_WASI_IO_URING
+/// Polls queued in a ring before they are submitted, more are submitted in
+/// several batches.
+inline constexpr uint32_t kRingEntries = 256;
+#endif
+
 inline constexpr bool isSpecialFd(int Fd) noexcept {
   switch (Fd) {
   case STDIN_FILENO:
@@ -1446,33 +1457,6 @@ WasiExpect<void> INode::updateStat() const noexcept {
   return {};
 }
 
-WasiExpect<Poller::Timer>
-PollerContext::acquireTimer(__wasi_clockid_t Clock) noexcept {
-  std::unique_lock Lock(TimerMutex);
-  if (auto &Timers = TimerPool.try_emplace(Clock).first->second;
-      Timers.empty()) {
-    Poller::Timer Result(Clock);
-    if (auto Res = Result.create(); unlikely(!Res)) {
-      return WasiUnexpect(fromErrNo(errno));
-    }
-    return Result;
-  } else {
-    Poller::Timer Result(std::move(Timers.back()));
-    Timers.pop_back();
-    return Result;
-  }
-}
-
-void PollerContext::releaseTimer(Poller::Timer &&Timer) noexcept {
-  std::unique_lock Lock(TimerMutex);
-  const auto Clock = Timer.Clock;
-  try {
-    TimerPool.try_emplace(Clock).first->second.push_back(std::move(Timer));
-  } catch (std::bad_alloc &) {
-    // giving up caching timer
-  }
-}
-
 #if __GLIBC_PREREQ(2, 8)
 WasiExpect<void> Poller::Timer::create() noexcept {
   if (const auto NewFd =
@@ -1485,17 +1469,26 @@ WasiExpect<void> Poller::Timer::create() noexcept {
   return {};
 }
 
+void Poller::Timer::disarm() noexcept {
+  itimerspec Spec{toTimespec(0), toTimespec(0)};
+  if (auto Res = ::timerfd_settime(Fd, 0, &Spec, nullptr); unlikely(Res < 0)) {
+    errno = 0;
+  }
+  Armed = false;
+}
+
+void Poller::Timer::drain() noexcept {
+  uint64_t Expirations;
+  if (auto Res = ::read(Fd, &Expirations, sizeof(Expirations));
+      unlikely(Res < 0)) {
+    errno = 0;
+  }
+}
+
 WasiExpect<void> Poller::Timer::setTime(__wasi_timestamp_t Timeout,
                                         __wasi_timestamp_t,
                                         __wasi_subclockflags_t Flags) noexcept {
-  // disarm timer
-  {
-    itimerspec Spec{toTimespec(0), toTimespec(0)};
-    if (auto Res = ::timerfd_settime(Fd, 0, &Spec, nullptr);
-        unlikely(Res < 0)) {
-      errno = 0;
-    }
-  }
+  disarm();
 
   int SysFlags = 0;
   if (Flags & __WASI_SUBCLOCKFLAGS_SUBSCRIPTION_CLOCK_ABSTIME) {
@@ -1509,6 +1502,7 @@ WasiExpect<void> Poller::Timer::setTime(__wasi_timestamp_t Timeout,
       unlikely(Res < 0)) {
     return WasiUnexpect(fromErrNo(errno));
   }
+  Armed = true;
 
   return {};
 }
@@ -1564,30 +1558,35 @@ WasiExpect<void> Poller::Timer::create() noexcept {
   return {};
 }
 
-WasiExpect<void> Poller::Timer::setTime(__wasi_timestamp_t Timeout,
-                                        __wasi_timestamp_t,
-                                        __wasi_subclockflags_t Flags) noexcept {
-  if (unlikely(!TimerId.Id)) {
-    return WasiUnexpect(__WASI_ERRNO_INVAL);
-  }
-
-  // disarm timer
-  {
+void Poller::Timer::disarm() noexcept {
+  if (likely(TimerId.Id)) {
     itimerspec Spec{toTimespec(0), toTimespec(0)};
     if (auto Res = ::timer_settime(*TimerId.Id, 0, &Spec, nullptr);
         unlikely(Res < 0)) {
       errno = 0;
     }
   }
-  // reset pipe
-  {
-    uint64_t Buffer[16];
-    while (true) {
-      if (auto Res = ::read(Fd, &Buffer, sizeof(Buffer)); Res <= 0) {
-        break;
-      }
+  drain();
+  Armed = false;
+}
+
+void Poller::Timer::drain() noexcept {
+  uint64_t Buffer[16];
+  while (true) {
+    if (auto Res = ::read(Fd, &Buffer, sizeof(Buffer)); Res <= 0) {
+      break;
     }
   }
+}
+
+WasiExpect<void> Poller::Timer::setTime(__wasi_timestamp_t Timeout,
+                                        __wasi_timestamp_t,
+                                        __wasi_subclockflags_t Flags) noexcept {
+  if (unlikely(!TimerId.Id)) {
+    return WasiUnexpect(__WASI_ERRNO_INVAL);
+  }
+
+  disarm();
 
   int SysFlags = 0;
   if (Flags & __WASI_SUBCLOCKFLAGS_SUBSCRIPTION_CLOCK_ABSTIME) {
@@ -1601,6 +1600,7 @@ WasiExpect<void> Poller::Timer::setTime(__wasi_timestamp_t Timeout,
       unlikely(Res < 0)) {
     return WasiUnexpect(fromErrNo(errno));
   }
+  Armed = true;
   return {};
 }
 #endif
@@ -1621,13 +1621,15 @@ Poller::Poller(PollerContext &C) noexcept
     return;
   }
 #endif
+  // Nothing is registered yet, the earlier closes do not matter.
+  SeenClosedFds = C.ClosedFdCount.load(std::memory_order_acquire);
 }
 
 WasiExpect<void> Poller::prepare(Span<__wasi_event_t> E) noexcept {
   WasiEvents = E;
   try {
     Events.reserve(E.size());
-    Timers.reserve(E.size());
+    ClockEvents.reserve(E.size());
     EPollEvents.reserve(E.size());
   } catch (std::bad_alloc &) {
     return WasiUnexpect(__WASI_ERRNO_NOMEM);
@@ -1637,7 +1639,7 @@ WasiExpect<void> Poller::prepare(Span<__wasi_event_t> E) noexcept {
 }
 
 void Poller::clock(__wasi_clockid_t Clock, __wasi_timestamp_t Timeout,
-                   __wasi_timestamp_t Precision, __wasi_subclockflags_t Flags,
+                   __wasi_timestamp_t, __wasi_subclockflags_t Flags,
                    __wasi_userdata_t UserData) noexcept {
   assuming(Events.size() < WasiEvents.size());
   auto &Event = Events.emplace_back();
@@ -1645,51 +1647,46 @@ void Poller::clock(__wasi_clockid_t Clock, __wasi_timestamp_t Timeout,
   Event.userdata = UserData;
   Event.type = __WASI_EVENTTYPE_CLOCK;
 
-  if (auto Res = Ctx->acquireTimer(Clock); unlikely(!Res)) {
-    Event.Valid = true;
-    Event.error = Res.error();
-    return;
-  } else {
-    Timers.emplace_back(std::move(*Res));
-  }
-
-  auto &Timer = Timers.back();
-  if (auto Res = Timer.setTime(Timeout, Precision, Flags); unlikely(!Res)) {
-    Ctx->releaseTimer(std::move(Timer));
-    Timers.pop_back();
-    Event.Valid = true;
-    Event.error = Res.error();
-    return;
-  }
-
-  assuming(Timer.Fd != Fd);
-  try {
-    auto [Iter, Added] = FdDatas.try_emplace(Timer.Fd);
-
-    Iter->second.ReadEvent = &Event;
-    assuming(Added);
-
-    epoll_event EPollEvent;
-    EPollEvent.events = EPOLLIN;
-#if defined(EPOLLRDHUP)
-    EPollEvent.events |= EPOLLRDHUP;
-#endif
-    EPollEvent.data.fd = Timer.Fd;
-
-    if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_ADD, Timer.Fd, &EPollEvent);
-        unlikely(Res < 0)) {
-      FdDatas.erase(Iter);
-      Ctx->releaseTimer(std::move(Timer));
-      Timers.pop_back();
+  // Timers are shared by all subscriptions of the same clock, so convert the
+  // relative timeout into an absolute deadline.
+  __wasi_timestamp_t Deadline = Timeout;
+  if (!(Flags & __WASI_SUBCLOCKFLAGS_SUBSCRIPTION_CLOCK_ABSTIME)) {
+    timespec Now;
+    if (auto Res = ::clock_gettime(toClockId(Clock), &Now);
+        unlikely(Res != 0)) {
       Event.Valid = true;
       Event.error = fromErrNo(errno);
       return;
     }
+    const __wasi_timestamp_t Base = fromTimespec(Now).raw();
+    Deadline = Base + std::min(Timeout,
+                               std::numeric_limits<__wasi_timestamp_t>::max() -
+                                   Base);
+  }
 
-    return;
+  try {
+    if (Timers.find(Clock) == Timers.end()) {
+      Timer NewTimer(Clock);
+      if (auto Res = NewTimer.create(); unlikely(!Res)) {
+        Event.Valid = true;
+        Event.error = Res.error();
+        return;
+      }
+
+      assuming(NewTimer.Fd != Fd);
+      epoll_event EPollEvent;
+      EPollEvent.events = EPOLLIN;
+      EPollEvent.data.fd = NewTimer.Fd;
+      if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_ADD, NewTimer.Fd, &EPollEvent);
+          unlikely(Res < 0)) {
+        Event.Valid = true;
+        Event.error = fromErrNo(errno);
+        return;
+      }
+      Timers.emplace(Clock, std::move(NewTimer));
+    }
+    ClockEvents.push_back({&Event, Clock, Deadline});
   } catch (std::bad_alloc &) {
-    Ctx->releaseTimer(std::move(Timer));
-    Timers.pop_back();
     Event.Valid = true;
     Event.error = __WASI_ERRNO_NOMEM;
     return;
@@ -1698,7 +1695,20 @@ void Poller::clock(__wasi_clockid_t Clock, __wasi_timestamp_t Timeout,
 
 void Poller::close(const INode &Node) noexcept {
   FdDatas.erase(Node.Fd);
-  OldFdDatas.erase(Node.Fd);
+  if (Registered.erase(Node.Fd)) {
+    // In kernel before 2.6.9, EPOLL_CTL_DEL required a non-null pointer. Use
+    // `this` as the dummy parameter.
+    ::epoll_ctl(Fd, EPOLL_CTL_DEL, Node.Fd,
+                reinterpret_cast<struct epoll_event *>(this));
+  }
+#if WASMEDGE_WASI_IO_URING
+  // Release the reference of the poll to the file right away.
+  if (auto Iter = RingPolls.find(Node.Fd); Iter != RingPolls.end()) {
+    Ring.Ring->pollRemove(Iter->second.UserData);
+    RingPolls.erase(Iter);
+    Ring.Ring->submit(0);
+  }
+#endif
 }
 
 void Poller::read(const INode &Node, TriggerType Trigger,
@@ -1712,7 +1722,6 @@ void Poller::read(const INode &Node, TriggerType Trigger,
   assuming(Node.Fd != Fd);
   try {
     auto [Iter, Added] = FdDatas.try_emplace(Node.Fd);
-    const bool New = OldFdDatas.find(Node.Fd) == OldFdDatas.end();
 
     if (unlikely(!Added && Iter->second.ReadEvent != nullptr)) {
       Event.Valid = true;
@@ -1720,36 +1729,8 @@ void Poller::read(const INode &Node, TriggerType Trigger,
       return;
     }
     Iter->second.ReadEvent = &Event;
-
-    epoll_event EPollEvent;
-    EPollEvent.events = EPOLLIN;
-    if (!Added) {
-      assuming(Iter->second.WriteEvent != nullptr);
-      EPollEvent.events |= EPOLLOUT;
-    }
     if (Trigger == TriggerType::Edge) {
-      EPollEvent.events |= EPOLLET;
-    }
-#if defined(EPOLLRDHUP)
-    EPollEvent.events |= EPOLLRDHUP;
-#endif
-    EPollEvent.data.fd = Node.Fd;
-
-    if (likely(Added) && New) {
-      if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_ADD, Node.Fd, &EPollEvent);
-          unlikely(Res < 0)) {
-        FdDatas.erase(Iter);
-        Event.Valid = true;
-        Event.error = fromErrNo(errno);
-        return;
-      }
-    } else {
-      if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_MOD, Node.Fd, &EPollEvent);
-          unlikely(Res < 0)) {
-        Event.Valid = true;
-        Event.error = fromErrNo(errno);
-        return;
-      }
+      Iter->second.Edge = true;
     }
   } catch (std::bad_alloc &) {
     Event.Valid = true;
@@ -1769,7 +1750,6 @@ void Poller::write(const INode &Node, TriggerType Trigger,
   assuming(Node.Fd != Fd);
   try {
     auto [Iter, Added] = FdDatas.try_emplace(Node.Fd);
-    const bool New = OldFdDatas.find(Node.Fd) == OldFdDatas.end();
 
     if (unlikely(!Added && Iter->second.WriteEvent != nullptr)) {
       Event.Valid = true;
@@ -1777,69 +1757,230 @@ void Poller::write(const INode &Node, TriggerType Trigger,
       return;
     }
     Iter->second.WriteEvent = &Event;
+    if (Trigger == TriggerType::Edge) {
+      Iter->second.Edge = true;
+    }
+  } catch (std::bad_alloc &) {
+    Event.Valid = true;
+    Event.error = __WASI_ERRNO_NOMEM;
+    return;
+  }
+}
+
+void PollerContext::closed(const INode &Node) noexcept {
+  std::unique_lock Lock(ClosedFdMutex);
+  try {
+    ClosedFds.push_back(Node.Fd);
+    if (ClosedFds.size() > kMaxClosedFds) {
+      ClosedFds.pop_front();
+      ++FirstClosedFd;
+    }
+  } catch (std::bad_alloc &) {
+    // Forget all of them, the pollers then drop all their registrations.
+    FirstClosedFd += ClosedFds.size() + 1;
+    ClosedFds.clear();
+  }
+  ClosedFdCount.store(FirstClosedFd + ClosedFds.size(),
+                      std::memory_order_release);
+}
 
+void Poller::dropClosedFds() noexcept {
+  // A closed file descriptor leaves the epoll instance, and its number can be
+  // reused by another file, so the registrations kept for the closed numbers
+  // are not trusted. They are added again, or modified if they still exist.
+  if (Ctx->ClosedFdCount.load(std::memory_order_acquire) == SeenClosedFds) {
+    return;
+  }
+  auto Drop = [this](int ClosedFd) noexcept {
+    Registered.erase(ClosedFd);
+#if WASMEDGE_WASI_IO_URING
+    // A poll holds a reference to the file, which stays open until the poll
+    // is cancelled.
+    if (auto Iter = RingPolls.find(ClosedFd); Iter != RingPolls.end()) {
+      Ring.Ring->pollRemove(Iter->second.UserData);
+      RingPolls.erase(Iter);
+    }
+#endif
+  };
+
+  std::unique_lock Lock(Ctx->ClosedFdMutex);
+  if (SeenClosedFds < Ctx->FirstClosedFd) {
+    // Too many closes since the last call to tell which ones.
+    Registered.clear();
+    std::vector<int> PollFds;
+    PollFds.reserve(RingPolls.size());
+    for (const auto &[PollFd, Poll] : RingPolls) {
+      if (!isTimer(PollFd)) {
+        PollFds.push_back(PollFd);
+      }
+    }
+    for (const int PollFd : PollFds) {
+      Drop(PollFd);
+    }
+  } else {
+    for (auto I = SeenClosedFds - Ctx->FirstClosedFd;
+         I < Ctx->ClosedFds.size(); ++I) {
+      Drop(Ctx->ClosedFds[I]);
+    }
+  }
+  SeenClosedFds = Ctx->FirstClosedFd + Ctx->ClosedFds.size();
+}
+
+bool Poller::isTimer(int PollFd) const noexcept {
+  return std::any_of(Timers.begin(), Timers.end(), [PollFd](const auto &Pair) {
+    return Pair.second.Fd == PollFd;
+  });
+}
+
+void Poller::updateRegistrations() noexcept {
+  dropClosedFds();
+
+  for (auto Iter = Registered.begin(); Iter != Registered.end();) {
+    if (FdDatas.find(Iter->first) == FdDatas.end()) {
+      // Remove unused event, ignore failed.
+      // In kernel before 2.6.9, EPOLL_CTL_DEL required a non-null pointer. Use
+      // `this` as the dummy parameter.
+      ::epoll_ctl(Fd, EPOLL_CTL_DEL, Iter->first,
+                  reinterpret_cast<struct epoll_event *>(this));
+      Iter = Registered.erase(Iter);
+    } else {
+      ++Iter;
+    }
+  }
+
+  for (auto &[NodeFd, FdData] : FdDatas) {
     epoll_event EPollEvent;
-    EPollEvent.events = EPOLLOUT;
-    if (!Added) {
-      assuming(Iter->second.ReadEvent != nullptr);
+    EPollEvent.events = 0;
+    if (FdData.ReadEvent) {
       EPollEvent.events |= EPOLLIN;
     }
-    if (Trigger == TriggerType::Edge) {
+    if (FdData.WriteEvent) {
+      EPollEvent.events |= EPOLLOUT;
+    }
+    if (FdData.Edge) {
       EPollEvent.events |= EPOLLET;
     }
 #if defined(EPOLLRDHUP)
     EPollEvent.events |= EPOLLRDHUP;
 #endif
-    EPollEvent.data.fd = Node.Fd;
-
-    if (likely(Added) && New) {
-      if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_ADD, Node.Fd, &EPollEvent);
-          unlikely(Res < 0)) {
-        FdDatas.erase(Iter);
-        Event.Valid = true;
-        Event.error = fromErrNo(errno);
-        return;
+    EPollEvent.data.fd = NodeFd;
+
+    auto Iter = Registered.find(NodeFd);
+    int Op = EPOLL_CTL_ADD;
+    if (Iter != Registered.end()) {
+      // A level-triggered registration with the same events is still valid.
+      // Edge-triggered ones are always modified to re-arm the readiness.
+      if (Iter->second == EPollEvent.events && !FdData.Edge) {
+        continue;
       }
+      Op = EPOLL_CTL_MOD;
+    }
+
+    __wasi_errno_t Error;
+    auto Res = ::epoll_ctl(Fd, Op, NodeFd, &EPollEvent);
+    if (Res < 0 && ((Op == EPOLL_CTL_ADD && errno == EEXIST) ||
+                    (Op == EPOLL_CTL_MOD && errno == ENOENT))) {
+      Res = ::epoll_ctl(Fd, Op == EPOLL_CTL_ADD ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+                        NodeFd, &EPollEvent);
+    }
+    if (unlikely(Res < 0)) {
+      Error = fromErrNo(errno);
+    } else if (Iter != Registered.end()) {
+      Iter->second = EPollEvent.events;
+      continue;
     } else {
-      if (auto Res = ::epoll_ctl(Fd, EPOLL_CTL_MOD, Node.Fd, &EPollEvent);
-          unlikely(Res < 0)) {
-        Event.Valid = true;
-        Event.error = fromErrNo(errno);
-        return;
+      try {
+        Registered.emplace(NodeFd, static_cast<uint32_t>(EPollEvent.events));
+        continue;
+      } catch (std::bad_alloc &) {
+        Error = __WASI_ERRNO_NOMEM;
+        ::epoll_ctl(Fd, EPOLL_CTL_DEL, NodeFd,
+                    reinterpret_cast<struct epoll_event *>(this));
       }
     }
-  } catch (std::bad_alloc &) {
-    Event.Valid = true;
-    Event.error = __WASI_ERRNO_NOMEM;
-    return;
-  }
-}
 
-void Poller::wait() noexcept {
-  for (const auto &[NodeFd, FdData] : OldFdDatas) {
-    if (auto Iter = FdDatas.find(NodeFd); Iter == FdDatas.end()) {
-      // Remove unused event, ignore failed.
-      // In kernel before 2.6.9, EPOLL_CTL_DEL required a non-null pointer. Use
-      // `this` as the dummy parameter.
+    // Drop the registration and report the error to the subscriptions.
+    if (Iter != Registered.end()) {
       ::epoll_ctl(Fd, EPOLL_CTL_DEL, NodeFd,
                   reinterpret_cast<struct epoll_event *>(this));
+      Registered.erase(Iter);
+    }
+    for (auto *Event : {FdData.ReadEvent, FdData.WriteEvent}) {
+      if (Event) {
+        Event->Valid = true;
+        Event->error = Error;
+      }
     }
+    FdData.ReadEvent = nullptr;
+    FdData.WriteEvent = nullptr;
   }
+}
 
-  EPollEvents.resize(Events.size());
-  const int Count =
-      ::epoll_wait(Fd, EPollEvents.data(), EPollEvents.size(), -1);
-  if (unlikely(Count < 0)) {
-    const auto Error = fromErrNo(errno);
-    for (auto &Event : Events) {
-      Event.Valid = true;
-      Event.error = Error;
+void Poller::updateTimers() noexcept {
+  for (auto &[Clock, ClockTimer] : Timers) {
+    std::optional<__wasi_timestamp_t> Earliest;
+    for (const auto &ClockEvent : ClockEvents) {
+      if (ClockEvent.Clock == Clock && !ClockEvent.Event->Valid) {
+        Earliest = std::min(Earliest.value_or(ClockEvent.Deadline),
+                            ClockEvent.Deadline);
+      }
+    }
+
+    if (!Earliest) {
+      // Unused timer, make sure a previous expiration will not wake us up.
+      if (ClockTimer.Armed) {
+        ClockTimer.disarm();
+      }
+      continue;
+    }
+
+    if (auto Res = ClockTimer.setTime(
+            *Earliest, 0, __WASI_SUBCLOCKFLAGS_SUBSCRIPTION_CLOCK_ABSTIME);
+        unlikely(!Res)) {
+      for (auto &ClockEvent : ClockEvents) {
+        if (ClockEvent.Clock == Clock) {
+          ClockEvent.Event->Valid = true;
+          ClockEvent.Event->error = Res.error();
+        }
+      }
+    }
+  }
+}
+
+void Poller::processClockEvents() noexcept {
+  for (auto &[Clock, ClockTimer] : Timers) {
+    if (!ClockTimer.Armed) {
+      continue;
+    }
+    timespec Now;
+    if (auto Res = ::clock_gettime(toClockId(Clock), &Now);
+        unlikely(Res != 0)) {
+      continue;
+    }
+    const __wasi_timestamp_t Time = fromTimespec(Now).raw();
+    for (auto &ClockEvent : ClockEvents) {
+      if (ClockEvent.Clock == Clock && !ClockEvent.Event->Valid &&
+          ClockEvent.Deadline <= Time) {
+        ClockEvent.Event->Valid = true;
+        ClockEvent.Event->error = __WASI_ERRNO_SUCCESS;
+      }
+    }
+  }
+}
+
+void Poller::processFdEvent(int EventFd, uint32_t Ready) noexcept {
+  const auto Iter = FdDatas.find(EventFd);
+  if (Iter == FdDatas.end()) {
+    // Timer expirations are checked against the deadlines below.
+    for (auto &[Clock, ClockTimer] : Timers) {
+      if (ClockTimer.Fd == EventFd) {
+        ClockTimer.drain();
+      }
     }
     return;
   }
 
-  auto ProcessEvent = [](const struct epoll_event &EPollEvent,
-                         OptionalEvent &Event) noexcept {
+  auto ProcessEvent = [EventFd, Ready](OptionalEvent &Event) noexcept {
     Event.Valid = true;
     Event.error = __WASI_ERRNO_SUCCESS;
     switch (Event.type) {
@@ -1847,12 +1988,12 @@ void Poller::wait() noexcept {
       break;
     case __WASI_EVENTTYPE_FD_READ: {
       Event.fd_readwrite.flags = static_cast<__wasi_eventrwflags_t>(0);
-      if (EPollEvent.events & EPOLLHUP) {
+      if (Ready & EPOLLHUP) {
         Event.fd_readwrite.flags |= __WASI_EVENTRWFLAGS_FD_READWRITE_HANGUP;
       }
       bool UnknownNBytes = false;
       int ReadBufUsed = 0;
-      if (auto Res = ::ioctl(EPollEvent.data.fd, FIONREAD, &ReadBufUsed);
+      if (auto Res = ::ioctl(EventFd, FIONREAD, &ReadBufUsed);
           unlikely(Res == 0)) {
         UnknownNBytes = true;
       }
@@ -1865,19 +2006,19 @@ void Poller::wait() noexcept {
     }
     case __WASI_EVENTTYPE_FD_WRITE: {
       Event.fd_readwrite.flags = static_cast<__wasi_eventrwflags_t>(0);
-      if (EPollEvent.events & EPOLLHUP) {
+      if (Ready & EPOLLHUP) {
         Event.fd_readwrite.flags |= __WASI_EVENTRWFLAGS_FD_READWRITE_HANGUP;
       }
       bool UnknownNBytes = false;
       int WriteBufSize = 0;
       socklen_t IntSize = sizeof(WriteBufSize);
-      if (auto Res = ::getsockopt(EPollEvent.data.fd, SOL_SOCKET, SO_SNDBUF,
+      if (auto Res = ::getsockopt(EventFd, SOL_SOCKET, SO_SNDBUF,
                                   &WriteBufSize, &IntSize);
           unlikely(Res != 0)) {
         UnknownNBytes = true;
       }
       int WriteBufUsed = 0;
-      if (auto Res = ::ioctl(EPollEvent.data.fd, TIOCOUTQ, &WriteBufUsed);
+      if (auto Res = ::ioctl(EventFd, TIOCOUTQ, &WriteBufUsed);
           unlikely(Res != 0)) {
         UnknownNBytes = true;
       }
@@ -1891,40 +2032,185 @@ void Poller::wait() noexcept {
     }
   };
 
-  for (int I = 0; I < Count; ++I) {
-    const auto &EPollEvent = EPollEvents[I];
-    const auto Iter = FdDatas.find(EPollEvent.data.fd);
-    assuming(Iter != FdDatas.end());
+  const bool NoInOut = !(Ready & (EPOLLIN | EPOLLOUT));
+  if (Iter->second.ReadEvent &&
+      ((Ready & EPOLLIN) || (NoInOut && Ready & EPOLLHUP))) {
+    assuming(Iter->second.ReadEvent->type == __WASI_EVENTTYPE_FD_READ);
+    ProcessEvent(*Iter->second.ReadEvent);
+  }
+  if (Iter->second.WriteEvent &&
+      ((Ready & EPOLLOUT) || (NoInOut && Ready & EPOLLHUP))) {
+    assuming(Iter->second.WriteEvent->type == __WASI_EVENTTYPE_FD_WRITE);
+    ProcessEvent(*Iter->second.WriteEvent);
+  }
+}
+
+bool Poller::hasResult() const noexcept {
+  return std::any_of(Events.begin(), Events.end(),
+                     [](const OptionalEvent &Event) { return Event.Valid; });
+}
+
+void Poller::wait() noexcept {
+#if WASMEDGE_WASI_IO_URING
+  if (!Ring.Checked) {
+    Ring.Checked = true;
+    Ring.Ring = IOUring::create(kRingEntries).release();
+  }
+  if (Ring.Ring) {
+    waitRing();
+    return;
+  }
+#endif
+
+  updateRegistrations();
+  updateTimers();
+
+  // Do not block if some subscriptions have already failed.
+  int Timeout = hasResult() ? 0 : -1;
+  EPollEvents.resize(Events.size() + Timers.size());
+  do {
+    const int Count =
+        ::epoll_wait(Fd, EPollEvents.data(), EPollEvents.size(), Timeout);
+    if (unlikely(Count < 0)) {
+      const auto Error = fromErrNo(errno);
+      for (auto &Event : Events) {
+        Event.Valid = true;
+        Event.error = Error;
+      }
+      break;
+    }
+
+    for (int I = 0; I < Count; ++I) {
+      processFdEvent(EPollEvents[I].data.fd, EPollEvents[I].events);
+    }
+    processClockEvents();
+  } while (unlikely(!hasResult()));
+
+  FdDatas.clear();
+  ClockEvents.clear();
+  EPollEvents.clear();
+}
 
-    const bool NoInOut = !(EPollEvent.events & (EPOLLIN | EPOLLOUT));
-    if ((EPollEvent.events & EPOLLIN) ||
-        (NoInOut && EPollEvent.events & EPOLLHUP && Iter->second.ReadEvent)) {
-      assuming(Iter->second.ReadEvent);
-      assuming(Iter->second.ReadEvent->type == __WASI_EVENTTYPE_CLOCK ||
-               Iter->second.ReadEvent->type == __WASI_EVENTTYPE_FD_READ);
-      ProcessEvent(EPollEvent, *Iter->second.ReadEvent);
+void Poller::RingHolder::reset() noexcept {
+#if WASMEDGE_WASI_IO_URING
+  delete Ring;
+#endif
+  Ring = nullptr;
+}
+
+#if WASMEDGE_WASI_IO_URING
+void Poller::waitRing() noexcept {
+  auto SetError = [this](int PollFd, __wasi_errno_t Error) noexcept {
+    if (auto Iter = FdDatas.find(PollFd); Iter != FdDatas.end()) {
+      for (auto *Event : {Iter->second.ReadEvent, Iter->second.WriteEvent}) {
+        if (Event) {
+          Event->Valid = true;
+          Event->error = Error;
+        }
+      }
+    }
+  };
+  // Queue a poll for each subscription and armed timer without a pending
+  // one of the same events. They are all submitted with the wait.
+  auto QueuePolls = [&]() noexcept {
+    auto Queue = [&](int PollFd, uint32_t Mask) noexcept {
+      auto Iter = RingPolls.find(PollFd);
+      if (Iter != RingPolls.end()) {
+        if (Iter->second.Mask == Mask) {
+          return;
+        }
+        Ring.Ring->pollRemove(Iter->second.UserData);
+        RingPolls.erase(Iter);
+      }
+      const uint64_t UserData = (static_cast<uint64_t>(++LastRingPoll) << 32) |
+                                static_cast<uint32_t>(PollFd);
+      try {
+        RingPolls.emplace(PollFd, RingPoll{UserData, Mask});
+      } catch (std::bad_alloc &) {
+        SetError(PollFd, __WASI_ERRNO_NOMEM);
+        return;
+      }
+      if (unlikely(!Ring.Ring->pollAdd(PollFd, Mask, UserData))) {
+        RingPolls.erase(PollFd);
+        SetError(PollFd, fromErrNo(errno));
+      }
+    };
+    for (const auto &[NodeFd, FdData] : FdDatas) {
+      if (!FdData.ReadEvent && !FdData.WriteEvent) {
+        continue;
+      }
+      // The poll events have the values of the epoll ones.
+      uint32_t Mask = 0;
+      if (FdData.ReadEvent) {
+        Mask |= EPOLLIN;
+      }
+      if (FdData.WriteEvent) {
+        Mask |= EPOLLOUT;
+      }
+#if defined(EPOLLRDHUP)
+      Mask |= EPOLLRDHUP;
+#endif
+      Queue(NodeFd, Mask);
+    }
+    for (const auto &[Clock, ClockTimer] : Timers) {
+      if (ClockTimer.Armed) {
+        Queue(ClockTimer.Fd, EPOLLIN);
+      }
     }
-    if (EPollEvent.events & EPOLLOUT ||
-        (NoInOut && EPollEvent.events & EPOLLHUP && Iter->second.WriteEvent)) {
-      assuming(Iter->second.WriteEvent);
-      assuming(Iter->second.WriteEvent->type == __WASI_EVENTTYPE_FD_WRITE);
-      ProcessEvent(EPollEvent, *Iter->second.WriteEvent);
+  };
+
+  dropClosedFds();
+  // Cancel the polls of the file descriptors which are not subscribed any
+  // more, the ones of the timers are kept.
+  for (auto Iter = RingPolls.begin(); Iter != RingPolls.end();) {
+    if (FdDatas.find(Iter->first) == FdDatas.end() && !isTimer(Iter->first)) {
+      Ring.Ring->pollRemove(Iter->second.UserData);
+      Iter = RingPolls.erase(Iter);
+    } else {
+      ++Iter;
     }
   }
-  for (auto &Timer : Timers) {
-    // Remove unused timer event, ignore failed.
-    // In kernel before 2.6.9, EPOLL_CTL_DEL required a non-null pointer. Use
-    // `this` as the dummy parameter.
-    ::epoll_ctl(Fd, EPOLL_CTL_DEL, Timer.Fd,
-                reinterpret_cast<struct epoll_event *>(this));
-    Ctx->releaseTimer(std::move(Timer));
+  updateTimers();
+
+  // Nothing would complete without subscriptions.
+  while (likely(!Events.empty())) {
+    QueuePolls();
+    // Do not block if some subscriptions have already failed.
+    if (auto Res = Ring.Ring->submit(hasResult() ? 0 : 1); unlikely(Res < 0)) {
+      const auto Error = fromErrNo(errno);
+      for (auto &Event : Events) {
+        Event.Valid = true;
+        Event.error = Error;
+      }
+      break;
+    }
+
+    uint64_t UserData;
+    int32_t Res;
+    while (Ring.Ring->popCompletion(UserData, Res)) {
+      const int PollFd = static_cast<int>(static_cast<uint32_t>(UserData));
+      auto Iter = RingPolls.find(PollFd);
+      if (Iter == RingPolls.end() || Iter->second.UserData != UserData) {
+        // A cancelled poll, or the completion of a cancellation.
+        continue;
+      }
+      RingPolls.erase(Iter);
+      if (unlikely(Res < 0)) {
+        SetError(PollFd, fromErrNo(-Res));
+      } else {
+        processFdEvent(PollFd, static_cast<uint32_t>(Res));
+      }
+    }
+    processClockEvents();
+    if (likely(hasResult())) {
+      break;
+    }
   }
 
-  std::swap(FdDatas, OldFdDatas);
   FdDatas.clear();
-  Timers.clear();
-  EPollEvents.clear();
+  ClockEvents.clear();
 }
+#endif
 
 void Poller::reset() noexcept {
   WasiEvents = {};
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/defines.h"
+#if WASMEDGE_OS_LINUX
+
+#include "common/errcode.h"
+#include "iouring.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <memory>
+#include <new>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace WasmEdge {
+namespace Host {
+namespace WASI {
+inline namespace detail {
+
+namespace {
+
+template <typename T> T *ringPtr(void *Base, uint32_t Offset) noexcept {
+  return reinterpret_cast<T *>(static_cast<uint8_t *>(Base) + Offset);
+}
+
+} // namespace
+
+IOUring::~IOUring() noexcept {
+  if (SQEs) {
+    ::munmap(SQEs, SQEsSize);
+  }
+  if (CQRing && CQRing != SQRing) {
+    ::munmap(CQRing, CQRingSize);
+  }
+  if (SQRing) {
+    ::munmap(SQRing, SQRingSize);
+  }
+  if (RingFd >= 0) {
+    ::close(RingFd);
+  }
+}
+
+std::unique_ptr<IOUring> IOUring::create(uint32_t Entries) noexcept {
+  std::unique_ptr<IOUring> Ring(new (std::nothrow) IOUring());
+  if (!Ring || !Ring->setup(Entries)) {
+    return nullptr;
+  }
+  return Ring;
+}
+
+bool IOUring::setup(uint32_t Entries) noexcept {
+  io_uring_params Params;
+  std::memset(&Params, 0, sizeof(Params));
+  if (auto Res = ::syscall(__NR_io_uring_setup, Entries, &Params);
+      unlikely(Res < 0)) {
+    return false;
+  } else {
+    RingFd = static_cast<int>(Res);
+  }
+
+  // Completions must not be dropped when more polls complete than the
+  // completion ring holds.
+  if (!(Params.features & IORING_FEAT_NODROP)) {
+    return false;
+  }
+  SQEntries = Params.sq_entries;
+
+  SQRingSize = Params.sq_off.array + Params.sq_entries * sizeof(uint32_t);
+  CQRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+  const bool SingleMmap = Params.features & IORING_FEAT_SINGLE_MMAP;
+  if (SingleMmap) {
+    SQRingSize = CQRingSize = std::max(SQRingSize, CQRingSize);
+  }
+
+  if (auto Ptr = ::mmap(nullptr, SQRingSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQ_RING);
+      unlikely(Ptr == MAP_FAILED)) {
+    return false;
+  } else {
+    SQRing = Ptr;
+  }
+  if (SingleMmap) {
+    CQRing = SQRing;
+  } else if (auto Ptr =
+                 ::mmap(nullptr, CQRingSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_CQ_RING);
+             unlikely(Ptr == MAP_FAILED)) {
+    return false;
+  } else {
+    CQRing = Ptr;
+  }
+  SQEsSize = Params.sq_entries * sizeof(io_uring_sqe);
+  if (auto Ptr = ::mmap(nullptr, SQEsSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQES);
+      unlikely(Ptr == MAP_FAILED)) {
+    return false;
+  } else {
+    SQEs = static_cast<io_uring_sqe *>(Ptr);
+  }
+
+  SQTail = ringPtr<uint32_t>(SQRing, Params.sq_off.tail);
+  SQMask = ringPtr<uint32_t>(SQRing, Params.sq_off.ring_mask);
+  SQArray = ringPtr<uint32_t>(SQRing, Params.sq_off.array);
+  CQHead = ringPtr<uint32_t>(CQRing, Params.cq_off.head);
+  CQTail = ringPtr<uint32_t>(CQRing, Params.cq_off.tail);
+  CQMask = ringPtr<uint32_t>(CQRing, Params.cq_off.ring_mask);
+  CQEs = ringPtr<io_uring_cqe>(CQRing, Params.cq_off.cqes);
+  return true;
+}
+
+io_uring_sqe *IOUring::getSqe() noexcept {
+  // Only this thread produces entries, and all the queued entries are
+  // consumed by each submission, so the ring is full only with queued ones.
+  if (Queued == SQEntries && submit(0) < 0) {
+    return nullptr;
+  }
+  const uint32_t Tail = *SQTail;
+  const uint32_t Index = Tail & *SQMask;
+  io_uring_sqe *Sqe = &SQEs[Index];
+  std::memset(Sqe, 0, sizeof(*Sqe));
+  SQArray[Index] = Index;
+  __atomic_store_n(SQTail, Tail + 1, __ATOMIC_RELEASE);
+  ++Queued;
+  return Sqe;
+}
+
+bool IOUring::pollAdd(int Fd, uint32_t Mask, uint64_t UserData) noexcept {
+  io_uring_sqe *Sqe = getSqe();
+  if (unlikely(!Sqe)) {
+    return false;
+  }
+  Sqe->opcode = IORING_OP_POLL_ADD;
+  Sqe->fd = Fd;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  // The kernel reads the 32-bit mask with its halves swapped.
+  Mask = (Mask << 16) | (Mask >> 16);
+#endif
+  Sqe->poll32_events = Mask;
+  Sqe->user_data = UserData;
+  return true;
+}
+
+bool IOUring::pollRemove(uint64_t UserData) noexcept {
+  io_uring_sqe *Sqe = getSqe();
+  if (unlikely(!Sqe)) {
+    return false;
+  }
+  Sqe->opcode = IORING_OP_POLL_REMOVE;
+  Sqe->fd = -1;
+  Sqe->addr = UserData;
+  return true;
+}
+
+int IOUring::submit(uint32_t MinComplete) noexcept {
+  while (true) {
+    const uint32_t Flags = MinComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    if (auto Res = ::syscall(__NR_io_uring_enter, RingFd, Queued, MinComplete,
+                             Flags, nullptr, 0);
+        unlikely(Res < 0)) {
+      if (errno == EINTR && Queued > 0) {
+        continue;
+      }
+      return -1;
+    } else {
+      Queued -= static_cast<uint32_t>(Res);
+    }
+    if (Queued == 0) {
+      return 0;
+    }
+  }
+}
+
+bool IOUring::popCompletion(uint64_t &UserData, int32_t &Res) noexcept {
+  const uint32_t Head = *CQHead;
+  if (Head == __atomic_load_n(CQTail, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+  const io_uring_cqe &Cqe = CQEs[Head & *CQMask];
+  UserData = Cqe.user_data;
+  Res = Cqe.res;
+  __atomic_store_n(CQHead, Head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+} // namespace detail
+} // namespace WASI
+} // namespace Host
+} // namespace WasmEdge
+
+#endif
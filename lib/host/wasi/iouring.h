@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#pragma once
+
+#include "common/defines.h"
+#if !WASMEDGE_OS_LINUX
+#error
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace WasmEdge {
+namespace Host {
+namespace WASI {
+inline namespace detail {
+
+/// Minimal io_uring submission/completion ring used by the completion-based
+/// `poll_oneoff`.
+///
+/// Entries are queued in the submission ring and passed to the kernel in
+/// batches: one `io_uring_enter` call submits all the queued entries and waits
+/// for the completions. A ring is used by one thread at a time.
+class IOUring {
+public:
+  IOUring(const IOUring &) = delete;
+  IOUring &operator=(const IOUring &) = delete;
+  ~IOUring() noexcept;
+
+  /// Create a ring with room for \p Entries queued entries, or nullptr if the
+  /// kernel does not support io_uring or it is blocked by a seccomp policy.
+  static std::unique_ptr<IOUring> create(uint32_t Entries) noexcept;
+
+  /// Queue a oneshot poll of \p Fd for the events of \p Mask. Its completion
+  /// carries \p UserData and the ready events.
+  bool pollAdd(int Fd, uint32_t Mask, uint64_t UserData) noexcept;
+
+  /// Queue the cancellation of the poll queued with \p UserData. The poll
+  /// then completes with `-ECANCELED` unless it has completed already.
+  bool pollRemove(uint64_t UserData) noexcept;
+
+  /// Submit the queued entries and wait until \p MinComplete completions are
+  /// available. Return -1 with `errno` set on failure.
+  int submit(uint32_t MinComplete) noexcept;
+
+  /// Pop a completion, return false if there is none.
+  bool popCompletion(uint64_t &UserData, int32_t &Res) noexcept;
+
+private:
+  IOUring() noexcept = default;
+  bool setup(uint32_t Entries) noexcept;
+  io_uring_sqe *getSqe() noexcept;
+
+  int RingFd = -1;
+  void *SQRing = nullptr;
+  void *CQRing = nullptr;
+  size_t SQRingSize = 0;
+  size_t CQRingSize = 0;
+  io_uring_sqe *SQEs = nullptr;
+  size_t SQEsSize = 0;
+  uint32_t SQEntries = 0;
+  /// Entries queued since the last submission.
+  uint32_t Queued = 0;
+
+  uint32_t *SQTail = nullptr;
+  uint32_t *SQMask = nullptr;
+  uint32_t *SQArray = nullptr;
+  uint32_t *CQHead = nullptr;
+  uint32_t *CQTail = nullptr;
+  uint32_t *CQMask = nullptr;
+  io_uring_cqe *CQEs = nullptr;
+};
+
+} // namespace detail
+} // namespace WASI
+} // namespace Host
+} // namespace WasmEdge
@@ -378,6 +378,7 @@ template <typename T> inline bool isMisaligned(uint32_t Ptr) noexcept {
 
 Expect<uint32_t> WasiArgsGet::body(const Runtime::CallingFrame &Frame,
                                    uint32_t ArgvPtr, uint32_t ArgvBufPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<uint8_t_ptr>(ArgvPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -419,6 +420,7 @@ Expect<uint32_t> WasiArgsGet::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiArgsSizesGet::body(const Runtime::CallingFrame &Frame,
                                         uint32_t /* Out */ ArgcPtr,
                                         uint32_t /* Out */ ArgvBufSizePtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_size_t>(ArgcPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -452,6 +454,7 @@ Expect<uint32_t> WasiArgsSizesGet::body(const Runtime::CallingFrame &Frame,
 
 Expect<uint32_t> WasiEnvironGet::body(const Runtime::CallingFrame &Frame,
                                       uint32_t EnvPtr, uint32_t EnvBufPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<uint8_t_ptr>(EnvPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -483,7 +486,7 @@ Expect<uint32_t> WasiEnvironGet::body(const Runtime::CallingFrame &Frame,
     EnvSpan[0] = EnvBufPtr;
   }
 
-  if (auto Res = this->Env.environGet(EnvSpan, EnvBuf); unlikely(!Res)) {
+  if (auto Res = Env.environGet(EnvSpan, EnvBuf); unlikely(!Res)) {
     return Res.error();
   }
 
@@ -493,6 +496,7 @@ Expect<uint32_t> WasiEnvironGet::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiEnvironSizesGet::body(const Runtime::CallingFrame &Frame,
                                            uint32_t /* Out */ EnvCntPtr,
                                            uint32_t /* Out */ EnvBufSizePtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_size_t>(EnvCntPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -528,6 +532,7 @@ Expect<uint32_t> WasiEnvironSizesGet::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiClockResGet::body(const Runtime::CallingFrame &Frame,
                                        uint32_t ClockId,
                                        uint32_t /* Out */ ResolutionPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_timestamp_t>(ResolutionPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -561,6 +566,7 @@ Expect<uint32_t> WasiClockResGet::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiClockTimeGet::body(const Runtime::CallingFrame &Frame,
                                         uint32_t ClockId, uint64_t Precision,
                                         uint32_t /* Out */ TimePtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_timestamp_t>(TimePtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -593,9 +599,10 @@ Expect<uint32_t> WasiClockTimeGet::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdAdvise::body(const Runtime::CallingFrame &, int32_t Fd,
-                                    uint64_t Offset, uint64_t Len,
+Expect<uint32_t> WasiFdAdvise::body(const Runtime::CallingFrame &Frame,
+                                    int32_t Fd, uint64_t Offset, uint64_t Len,
                                     uint32_t Advice) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_advice_t WasiAdvice;
   if (auto Res = cast<__wasi_advice_t>(Advice); unlikely(!Res)) {
     return Res.error();
@@ -614,8 +621,10 @@ Expect<uint32_t> WasiFdAdvise::body(const Runtime::CallingFrame &, int32_t Fd,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdAllocate::body(const Runtime::CallingFrame &, int32_t Fd,
-                                      uint64_t Offset, uint64_t Len) {
+Expect<uint32_t> WasiFdAllocate::body(const Runtime::CallingFrame &Frame,
+                                      int32_t Fd, uint64_t Offset,
+                                      uint64_t Len) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
   const __wasi_filesize_t WasiOffset = Offset;
   const __wasi_filesize_t WasiLen = Len;
@@ -626,7 +635,9 @@ Expect<uint32_t> WasiFdAllocate::body(const Runtime::CallingFrame &, int32_t Fd,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdClose::body(const Runtime::CallingFrame &, int32_t Fd) {
+Expect<uint32_t> WasiFdClose::body(const Runtime::CallingFrame &Frame,
+                                   int32_t Fd) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
 
   if (auto Res = Env.fdClose(WasiFd); unlikely(!Res)) {
@@ -635,8 +646,9 @@ Expect<uint32_t> WasiFdClose::body(const Runtime::CallingFrame &, int32_t Fd) {
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdDatasync::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiFdDatasync::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
 
   if (auto Res = Env.fdDatasync(WasiFd); unlikely(!Res)) {
@@ -648,6 +660,7 @@ Expect<uint32_t> WasiFdDatasync::body(const Runtime::CallingFrame &,
 Expect<uint32_t> WasiFdFdstatGet::body(const Runtime::CallingFrame &Frame,
                                        int32_t Fd,
                                        uint32_t /* Out */ FdStatPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fdstat_t>(FdStatPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -672,8 +685,9 @@ Expect<uint32_t> WasiFdFdstatGet::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdFdstatSetFlags::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiFdFdstatSetFlags::body(const Runtime::CallingFrame &Frame,
                                             int32_t Fd, uint32_t FsFlags) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_fdflags_t WasiFdFlags;
   if (auto Res = cast<__wasi_fdflags_t>(FsFlags); unlikely(!Res)) {
     return Res.error();
@@ -689,9 +703,10 @@ Expect<uint32_t> WasiFdFdstatSetFlags::body(const Runtime::CallingFrame &,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdFdstatSetRights::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiFdFdstatSetRights::body(const Runtime::CallingFrame &Frame,
                                              int32_t Fd, uint64_t FsRightsBase,
                                              uint64_t FsRightsInheriting) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_rights_t WasiFsRightsBase;
   if (auto Res = cast<__wasi_rights_t>(FsRightsBase); unlikely(!Res)) {
     return Res.error();
@@ -719,6 +734,7 @@ Expect<uint32_t> WasiFdFdstatSetRights::body(const Runtime::CallingFrame &,
 Expect<uint32_t> WasiFdFilestatGet::body(const Runtime::CallingFrame &Frame,
                                          int32_t Fd,
                                          uint32_t /* Out */ FilestatPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_filestat_t>(FilestatPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -743,8 +759,9 @@ Expect<uint32_t> WasiFdFilestatGet::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdFilestatSetSize::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiFdFilestatSetSize::body(const Runtime::CallingFrame &Frame,
                                              int32_t Fd, uint64_t Size) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
   const __wasi_filesize_t WasiSize = Size;
 
@@ -754,10 +771,10 @@ Expect<uint32_t> WasiFdFilestatSetSize::body(const Runtime::CallingFrame &,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdFilestatSetTimes::body(const Runtime::CallingFrame &,
-                                              int32_t Fd, uint64_t ATim,
-                                              uint64_t MTim,
-                                              uint32_t FstFlags) {
+Expect<uint32_t>
+WasiFdFilestatSetTimes::body(const Runtime::CallingFrame &Frame, int32_t Fd,
+                             uint64_t ATim, uint64_t MTim, uint32_t FstFlags) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_fstflags_t WasiFstFlags;
   if (auto Res = cast<__wasi_fstflags_t>(FstFlags); unlikely(!Res)) {
     return Res.error();
@@ -781,6 +798,7 @@ Expect<uint32_t> WasiFdPread::body(const Runtime::CallingFrame &Frame,
                                    int32_t Fd, uint32_t IOVsPtr,
                                    uint32_t IOVsLen, uint64_t Offset,
                                    uint32_t /* Out */ NReadPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_iovec_t>(IOVsPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -846,6 +864,7 @@ Expect<uint32_t> WasiFdPread::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiFdPrestatDirName::body(const Runtime::CallingFrame &Frame,
                                             int32_t Fd, uint32_t PathBufPtr,
                                             uint32_t PathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // PathBufPtr should be aligned to at least 1 byte (which is always true)
 
@@ -871,6 +890,7 @@ Expect<uint32_t> WasiFdPrestatDirName::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiFdPrestatGet::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd,
                                         uint32_t /* Out */ PreStatPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_prestat_t>(PreStatPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -900,6 +920,7 @@ Expect<uint32_t> WasiFdPwrite::body(const Runtime::CallingFrame &Frame,
                                     int32_t Fd, uint32_t IOVsPtr,
                                     uint32_t IOVsLen, uint64_t Offset,
                                     uint32_t /* Out */ NWrittenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_ciovec_t>(IOVsPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -969,6 +990,7 @@ Expect<uint32_t> WasiFdRead::body(const Runtime::CallingFrame &Frame,
                                   int32_t Fd, uint32_t IOVsPtr,
                                   uint32_t IOVsLen,
                                   uint32_t /* Out */ NReadPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_iovec_t>(IOVsPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1033,6 +1055,7 @@ Expect<uint32_t> WasiFdReadDir::body(const Runtime::CallingFrame &Frame,
                                      int32_t Fd, uint32_t BufPtr,
                                      uint32_t BufLen, uint64_t Cookie,
                                      uint32_t /* Out */ NReadPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_size_t>(NReadPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1068,8 +1091,9 @@ Expect<uint32_t> WasiFdReadDir::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdRenumber::body(const Runtime::CallingFrame &, int32_t Fd,
-                                      int32_t ToFd) {
+Expect<uint32_t> WasiFdRenumber::body(const Runtime::CallingFrame &Frame,
+                                      int32_t Fd, int32_t ToFd) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
   const __wasi_fd_t WasiToFd = ToFd;
 
@@ -1082,6 +1106,7 @@ Expect<uint32_t> WasiFdRenumber::body(const Runtime::CallingFrame &, int32_t Fd,
 Expect<int32_t> WasiFdSeek::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                                  int64_t Offset, uint32_t Whence,
                                  uint32_t /* Out */ NewOffsetPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_filesize_t>(NewOffsetPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1116,7 +1141,9 @@ Expect<int32_t> WasiFdSeek::body(const Runtime::CallingFrame &Frame, int32_t Fd,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiFdSync::body(const Runtime::CallingFrame &, int32_t Fd) {
+Expect<uint32_t> WasiFdSync::body(const Runtime::CallingFrame &Frame,
+                                  int32_t Fd) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
 
   if (auto Res = Env.fdSync(WasiFd); unlikely(!Res)) {
@@ -1127,6 +1154,7 @@ Expect<uint32_t> WasiFdSync::body(const Runtime::CallingFrame &, int32_t Fd) {
 
 Expect<uint32_t> WasiFdTell::body(const Runtime::CallingFrame &Frame,
                                   int32_t Fd, uint32_t /* Out */ OffsetPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_filesize_t>(OffsetPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1157,6 +1185,7 @@ Expect<uint32_t> WasiFdWrite::body(const Runtime::CallingFrame &Frame,
                                    int32_t Fd, uint32_t IOVsPtr,
                                    uint32_t IOVsLen,
                                    uint32_t /* Out */ NWrittenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_ciovec_t>(IOVsPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1222,6 +1251,7 @@ Expect<uint32_t> WasiFdWrite::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t>
 WasiPathCreateDirectory::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                               uint32_t PathPtr, uint32_t PathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // PathPtr should be aligned to at least 1 byte (which is always true)
   // Check memory instance from module.
   auto *MemInst = Frame.getMemoryByIndex(0);
@@ -1247,6 +1277,7 @@ Expect<uint32_t> WasiPathFilestatGet::body(const Runtime::CallingFrame &Frame,
                                            int32_t Fd, uint32_t Flags,
                                            uint32_t PathPtr, uint32_t PathLen,
                                            uint32_t /* Out */ FilestatPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_filestat_t>(FilestatPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1291,6 +1322,7 @@ WasiPathFilestatSetTimes::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                                uint32_t Flags, uint32_t PathPtr,
                                uint32_t PathLen, uint64_t ATim, uint64_t MTim,
                                uint32_t FstFlags) {
+  WASI::Environ &Env = getEnv(Frame);
   // PathPtr should be aligned to at least 1 byte (which is always true)
 
   // Check memory instance from module.
@@ -1336,6 +1368,7 @@ Expect<uint32_t> WasiPathLink::body(const Runtime::CallingFrame &Frame,
                                     uint32_t OldPathPtr, uint32_t OldPathLen,
                                     int32_t NewFd, uint32_t NewPathPtr,
                                     uint32_t NewPathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // OldPathPtr and NewPathPtr should be aligned to at least 1 byte (which is
   // always true)
 
@@ -1379,6 +1412,7 @@ Expect<uint32_t> WasiPathOpen::body(
     const Runtime::CallingFrame &Frame, int32_t DirFd, uint32_t DirFlags,
     uint32_t PathPtr, uint32_t PathLen, uint32_t OFlags, uint64_t FsRightsBase,
     uint64_t FsRightsInheriting, uint32_t FsFlags, uint32_t /* Out */ FdPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fd_t>(FdPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1462,6 +1496,7 @@ Expect<uint32_t> WasiPathReadLink::body(const Runtime::CallingFrame &Frame,
                                         uint32_t PathLen, uint32_t BufPtr,
                                         uint32_t BufLen,
                                         uint32_t /* Out */ NReadPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_size_t>(NReadPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1504,6 +1539,7 @@ Expect<uint32_t> WasiPathReadLink::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t>
 WasiPathRemoveDirectory::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                               uint32_t PathPtr, uint32_t PathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // PathPtr should be aligned to at least 1 byte (which is always true)
 
@@ -1532,6 +1568,7 @@ Expect<uint32_t> WasiPathRename::body(const Runtime::CallingFrame &Frame,
                                       uint32_t OldPathLen, int32_t NewFd,
                                       uint32_t NewPathPtr,
                                       uint32_t NewPathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // OldPathPtr and NewPathPtr should be aligned to at least 1 byte (which is
   // always true).
@@ -1568,6 +1605,7 @@ Expect<uint32_t> WasiPathSymlink::body(const Runtime::CallingFrame &Frame,
                                        uint32_t OldPathPtr, uint32_t OldPathLen,
                                        int32_t Fd, uint32_t NewPathPtr,
                                        uint32_t NewPathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // OldPathPtr and NewPathPtr should be aligned to at least 1 byte (which is
   // always true)
@@ -1605,6 +1643,7 @@ Expect<uint32_t> WasiPathSymlink::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiPathUnlinkFile::body(const Runtime::CallingFrame &Frame,
                                           int32_t Fd, uint32_t PathPtr,
                                           uint32_t PathLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // PathPtr should be aligned to at least 1 byte (which is always true)
 
@@ -1631,6 +1670,7 @@ template <WASI::TriggerType Trigger>
 Expect<uint32_t> WasiPollOneoff<Trigger>::body(
     const Runtime::CallingFrame &Frame, uint32_t InPtr, uint32_t OutPtr,
     uint32_t NSubscriptions, uint32_t /* Out */ NEventsPtr) {
+  WASI::Environ &Env = this->getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_subscription_t>(InPtr))) {
     return Unexpect(ErrCode::Value::UnalignedAtomicAccess);
@@ -1666,7 +1706,7 @@ Expect<uint32_t> WasiPollOneoff<Trigger>::body(
   }
 
   // Validate contents
-  if (auto Poll = this->Env.acquirePoller(Events); unlikely(!Poll)) {
+  if (auto Poll = Env.acquirePoller(Events); unlikely(!Poll)) {
     for (__wasi_size_t I = 0; I < WasiNSub.raw(); ++I) {
       Events[I].userdata = Subs[I].userdata;
       Events[I].error = Poll.error();
@@ -1736,7 +1776,7 @@ Expect<uint32_t> WasiPollOneoff<Trigger>::body(
     Poller.wait();
     *NEvents = EndianValue<__wasi_size_t>(Poller.result()).le();
     Poller.reset();
-    this->Env.releasePoller(std::move(Poller));
+    Env.releasePoller(std::move(Poller));
   }
 
   return __WASI_ERRNO_SUCCESS;
@@ -1745,14 +1785,16 @@ Expect<uint32_t> WasiPollOneoff<Trigger>::body(
 template class WasiPollOneoff<WASI::TriggerType::Level>;
 template class WasiPollOneoff<WASI::TriggerType::Edge>;
 
-Expect<void> WasiProcExit::body(const Runtime::CallingFrame &,
+Expect<void> WasiProcExit::body(const Runtime::CallingFrame &Frame,
                                 uint32_t ExitCode) {
+  WASI::Environ &Env = getEnv(Frame);
   Env.procExit(ExitCode);
   return Unexpect(ErrCode::Value::Terminated);
 }
 
-Expect<uint32_t> WasiProcRaise::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiProcRaise::body(const Runtime::CallingFrame &Frame,
                                      uint32_t Signal) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_signal_t WasiSignal;
   if (auto Res = cast<__wasi_signal_t>(Signal); unlikely(!Res)) {
     return Res.error();
@@ -1766,7 +1808,8 @@ Expect<uint32_t> WasiProcRaise::body(const Runtime::CallingFrame &,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiSchedYield::body(const Runtime::CallingFrame &) {
+Expect<uint32_t> WasiSchedYield::body(const Runtime::CallingFrame &Frame) {
+  WASI::Environ &Env = getEnv(Frame);
   if (auto Res = Env.schedYield(); unlikely(!Res)) {
     return Res.error();
   }
@@ -1775,6 +1818,7 @@ Expect<uint32_t> WasiSchedYield::body(const Runtime::CallingFrame &) {
 
 Expect<uint32_t> WasiRandomGet::body(const Runtime::CallingFrame &Frame,
                                      uint32_t BufPtr, uint32_t BufLen) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // BufPtr should be aligned to at least 1 byte (which is always true)
 
@@ -1800,6 +1844,7 @@ Expect<uint32_t> WasiRandomGet::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockOpenV1::body(const Runtime::CallingFrame &Frame,
                                       uint32_t AddressFamily, uint32_t SockType,
                                       uint32_t /* Out */ RoFdPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fd_t>(RoFdPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -1847,6 +1892,7 @@ Expect<uint32_t> WasiSockOpenV1::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockBindV1::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t AddressPtr,
                                       uint32_t Port) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -1891,8 +1937,9 @@ Expect<uint32_t> WasiSockBindV1::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiSockListenV1::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiSockListenV1::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd, int32_t Backlog) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
   if (auto Res = Env.sockListen(WasiFd, Backlog); unlikely(!Res)) {
     return Res.error();
@@ -1903,6 +1950,7 @@ Expect<uint32_t> WasiSockListenV1::body(const Runtime::CallingFrame &,
 Expect<uint32_t> WasiSockAcceptV1::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd,
                                         uint32_t /* Out */ RoFdPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fd_t>(RoFdPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -1931,6 +1979,7 @@ Expect<uint32_t> WasiSockAcceptV1::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockAcceptV2::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd, uint32_t FsFlags,
                                         uint32_t /* Out */ RoFdPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fd_t>(RoFdPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -1966,6 +2015,7 @@ Expect<uint32_t> WasiSockAcceptV2::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockConnectV1::body(const Runtime::CallingFrame &Frame,
                                          int32_t Fd, uint32_t AddressPtr,
                                          uint32_t Port) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2015,6 +2065,7 @@ Expect<uint32_t> WasiSockRecvV1::body(const Runtime::CallingFrame &Frame,
                                       uint32_t RiDataLen, uint32_t RiFlags,
                                       uint32_t /* Out */ RoDataLenPtr,
                                       uint32_t /* Out */ RoFlagsPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_iovec_t>(RiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2101,6 +2152,7 @@ Expect<uint32_t> WasiSockRecvFromV1::body(const Runtime::CallingFrame &Frame,
                                           uint32_t AddressPtr, uint32_t RiFlags,
                                           uint32_t /* Out */ RoDataLenPtr,
                                           uint32_t /* Out */ RoFlagsPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2199,6 +2251,7 @@ Expect<uint32_t> WasiSockSendV1::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t SiDataPtr,
                                       uint32_t SiDataLen, uint32_t SiFlags,
                                       uint32_t /* Out */ SoDataLenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_ciovec_t>(SiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2273,6 +2326,7 @@ Expect<uint32_t> WasiSockSendToV1::body(const Runtime::CallingFrame &Frame,
                                         uint32_t SiDataLen, uint32_t AddressPtr,
                                         int32_t Port, uint32_t SiFlags,
                                         uint32_t /* Out */ SoDataLenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2373,8 +2427,9 @@ Expect<uint32_t> WasiSockSendToV1::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiSockShutdown::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiSockShutdown::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd, uint32_t SdFlags) {
+  WASI::Environ &Env = getEnv(Frame);
   __wasi_sdflags_t WasiSdFlags;
   if (auto Res = cast<__wasi_sdflags_t>(SdFlags); unlikely(!Res)) {
     return Res.error();
@@ -2394,6 +2449,7 @@ Expect<uint32_t> WasiSockSetOpt::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t SockOptLevel,
                                       uint32_t SockOptName, uint32_t FlagPtr,
                                       uint32_t FlagSize) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // FlagPtr should be aligned to at least 1 byte (which is always true)
 
@@ -2436,6 +2492,7 @@ Expect<uint32_t> WasiSockGetAddrinfo::body(
     const Runtime::CallingFrame &Frame, uint32_t NodePtr, uint32_t NodeLen,
     uint32_t ServicePtr, uint32_t ServiceLen, uint32_t HintsPtr,
     uint32_t ResPtr, uint32_t MaxResLength, uint32_t ResLengthPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // NodePtr, ServicePtr should be aligned to at least 1 byte (which is always
   // true)
@@ -2616,6 +2673,7 @@ Expect<uint32_t>
 WasiSockGetLocalAddrV1::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                              uint32_t AddressPtr, uint32_t AddressTypePtr,
                              uint32_t PortPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2696,6 +2754,7 @@ Expect<uint32_t> WasiSockGetPeerAddrV1::body(const Runtime::CallingFrame &Frame,
                                              int32_t Fd, uint32_t AddressPtr,
                                              uint32_t AddressTypePtr,
                                              uint32_t PortPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2776,6 +2835,7 @@ Expect<uint32_t> WasiSockGetPeerAddrV1::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockOpenV2::body(const Runtime::CallingFrame &Frame,
                                       uint32_t AddressFamily, uint32_t SockType,
                                       uint32_t /* Out */ RoFdPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_fd_t>(RoFdPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2823,6 +2883,7 @@ Expect<uint32_t> WasiSockOpenV2::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t> WasiSockBindV2::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t AddressPtr,
                                       uint32_t Port) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2874,8 +2935,9 @@ Expect<uint32_t> WasiSockBindV2::body(const Runtime::CallingFrame &Frame,
   return __WASI_ERRNO_SUCCESS;
 }
 
-Expect<uint32_t> WasiSockListenV2::body(const Runtime::CallingFrame &,
+Expect<uint32_t> WasiSockListenV2::body(const Runtime::CallingFrame &Frame,
                                         int32_t Fd, int32_t Backlog) {
+  WASI::Environ &Env = getEnv(Frame);
   const __wasi_fd_t WasiFd = Fd;
   if (auto Res = Env.sockListen(WasiFd, Backlog); unlikely(!Res)) {
     return Res.error();
@@ -2886,6 +2948,7 @@ Expect<uint32_t> WasiSockListenV2::body(const Runtime::CallingFrame &,
 Expect<uint32_t> WasiSockConnectV2::body(const Runtime::CallingFrame &Frame,
                                          int32_t Fd, uint32_t AddressPtr,
                                          uint32_t Port) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -2943,6 +3006,7 @@ Expect<uint32_t> WasiSockRecvV2::body(const Runtime::CallingFrame &Frame,
                                       uint32_t RiDataLen, uint32_t RiFlags,
                                       uint32_t /* Out */ RoDataLenPtr,
                                       uint32_t /* Out */ RoFlagsPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_iovec_t>(RiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -3028,6 +3092,7 @@ Expect<uint32_t> WasiSockRecvFromV2::body(const Runtime::CallingFrame &Frame,
                                           uint32_t /* Out */ PortPtr,
                                           uint32_t /* Out */ RoDataLenPtr,
                                           uint32_t /* Out */ RoFlagsPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_iovec_t>(RiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -3154,6 +3219,7 @@ Expect<uint32_t> WasiSockSendV2::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t SiDataPtr,
                                       uint32_t SiDataLen, uint32_t SiFlags,
                                       uint32_t /* Out */ SoDataLenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_ciovec_t>(SiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -3228,6 +3294,7 @@ Expect<uint32_t> WasiSockSendToV2::body(const Runtime::CallingFrame &Frame,
                                         uint32_t SiDataLen, uint32_t AddressPtr,
                                         int32_t Port, uint32_t SiFlags,
                                         uint32_t /* Out */ SoDataLenPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_ciovec_t>(SiDataPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -3339,6 +3406,7 @@ Expect<uint32_t> WasiSockGetOpt::body(const Runtime::CallingFrame &Frame,
                                       int32_t Fd, uint32_t SockOptLevel,
                                       uint32_t SockOptName, uint32_t FlagPtr,
                                       uint32_t FlagSizePtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   // no alignment requirement for FlagPtr as it's a byte array
 
@@ -3390,6 +3458,7 @@ Expect<uint32_t> WasiSockGetOpt::body(const Runtime::CallingFrame &Frame,
 Expect<uint32_t>
 WasiSockGetLocalAddrV2::body(const Runtime::CallingFrame &Frame, int32_t Fd,
                              uint32_t AddressPtr, uint32_t PortPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
@@ -3446,6 +3515,7 @@ WasiSockGetLocalAddrV2::body(const Runtime::CallingFrame &Frame, int32_t Fd,
 Expect<uint32_t> WasiSockGetPeerAddrV2::body(const Runtime::CallingFrame &Frame,
                                              int32_t Fd, uint32_t AddressPtr,
                                              uint32_t PortPtr) {
+  WASI::Environ &Env = getEnv(Frame);
   // Alignment checks
   if (unlikely(isMisaligned<__wasi_address_t>(AddressPtr))) {
     return __WASI_ERRNO_ADDRNOTAVAIL;
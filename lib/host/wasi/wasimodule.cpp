@@ -5,64 +5,72 @@
 #include "host/wasi/wasifunc.h"
 
 #include <memory>
+#include <utility>
 
 namespace WasmEdge {
 namespace Host {
 
-WasiModule::WasiModule() : ModuleInstance("wasi_snapshot_preview1") {
-  addHostFunc("args_get", std::make_unique<WasiArgsGet>(Env));
-  addHostFunc("args_sizes_get", std::make_unique<WasiArgsSizesGet>(Env));
-  addHostFunc("environ_get", std::make_unique<WasiEnvironGet>(Env));
-  addHostFunc("environ_sizes_get", std::make_unique<WasiEnvironSizesGet>(Env));
-  addHostFunc("clock_res_get", std::make_unique<WasiClockResGet>(Env));
-  addHostFunc("clock_time_get", std::make_unique<WasiClockTimeGet>(Env));
-  addHostFunc("fd_advise", std::make_unique<WasiFdAdvise>(Env));
-  addHostFunc("fd_allocate", std::make_unique<WasiFdAllocate>(Env));
-  addHostFunc("fd_close", std::make_unique<WasiFdClose>(Env));
-  addHostFunc("fd_datasync", std::make_unique<WasiFdDatasync>(Env));
-  addHostFunc("fd_fdstat_get", std::make_unique<WasiFdFdstatGet>(Env));
-  addHostFunc("fd_fdstat_set_flags",
-              std::make_unique<WasiFdFdstatSetFlags>(Env));
-  addHostFunc("fd_fdstat_set_rights",
-              std::make_unique<WasiFdFdstatSetRights>(Env));
-  addHostFunc("fd_filestat_get", std::make_unique<WasiFdFilestatGet>(Env));
-  addHostFunc("fd_filestat_set_size",
-              std::make_unique<WasiFdFilestatSetSize>(Env));
-  addHostFunc("fd_filestat_set_times",
-              std::make_unique<WasiFdFilestatSetTimes>(Env));
-  addHostFunc("fd_pread", std::make_unique<WasiFdPread>(Env));
-  addHostFunc("fd_prestat_get", std::make_unique<WasiFdPrestatGet>(Env));
-  addHostFunc("fd_prestat_dir_name",
-              std::make_unique<WasiFdPrestatDirName>(Env));
-  addHostFunc("fd_pwrite", std::make_unique<WasiFdPwrite>(Env));
-  addHostFunc("fd_read", std::make_unique<WasiFdRead>(Env));
-  addHostFunc("fd_readdir", std::make_unique<WasiFdReadDir>(Env));
-  addHostFunc("fd_renumber", std::make_unique<WasiFdRenumber>(Env));
-  addHostFunc("fd_seek", std::make_unique<WasiFdSeek>(Env));
-  addHostFunc("fd_sync", std::make_unique<WasiFdSync>(Env));
-  addHostFunc("fd_tell", std::make_unique<WasiFdTell>(Env));
-  addHostFunc("fd_write", std::make_unique<WasiFdWrite>(Env));
-  addHostFunc("path_create_directory",
-              std::make_unique<WasiPathCreateDirectory>(Env));
-  addHostFunc("path_filestat_get", std::make_unique<WasiPathFilestatGet>(Env));
-  addHostFunc("path_filestat_set_times",
-              std::make_unique<WasiPathFilestatSetTimes>(Env));
-  addHostFunc("path_link", std::make_unique<WasiPathLink>(Env));
-  addHostFunc("path_open", std::make_unique<WasiPathOpen>(Env));
-  addHostFunc("path_readlink", std::make_unique<WasiPathReadLink>(Env));
-  addHostFunc("path_remove_directory",
-              std::make_unique<WasiPathRemoveDirectory>(Env));
-  addHostFunc("path_rename", std::make_unique<WasiPathRename>(Env));
-  addHostFunc("path_symlink", std::make_unique<WasiPathSymlink>(Env));
-  addHostFunc("path_unlink_file", std::make_unique<WasiPathUnlinkFile>(Env));
-  addHostFunc("poll_oneoff",
-              std::make_unique<WasiPollOneoff<WASI::TriggerType::Level>>(Env));
-  addHostFunc("epoll_oneoff",
-              std::make_unique<WasiPollOneoff<WASI::TriggerType::Edge>>(Env));
-  addHostFunc("proc_exit", std::make_unique<WasiProcExit>(Env));
-  addHostFunc("proc_raise", std::make_unique<WasiProcRaise>(Env));
-  addHostFunc("sched_yield", std::make_unique<WasiSchedYield>(Env));
-  addHostFunc("random_get", std::make_unique<WasiRandomGet>(Env));
+namespace {
+void addWasiFunctions(Runtime::Instance::ModuleInstance &Mod,
+                      WASI::Environ &Env) {
+  Mod.addHostFunc("args_get", std::make_unique<WasiArgsGet>(Env));
+  Mod.addHostFunc("args_sizes_get", std::make_unique<WasiArgsSizesGet>(Env));
+  Mod.addHostFunc("environ_get", std::make_unique<WasiEnvironGet>(Env));
+  Mod.addHostFunc("environ_sizes_get",
+                  std::make_unique<WasiEnvironSizesGet>(Env));
+  Mod.addHostFunc("clock_res_get", std::make_unique<WasiClockResGet>(Env));
+  Mod.addHostFunc("clock_time_get", std::make_unique<WasiClockTimeGet>(Env));
+  Mod.addHostFunc("fd_advise", std::make_unique<WasiFdAdvise>(Env));
+  Mod.addHostFunc("fd_allocate", std::make_unique<WasiFdAllocate>(Env));
+  Mod.addHostFunc("fd_close", std::make_unique<WasiFdClose>(Env));
+  Mod.addHostFunc("fd_datasync", std::make_unique<WasiFdDatasync>(Env));
+  Mod.addHostFunc("fd_fdstat_get", std::make_unique<WasiFdFdstatGet>(Env));
+  Mod.addHostFunc("fd_fdstat_set_flags",
+                  std::make_unique<WasiFdFdstatSetFlags>(Env));
+  Mod.addHostFunc("fd_fdstat_set_rights",
+                  std::make_unique<WasiFdFdstatSetRights>(Env));
+  Mod.addHostFunc("fd_filestat_get", std::make_unique<WasiFdFilestatGet>(Env));
+  Mod.addHostFunc("fd_filestat_set_size",
+                  std::make_unique<WasiFdFilestatSetSize>(Env));
+  Mod.addHostFunc("fd_filestat_set_times",
+                  std::make_unique<WasiFdFilestatSetTimes>(Env));
+  Mod.addHostFunc("fd_pread", std::make_unique<WasiFdPread>(Env));
+  Mod.addHostFunc("fd_prestat_get", std::make_unique<WasiFdPrestatGet>(Env));
+  Mod.addHostFunc("fd_prestat_dir_name",
+                  std::make_unique<WasiFdPrestatDirName>(Env));
+  Mod.addHostFunc("fd_pwrite", std::make_unique<WasiFdPwrite>(Env));
+  Mod.addHostFunc("fd_read", std::make_unique<WasiFdRead>(Env));
+  Mod.addHostFunc("fd_readdir", std::make_unique<WasiFdReadDir>(Env));
+  Mod.addHostFunc("fd_renumber", std::make_unique<WasiFdRenumber>(Env));
+  Mod.addHostFunc("fd_seek", std::make_unique<WasiFdSeek>(Env));
+  Mod.addHostFunc("fd_sync", std::make_unique<WasiFdSync>(Env));
+  Mod.addHostFunc("fd_tell", std::make_unique<WasiFdTell>(Env));
+  Mod.addHostFunc("fd_write", std::make_unique<WasiFdWrite>(Env));
+  Mod.addHostFunc("path_create_directory",
+                  std::make_unique<WasiPathCreateDirectory>(Env));
+  Mod.addHostFunc("path_filestat_get",
+                  std::make_unique<WasiPathFilestatGet>(Env));
+  Mod.addHostFunc("path_filestat_set_times",
+                  std::make_unique<WasiPathFilestatSetTimes>(Env));
+  Mod.addHostFunc("path_link", std::make_unique<WasiPathLink>(Env));
+  Mod.addHostFunc("path_open", std::make_unique<WasiPathOpen>(Env));
+  Mod.addHostFunc("path_readlink", std::make_unique<WasiPathReadLink>(Env));
+  Mod.addHostFunc("path_remove_directory",
+                  std::make_unique<WasiPathRemoveDirectory>(Env));
+  Mod.addHostFunc("path_rename", std::make_unique<WasiPathRename>(Env));
+  Mod.addHostFunc("path_symlink", std::make_unique<WasiPathSymlink>(Env));
+  Mod.addHostFunc("path_unlink_file",
+                  std::make_unique<WasiPathUnlinkFile>(Env));
+  Mod.addHostFunc(
+      "poll_oneoff",
+      std::make_unique<WasiPollOneoff<WASI::TriggerType::Level>>(Env));
+  Mod.addHostFunc(
+      "epoll_oneoff",
+      std::make_unique<WasiPollOneoff<WASI::TriggerType::Edge>>(Env));
+  Mod.addHostFunc("proc_exit", std::make_unique<WasiProcExit>(Env));
+  Mod.addHostFunc("proc_raise", std::make_unique<WasiProcRaise>(Env));
+  Mod.addHostFunc("sched_yield", std::make_unique<WasiSchedYield>(Env));
+  Mod.addHostFunc("random_get", std::make_unique<WasiRandomGet>(Env));
   // To make the socket API compatible with the old one,
   // we will duplicate all the API to V1 and V2.
   // V1 represents the original behavior before the 0.12 release.
@@ -72,35 +80,83 @@ WasiModule::WasiModule() : ModuleInstance("wasi_snapshot_preview1") {
   // AF_UNIX.
   // By default, we register V1 first. If the signatures are not the same as the
   // wasm application imported, V2 will replace it.
-  addHostFunc("sock_open", std::make_unique<WasiSockOpenV1>(Env));
-  addHostFunc("sock_bind", std::make_unique<WasiSockBindV1>(Env));
-  addHostFunc("sock_connect", std::make_unique<WasiSockConnectV1>(Env));
-  addHostFunc("sock_listen", std::make_unique<WasiSockListenV1>(Env));
-  addHostFunc("sock_accept", std::make_unique<WasiSockAcceptV1>(Env));
-  addHostFunc("sock_recv", std::make_unique<WasiSockRecvV1>(Env));
-  addHostFunc("sock_recv_from", std::make_unique<WasiSockRecvFromV1>(Env));
-  addHostFunc("sock_send", std::make_unique<WasiSockSendV1>(Env));
-  addHostFunc("sock_send_to", std::make_unique<WasiSockSendToV1>(Env));
-  addHostFunc("sock_accept_v2", std::make_unique<WasiSockAcceptV2>(Env));
-  addHostFunc("sock_open_v2", std::make_unique<WasiSockOpenV2>(Env));
-  addHostFunc("sock_bind_v2", std::make_unique<WasiSockBindV2>(Env));
-  addHostFunc("sock_connect_v2", std::make_unique<WasiSockConnectV2>(Env));
-  addHostFunc("sock_listen_v2", std::make_unique<WasiSockListenV2>(Env));
-  addHostFunc("sock_recv_v2", std::make_unique<WasiSockRecvV2>(Env));
-  addHostFunc("sock_recv_from_v2", std::make_unique<WasiSockRecvFromV2>(Env));
-  addHostFunc("sock_send_v2", std::make_unique<WasiSockSendV2>(Env));
-  addHostFunc("sock_send_to_v2", std::make_unique<WasiSockSendToV2>(Env));
-  addHostFunc("sock_shutdown", std::make_unique<WasiSockShutdown>(Env));
-  addHostFunc("sock_getsockopt", std::make_unique<WasiSockGetOpt>(Env));
-  addHostFunc("sock_setsockopt", std::make_unique<WasiSockSetOpt>(Env));
-  addHostFunc("sock_getlocaladdr",
-              std::make_unique<WasiSockGetLocalAddrV1>(Env));
-  addHostFunc("sock_getpeeraddr", std::make_unique<WasiSockGetPeerAddrV1>(Env));
-  addHostFunc("sock_getlocaladdr_v2",
-              std::make_unique<WasiSockGetLocalAddrV2>(Env));
-  addHostFunc("sock_getpeeraddr_v2",
-              std::make_unique<WasiSockGetPeerAddrV2>(Env));
-  addHostFunc("sock_getaddrinfo", std::make_unique<WasiSockGetAddrinfo>(Env));
+  Mod.addHostFunc("sock_open", std::make_unique<WasiSockOpenV1>(Env));
+  Mod.addHostFunc("sock_bind", std::make_unique<WasiSockBindV1>(Env));
+  Mod.addHostFunc("sock_connect", std::make_unique<WasiSockConnectV1>(Env));
+  Mod.addHostFunc("sock_listen", std::make_unique<WasiSockListenV1>(Env));
+  Mod.addHostFunc("sock_accept", std::make_unique<WasiSockAcceptV1>(Env));
+  Mod.addHostFunc("sock_recv", std::make_unique<WasiSockRecvV1>(Env));
+  Mod.addHostFunc("sock_recv_from", std::make_unique<WasiSockRecvFromV1>(Env));
+  Mod.addHostFunc("sock_send", std::make_unique<WasiSockSendV1>(Env));
+  Mod.addHostFunc("sock_send_to", std::make_unique<WasiSockSendToV1>(Env));
+  Mod.addHostFunc("sock_accept_v2", std::make_unique<WasiSockAcceptV2>(Env));
+  Mod.addHostFunc("sock_open_v2", std::make_unique<WasiSockOpenV2>(Env));
+  Mod.addHostFunc("sock_bind_v2", std::make_unique<WasiSockBindV2>(Env));
+  Mod.addHostFunc("sock_connect_v2", std::make_unique<WasiSockConnectV2>(Env));
+  Mod.addHostFunc("sock_listen_v2", std::make_unique<WasiSockListenV2>(Env));
+  Mod.addHostFunc("sock_recv_v2", std::make_unique<WasiSockRecvV2>(Env));
+  Mod.addHostFunc("sock_recv_from_v2",
+                  std::make_unique<WasiSockRecvFromV2>(Env));
+  Mod.addHostFunc("sock_send_v2", std::make_unique<WasiSockSendV2>(Env));
+  Mod.addHostFunc("sock_send_to_v2", std::make_unique<WasiSockSendToV2>(Env));
+  Mod.addHostFunc("sock_shutdown", std::make_unique<WasiSockShutdown>(Env));
+  Mod.addHostFunc("sock_getsockopt", std::make_unique<WasiSockGetOpt>(Env));
+  Mod.addHostFunc("sock_setsockopt", std::make_unique<WasiSockSetOpt>(Env));
+  Mod.addHostFunc("sock_getlocaladdr",
+                  std::make_unique<WasiSockGetLocalAddrV1>(Env));
+  Mod.addHostFunc("sock_getpeeraddr",
+                  std::make_unique<WasiSockGetPeerAddrV1>(Env));
+  Mod.addHostFunc("sock_getlocaladdr_v2",
+                  std::make_unique<WasiSockGetLocalAddrV2>(Env));
+  Mod.addHostFunc("sock_getpeeraddr_v2",
+                  std::make_unique<WasiSockGetPeerAddrV2>(Env));
+  Mod.addHostFunc("sock_getaddrinfo",
+                  std::make_unique<WasiSockGetAddrinfo>(Env));
+}
+
+/// The immutable module holding the host function bodies shared by the WASI
+/// modules created by `WasiModule::createShared()`.
+const Runtime::Instance::ModuleInstance &sharedTemplate() {
+  static const std::unique_ptr<const Runtime::Instance::ModuleInstance>
+      Template = []() {
+        auto Mod = std::make_unique<Runtime::Instance::ModuleInstance>(
+            "wasi_snapshot_preview1");
+        addWasiFunctions(*Mod, WasiModule::unboundEnv());
+        Mod->finalizeInstantiation();
+        return Mod;
+      }();
+  return *Template;
+}
+} // namespace
+
+WasiModule::WasiModule() : ModuleInstance("wasi_snapshot_preview1") {
+  addWasiFunctions(*this, Env);
+}
+
+WasiModule::WasiModule(const Runtime::Instance::ModuleInstance &Template)
+    : ModuleInstance("wasi_snapshot_preview1") {
+  shareHostFuncs(Template);
+}
+
+std::unique_ptr<WasiModule> WasiModule::createShared() {
+  return std::unique_ptr<WasiModule>(new WasiModule(sharedTemplate()));
+}
+
+WASI::Environ &WasiModule::unboundEnv() noexcept {
+  static WASI::Environ Unbound;
+  return Unbound;
+}
+
+WASI::Environ *
+WasiModule::resolveEnv(const Runtime::CallingFrame &Frame) noexcept {
+  // Every WASI module sharing the bodies has its own function instances, so
+  // the called one leads to the environment however it was reached.
+  if (const auto *Func = Frame.getFunction()) {
+    if (const auto *Mod = dynamic_cast<const WasiModule *>(Func->getModule())) {
+      return &const_cast<WasiModule *>(Mod)->Env;
+    }
+  }
+  return nullptr;
 }
 
 } // namespace Host
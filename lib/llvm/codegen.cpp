@@ -305,7 +305,8 @@ Expect<void> outputNativeLibrary(const std::filesystem::path &OutputPath,
 Expect<void> outputWasmLibrary(LLVM::Context LLContext,
                                const std::filesystem::path &OutputPath,
                                Span<const Byte> Data,
-                               const LLVM::MemoryBuffer &OSVec) noexcept {
+                               const LLVM::MemoryBuffer &OSVec,
+                               std::string_view TargetCPU) noexcept {
   std::filesystem::path SharedObjectName;
   {
     // tempfile
@@ -346,7 +347,13 @@ Expect<void> outputWasmLibrary(LLVM::Context LLContext,
   std::string OSCustomSecVec;
   {
     std::ostringstream OS;
-    WriteName(OS, "wasmedge"sv);
+    if (TargetCPU.empty()) {
+      WriteName(OS, "wasmedge"sv);
+    } else {
+      // Code variants are in their own sections, which are unknown to and
+      // skipped by the loaders without the variant selection.
+      WriteName(OS, "wasmedge."s.append(TargetCPU));
+    }
     WriteU32(OS, AOT::kBinaryVersion);
 
 #if WASMEDGE_OS_LINUX
@@ -487,13 +494,18 @@ Expect<void> outputWasmLibrary(LLVM::Context LLContext,
 
   spdlog::info("output start"sv);
 
-  std::ofstream OS(OutputPath, std::ios_base::binary);
+  // A code variant is appended to the universal wasm of the baseline.
+  std::ofstream OS(OutputPath, TargetCPU.empty()
+                                   ? std::ios_base::binary
+                                   : std::ios_base::binary | std::ios_base::app);
   if (!OS) {
     spdlog::error("output failed."sv);
     return Unexpect(ErrCode::Value::IllegalPath);
   }
-  OS.write(reinterpret_cast<const char *>(Data.data()),
-           static_cast<std::streamsize>(Data.size()));
+  if (TargetCPU.empty()) {
+    OS.write(reinterpret_cast<const char *>(Data.data()),
+             static_cast<std::streamsize>(Data.size()));
+  }
   // Custom section id
   WriteByte(OS, UINT8_C(0x00));
   WriteName(OS, std::string_view(OSCustomSecVec.data(), OSCustomSecVec.size()));
@@ -605,6 +617,12 @@ Expect<void> CodeGen::codegen(Span<const Byte> WasmData, Data D,
     }
   }
 
+  if (!TargetCPU.empty() && Conf.getCompilerConfigure().getOutputFormat() !=
+                                CompilerConfigure::OutputFormat::Wasm) {
+    spdlog::error("code variants require the universal wasm output format."sv);
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+
   spdlog::info("codegen start"sv);
   // codegen
   {
@@ -626,7 +644,8 @@ Expect<void> CodeGen::codegen(Span<const Byte> WasmData, Data D,
 
     if (Conf.getCompilerConfigure().getOutputFormat() ==
         CompilerConfigure::OutputFormat::Wasm) {
-      EXPECTED_TRY(outputWasmLibrary(LLContext, OutputPath, WasmData, OSVec));
+      EXPECTED_TRY(outputWasmLibrary(LLContext, OutputPath, WasmData, OSVec,
+                                     TargetCPU));
     } else {
       EXPECTED_TRY(outputNativeLibrary(OutputPath, OSVec));
     }
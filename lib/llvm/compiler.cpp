@@ -109,6 +109,20 @@ Expect<void> Compiler::checkConfigure() noexcept {
   return {};
 }
 
+Expect<void> Compiler::setTargetCPU(std::string_view Name) noexcept {
+  if (Name.empty()) {
+    Target.reset();
+    return {};
+  }
+  if (auto T = CPU::find(Name)) {
+    Target = *T;
+    return {};
+  }
+  spdlog::error(ErrCode::Value::InvalidAOTConfigure);
+  spdlog::error("    Unknown target CPU {} for the host architecture."sv, Name);
+  return Unexpect(ErrCode::Value::InvalidAOTConfigure);
+}
+
 Expect<void> Compiler::optimize(LLVM::Module &LLModule,
                                 LLVM::TargetMachine &TM) noexcept {
   spdlog::info("optimize start"sv);
@@ -123,7 +137,9 @@ Expect<void> Compiler::optimize(LLVM::Module &LLModule,
 #if defined(__riscv) && __riscv_xlen == 64
   CPUName = "generic-rv64"s;
 #else
-  if (!Conf.getCompilerConfigure().isGenericBinary()) {
+  if (Target) {
+    CPUName = Target->Name;
+  } else if (!Conf.getCompilerConfigure().isGenericBinary()) {
     CPUName = LLVM::getHostCPUName().string_view();
   } else {
     CPUName = "generic"s;
@@ -132,14 +148,19 @@ Expect<void> Compiler::optimize(LLVM::Module &LLModule,
 
   // On RISC-V we use generic-rv64 as the CPU, so also use default
   // features; host features under QEMU can be inconsistent (e.g.
-  // zvl*b without v) which LLVM >= 20 rejects.
-  TM = LLVM::TargetMachine::create(
-      TheTarget, Triple, CPUName.c_str(),
-#if defined(__riscv) && __riscv_xlen == 64
-      "",
-#else
-      LLVM::getHostCPUFeatures().unwrap(),
+  // zvl*b without v) which LLVM >= 20 rejects. The generic binary, which is
+  // also the baseline code of a multi-variant binary, uses no host features
+  // either, so it runs on any CPU of the architecture.
+  std::string Features;
+#if !(defined(__riscv) && __riscv_xlen == 64)
+  if (Target) {
+    Features = Target->Features;
+  } else if (!Conf.getCompilerConfigure().isGenericBinary()) {
+    Features = LLVM::getHostCPUFeatures().string_view();
+  }
 #endif
+  TM = LLVM::TargetMachine::create(
+      TheTarget, Triple, CPUName.c_str(), Features.c_str(),
       toLLVMCodeGenLevel(Conf.getCompilerConfigure().getOptimizationLevel()),
       LLVMRelocPIC, LLVMCodeModelDefault);
 
@@ -213,12 +234,38 @@ Expect<Data> Compiler::compile(const AST::Module &Module) noexcept {
   auto &LLModule = D.extract().LLModule;
 
   CompileContext NewContext(LLContext, LLModule,
-                            Conf.getCompilerConfigure().isGenericBinary());
+                            Conf.getCompilerConfigure().isGenericBinary(),
+                            Target ? Target->Features : std::string_view());
   RAIICleanup Cleanup(Context, &NewContext);
   Context->addVersionGlobal();
 
+  // Use the profile only if it was recorded from this module.
+  if (Prof != nullptr) {
+    uint64_t Hash = 0;
+    for (const auto &Seg : Module.getCodeSection().getContent()) {
+      for (const auto &Instr : Seg.getExpr().getInstrs()) {
+        Hash = Profile::Profile::hashInstr(
+            Hash, Instr.getOffset(), static_cast<uint32_t>(Instr.getOpCode()));
+      }
+    }
+    if (Prof->getModuleHash() != Hash) {
+      spdlog::warn("profile does not match the module, ignored"sv);
+    } else {
+      Context->Prof = Prof;
+      Context->HotCallThreshold = Prof->getHotCallThreshold();
+    }
+  }
+
   // Compile all sections and the function declarations.
   compileSections(Module, false);
+  if (Context->Prof != nullptr) {
+    for (uint32_t I = 0; I < Context->Functions.size(); ++I) {
+      if (const auto *Code = std::get<2>(Context->Functions[I])) {
+        Context->ProfiledFuncs.emplace(
+            Code->getExpr().getInstrs().front().getOffset(), I);
+      }
+    }
+  }
   // Compile all function bodies.
   const auto DefinedCount = Module.getDefinedFuncCount();
   for (uint32_t I = 0; I < DefinedCount; ++I) {
@@ -625,7 +672,22 @@ Expect<void> Compiler::compileFunctionBody(uint32_t LocalFuncIndex) noexcept {
       *Context, F, Locals, Conf.getCompilerConfigure().isInterruptible(),
       Conf.getStatisticsConfigure().isInstructionCounting(),
       Conf.getStatisticsConfigure().isCostMeasuring(),
-      Conf.getRuntimeConfigure().getRunMode() == RunMode::LazyJIT);
+      Conf.getRuntimeConfigure().getRunMode() == RunMode::LazyJIT ||
+          Conf.getRuntimeConfigure().getRunMode() == RunMode::Tiered);
+  if (Context->Prof != nullptr) {
+    // Functions never called during profiling are optimized for size, and
+    // the most called ones are hinted to be inlined.
+    const auto Count = Context->Prof->getCallCount(
+        Code->getExpr().getInstrs().front().getOffset());
+    if (Count == 0) {
+      F.Fn.addFnAttr(Context->Cold);
+      F.Fn.addFnAttr(Context->OptimizeForSize);
+    } else if (Count >= Context->HotCallThreshold) {
+      F.Fn.addFnAttr(Context->Hot);
+      F.Fn.addFnAttr(Context->InlineHint);
+    }
+  }
+
   auto Type = Context->resolveBlockType(T);
   EXPECTED_TRY(FC.compile(*Code, std::move(Type)));
   F.Fn.eliminateUnreachableBlocks();
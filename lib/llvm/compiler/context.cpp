@@ -15,8 +15,9 @@ using namespace std::literals;
 
 namespace WasmEdge::LLVM {
 
-Compiler::CompileContext::CompileContext(LLVM::Context C, LLVM::Module &M,
-                                         bool IsGenericBinary) noexcept
+Compiler::CompileContext::CompileContext(
+    LLVM::Context C, LLVM::Module &M, bool IsGenericBinary,
+    std::string_view TargetFeatures) noexcept
     : LLContext(C), LLModule(M),
       Cold(LLVM::Attribute::createEnum(C, LLVM::Core::Cold, 0)),
       NoAlias(LLVM::Attribute::createEnum(C, LLVM::Core::NoAlias, 0)),
@@ -28,6 +29,10 @@ Compiler::CompileContext::CompileContext(LLVM::Context C, LLVM::Module &M,
                                           LLVM::Core::UWTableDefault)),
       NoStackArgProbe(
           LLVM::Attribute::createString(C, "no-stack-arg-probe"sv, {})),
+      Hot(LLVM::Attribute::createEnum(C, LLVM::Core::Hot, 0)),
+      InlineHint(LLVM::Attribute::createEnum(C, LLVM::Core::InlineHint, 0)),
+      OptimizeForSize(
+          LLVM::Attribute::createEnum(C, LLVM::Core::OptimizeForSize, 0)),
       VoidTy(LLContext.getVoidTy()), Int8Ty(LLContext.getInt8Ty()),
       Int16Ty(LLContext.getInt16Ty()), Int32Ty(LLContext.getInt32Ty()),
       Int64Ty(LLContext.getInt64Ty()), Int128Ty(LLContext.getInt128Ty()),
@@ -59,6 +64,8 @@ Compiler::CompileContext::CompileContext(LLVM::Context C, LLVM::Module &M,
                                         Int8PtrTy,
                                         // Tags
                                         Int8PtrPtrTy,
+                                        // CanonicalTypeIDs
+                                        Int32PtrTy,
                                     })),
       ModCtxPtrTy(ModCtxTy.getPointerTo()),
       ExecCtxTy(LLVM::Type::getStructType(
@@ -95,41 +102,43 @@ Compiler::CompileContext::CompileContext(LLVM::Context C, LLVM::Module &M,
   Trap.Fn.addFnAttr(Cold);
   Trap.Fn.addFnAttr(NoInline);
 
-  if (!IsGenericBinary) {
+  // The features of the target CPU of a code variant, or of the host.
+  auto Features = TargetFeatures;
+  if (Features.empty() && !IsGenericBinary) {
     SubtargetFeatures = LLVM::getHostCPUFeatures();
-    auto Features = SubtargetFeatures.string_view();
-    while (!Features.empty()) {
-      std::string_view Feature;
-      if (auto Pos = Features.find(','); Pos != std::string_view::npos) {
-        Feature = Features.substr(0, Pos);
-        Features = Features.substr(Pos + 1);
-      } else {
-        Feature = std::exchange(Features, std::string_view());
-      }
-      if (Feature[0] != '+') {
-        continue;
-      }
-      Feature = Feature.substr(1);
+    Features = SubtargetFeatures.string_view();
+  }
+  while (!Features.empty()) {
+    std::string_view Feature;
+    if (auto Pos = Features.find(','); Pos != std::string_view::npos) {
+      Feature = Features.substr(0, Pos);
+      Features = Features.substr(Pos + 1);
+    } else {
+      Feature = std::exchange(Features, std::string_view());
+    }
+    if (Feature[0] != '+') {
+      continue;
+    }
+    Feature = Feature.substr(1);
 
 #if defined(__x86_64__)
-      if (!SupportXOP && Feature == "xop"sv) {
-        SupportXOP = true;
-      }
-      if (!SupportSSE4_1 && Feature == "sse4.1"sv) {
-        SupportSSE4_1 = true;
-      }
-      if (!SupportSSSE3 && Feature == "ssse3"sv) {
-        SupportSSSE3 = true;
-      }
-      if (!SupportSSE2 && Feature == "sse2"sv) {
-        SupportSSE2 = true;
-      }
+    if (!SupportXOP && Feature == "xop"sv) {
+      SupportXOP = true;
+    }
+    if (!SupportSSE4_1 && Feature == "sse4.1"sv) {
+      SupportSSE4_1 = true;
+    }
+    if (!SupportSSSE3 && Feature == "ssse3"sv) {
+      SupportSSSE3 = true;
+    }
+    if (!SupportSSE2 && Feature == "sse2"sv) {
+      SupportSSE2 = true;
+    }
 #elif defined(__aarch64__)
-      if (!SupportNEON && Feature == "neon"sv) {
-        SupportNEON = true;
-      }
-#endif
+    if (!SupportNEON && Feature == "neon"sv) {
+      SupportNEON = true;
     }
+#endif
   }
 
   compileTrap();
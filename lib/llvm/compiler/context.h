@@ -11,8 +11,9 @@
 
 #include <cstdint>
 #include <functional>
-
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,9 @@ struct Compiler::CompileContext {
   LLVM::Attribute StrictFP;
   LLVM::Attribute UWTable;
   LLVM::Attribute NoStackArgProbe;
+  LLVM::Attribute Hot;
+  LLVM::Attribute InlineHint;
+  LLVM::Attribute OptimizeForSize;
   LLVM::Type VoidTy;
   LLVM::Type Int8Ty;
   LLVM::Type Int16Ty;
@@ -114,8 +118,12 @@ struct Compiler::CompileContext {
   std::vector<uint32_t> Tags;
   LLVM::Value IntrinsicsTable;
   LLVM::FunctionCallee Trap;
-  CompileContext(LLVM::Context C, LLVM::Module &M,
-                 bool IsGenericBinary) noexcept;
+  const Profile::Profile *Prof = nullptr;
+  uint64_t HotCallThreshold = UINT64_MAX;
+  /// Function indices by the body offsets used in the profile.
+  std::unordered_map<uint32_t, uint32_t> ProfiledFuncs;
+  CompileContext(LLVM::Context C, LLVM::Module &M, bool IsGenericBinary,
+                 std::string_view TargetFeatures = {}) noexcept;
   LLVM::Value getMemory(LLVM::Builder &Builder, LLVM::Value ModCtx,
                         uint32_t Index) noexcept {
     auto Array = Builder.createExtractValue(ModCtx, 0);
@@ -198,6 +206,16 @@ struct Compiler::CompileContext {
                      LLVM::Metadata(LLContext, {}));
     return VPtr;
   }
+  LLVM::Value getCanonicalTypeID(LLVM::Builder &Builder, LLVM::Value ModCtx,
+                                 uint32_t Index) noexcept {
+    auto Array = Builder.createExtractValue(ModCtx, 7);
+    auto ID = Builder.createLoad(
+        Int32Ty,
+        Builder.createInBoundsGEP1(Int32Ty, Array, LLContext.getInt64(Index)));
+    ID.setMetadata(LLContext, LLVM::Core::InvariantGroup,
+                   LLVM::Metadata(LLContext, {}));
+    return ID;
+  }
   LLVM::Value getPendingExnTagAddr(LLVM::Builder &Builder,
                                    LLVM::Value ExecCtx) noexcept {
     return Builder.createExtractValue(ExecCtx, 5);
@@ -254,7 +272,8 @@ struct Compiler::CompileContext {
   }
   void finalizeIntrinsicsTable() noexcept {
     if (auto Table = LLModule.get().getNamedGlobal("intrinsics")) {
-      Table.setInitializer(LLVM::Value::getConstNull(Table.getType()));
+      // The type of a global is a pointer to its value type.
+      Table.setInitializer(LLVM::Value::getConstNull(IntrinsicsTablePtrTy));
       Table.setGlobalConstant(false);
     } else {
       LLModule.get().addGlobal(IntrinsicsTablePtrTy, false, LLVMExternalLinkage,
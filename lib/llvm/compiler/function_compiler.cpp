@@ -4,6 +4,7 @@
 #include "compiler/function_compiler.h"
 
 #include "runtime/instance/function.h"
+#include "runtime/instance/module.h"
 
 #include <algorithm>
 #include <array>
@@ -173,7 +174,8 @@ Expect<void> FunctionCompiler::compile(AST::InstrView Instrs) noexcept {
       } else {
         Cond = Builder.createICmpNE(stackPop(), LLContext.getInt32(0));
       }
-      Builder.createCondBr(Cond, Then, Else);
+      setBranchWeights(Builder.createCondBr(Cond, Then, Else),
+                       Instr.getOffset());
 
       Builder.positionAtEnd(Then);
       auto Type = Context.resolveBlockType(Instr.getBlockType());
@@ -257,7 +259,8 @@ Expect<void> FunctionCompiler::compile(AST::InstrView Instrs) noexcept {
       auto Cond = Builder.createICmpNE(stackPop(), LLContext.getInt32(0));
       setLableJumpPHI(Label);
       auto Next = LLVM::BasicBlock::create(LLContext, F.Fn, "br_if.end");
-      Builder.createCondBr(Cond, getLabel(Label), Next);
+      setBranchWeights(Builder.createCondBr(Cond, getLabel(Label), Next),
+                       Instr.getOffset());
       Builder.positionAtEnd(Next);
       break;
     }
@@ -350,7 +353,8 @@ Expect<void> FunctionCompiler::compile(AST::InstrView Instrs) noexcept {
     case OpCode::Call_indirect:
       updateInstrCount();
       updateGas();
-      compileIndirectCallOp(Instr.getSourceIndex(), Instr.getTargetIndex());
+      compileIndirectCallOp(Instr.getSourceIndex(), Instr.getTargetIndex(),
+                            Instr.getOffset());
       break;
     case OpCode::Return_call:
       updateInstrCount();
@@ -1109,6 +1113,53 @@ void FunctionCompiler::compileReturn() noexcept {
   }
 }
 
+void FunctionCompiler::setBranchWeights(LLVM::Value Br,
+                                        uint32_t Offset) noexcept {
+  if (Context.Prof == nullptr) {
+    return;
+  }
+  const auto Count = Context.Prof->getBranchCount(Offset);
+  if (!Count) {
+    return;
+  }
+  // Branch weights are 32-bit; scale both counts down together.
+  auto [Taken, NotTaken] = *Count;
+  while (Taken > UINT32_MAX || NotTaken > UINT32_MAX) {
+    Taken >>= 1;
+    NotTaken >>= 1;
+  }
+  LLVM::Metadata Weights[] = {
+      LLVM::Metadata::getString(LLContext, "branch_weights"sv),
+      LLVM::Metadata(LLContext.getInt32(static_cast<uint32_t>(Taken))),
+      LLVM::Metadata(LLContext.getInt32(static_cast<uint32_t>(NotTaken)))};
+  Br.setMetadata(LLContext, LLVM::Core::Prof,
+                 LLVM::Metadata(LLContext, Weights));
+}
+
+std::optional<uint32_t>
+FunctionCompiler::getPromotedCallee(uint32_t Offset,
+                                    uint32_t FuncTypeIndex) noexcept {
+  // The lazy JIT compiles every function into its own module.
+  if (Context.Prof == nullptr || IsLazyJIT) {
+    return std::nullopt;
+  }
+  const auto Target = Context.Prof->getIndirectCallTarget(Offset);
+  if (!Target) {
+    return std::nullopt;
+  }
+  const auto It = Context.ProfiledFuncs.find(Target->first);
+  if (It == Context.ProfiledFuncs.end()) {
+    return std::nullopt;
+  }
+  const auto &CalleeType =
+      Context.CompositeTypes[std::get<0>(Context.Functions[It->second])];
+  if (CalleeType->getFuncType() !=
+      Context.CompositeTypes[FuncTypeIndex]->getFuncType()) {
+    return std::nullopt;
+  }
+  return It->second;
+}
+
 void FunctionCompiler::updateInstrCount() noexcept {
   if (LocalInstrCount) {
     auto Store [[maybe_unused]] = Builder.createAtomicRMW(
@@ -1435,8 +1486,9 @@ void FunctionCompiler::compileCallOp(const unsigned int FuncIndex) noexcept {
   checkPendingException();
 }
 
-void FunctionCompiler::compileIndirectCallOp(
-    const uint32_t TableIndex, const uint32_t FuncTypeIndex) noexcept {
+void FunctionCompiler::compileIndirectCallOp(const uint32_t TableIndex,
+                                             const uint32_t FuncTypeIndex,
+                                             const uint32_t Offset) noexcept {
   auto TryFastBB = LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.tryfast");
   auto NonNullBB = LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.nonnull");
   auto FastBB = LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.fast");
@@ -1475,9 +1527,11 @@ void FunctionCompiler::compileIndirectCallOp(
 
   auto Idx64 = Builder.createZExt(FuncIndex, Context.Int64Ty);
 
-  // Fast path: an in-bounds funcref defined in the running module with the
-  // call site's type index and compiled code is called directly.
+  // Fast path: an in-bounds funcref with compiled code and the same canonical
+  // type ID as the call site's type is called directly, with the module
+  // context of the module defining it.
   std::vector<LLVM::Value> FastRetsVec;
+  LLVM::BasicBlock FastExitBB = FastBB;
   {
     Builder.createCondBr(
         Builder.createLikely(Builder.createICmpULT(
@@ -1506,24 +1560,65 @@ void FunctionCompiler::compileIndirectCallOp(
                   Ty.getPointerTo()));
     };
     using Runtime::Instance::FunctionInstance;
-    auto DefModule =
-        LoadField(FunctionInstance::getModuleOffset(), Context.Int8PtrTy);
-    auto CalleeTypeIdx =
-        LoadField(FunctionInstance::getTypeIndexOffset(), Context.Int32Ty);
+    using Runtime::Instance::ModuleInstance;
+    auto CalleeTypeID = LoadField(FunctionInstance::getCanonicalTypeIDOffset(),
+                                  Context.Int32Ty);
     auto Code =
         LoadField(FunctionInstance::getCompiledCodeOffset(), Context.Int8PtrTy);
     auto Hit = Builder.createAnd(
-        Builder.createAnd(Builder.createICmpEQ(DefModule, Context.getModuleInst(
-                                                              Builder, ModCtx)),
-                          Builder.createICmpEQ(CalleeTypeIdx, TypeIdx)),
+        Builder.createICmpEQ(CalleeTypeID, Context.getCanonicalTypeID(
+                                               Builder, ModCtx, FuncTypeIndex)),
         Builder.createNot(Builder.createIsNull(Code)));
     Builder.createCondBr(Builder.createLikely(Hit), FastBB, SlowBB);
 
     Builder.positionAtEnd(FastBB);
-    auto FastRet = Builder.createCall(
-        LLVM::FunctionCallee{FTy, Builder.createBitCast(Code, FPtrTy)},
-        ArgsVec);
+    auto DefModule =
+        LoadField(FunctionInstance::getModuleOffset(), Context.Int8PtrTy);
+    std::vector<LLVM::Value> FastArgsVec = ArgsVec;
+    FastArgsVec[0] = Builder.createBitCast(
+        Builder.createInBoundsGEP1(
+            Context.Int8Ty, DefModule,
+            LLContext.getInt64(ModuleInstance::getModuleContextOffset())),
+        Context.ModCtxPtrTy);
+    LLVM::Value FastRet;
+    if (auto Callee = getPromotedCallee(Offset, FuncTypeIndex)) {
+      // The callee taking most of the calls in the profile is called
+      // directly, so that it can be inlined.
+      auto PromotedBB =
+          LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.promoted");
+      auto IndirectBB =
+          LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.indirect");
+      auto FastEndBB =
+          LLVM::BasicBlock::create(LLContext, F.Fn, "c_i.fast_end");
+      const auto &Target = std::get<1>(Context.Functions[*Callee]);
+      Builder.createCondBr(
+          Builder.createLikely(Builder.createICmpEQ(
+              Code, Builder.createBitCast(Target.Fn, Context.Int8PtrTy))),
+          PromotedBB, IndirectBB);
+
+      Builder.positionAtEnd(PromotedBB);
+      auto PromotedRet = Builder.createCall(Target, FastArgsVec);
+      Builder.createBr(FastEndBB);
+
+      Builder.positionAtEnd(IndirectBB);
+      auto IndirectRet = Builder.createCall(
+          LLVM::FunctionCallee{FTy, Builder.createBitCast(Code, FPtrTy)},
+          FastArgsVec);
+      Builder.createBr(FastEndBB);
+
+      Builder.positionAtEnd(FastEndBB);
+      if (RetSize != 0) {
+        FastRet = Builder.createPHI(RTy);
+        FastRet.addIncoming(PromotedRet, PromotedBB);
+        FastRet.addIncoming(IndirectRet, IndirectBB);
+      }
+    } else {
+      FastRet = Builder.createCall(
+          LLVM::FunctionCallee{FTy, Builder.createBitCast(Code, FPtrTy)},
+          FastArgsVec);
+    }
     FastRetsVec = UnpackRets(FastRet);
+    FastExitBB = Builder.getInsertBlock();
     Builder.createBr(EndBB);
   }
 
@@ -1591,7 +1686,7 @@ void FunctionCompiler::compileIndirectCallOp(
 
   for (unsigned I = 0; I < RetSize; ++I) {
     auto PHIRet = Builder.createPHI(FPtrRetsVec[I].getType());
-    PHIRet.addIncoming(FastRetsVec[I], FastBB);
+    PHIRet.addIncoming(FastRetsVec[I], FastExitBB);
     PHIRet.addIncoming(FPtrRetsVec[I], NotNullBB);
     PHIRet.addIncoming(RetsVec[I], IsNullBB);
     stackPush(PHIRet);
@@ -2026,8 +2121,18 @@ void FunctionCompiler::checkStop() noexcept {
 #endif
   auto NotStop = Builder.createLikely(
       Builder.createICmpEQ(StopToken, LLContext.getInt32(0)));
-  Builder.createCondBr(NotStop, NotStopBB,
-                       getTrapBB(ErrCode::Value::Interrupted));
+  // The runtime traps on a stop request, or yields and continues.
+  auto StopBB = LLVM::BasicBlock::create(LLContext, F.Fn, "Stop");
+  Builder.createCondBr(NotStop, NotStopBB, StopBB);
+
+  Builder.positionAtEnd(StopBB);
+  Builder.createCall(
+      Context.getIntrinsic(
+          Builder, Executable::Intrinsics::kCheckStop,
+          LLVM::Type::getFunctionType(Context.VoidTy, {Context.Int32Ty},
+                                      false)),
+      {StopToken});
+  Builder.createBr(NotStopBB);
 
   Builder.positionAtEnd(NotStopBB);
 }
@@ -5,6 +5,7 @@
 #include "compiler/context.h"
 
 #include <cstdint>
+#include <optional>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -70,6 +71,14 @@ public:
 
   void updateGasAtTrap() noexcept;
 
+  /// Attach the profiled branch weights of the instruction at \p Offset.
+  void setBranchWeights(LLVM::Value Br, uint32_t Offset) noexcept;
+
+  /// Get the defined function to promote the call_indirect at \p Offset to,
+  /// which must have the type of the call site.
+  std::optional<uint32_t> getPromotedCallee(uint32_t Offset,
+                                            uint32_t FuncTypeIndex) noexcept;
+
 private:
   void compileTryTableOp(const AST::Instruction &Instr) noexcept;
 
@@ -80,7 +89,8 @@ private:
   void compileCallOp(const unsigned int FuncIndex) noexcept;
 
   void compileIndirectCallOp(const uint32_t TableIndex,
-                             const uint32_t FuncTypeIndex) noexcept;
+                             const uint32_t FuncTypeIndex,
+                             const uint32_t Offset) noexcept;
 
   void compileReturnCallOp(const unsigned int FuncIndex) noexcept;
 
@@ -74,6 +74,44 @@ static WasmEdge::Expect<LLVM::OrcLLJIT> createTunedLazyLLJIT() noexcept {
   return Result;
 }
 
+// Emit the machine code object of the optimized module, so the object can be
+// cached and linked instead of compiling the IR module in the JIT.
+LLVM::MemoryBuffer emitObject(LLVM::Data &D) noexcept {
+  auto [Object, ErrorMessage] =
+      D.extract().TM.emitToMemoryBuffer(D.extract().LLModule, LLVMObjectFile);
+  if (ErrorMessage) {
+    spdlog::warn("[jit-cache]: object emission failed: {}"sv,
+                 ErrorMessage.string_view());
+    return {};
+  }
+  return std::move(Object);
+}
+
+// Resolve the wasm function symbols of a batch added under the tracker. On
+// failure the batch is removed from the JIT again.
+WasmEdge::Expect<std::vector<LLVM::WasmFunctionCodeAddress>>
+resolveBatch(LLVM::OrcLLJIT &J, LLVM::OrcResourceTracker &RT,
+             WasmEdge::Span<const uint32_t> GlobalFuncIndices) noexcept {
+  std::vector<LLVM::WasmFunctionCodeAddress> Addresses;
+  Addresses.reserve(GlobalFuncIndices.size());
+  for (uint32_t GlobalFuncIndex : GlobalFuncIndices) {
+    const std::string SymName = fmt::format("f{}"sv, GlobalFuncIndex);
+    auto AddrOrErr = J.lookup<void *>(SymName.c_str());
+    if (!AddrOrErr) {
+      spdlog::error("[lazy-jit]: failed to lookup function symbol {}: {}"sv,
+                    SymName, errorToString(std::move(AddrOrErr.error())));
+      if (auto RemoveErr = RT.remove()) {
+        spdlog::error(
+            "[lazy-jit]: failed to remove failed module from tracker: {}"sv,
+            RemoveErr.message().string_view());
+      }
+      return WasmEdge::Unexpect(WasmEdge::ErrCode::Value::LazyCompilationError);
+    }
+    Addresses.push_back(*AddrOrErr);
+  }
+  return Addresses;
+}
+
 } // namespace
 
 namespace WasmEdge::LLVM {
@@ -183,8 +221,22 @@ Expect<std::shared_ptr<Executable>> JIT::loadImpl(Data &D,
   }
 
   auto MainJD = LLJITInstance.getMainJITDylib();
-  if (auto Err = LLJITInstance.addLLVMIRModule(
-          MainJD, OrcThreadSafeModule(LLModule.release(), TSContext))) {
+  // The lazy infrastructure module is not optimized and has no target
+  // machine, so only the whole module of the JIT is cached.
+  MemoryBuffer Object;
+  if (!IsLazy && Cache && Cache->enabled()) {
+    Object = emitObject(D);
+  }
+  if (Object) {
+    Cache->store(Cache->getPath("module"sv),
+                 Span<const char>(Object.data(), Object.size()));
+    if (auto Err = LLJITInstance.addObjectFile(MainJD, std::move(Object))) {
+      spdlog::error("failed to add object file: {}"sv,
+                    Err.message().string_view());
+      return Unexpect(ErrCode::Value::HostFuncError);
+    }
+  } else if (auto Err = LLJITInstance.addLLVMIRModule(
+                 MainJD, OrcThreadSafeModule(LLModule.release(), TSContext))) {
     spdlog::error("failed to add LLVM IR module: {}"sv,
                   Err.message().string_view());
     return Unexpect(ErrCode::Value::HostFuncError);
@@ -212,30 +264,92 @@ JIT::add(JITLibrary &Lib, Data &D,
     return Unexpect(ErrCode::Value::LazyCompilationError);
   }
 
-  if (auto Err = Lib.J->addLLVMIRModuleWithRT(
-          RT, OrcThreadSafeModule(LLModule.release(), TSContext))) {
+  MemoryBuffer Object;
+  if (Cache && Cache->enabled()) {
+    Object = emitObject(D);
+  }
+  if (Object) {
+    Cache->store(Cache->getPath("batch"sv, GlobalFuncIndices),
+                 Span<const char>(Object.data(), Object.size()));
+    if (auto Err = Lib.J->addObjectFileWithRT(RT, std::move(Object))) {
+      spdlog::error("[lazy-jit]: failed to add object file: {}"sv,
+                    Err.message().string_view());
+      return Unexpect(ErrCode::Value::LazyCompilationError);
+    }
+  } else if (auto Err = Lib.J->addLLVMIRModuleWithRT(
+                 RT, OrcThreadSafeModule(LLModule.release(), TSContext))) {
     spdlog::error("[lazy-jit]: failed to add LLVM IR module: {}"sv,
                   Err.message().string_view());
     return Unexpect(ErrCode::Value::LazyCompilationError);
   }
 
-  std::vector<WasmFunctionCodeAddress> Addresses;
-  Addresses.reserve(GlobalFuncIndices.size());
-  for (uint32_t GlobalFuncIndex : GlobalFuncIndices) {
-    const std::string SymName = fmt::format("f{}"sv, GlobalFuncIndex);
-    auto AddrOrErr = Lib.J->lookup<void *>(SymName.c_str());
-    if (!AddrOrErr) {
-      spdlog::error("[lazy-jit]: failed to lookup function symbol {}: {}"sv,
-                    SymName, errorToString(std::move(AddrOrErr.error())));
-      if (auto RemoveErr = RT.remove()) {
-        spdlog::error(
-            "[lazy-jit]: failed to remove failed module from tracker: {}"sv,
-            RemoveErr.message().string_view());
-      }
-      return Unexpect(ErrCode::Value::LazyCompilationError);
-    }
-    Addresses.push_back(*AddrOrErr);
+  return resolveBatch(*Lib.J, RT, GlobalFuncIndices);
+}
+
+std::shared_ptr<Executable> JIT::loadCached() noexcept {
+  if (!Cache || !Cache->enabled()) {
+    return nullptr;
   }
-  return Addresses;
+  const auto Path = Cache->getPath("module"sv);
+  if (!Cache->lookup(Path)) {
+    return nullptr;
+  }
+  auto [Object, ErrorMessage] = MemoryBuffer::getFile(Path.u8string().c_str());
+  if (ErrorMessage) {
+    spdlog::warn("[jit-cache]: cannot read {}: {}"sv, Path.u8string(),
+                 ErrorMessage.string_view());
+    return nullptr;
+  }
+  auto R = OrcLLJIT::create();
+  if (!R) {
+    spdlog::error("failed to create LLJIT: {}"sv,
+                  R.error().message().string_view());
+    return nullptr;
+  }
+  if (auto Err = R->addObjectFile(R->getMainJITDylib(), std::move(Object))) {
+    spdlog::warn("[jit-cache]: cannot load {}: {}"sv, Path.u8string(),
+                 Err.message().string_view());
+    Cache->evict(Path);
+    return nullptr;
+  }
+  return std::make_shared<JITLibrary>(std::make_shared<OrcLLJIT>(std::move(*R)),
+                                      false);
+}
+
+std::optional<std::vector<WasmFunctionCodeAddress>>
+JIT::addCached(JITLibrary &Lib,
+               Span<const uint32_t> GlobalFuncIndices) noexcept {
+  if (!Cache || !Cache->enabled() || GlobalFuncIndices.empty()) {
+    return std::nullopt;
+  }
+  const auto Path = Cache->getPath("batch"sv, GlobalFuncIndices);
+  if (!Cache->lookup(Path)) {
+    return std::nullopt;
+  }
+  auto [Object, ErrorMessage] = MemoryBuffer::getFile(Path.u8string().c_str());
+  if (ErrorMessage) {
+    spdlog::warn("[jit-cache]: cannot read {}: {}"sv, Path.u8string(),
+                 ErrorMessage.string_view());
+    return std::nullopt;
+  }
+  auto RT = Lib.J->getMainJITDylib().createResourceTracker();
+  if (!RT) {
+    spdlog::error("[lazy-jit]: failed to create resource tracker"sv);
+    return std::nullopt;
+  }
+  if (auto Err = Lib.J->addObjectFileWithRT(RT, std::move(Object))) {
+    spdlog::warn("[jit-cache]: cannot load {}: {}"sv, Path.u8string(),
+                 Err.message().string_view());
+    Cache->evict(Path);
+    return std::nullopt;
+  }
+  // A cached object failing to resolve is evicted and compiled again.
+  auto Addresses = resolveBatch(*Lib.J, RT, GlobalFuncIndices);
+  if (!Addresses) {
+    Cache->evict(Path);
+    return std::nullopt;
+  }
+  return std::move(*Addresses);
 }
+
 } // namespace WasmEdge::LLVM
@@ -10,13 +10,19 @@
 #include "llvm/compiler.h"
 #include "llvm/data.h"
 #include "llvm/jit.h"
+#include "llvm/objcache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -77,11 +83,12 @@ std::vector<uint32_t> collectCallGraphBatch(
 
 // Upgrade the function instance at GlobalFuncIdx of a bound module instance
 // to run the compiled code at Address. Shared by the fresh-batch path and the
-// re-instantiation restore path.
+// re-instantiation restore path. When Retired is given, the interpreted body
+// is moved into it instead of being destroyed.
 void upgradeToCompiled(
     Span<const Runtime::Instance::FunctionInstance *const> FuncInsts,
-    size_t GlobalFuncIdx, JITLibrary &JITLib,
-    WasmFunctionCodeAddress Address) noexcept {
+    size_t GlobalFuncIdx, JITLibrary &JITLib, WasmFunctionCodeAddress Address,
+    std::vector<AST::InstrVec> *Retired = nullptr) noexcept {
   // A fully instantiated instance of the same AST module covers every
   // compiled local function index.
   assuming(GlobalFuncIdx < FuncInsts.size());
@@ -91,7 +98,12 @@ void upgradeToCompiled(
   // unsafeUpgradeToCompiled itself.
   auto *FuncInst = const_cast<Runtime::Instance::FunctionInstance *>(
       FuncInsts[GlobalFuncIdx]);
-  FuncInst->unsafeUpgradeToCompiled(JITLib.createCodeSymbol(Address));
+  if (Retired != nullptr) {
+    FuncInst->unsafeUpgradeToCompiled(JITLib.createCodeSymbol(Address),
+                                      Retired->emplace_back());
+  } else {
+    FuncInst->unsafeUpgradeToCompiled(JITLib.createCodeSymbol(Address));
+  }
 }
 
 // True while someone outside the engine still holds the AST module and could
@@ -105,6 +117,88 @@ bool isReinstantiable(
 } // namespace
 
 struct LazyJITEngine::Impl {
+  class TierUpWorker;
+
+  /// Background compilation of the tiered run mode. The worker only writes
+  /// the results, and publishes them by setting Done.
+  struct TierUpTask {
+    TierUpTask(TierUpWorker &W) noexcept : Worker(W) {}
+    ~TierUpTask() noexcept { Worker.cancel(*this); }
+    /// Local function indices of the batch.
+    std::vector<uint32_t> BatchLocals;
+    /// LLVM data moved from the module state during the compilation.
+    Data LLData;
+    /// Resolved addresses of the batch. Empty if the compilation failed.
+    std::vector<WasmFunctionCodeAddress> Addresses;
+    std::atomic_bool Done = false;
+    TierUpWorker &Worker;
+  };
+
+  /// The single background compiler thread of the engine, started on the
+  /// first tier-up. The tasks are compiled in order. The thread is not
+  /// created per task, as the LLVM library is built without exceptions and
+  /// a failed thread creation cannot be recovered.
+  class TierUpWorker {
+  public:
+    ~TierUpWorker() noexcept {
+      {
+        std::unique_lock Lock(Mutex);
+        Stopping = true;
+      }
+      CV.notify_all();
+      if (Thread.joinable()) {
+        Thread.join();
+      }
+    }
+
+    /// Queue the compilation job of the task.
+    void post(TierUpTask &Task, std::function<void()> Job) noexcept {
+      std::unique_lock Lock(Mutex);
+      if (!Thread.joinable()) {
+        Thread = std::thread([this]() noexcept { run(); });
+      }
+      Jobs.emplace_back(&Task, std::move(Job));
+      CV.notify_all();
+    }
+
+    /// Drop the queued job of the task, or wait for its running job.
+    void cancel(const TierUpTask &Task) noexcept {
+      std::unique_lock Lock(Mutex);
+      Jobs.erase(std::remove_if(Jobs.begin(), Jobs.end(),
+                                [&Task](const auto &Entry) {
+                                  return Entry.first == &Task;
+                                }),
+                 Jobs.end());
+      CV.wait(Lock, [this, &Task]() { return Running != &Task; });
+    }
+
+  private:
+    void run() noexcept {
+      std::unique_lock Lock(Mutex);
+      while (true) {
+        CV.wait(Lock, [this]() { return Stopping || !Jobs.empty(); });
+        if (Stopping) {
+          return;
+        }
+        auto [Task, Job] = std::move(Jobs.front());
+        Jobs.pop_front();
+        Running = Task;
+        Lock.unlock();
+        Job();
+        Lock.lock();
+        Running = nullptr;
+        CV.notify_all();
+      }
+    }
+
+    std::mutex Mutex;
+    std::condition_variable CV;
+    std::deque<std::pair<const TierUpTask *, std::function<void()>>> Jobs;
+    const TierUpTask *Running = nullptr;
+    bool Stopping = false;
+    std::thread Thread;
+  };
+
   struct ModuleState {
     /// Shared ownership of the AST module for on-demand compilation. Held
     /// from prepare time on, so the AST module pointers used as map keys
@@ -114,6 +208,8 @@ struct LazyJITEngine::Impl {
     Data LLData;
     /// Per-module ORC LLJIT holding the generated code.
     std::shared_ptr<JITLibrary> JITLib;
+    /// Cache of the machine code objects of the compiled batches.
+    std::shared_ptr<const ObjectCache> Cache;
     /// Resolved machine code addresses of lazily compiled functions, keyed
     /// by local function index. Survives re-instantiations, so rebinding
     /// restores compiled functions without further JIT symbol lookups.
@@ -123,9 +219,18 @@ struct LazyJITEngine::Impl {
         FuncIndices;
     /// Number of imported functions of the module.
     uint32_t ImportFuncCount = 0;
+    /// Running background compilation of the tiered run mode.
+    std::unique_ptr<TierUpTask> TierUp;
+    /// Set when the background compilation failed, so it is not retried.
+    bool TierUpFailed = false;
+    /// Interpreted bodies of the functions upgraded by the tier-up, kept for
+    /// the interpreter frames of the bound instance still running them.
+    std::vector<AST::InstrVec> RetiredBodies;
   };
 
-  Impl(const Configure &C) noexcept : Conf(C) {}
+  Impl(const Configure &C, Statistics::Statistics *S) noexcept
+      : Conf(C), Stat(S),
+        IsTiered(C.getRuntimeConfigure().getRunMode() == RunMode::Tiered) {}
 
   /// Locate the bound state and the local function index when the function
   /// still needs lazy compilation. Returns {nullptr, 0} when there is
@@ -166,8 +271,90 @@ struct LazyJITEngine::Impl {
     return {&State, LocalFuncIdx};
   }
 
+  /// Start compiling all not-yet-compiled local functions of the state on a
+  /// background thread. The caller must hold Mutex exclusively.
+  void startTierUp(ModuleState &State) noexcept {
+    if (State.TierUp || State.TierUpFailed) {
+      return;
+    }
+    auto Task = std::make_unique<TierUpTask>(Worker);
+    const uint32_t DefinedCount = State.Module->getDefinedFuncCount();
+    for (uint32_t L = 0; L < DefinedCount; ++L) {
+      if (State.CompiledCode.count(L) == 0) {
+        Task->BatchLocals.push_back(L);
+      }
+    }
+    if (Task->BatchLocals.empty()) {
+      return;
+    }
+    spdlog::debug("[tiered]: background compiling {} local funcs"sv,
+                  Task->BatchLocals.size());
+    Task->LLData = std::move(State.LLData);
+    // The job shares the module, the JIT library, and the cache with the
+    // state, and the task cancels or waits for it before being destroyed.
+    Worker.post(
+        *Task,
+        [&Task = *Task, Conf = Conf, Module = State.Module,
+         JITLib = State.JITLib, Cache = State.Cache,
+         ImportFuncCount = State.ImportFuncCount,
+         Notifier = TierUpNotifier]() noexcept {
+          std::vector<uint32_t> BatchGlobal;
+          BatchGlobal.reserve(Task.BatchLocals.size());
+          for (uint32_t L : Task.BatchLocals) {
+            BatchGlobal.push_back(ImportFuncCount + L);
+          }
+          JIT JITEngine(Conf, Cache);
+          if (auto Cached = JITEngine.addCached(*JITLib, BatchGlobal)) {
+            Task.Addresses = std::move(*Cached);
+          } else if (auto Res =
+                         Compiler(Conf)
+                             .compileFunctions(std::move(Task.LLData),
+                                               *Module, Task.BatchLocals)
+                             .and_then([&](Data CompiledData) {
+                               Task.LLData = std::move(CompiledData);
+                               return JITEngine.add(*JITLib, Task.LLData,
+                                                    BatchGlobal);
+                             })) {
+            Task.Addresses = std::move(*Res);
+          } else {
+            spdlog::error("[tiered]: background compilation failed: {}"sv,
+                          Res.error());
+          }
+          Task.Done.store(true, std::memory_order_release);
+          if (Notifier) {
+            Notifier();
+          }
+        });
+    State.TierUp = std::move(Task);
+  }
+
+  /// Take the results of the finished background compilation into the
+  /// compiled code of the state. Returns the local function indices of the
+  /// newly compiled functions. The caller must hold Mutex exclusively.
+  std::vector<uint32_t> finishTierUp(ModuleState &State) noexcept {
+    if (!State.TierUp ||
+        !State.TierUp->Done.load(std::memory_order_acquire)) {
+      return {};
+    }
+    auto Task = std::move(State.TierUp);
+    State.LLData = std::move(Task->LLData);
+    if (Task->Addresses.size() != Task->BatchLocals.size()) {
+      State.TierUpFailed = true;
+      return {};
+    }
+    for (size_t I = 0; I < Task->BatchLocals.size(); ++I) {
+      State.CompiledCode.emplace(Task->BatchLocals[I], Task->Addresses[I]);
+    }
+    return std::move(Task->BatchLocals);
+  }
+
   const Configure Conf;
+  Statistics::Statistics *const Stat;
+  const bool IsTiered;
+  std::function<void()> TierUpNotifier;
   mutable std::shared_mutex Mutex;
+  /// Declared before the states, so it outlives their tasks.
+  TierUpWorker Worker;
   /// States prepared but not yet bound to a module instance, keyed by the
   /// AST module owned by the state itself.
   std::unordered_map<const AST::Module *, ModuleState> PendingStates;
@@ -176,8 +363,9 @@ struct LazyJITEngine::Impl {
       States;
 };
 
-LazyJITEngine::LazyJITEngine(const Configure &Conf) noexcept
-    : PImpl(std::make_unique<Impl>(Conf)) {}
+LazyJITEngine::LazyJITEngine(const Configure &Conf,
+                             Statistics::Statistics *Stat) noexcept
+    : PImpl(std::make_unique<Impl>(Conf, Stat)) {}
 
 LazyJITEngine::~LazyJITEngine() noexcept = default;
 
@@ -200,6 +388,8 @@ LazyJITEngine::prepare(std::shared_ptr<const AST::Module> Module) {
   State.JITLib = std::static_pointer_cast<JITLibrary>(Exec);
 
   State.ImportFuncCount = State.Module->getImportFuncCount();
+  State.Cache = std::make_shared<const ObjectCache>(PImpl->Conf, *State.Module,
+                                                    PImpl->Stat);
 
   std::unique_lock Lock(PImpl->Mutex);
   // Prune pending states nobody can re-instantiate anymore.
@@ -239,10 +429,14 @@ void LazyJITEngine::registerInstance(
   // Rebinding after a re-instantiation: the fresh function instances start
   // in interpreter mode, so restore the functions already compiled in
   // earlier instantiations from their persisted code addresses.
+  PImpl->finishTierUp(State);
   for (const auto &[LocalFuncIdx, Address] : State.CompiledCode) {
     upgradeToCompiled(FuncInsts, size_t{State.ImportFuncCount} + LocalFuncIdx,
                       *State.JITLib, Address);
   }
+  if (PImpl->IsTiered) {
+    PImpl->startTierUp(State);
+  }
 
   PImpl->States.insert_or_assign(&ModInst, std::move(State));
 }
@@ -261,6 +455,8 @@ void LazyJITEngine::unregisterInstance(
   auto State = std::move(It->second);
   PImpl->States.erase(It);
   State.FuncIndices.clear();
+  // No frame of the dropped instance runs its retired bodies anymore.
+  State.RetiredBodies.clear();
   // Keep the state only while it can be rebound; otherwise drop it instead
   // of leaking the JIT and its compiled code.
   if (const auto *Key = State.Module.get(); isReinstantiable(State.Module)) {
@@ -277,6 +473,11 @@ Expect<void> LazyJITEngine::compileOnDemand(
   if (ModInst == nullptr) {
     return {};
   }
+  // The tiered run mode only compiles in the background, and its results
+  // are applied by applyTierUp on request.
+  if (PImpl->IsTiered) {
+    return {};
+  }
 
   // Fast path: the common no-work cases (unbound module, host function,
   // already compiled) need only read access. All writers hold the exclusive
@@ -312,17 +513,6 @@ Expect<void> LazyJITEngine::compileOnDemand(
     };
   };
 
-  // The configure was already validated by checkConfigure() in prepare(),
-  // and a state only exists after a successful prepare, so re-validating
-  // here would only repeat its per-proposal warnings once per batch.
-  Compiler BatchCompiler(PImpl->Conf);
-  EXPECTED_TRY(
-      auto CompiledData,
-      BatchCompiler
-          .compileFunctions(std::move(State.LLData), *State.Module, BatchLocals)
-          .map_error(LogError("lazy JIT function compilation"sv)));
-  State.LLData = std::move(CompiledData);
-
   std::vector<uint32_t> BatchGlobal;
   BatchGlobal.reserve(BatchLocals.size());
   for (uint32_t L : BatchLocals) {
@@ -331,18 +521,33 @@ Expect<void> LazyJITEngine::compileOnDemand(
 
   // The JIT library is created in prepare() and lives as long as the state.
   assuming(State.JITLib);
-  JIT JITEngine(PImpl->Conf);
-  EXPECTED_TRY(auto ResolvedAddresses,
-               JITEngine.add(*State.JITLib, State.LLData, BatchGlobal)
-                   .map_error(LogError("lazy JIT add"sv)));
+  JIT JITEngine(PImpl->Conf, State.Cache);
+  // A batch found in the object cache skips its compilation.
+  auto ResolvedAddresses = JITEngine.addCached(*State.JITLib, BatchGlobal);
+  if (!ResolvedAddresses) {
+    // The configure was already validated by checkConfigure() in prepare(),
+    // and a state only exists after a successful prepare, so re-validating
+    // here would only repeat its per-proposal warnings once per batch.
+    Compiler BatchCompiler(PImpl->Conf);
+    EXPECTED_TRY(auto CompiledData,
+                 BatchCompiler
+                     .compileFunctions(std::move(State.LLData), *State.Module,
+                                       BatchLocals)
+                     .map_error(LogError("lazy JIT function compilation"sv)));
+    State.LLData = std::move(CompiledData);
+
+    EXPECTED_TRY(ResolvedAddresses,
+                 JITEngine.add(*State.JITLib, State.LLData, BatchGlobal)
+                     .map_error(LogError("lazy JIT add"sv)));
+  }
 
   // The machine code now lives in the persisted JIT regardless of the
   // instance bindings, so record each address before upgrading its instance.
   const auto FuncInsts = ModInst->getFunctionInstances();
   for (size_t I = 0; I < BatchLocals.size(); ++I) {
-    State.CompiledCode.emplace(BatchLocals[I], ResolvedAddresses[I]);
+    State.CompiledCode.emplace(BatchLocals[I], (*ResolvedAddresses)[I]);
     upgradeToCompiled(FuncInsts, BatchGlobal[I], *State.JITLib,
-                      ResolvedAddresses[I]);
+                      (*ResolvedAddresses)[I]);
   }
 
   spdlog::debug(
@@ -353,6 +558,29 @@ Expect<void> LazyJITEngine::compileOnDemand(
   return {};
 }
 
+void LazyJITEngine::setTierUpNotifier(
+    std::function<void()> Notifier) noexcept {
+  std::unique_lock Lock(PImpl->Mutex);
+  PImpl->TierUpNotifier = std::move(Notifier);
+}
+
+void LazyJITEngine::applyTierUp() noexcept {
+  std::unique_lock Lock(PImpl->Mutex);
+  for (auto &[ModInst, State] : PImpl->States) {
+    const auto BatchLocals = PImpl->finishTierUp(State);
+    if (BatchLocals.empty()) {
+      continue;
+    }
+    const auto FuncInsts = ModInst->getFunctionInstances();
+    for (uint32_t L : BatchLocals) {
+      upgradeToCompiled(FuncInsts, size_t{State.ImportFuncCount} + L,
+                        *State.JITLib, State.CompiledCode.at(L),
+                        &State.RetiredBodies);
+    }
+    spdlog::debug("[tiered]: tiered up {} functions"sv, BatchLocals.size());
+  }
+}
+
 uint32_t LazyJITEngine::compiledFunctionCount() const noexcept {
   std::shared_lock Lock(PImpl->Mutex);
   uint32_t Count = 0;
@@ -154,8 +154,11 @@ public:
 #endif
 
   static inline unsigned int Cold = 0;
+  static inline unsigned int Hot = 0;
+  static inline unsigned int InlineHint = 0;
   static inline unsigned int NoAlias = 0;
   static inline unsigned int NoInline = 0;
+  static inline unsigned int OptimizeForSize = 0;
   static inline unsigned int NoReturn = 0;
   static inline unsigned int ReadOnly = 0;
   static inline unsigned int StrictFP = 0;
@@ -167,6 +170,7 @@ public:
 #endif
 
   static inline unsigned int InvariantGroup = 0;
+  static inline unsigned int Prof = 0;
 
 private:
   static inline std::once_flag Once;
@@ -246,14 +250,18 @@ private:
 #endif
 
     Cold = getEnumAttributeKind("cold"sv);
+    Hot = getEnumAttributeKind("hot"sv);
+    InlineHint = getEnumAttributeKind("inlinehint"sv);
     NoAlias = getEnumAttributeKind("noalias"sv);
     NoInline = getEnumAttributeKind("noinline"sv);
+    OptimizeForSize = getEnumAttributeKind("optsize"sv);
     NoReturn = getEnumAttributeKind("noreturn"sv);
     ReadOnly = getEnumAttributeKind("readonly"sv);
     StrictFP = getEnumAttributeKind("strictfp"sv);
     UWTable = getEnumAttributeKind("uwtable"sv);
 
     InvariantGroup = getMetadataKind(C, "invariant.group"sv);
+    Prof = getMetadataKind(C, "prof"sv);
   }
 
   template <typename... ArgsT>
@@ -495,6 +503,7 @@ public:
   }
   const char *data() const noexcept { return LLVMGetBufferStart(Ref); }
   size_t size() const noexcept { return LLVMGetBufferSize(Ref); }
+  LLVMMemoryBufferRef release() noexcept { return std::exchange(Ref, nullptr); }
 
 private:
   LLVMMemoryBufferRef Ref = nullptr;
@@ -895,6 +904,9 @@ public:
     Ref = LLVMMDNodeInContext2(C.unwrap(), Data, Size);
   }
   Metadata(Value V) noexcept : Ref(LLVMValueAsMetadata(V.unwrap())) {}
+  static Metadata getString(Context &C, std::string_view Str) noexcept {
+    return LLVMMDStringInContext2(C.unwrap(), Str.data(), Str.size());
+  }
 
   constexpr operator bool() const noexcept { return Ref != nullptr; }
   constexpr auto &unwrap() const noexcept { return Ref; }
@@ -2302,6 +2314,15 @@ public:
     return LLVMOrcLLJITAddLLVMIRModuleWithRT(Ref, RT.unwrap(), M.release());
   }
 
+  Error addObjectFile(const OrcJITDylib &L, MemoryBuffer O) noexcept {
+    return LLVMOrcLLJITAddObjectFile(Ref, L.unwrap(), O.release());
+  }
+
+  Error addObjectFileWithRT(const OrcResourceTracker &RT,
+                            MemoryBuffer O) noexcept {
+    return LLVMOrcLLJITAddObjectFileWithRT(Ref, RT.unwrap(), O.release());
+  }
+
   template <typename T>
   cxx20::expected<T *, Error> lookup(const char *Name) noexcept {
     LLVMOrcJITTargetAddress Addr;
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "llvm/objcache.h"
+
+#include "aot/blake3.h"
+#include "aot/cache.h"
+#include "aot/version.h"
+#include "common/hash.h"
+#include "common/spdlog.h"
+#include "loader/serialize.h"
+
+#include "llvm.h"
+
+#include <atomic>
+#include <fmt/format.h>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace std::literals;
+
+namespace WasmEdge::LLVM {
+
+namespace {
+
+std::atomic<uint64_t> HitCount = 0;
+std::atomic<uint64_t> MissCount = 0;
+
+void updateU64(AOT::Blake3 &Hasher, uint64_t Value) noexcept {
+  std::array<Byte, 8> Bytes;
+  for (auto &B : Bytes) {
+    B = static_cast<Byte>(Value);
+    Value >>= 8;
+  }
+  Hasher.update(Bytes);
+}
+
+void updateString(AOT::Blake3 &Hasher, std::string_view Str) noexcept {
+  updateU64(Hasher, Str.size());
+  Hasher.update(Span<const Byte>(reinterpret_cast<const Byte *>(Str.data()),
+                                 Str.size()));
+}
+
+} // namespace
+
+JITCacheStatistics getJITCacheStatistics() noexcept {
+  return {HitCount.load(std::memory_order_relaxed),
+          MissCount.load(std::memory_order_relaxed)};
+}
+
+ObjectCache::ObjectCache(const Configure &Conf, const AST::Module &Module,
+                         Statistics::Statistics *Stat) noexcept
+    : Stat(Stat) {
+  if (!Conf.getRuntimeConfigure().isEnableJITCache()) {
+    return;
+  }
+  Loader::Serializer Ser(Conf);
+  auto Bytes = Ser.serializeModule(Module);
+  if (!Bytes) {
+    spdlog::debug("[jit-cache]: module cannot be serialized, cache disabled"sv);
+    return;
+  }
+
+  AOT::Blake3 Hasher;
+  updateU64(Hasher, AOT::kBinaryVersion);
+  const auto &CompilerConf = Conf.getCompilerConfigure();
+  const auto &StatConf = Conf.getStatisticsConfigure();
+  // Generic binaries do not depend on the host CPU.
+  updateU64(Hasher, CompilerConf.isGenericBinary());
+  if (!CompilerConf.isGenericBinary()) {
+    updateString(Hasher, getHostCPUName().string_view());
+    updateString(Hasher, getHostCPUFeatures().string_view());
+  }
+  updateU64(Hasher, static_cast<uint64_t>(CompilerConf.getOptimizationLevel()));
+  updateU64(Hasher, CompilerConf.isInterruptible());
+  updateU64(Hasher, StatConf.isInstructionCounting());
+  updateU64(Hasher, StatConf.isCostMeasuring());
+  // The force interpreter option only selects the interpreter run mode.
+  updateU64(Hasher,
+            static_cast<uint64_t>(Conf.getRuntimeConfigure().getRunMode()));
+  for (uint8_t I = 0; I < static_cast<uint8_t>(Proposal::Max); ++I) {
+    updateU64(Hasher, Conf.hasProposal(static_cast<Proposal>(I)));
+  }
+  updateU64(Hasher, Bytes->size());
+  Hasher.update(*Bytes);
+  Hasher.finalize(ModuleHash.emplace());
+  Dir = Conf.getRuntimeConfigure().getJITCacheDir();
+}
+
+std::filesystem::path
+ObjectCache::getPath(std::string_view Kind,
+                     Span<const uint32_t> FuncIndices) const noexcept {
+  std::vector<Byte> Key(ModuleHash->begin(), ModuleHash->end());
+  Key.insert(Key.end(), Kind.begin(), Kind.end());
+  for (const auto Index : FuncIndices) {
+    for (unsigned I = 0; I < 4; ++I) {
+      Key.push_back(static_cast<Byte>(Index >> (I * 8)));
+    }
+  }
+  auto Path =
+      AOT::Cache::getPath(Key, AOT::Cache::StorageScope::Local, "jit"sv);
+  if (Path && !Dir.empty()) {
+    Path = Dir / Path->filename();
+  }
+  // Without a home directory the cache root would be relative to the working
+  // directory.
+  if (!Path || !Path->is_absolute()) {
+    return {};
+  }
+  return std::move(*Path);
+}
+
+bool ObjectCache::lookup(const std::filesystem::path &Path) const noexcept {
+  std::error_code EC;
+  if (Path.empty() || !std::filesystem::is_regular_file(Path, EC)) {
+    MissCount.fetch_add(1, std::memory_order_relaxed);
+    if (Stat) {
+      Stat->addJITCacheLookup(false);
+    }
+    return false;
+  }
+  spdlog::debug("[jit-cache]: hit {}"sv, Path.u8string());
+  HitCount.fetch_add(1, std::memory_order_relaxed);
+  if (Stat) {
+    Stat->addJITCacheLookup(true);
+  }
+  return true;
+}
+
+void ObjectCache::store(const std::filesystem::path &Path,
+                        Span<const char> Object) const noexcept {
+  if (Path.empty()) {
+    return;
+  }
+  std::error_code EC;
+  std::filesystem::create_directories(Path.parent_path(), EC);
+  if (EC) {
+    spdlog::debug("[jit-cache]: cannot create {}: {}"sv,
+                  Path.parent_path().u8string(), EC.message());
+    return;
+  }
+  // Write to a temporary file and rename it, so concurrent processes never
+  // read a partially written object.
+  auto TempPath = Path;
+  TempPath += fmt::format(".{:016x}"sv, Hash::RandEngine());
+  {
+    std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+    File.write(Object.data(), static_cast<std::streamsize>(Object.size()));
+    if (!File.flush()) {
+      File.close();
+      std::filesystem::remove(TempPath, EC);
+      spdlog::debug("[jit-cache]: cannot write {}"sv, TempPath.u8string());
+      return;
+    }
+  }
+  std::filesystem::rename(TempPath, Path, EC);
+  if (EC) {
+    std::filesystem::remove(TempPath, EC);
+  }
+}
+
+void ObjectCache::evict(const std::filesystem::path &Path) const noexcept {
+  spdlog::debug("[jit-cache]: evict {}"sv, Path.u8string());
+  std::error_code EC;
+  std::filesystem::remove(Path, EC);
+}
+
+} // namespace WasmEdge::LLVM
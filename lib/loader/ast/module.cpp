@@ -4,12 +4,14 @@
 #include "loader/aot_section.h"
 #include "loader/loader.h"
 #include "loader/shared_library.h"
+#include "system/cpu.h"
 
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -195,6 +197,7 @@ Expect<void> Loader::loadExecutable(AST::Module &Mod,
     CodeSegs[I].setSymbol(std::move(CodeSymbols[I]));
   }
   Mod.setSymbol(std::move(IntrinsicsSymbol));
+  Mod.setCodeSize(Exec->getCodeSize());
   // loadExecutable is reached only when native code is being prepared (AOT
   // load or JIT compile). Patch the intrinsics-table pointer embedded in
   // the produced executable so the native code can call back into the
@@ -236,6 +239,10 @@ Expect<void> Loader::loadModuleAOT(AST::AOTSection &AOTSection) {
   // This loop checks whether the input is a universal WASM.
   // Therefore, if the configuration is set to force interpreter mode, skip
   // this.
+  // Besides the baseline `wasmedge` section, code variants for more capable
+  // CPUs are in `wasmedge.<CPU>` sections. The most capable one supported by
+  // the running CPU is used, ranked by the order of the known CPU targets.
+  size_t AOTRank = 0;
   while (WASMType != InputType::SharedLibrary) {
     // This loop only scans custom sections and reads the AOT section.
     // For other general errors, break and handle them in the sequential
@@ -274,7 +281,20 @@ Expect<void> Loader::loadModuleAOT(AST::AOTSection &AOTSection) {
         continue;
       }
 
-      if (Name == "wasmedge") {
+      std::optional<size_t> Rank;
+      if (Name == "wasmedge"sv) {
+        Rank = 0;
+      } else if (std::string_view(Name).substr(0, 9) == "wasmedge."sv) {
+        const auto CPUName = std::string_view(Name).substr(9);
+        const auto Targets = CPU::targets();
+        for (size_t I = 0; I < Targets.size(); ++I) {
+          if (Targets[I].Name == CPUName && CPU::supports(CPUName)) {
+            Rank = I + 1;
+            break;
+          }
+        }
+      }
+      if (Rank && *Rank >= AOTRank) {
         // Found the AOT section in universal WASM. Load the AOT code.
         // Read the content.
         std::vector<uint8_t> Content;
@@ -293,6 +313,7 @@ Expect<void> Loader::loadModuleAOT(AST::AOTSection &AOTSection) {
           // If the new AOT section discovered, use the new one.
           WASMType = InputType::UniversalWASM;
           AOTSection = std::move(NewAOTSection);
+          AOTRank = *Rank;
         } else {
           // If the new AOT section load failed, use the old one or the
           // interpreter mode.
@@ -305,7 +326,8 @@ Expect<void> Loader::loadModuleAOT(AST::AOTSection &AOTSection) {
           }
         }
       } else {
-        // Found other custom sections. Jump to the next section.
+        // Found other custom sections, or AOT sections not usable or not
+        // better than the loaded one. Jump to the next section.
         FMgr.seek(StartOffset + ContentSize);
         continue;
       }
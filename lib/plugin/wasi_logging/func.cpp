@@ -39,12 +39,7 @@ Expect<void> Log::body(const Runtime::CallingFrame &Frame, uint32_t Level,
   } else {
     if (CxtSV != Env.getLogFileName()) {
       try {
-        spdlog::drop(Env.getLogRegName());
-        Env.FileLogger =
-            spdlog::basic_logger_mt(Env.getLogRegName(), std::string(CxtSV));
-        Env.FileLogger->set_level(spdlog::level::trace);
-        Env.FileLogger->set_pattern(Env.DefFormat);
-        Env.setLogFileName(CxtSV);
+        Env.openLogFile(CxtSV);
       } catch (const spdlog::spdlog_ex &Ex) {
         spdlog::error("[WasiLogging] Cannot log into file: {}"sv, Ex.what());
         return Unexpect(ErrCode::Value::HostFuncError);
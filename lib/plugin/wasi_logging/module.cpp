@@ -18,15 +18,32 @@ Runtime::Instance::ModuleInstance *
 create(const Plugin::PluginModule::ModuleDescriptor *) noexcept {
   return new WasiLoggingModule;
 }
+void addOptions(const Plugin::Plugin::PluginDescriptor *,
+                PO::ArgumentParser &Parser) noexcept {
+  using namespace std::literals;
+  Parser.add_option("wasi-logging-async"sv, WASILogging::LogEnv::AsyncMode)
+      .add_option("wasi-logging-queue-size"sv, WASILogging::LogEnv::QueueSize)
+      .add_option("wasi-logging-drop-on-full"sv,
+                  WASILogging::LogEnv::DropOnFull);
+}
 } // namespace
 
 using namespace std::literals;
 
-const std::string WASILogging::LogEnv::DefFormat =
-    "[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] %v";
 std::mutex WASILogging::LogEnv::Mutex;
 std::unordered_set<uint64_t> WASILogging::LogEnv::RegisteredID;
 
+PO::Option<PO::Toggle> WASILogging::LogEnv::AsyncMode(PO::Description(
+    "Write the wasi-logging records from a background thread."sv));
+PO::Option<uint32_t> WASILogging::LogEnv::QueueSize(
+    PO::Description(
+        "Number of records queued for the background writer of wasi-logging. "
+        "Defaults to 8192."sv),
+    PO::MetaVar("RECORDS"sv), PO::DefaultValue<uint32_t>(8192));
+PO::Option<PO::Toggle> WASILogging::LogEnv::DropOnFull(
+    PO::Description("Drop the oldest queued wasi-logging record instead of "
+                    "waiting when the queue is full."sv));
+
 WasiLoggingModule::WasiLoggingModule()
     : ModuleInstance("wasi:logging/logging"sv) {
   addHostFunc("log"sv, std::make_unique<WASILogging::Log>(Env));
@@ -49,7 +66,7 @@ Plugin::Plugin::PluginDescriptor WasiLoggingModule::PluginDescriptor{
     /* ModuleDescriptions */ ModuleDescriptor,
     /* ComponentCount */ 0,
     /* ComponentDescriptions */ nullptr,
-    /* AddOptions */ nullptr,
+    /* AddOptions */ addOptions,
 };
 
 } // namespace Host
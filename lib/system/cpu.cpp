@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "system/cpu.h"
+
+#include <array>
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+using namespace std::literals;
+
+namespace WasmEdge {
+
+namespace {
+#if defined(__x86_64__)
+#define X86_64_V2_FEATURES "+cx16,+sahf,+popcnt,+sse2,+sse3,+ssse3,+sse4.1,+sse4.2"
+#define X86_64_V3_FEATURES                                                     \
+  X86_64_V2_FEATURES ",+avx,+avx2,+bmi,+bmi2,+f16c,+fma,+lzcnt,+movbe,+xsave"
+#define X86_64_V4_FEATURES                                                     \
+  X86_64_V3_FEATURES ",+avx512f,+avx512bw,+avx512cd,+avx512dq,+avx512vl"
+constexpr const std::array<CPU::Target, 3> kTargets = {{
+    {"x86-64-v2"sv, X86_64_V2_FEATURES ""sv},
+    {"x86-64-v3"sv, X86_64_V3_FEATURES ""sv},
+    {"x86-64-v4"sv, X86_64_V4_FEATURES ""sv},
+}};
+#undef X86_64_V4_FEATURES
+#undef X86_64_V3_FEATURES
+#undef X86_64_V2_FEATURES
+
+/// Check the CPUID bits of the features which __builtin_cpu_supports does not
+/// know.
+bool supportsCPUID(unsigned Leaf, unsigned ECXMask) noexcept {
+  unsigned EAX = 0, EBX = 0, ECX = 0, EDX = 0;
+  return __get_cpuid(Leaf, &EAX, &EBX, &ECX, &EDX) &&
+         (ECX & ECXMask) == ECXMask;
+}
+
+bool supportsLevel(size_t Level) noexcept {
+  // CPUID leaf 1 ECX: CX16, MOVBE, XSAVE, F16C.
+  constexpr unsigned kCX16 = 1U << 13, kMOVBE = 1U << 22, kXSAVE = 1U << 26,
+                     kF16C = 1U << 29;
+  // CPUID leaf 0x80000001 ECX: LAHF/SAHF, LZCNT.
+  constexpr unsigned kLAHF = 1U << 0, kLZCNT = 1U << 5;
+  __builtin_cpu_init();
+  bool Result = supportsCPUID(1, kCX16) && supportsCPUID(0x80000001, kLAHF) &&
+                __builtin_cpu_supports("popcnt") &&
+                __builtin_cpu_supports("sse3") &&
+                __builtin_cpu_supports("ssse3") &&
+                __builtin_cpu_supports("sse4.1") &&
+                __builtin_cpu_supports("sse4.2");
+  if (Level >= 1) {
+    Result = Result && supportsCPUID(1, kMOVBE | kXSAVE | kF16C) &&
+             supportsCPUID(0x80000001, kLZCNT) &&
+             __builtin_cpu_supports("avx") &&
+             __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") &&
+             __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma");
+  }
+  if (Level >= 2) {
+    Result = Result && __builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512cd") &&
+             __builtin_cpu_supports("avx512dq") &&
+             __builtin_cpu_supports("avx512vl");
+  }
+  return Result;
+}
+#else
+// Code variants are only defined for x86-64 microarchitecture levels.
+constexpr const std::array<CPU::Target, 0> kTargets = {};
+
+bool supportsLevel(size_t) noexcept { return false; }
+#endif
+} // namespace
+
+Span<const CPU::Target> CPU::targets() noexcept { return kTargets; }
+
+std::optional<CPU::Target> CPU::find(std::string_view Name) noexcept {
+  for (const auto &T : kTargets) {
+    if (T.Name == Name) {
+      return T;
+    }
+  }
+  return std::nullopt;
+}
+
+bool CPU::supports(std::string_view Name) noexcept {
+  for (size_t I = 0; I < kTargets.size(); ++I) {
+    if (kTargets[I].Name == Name) {
+      static const std::array<bool, kTargets.size()> Supported = []() {
+        std::array<bool, kTargets.size()> Result{};
+        for (size_t J = 0; J < Result.size(); ++J) {
+          Result[J] = supportsLevel(J);
+        }
+        return Result;
+      }();
+      return Supported[I];
+    }
+  }
+  return false;
+}
+
+} // namespace WasmEdge
@@ -114,6 +114,10 @@ Fault::~Fault() noexcept {
   localHandler = std::exchange(Prev, nullptr);
 }
 
+Fault *Fault::swapHandlers(Fault *Handlers) noexcept {
+  return std::exchange(localHandler, Handlers);
+}
+
 [[noreturn]] void Fault::emitFault(ErrCode Error) {
   assuming(localHandler != nullptr);
   auto Buffer = stackTrace(localHandler->StackTraceBuffer);
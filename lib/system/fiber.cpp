@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+// The ucontext functions are only declared in the X/Open mode on macOS.
+#define _XOPEN_SOURCE 600
+#endif
+
+#include "system/fiber.h"
+
+#include "common/defines.h"
+#include "common/errcode.h"
+
+#include <cstdint>
+#include <utility>
+
+#if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+namespace WasmEdge {
+
+namespace {
+thread_local Fiber *CurrentFiber = nullptr;
+} // namespace
+
+#if WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS
+
+struct Fiber::Impl {
+  std::function<void()> Entry;
+  ucontext_t Context;
+  ucontext_t Caller;
+  void *Stack = nullptr;
+  size_t StackSize = 0;
+  bool Finished = false;
+
+  // The pointer is passed in two int arguments, as makecontext() requires.
+  static void trampoline(unsigned int High, unsigned int Low) noexcept {
+    auto *Self = reinterpret_cast<Impl *>(
+        static_cast<uintptr_t>((static_cast<uint64_t>(High) << 32) | Low));
+    Self->Entry();
+    Self->Finished = true;
+    // Never resumed after finishing.
+    swapcontext(&Self->Context, &Self->Caller);
+  }
+};
+
+Fiber::Fiber(std::function<void()> Entry, size_t StackSize) noexcept
+    : Data(std::make_unique<Impl>()) {
+  Data->Entry = std::move(Entry);
+  const auto PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  StackSize = (StackSize + PageSize - 1) / PageSize * PageSize;
+  // The lowest page is a guard page against stack overflows.
+  void *Stack = mmap(nullptr, StackSize + PageSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (Stack == MAP_FAILED) {
+    return;
+  }
+  mprotect(Stack, PageSize, PROT_NONE);
+  if (getcontext(&Data->Context) != 0) {
+    munmap(Stack, StackSize + PageSize);
+    return;
+  }
+  Data->Stack = Stack;
+  Data->StackSize = StackSize + PageSize;
+  Data->Context.uc_stack.ss_sp = static_cast<uint8_t *>(Stack) + PageSize;
+  Data->Context.uc_stack.ss_size = StackSize;
+  Data->Context.uc_link = nullptr;
+  const auto Pointer =
+      static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Data.get()));
+  makecontext(&Data->Context, reinterpret_cast<void (*)()>(&Impl::trampoline),
+              2, static_cast<unsigned int>(Pointer >> 32),
+              static_cast<unsigned int>(Pointer));
+}
+
+Fiber::~Fiber() noexcept {
+  if (Data->Stack) {
+    munmap(Data->Stack, Data->StackSize);
+  }
+}
+
+bool Fiber::valid() const noexcept { return Data->Stack != nullptr; }
+
+bool Fiber::finished() const noexcept { return Data->Finished; }
+
+void Fiber::resume() noexcept {
+  assuming(valid() && !finished());
+  Fiber *Prev = std::exchange(CurrentFiber, this);
+  swapcontext(&Data->Caller, &Data->Context);
+  CurrentFiber = Prev;
+}
+
+void Fiber::suspend() noexcept {
+  Fiber *Self = CurrentFiber;
+  assuming(Self != nullptr);
+  // The resume() switched back to restores the current fiber of its thread.
+  swapcontext(&Self->Data->Context, &Self->Data->Caller);
+}
+
+#else
+
+// Fibers are not supported on this platform yet: the fiber is never valid.
+struct Fiber::Impl {};
+
+Fiber::Fiber(std::function<void()>, size_t) noexcept
+    : Data(std::make_unique<Impl>()) {}
+
+Fiber::~Fiber() noexcept = default;
+
+bool Fiber::valid() const noexcept { return false; }
+
+bool Fiber::finished() const noexcept { return false; }
+
+void Fiber::resume() noexcept { assumingUnreachable(); }
+
+void Fiber::suspend() noexcept { assumingUnreachable(); }
+
+#endif
+
+Fiber *Fiber::current() noexcept { return CurrentFiber; }
+
+} // namespace WasmEdge
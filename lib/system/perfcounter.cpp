@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "system/perfcounter.h"
+
+#include "common/defines.h"
+#include "common/spdlog.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#if WASMEDGE_OS_LINUX
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std::literals;
+
+namespace WasmEdge {
+
+namespace {
+#if WASMEDGE_OS_LINUX
+struct EventConfig {
+  uint32_t Type;
+  uint64_t Config;
+};
+
+// Events in the order of HardwareCounter.
+constexpr const std::array<EventConfig, 5> kEvents = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+}};
+static_assert(kEvents.size() ==
+              static_cast<size_t>(HardwareCounter::Max));
+
+// Counters of one thread, opened as one group, so that they are scheduled
+// together and a single read returns all of them. The first event which can
+// be opened leads the group, so the software events still count when the
+// hardware events are not available, such as in virtual machines.
+struct ThreadCounters {
+  /// Position of each event in the group read, or -1 if it is not open.
+  std::array<int, kEvents.size()> Positions;
+  std::array<int, kEvents.size()> Fds;
+  int Leader = -1;
+  size_t Count = 0;
+
+  ThreadCounters() noexcept {
+    for (size_t I = 0; I < kEvents.size(); ++I) {
+      perf_event_attr Attr{};
+      Attr.size = sizeof(Attr);
+      Attr.type = kEvents[I].Type;
+      Attr.config = kEvents[I].Config;
+      Attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+      // Unprivileged processes may only count the user mode.
+      Attr.exclude_kernel = 1;
+      Attr.exclude_hv = 1;
+      Fds[I] = static_cast<int>(syscall(SYS_perf_event_open, &Attr, 0, -1,
+                                        Leader, PERF_FLAG_FD_CLOEXEC));
+      Positions[I] = Fds[I] >= 0 ? static_cast<int>(Count++) : -1;
+      if (Leader < 0) {
+        Leader = Fds[I];
+      }
+    }
+    if (Leader < 0) {
+      static std::once_flag Warned;
+      std::call_once(Warned, []() {
+        spdlog::warn("Hardware performance counters are not available, check "
+                     "the perf_event_paranoid setting."sv);
+      });
+    }
+  }
+  ~ThreadCounters() noexcept {
+    for (const int Fd : Fds) {
+      if (Fd >= 0) {
+        close(Fd);
+      }
+    }
+  }
+  ThreadCounters(const ThreadCounters &) = delete;
+  ThreadCounters &operator=(const ThreadCounters &) = delete;
+};
+#endif
+} // namespace
+
+bool PerfCounter::read(Statistics::HardwareCounterValues &Values) noexcept {
+#if WASMEDGE_OS_LINUX
+  thread_local ThreadCounters Counters;
+  if (Counters.Leader < 0) {
+    return false;
+  }
+  // The group read format is {nr, time_enabled, time_running, values[nr]}.
+  std::array<uint64_t, 3 + kEvents.size()> Buf;
+  const auto Size =
+      static_cast<ssize_t>((3 + Counters.Count) * sizeof(uint64_t));
+  if (::read(Counters.Leader, Buf.data(), static_cast<size_t>(Size)) != Size) {
+    return false;
+  }
+  // When more events are open than the hardware can count at once, the group
+  // only runs for a part of the time. Scale the values to the whole time.
+  const uint64_t Enabled = Buf[1];
+  const uint64_t Running = Buf[2];
+  for (size_t I = 0; I < Values.size(); ++I) {
+    if (Counters.Positions[I] < 0) {
+      Values[I] = 0;
+      continue;
+    }
+    const uint64_t Value = Buf[3 + static_cast<size_t>(Counters.Positions[I])];
+    Values[I] = Running == 0 || Running >= Enabled
+                    ? Value
+                    : static_cast<uint64_t>(static_cast<double>(Value) *
+                                            static_cast<double>(Enabled) /
+                                            static_cast<double>(Running));
+  }
+  return true;
+#else
+  Values.fill(0);
+  return false;
+#endif
+}
+
+} // namespace WasmEdge
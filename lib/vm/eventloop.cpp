@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "vm/eventloop.h"
+
+#include "common/spdlog.h"
+#include "system/fiber.h"
+#include "vm/vm.h"
+
+#include <optional>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace VM {
+
+struct EventLoop::Task {
+  Executor::Executor *Exec = nullptr;
+  const Runtime::Instance::FunctionInstance *Func = nullptr;
+  std::vector<ValVariant> Params;
+  std::vector<ValType> ParamTypes;
+  std::promise<Result> Promise;
+  std::optional<Result> Res;
+  /// Stack of the task, created when the task starts.
+  std::unique_ptr<Fiber> Stack;
+  /// Operation awaited by the suspended task, started by the loop.
+  Executor::Executor::AsyncStart Pending;
+
+  void run() { Res.emplace(Exec->invoke(Func, Params, ParamTypes)); }
+};
+
+EventLoop::EventLoop() = default;
+
+EventLoop::~EventLoop() noexcept {
+  {
+    std::unique_lock Lock(Mutex);
+    // Fail the tasks not started yet. The started ones are interrupted after
+    // their awaited operations complete, as the operations call back the loop.
+    for (auto It = Ready.begin(); It != Ready.end();) {
+      if ((*It)->Stack) {
+        ++It;
+        continue;
+      }
+      (*It)->Promise.set_value(Unexpect(ErrCode::Value::Interrupted));
+      Tasks.erase(*It);
+      It = Ready.erase(It);
+    }
+    for (auto &Entry : Tasks) {
+      Entry.second->Exec->stop();
+    }
+  }
+  run();
+}
+
+std::future<EventLoop::Result>
+EventLoop::spawn(VM &TargetVM, std::string_view Func,
+                 Span<const ValVariant> Params,
+                 Span<const ValType> ParamTypes) {
+  auto NewTask = std::make_unique<Task>();
+  auto Future = NewTask->Promise.get_future();
+  const auto *ModInst = TargetVM.getActiveModule();
+  if (unlikely(!ModInst)) {
+    spdlog::error(ErrCode::Value::WrongInstanceAddress);
+    spdlog::error(ErrInfo::InfoExecuting("When invoking"sv, Func));
+    NewTask->Promise.set_value(Unexpect(ErrCode::Value::WrongInstanceAddress));
+    return Future;
+  }
+  // A function not found is reported by the executor.
+  NewTask->Exec = &TargetVM.getExecutor();
+  NewTask->Func = ModInst->findFuncExports(Func);
+  NewTask->Params.assign(Params.begin(), Params.end());
+  NewTask->ParamTypes.assign(ParamTypes.begin(), ParamTypes.end());
+
+  std::unique_lock Lock(Mutex);
+  Task *T = NewTask.get();
+  Tasks.emplace(T, std::move(NewTask));
+  Ready.push_back(T);
+  CV.notify_one();
+  return Future;
+}
+
+void EventLoop::run() {
+  std::unique_lock Lock(Mutex);
+  while (!Tasks.empty()) {
+    CV.wait(Lock, [this]() { return !Ready.empty(); });
+    Task *T = Ready.front();
+    Ready.pop_front();
+    Lock.unlock();
+    step(*T);
+    Lock.lock();
+  }
+}
+
+size_t EventLoop::getPendingCount() const {
+  std::unique_lock Lock(Mutex);
+  return Tasks.size();
+}
+
+void EventLoop::step(Task &T) {
+  if (!T.Stack) {
+    T.Stack = std::make_unique<Fiber>([&T]() noexcept { T.run(); });
+  }
+  if (T.Stack->valid()) {
+    T.Exec->setAwaitHandler([&T](Executor::Executor::AsyncStart Start) {
+      T.Pending = std::move(Start);
+      Fiber::suspend();
+    });
+    T.Stack->resume();
+    T.Exec->setAwaitHandler({});
+  } else {
+    // Without the fibers, the awaits block this thread.
+    T.run();
+  }
+
+  if (T.Res) {
+    T.Promise.set_value(std::move(*T.Res));
+    std::unique_lock Lock(Mutex);
+    Tasks.erase(&T);
+    return;
+  }
+  // The operation starts after the task is suspended, so its completion may
+  // call back at once, even on this thread.
+  auto Start = std::move(T.Pending);
+  T.Pending = nullptr;
+  Start([this, &T]() {
+    std::unique_lock Lock(Mutex);
+    Ready.push_back(&T);
+    CV.notify_one();
+  });
+}
+
+} // namespace VM
+} // namespace WasmEdge
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "vm/scheduler.h"
+
+#include "common/spdlog.h"
+#include "system/fiber.h"
+#include "vm/vm.h"
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace VM {
+
+struct Scheduler::Task {
+  Executor::Executor *Exec = nullptr;
+  const Runtime::Instance::FunctionInstance *Func = nullptr;
+  std::vector<ValVariant> Params;
+  std::vector<ValType> ParamTypes;
+  std::promise<Result> Promise;
+  std::optional<Result> Res;
+  /// Stack of the task, created when the task starts.
+  std::unique_ptr<Fiber> Stack;
+  std::chrono::steady_clock::time_point ReadySince;
+
+  void run() {
+    Res.emplace(Exec->invoke(Func, Params, ParamTypes));
+  }
+};
+
+struct Scheduler::Tenant {
+  uint32_t ID = 0;
+  uint32_t Shares = kDefaultShares;
+  /// Run time weighted by the shares, in nanoseconds.
+  uint64_t VRuntime = 0;
+  std::deque<std::unique_ptr<Task>> Tasks;
+  bool Parked = false;
+  bool Queued = false;
+  bool IsRunning = false;
+  bool YieldRequested = false;
+  /// Worker which the started first task is bound to.
+  std::optional<uint32_t> Worker;
+  std::chrono::steady_clock::time_point SliceStart;
+  TenantStatistics Stat;
+};
+
+Scheduler::Scheduler(uint32_t WorkerCount, std::chrono::microseconds S)
+    : Slice(S) {
+  if (WorkerCount == 0) {
+    WorkerCount = std::max(1U, std::thread::hardware_concurrency());
+  }
+  Running.resize(WorkerCount, nullptr);
+  Workers.reserve(WorkerCount);
+  for (uint32_t I = 0; I < WorkerCount; ++I) {
+    Workers.emplace_back(&Scheduler::runWorker, this, I);
+  }
+  Ticker = std::thread(&Scheduler::runTicker, this);
+}
+
+Scheduler::~Scheduler() noexcept {
+  {
+    std::unique_lock Lock(Mutex);
+    Stopping = true;
+    // Fail the tasks not started yet, and interrupt the started ones, which
+    // are resumed to unwind their stacks.
+    for (auto &T : Tenants) {
+      T->Parked = false;
+      for (auto It = T->Tasks.begin(); It != T->Tasks.end();) {
+        if ((*It)->Stack) {
+          (*It)->Exec->stop();
+          ++It;
+        } else {
+          (*It)->Promise.set_value(Unexpect(ErrCode::Value::Interrupted));
+          It = T->Tasks.erase(It);
+        }
+      }
+      enqueue(*T);
+    }
+  }
+  WorkerCV.notify_all();
+  TickerCV.notify_all();
+  for (auto &Worker : Workers) {
+    Worker.join();
+  }
+  Ticker.join();
+}
+
+uint32_t Scheduler::addTenant(uint32_t Shares) {
+  std::unique_lock Lock(Mutex);
+  auto T = std::make_unique<Tenant>();
+  T->ID = static_cast<uint32_t>(Tenants.size());
+  T->Shares = std::max(Shares, 1U);
+  T->VRuntime = MinVRuntime;
+  Tenants.push_back(std::move(T));
+  return Tenants.back()->ID;
+}
+
+void Scheduler::setShares(uint32_t Tenant, uint32_t Shares) {
+  std::unique_lock Lock(Mutex);
+  assuming(Tenant < Tenants.size());
+  Tenants[Tenant]->Shares = std::max(Shares, 1U);
+}
+
+void Scheduler::park(uint32_t Tenant) {
+  std::unique_lock Lock(Mutex);
+  assuming(Tenant < Tenants.size());
+  auto &T = *Tenants[Tenant];
+  T.Parked = true;
+  if (T.Queued) {
+    Ready.erase({T.VRuntime, T.ID});
+    T.Queued = false;
+  }
+  if (T.IsRunning && !T.YieldRequested) {
+    T.YieldRequested = true;
+    T.Tasks.front()->Exec->requestYield();
+  }
+}
+
+void Scheduler::unpark(uint32_t Tenant) {
+  std::unique_lock Lock(Mutex);
+  assuming(Tenant < Tenants.size());
+  Tenants[Tenant]->Parked = false;
+  enqueue(*Tenants[Tenant]);
+}
+
+std::future<Scheduler::Result>
+Scheduler::submit(uint32_t Tenant, VM &TargetVM, std::string_view Func,
+                  Span<const ValVariant> Params,
+                  Span<const ValType> ParamTypes) {
+  auto NewTask = std::make_unique<Task>();
+  auto Future = NewTask->Promise.get_future();
+  const auto *ModInst = TargetVM.getActiveModule();
+  if (unlikely(!ModInst)) {
+    spdlog::error(ErrCode::Value::WrongInstanceAddress);
+    spdlog::error(ErrInfo::InfoExecuting("When invoking"sv, Func));
+    NewTask->Promise.set_value(Unexpect(ErrCode::Value::WrongInstanceAddress));
+    return Future;
+  }
+  // A function not found is reported by the executor.
+  NewTask->Exec = &TargetVM.getExecutor();
+  NewTask->Func = ModInst->findFuncExports(Func);
+  NewTask->Params.assign(Params.begin(), Params.end());
+  NewTask->ParamTypes.assign(ParamTypes.begin(), ParamTypes.end());
+
+  std::unique_lock Lock(Mutex);
+  assuming(Tenant < Tenants.size());
+  auto &T = *Tenants[Tenant];
+  if (unlikely(Stopping)) {
+    NewTask->Promise.set_value(Unexpect(ErrCode::Value::Interrupted));
+    return Future;
+  }
+  T.Tasks.push_back(std::move(NewTask));
+  ++T.Stat.Submitted;
+  enqueue(T);
+  return Future;
+}
+
+Scheduler::TenantStatistics Scheduler::getStatistics(uint32_t Tenant) const {
+  std::unique_lock Lock(Mutex);
+  assuming(Tenant < Tenants.size());
+  return Tenants[Tenant]->Stat;
+}
+
+void Scheduler::enqueue(Tenant &T) {
+  if (T.Parked || T.Queued || T.IsRunning || T.Tasks.empty()) {
+    return;
+  }
+  T.VRuntime = std::max(T.VRuntime, MinVRuntime);
+  Ready.emplace(T.VRuntime, T.ID);
+  T.Queued = true;
+  T.Tasks.front()->ReadySince = std::chrono::steady_clock::now();
+  WorkerCV.notify_all();
+}
+
+Scheduler::Tenant *Scheduler::pickTenant(uint32_t Worker) {
+  for (auto It = Ready.begin(); It != Ready.end(); ++It) {
+    auto &T = *Tenants[It->second];
+    if (!T.Worker || *T.Worker == Worker) {
+      Ready.erase(It);
+      T.Queued = false;
+      MinVRuntime = std::max(MinVRuntime, T.VRuntime);
+      return &T;
+    }
+  }
+  return nullptr;
+}
+
+void Scheduler::runWorker(uint32_t Index) {
+  std::unique_lock Lock(Mutex);
+  while (true) {
+    Tenant *T = nullptr;
+    WorkerCV.wait(Lock, [&]() {
+      T = pickTenant(Index);
+      return T != nullptr || Stopping;
+    });
+    if (T == nullptr) {
+      return;
+    }
+
+    auto &CurrTask = *T->Tasks.front();
+    const auto Start = std::chrono::steady_clock::now();
+    const auto Waited = Start - CurrTask.ReadySince;
+    T->Stat.QueueTime += Waited;
+    T->Stat.MaxQueueTime = std::max<std::chrono::nanoseconds>(
+        T->Stat.MaxQueueTime, Waited);
+    T->IsRunning = true;
+    T->YieldRequested = false;
+    T->SliceStart = Start;
+    Running[Index] = T;
+    if (!CurrTask.Stack) {
+      CurrTask.Stack = std::make_unique<Fiber>([&CurrTask]() noexcept {
+        CurrTask.Exec->setYieldHandler([]() { Fiber::suspend(); });
+        CurrTask.run();
+        CurrTask.Exec->setYieldHandler({});
+      });
+    }
+    TickerCV.notify_one();
+    Lock.unlock();
+
+    if (CurrTask.Stack->valid()) {
+      CurrTask.Stack->resume();
+    } else {
+      // Without the fibers, the task runs to its completion.
+      CurrTask.run();
+    }
+
+    Lock.lock();
+    const auto Elapsed = std::chrono::steady_clock::now() - Start;
+    Running[Index] = nullptr;
+    T->IsRunning = false;
+    if (Stopping) {
+      TickerCV.notify_one();
+    }
+    ++T->Stat.Slices;
+    T->Stat.RunTime += Elapsed;
+    T->VRuntime += static_cast<uint64_t>(
+                       std::chrono::nanoseconds(Elapsed).count()) *
+                   kDefaultShares / T->Shares;
+    if (CurrTask.Res) {
+      CurrTask.Promise.set_value(std::move(*CurrTask.Res));
+      T->Tasks.pop_front();
+      T->Worker.reset();
+      ++T->Stat.Completed;
+    } else {
+      ++T->Stat.Yields;
+      T->Worker = Index;
+    }
+    enqueue(*T);
+  }
+}
+
+void Scheduler::runTicker() {
+  std::unique_lock Lock(Mutex);
+  while (true) {
+    // Request the expired slices to yield, and sleep until the earliest
+    // running slice expires.
+    const auto Now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> Deadline;
+    for (auto *T : Running) {
+      if (T == nullptr || T->YieldRequested) {
+        continue;
+      }
+      const auto Expiry = T->SliceStart + Slice;
+      if (Expiry <= Now || T->Parked) {
+        T->YieldRequested = true;
+        T->Tasks.front()->Exec->requestYield();
+      } else if (!Deadline || Expiry < *Deadline) {
+        Deadline = Expiry;
+      }
+    }
+    if (Stopping && Ready.empty() &&
+        std::all_of(Running.begin(), Running.end(),
+                    [](const Tenant *T) { return T == nullptr; })) {
+      return;
+    }
+    if (Deadline) {
+      TickerCV.wait_until(Lock, *Deadline);
+    } else {
+      TickerCV.wait(Lock);
+    }
+  }
+}
+
+} // namespace VM
+} // namespace WasmEdge
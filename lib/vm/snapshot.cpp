@@ -0,0 +1,496 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "vm/snapshot.h"
+
+#include "common/config.h"
+#include "common/defines.h"
+#include "common/hash.h"
+#include "common/spdlog.h"
+#include "system/allocator.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#if (WASMEDGE_OS_LINUX || WASMEDGE_OS_MACOS) && WASMEDGE_ALLOCATOR_IS_STABLE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define WASMEDGE_SNAPSHOT_MMAP 1
+#else
+#define WASMEDGE_SNAPSHOT_MMAP 0
+#endif
+
+using namespace std::literals;
+
+namespace WasmEdge {
+namespace VM {
+
+namespace {
+
+using MemoryInstance = Runtime::Instance::MemoryInstance;
+using FunctionInstance = Runtime::Instance::FunctionInstance;
+
+constexpr std::array<char, 8> kMagic = {'W', 'E', 'S', 'N', 'A', 'P', 0, 0};
+constexpr uint32_t kVersion = 1;
+/// Memory contents start at page boundaries, which also satisfies the mmap
+/// offset alignment of the host.
+constexpr uint64_t kDataAlign = MemoryInstance::kPageSize;
+
+struct FileHeader {
+  std::array<char, 8> Magic;
+  uint32_t Version;
+  uint32_t MemoryCount;
+  uint64_t Fingerprint;
+  uint32_t TableCount;
+  uint32_t GlobalCount;
+};
+
+struct RefRecord {
+  std::array<uint8_t, 8> Type;
+  uint32_t IsNull;
+  uint32_t FuncIdx;
+};
+
+struct GlobalRecord {
+  uint32_t Index;
+  uint32_t IsRef;
+  std::array<uint8_t, 8> Type;
+  uint128_t Value;
+};
+
+struct MemoryRecord {
+  uint64_t PageCount;
+  uint64_t DataOffset;
+};
+
+/// Raw bytes of a value type with the reserved padding cleared, so that the
+/// same type always has the same encoding.
+std::array<uint8_t, 8> rawType(const ValType &Type) noexcept {
+  auto Raw = Type.getRawData();
+  Raw[0] = 0;
+  return Raw;
+}
+
+/// Encode a reference. Only null and function references in the module index
+/// space have a stable meaning across processes.
+Expect<RefRecord> encodeRef(
+    const RefVariant &Ref,
+    const std::unordered_map<const FunctionInstance *, uint32_t> &FuncIdx) {
+  RefRecord Record{};
+  Record.Type = rawType(Ref.getType());
+  if (Ref.isNull()) {
+    Record.IsNull = 1;
+    return Record;
+  }
+  if (auto It = FuncIdx.find(Ref.getPtr<FunctionInstance>());
+      It != FuncIdx.end()) {
+    Record.FuncIdx = It->second;
+    return Record;
+  }
+  spdlog::error("Snapshot: only null and function references of the module "
+                "can be saved."sv);
+  return Unexpect(ErrCode::Value::RuntimeError);
+}
+
+Expect<RefVariant>
+decodeRef(const RefRecord &Record,
+          const Runtime::Instance::ModuleInstance &ModInst) noexcept {
+  const ValType Type(Record.Type);
+  if (unlikely(!Type.isRefType() || Record.IsNull > 1)) {
+    spdlog::error("Snapshot: malformed reference."sv);
+    return Unexpect(ErrCode::Value::MalformedValType);
+  }
+  if (Record.IsNull) {
+    return RefVariant(Type);
+  }
+  const auto Funcs = ModInst.getFunctionInstances();
+  if (unlikely(Record.FuncIdx >= Funcs.size())) {
+    spdlog::error("Snapshot: invalid function index {}."sv, Record.FuncIdx);
+    return Unexpect(ErrCode::Value::MalformedValType);
+  }
+  const auto *Func = Funcs[Record.FuncIdx];
+  return RefVariant(Func->getDefType(), Func);
+}
+
+template <typename T> bool readRecord(std::ifstream &File, T &Record) {
+  return static_cast<bool>(
+      File.read(reinterpret_cast<char *>(&Record), sizeof(Record)));
+}
+
+template <typename T> void writeRecord(std::ofstream &File, const T &Record) {
+  File.write(reinterpret_cast<const char *>(&Record), sizeof(Record));
+}
+
+/// Fill the memory with the file contents. The pages of a non-shared memory
+/// are mapped copy-on-write when possible, so they are only read on first
+/// access. Shared memories are always copied in place, a private mapping
+/// would detach them from the other instances.
+bool loadMemory(const std::filesystem::path &Path, std::ifstream &File,
+                uint8_t *Data, uint64_t Size, uint64_t Offset,
+                bool IsShared) noexcept {
+  if (Size == 0) {
+    return true;
+  }
+#if WASMEDGE_SNAPSHOT_MMAP
+  if (const int Fd = IsShared ? -1 : ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+      Fd >= 0) {
+    // Check the mapped range against the file that is actually mapped, pages
+    // beyond its end would raise SIGBUS on access.
+    struct stat St;
+    void *Ptr = MAP_FAILED;
+    if (::fstat(Fd, &St) == 0 && S_ISREG(St.st_mode) &&
+        static_cast<uint64_t>(St.st_size) >= Offset &&
+        static_cast<uint64_t>(St.st_size) - Offset >= Size) {
+      Ptr = ::mmap(Data, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                   Fd, static_cast<off_t>(Offset));
+    }
+    ::close(Fd);
+    if (Ptr != MAP_FAILED) {
+      return true;
+    }
+  }
+#else
+  static_cast<void>(Path);
+  static_cast<void>(IsShared);
+#endif
+  File.seekg(static_cast<std::streamoff>(Offset));
+  return static_cast<bool>(File.read(reinterpret_cast<char *>(Data),
+                                     static_cast<std::streamsize>(Size)));
+}
+
+} // namespace
+
+uint64_t Snapshot::fingerprint(
+    const Runtime::Instance::ModuleInstance &ModInst) noexcept {
+  std::vector<uint8_t> Buf;
+  auto Append = [&Buf](const auto &Value) {
+    const auto *Ptr = reinterpret_cast<const uint8_t *>(&Value);
+    Buf.insert(Buf.end(), Ptr, Ptr + sizeof(Value));
+  };
+  Append(static_cast<uint32_t>(ModInst.FuncInsts.size()));
+  for (const auto *Func : ModInst.FuncInsts) {
+    const auto &Type = Func->getFuncType();
+    Append(static_cast<uint32_t>(Type.getParamTypes().size()));
+    for (const auto &VT : Type.getParamTypes()) {
+      Append(rawType(VT));
+    }
+    Append(static_cast<uint32_t>(Type.getReturnTypes().size()));
+    for (const auto &VT : Type.getReturnTypes()) {
+      Append(rawType(VT));
+    }
+  }
+  Append(static_cast<uint32_t>(ModInst.TabInsts.size()));
+  for (const auto *Tab : ModInst.TabInsts) {
+    Append(rawType(Tab->getTableType().getRefType()));
+  }
+  Append(static_cast<uint32_t>(ModInst.GlobInsts.size()));
+  for (const auto *Glob : ModInst.GlobInsts) {
+    Append(rawType(Glob->getGlobalType().getValType()));
+    Append(static_cast<uint8_t>(Glob->getGlobalType().getValMut()));
+  }
+  Append(static_cast<uint32_t>(ModInst.MemInsts.size()));
+  for (const auto *Mem : ModInst.MemInsts) {
+    const auto &Limit = Mem->getMemoryType().getLimit();
+    Append(static_cast<uint8_t>(Limit.is64()));
+    Append(static_cast<uint8_t>(Limit.isShared()));
+  }
+  // `Hash::rapidHash` is seeded per process, so fold the layout with a fixed
+  // seed to keep the fingerprint stable across runs.
+  Buf.resize((Buf.size() + 7) / 8 * 8);
+  uint64_t Result = Buf.size();
+  for (size_t I = 0; I < Buf.size(); I += 8) {
+    uint64_t Word;
+    std::memcpy(&Word, Buf.data() + I, sizeof(Word));
+    Result = Hash::rapidMix(Result ^ Word, UINT64_C(0x8bb84b93962eacc9));
+  }
+  return Result;
+}
+
+bool Snapshot::matchRef(const Runtime::Instance::ModuleInstance &ModInst,
+                        const ValType &Exp, const RefVariant &Ref) noexcept {
+  if (Ref.isNull()) {
+    return Exp.isNullableRefType() &&
+           AST::TypeMatcher::matchType(ModInst.getTypeList(), Exp,
+                                       Ref.getType());
+  }
+  const auto *Func = Ref.getPtr<Runtime::Instance::FunctionInstance>();
+  Span<const AST::SubType *const> GotTypeList = ModInst.getTypeList();
+  if (Func->getModule()) {
+    GotTypeList = Func->getModule()->getTypeList();
+  }
+  return AST::TypeMatcher::matchType(ModInst.getTypeList(), Exp, GotTypeList,
+                                     Func->getDefType());
+}
+
+Expect<void>
+Snapshot::save(const Runtime::Instance::ModuleInstance &ModInst,
+               const std::filesystem::path &Path) noexcept {
+  std::shared_lock Lock(ModInst.Mutex);
+  const auto &Tabs = ModInst.TabInsts;
+  const auto &Globs = ModInst.GlobInsts;
+  const auto &Mems = ModInst.MemInsts;
+
+  std::unordered_map<const FunctionInstance *, uint32_t> FuncIdx;
+  for (uint32_t I = 0; I < ModInst.FuncInsts.size(); ++I) {
+    FuncIdx.emplace(ModInst.FuncInsts[I], I);
+  }
+
+  // Collect the tables and the mutable globals first, their size decides
+  // where the memory contents start.
+  std::vector<std::vector<RefRecord>> TabRecords;
+  TabRecords.reserve(Tabs.size());
+  for (const auto *Tab : Tabs) {
+    EXPECTED_TRY(auto Refs, Tab->getRefs(0, Tab->getSize()));
+    auto &Records = TabRecords.emplace_back();
+    Records.reserve(Refs.size());
+    for (const auto &Ref : Refs) {
+      EXPECTED_TRY(auto Record, encodeRef(Ref, FuncIdx));
+      Records.push_back(Record);
+    }
+  }
+  std::vector<GlobalRecord> GlobRecords;
+  for (uint32_t I = 0; I < Globs.size(); ++I) {
+    const auto &GlobType = Globs[I]->getGlobalType();
+    if (GlobType.getValMut() != ValMut::Var) {
+      continue;
+    }
+    GlobalRecord Record{};
+    Record.Index = I;
+    if (GlobType.getValType().isRefType()) {
+      // Reference globals keep the encoded reference in the value slot.
+      EXPECTED_TRY(auto Ref, encodeRef(Globs[I]->getValue().get<RefVariant>(),
+                                       FuncIdx));
+      Record.IsRef = 1;
+      Record.Type = Ref.Type;
+      Record.Value = static_cast<uint128_t>(Ref.IsNull) << 64 | Ref.FuncIdx;
+    } else {
+      Record.Type = rawType(GlobType.getValType());
+      Record.Value = Globs[I]->getValue().get<uint128_t>();
+    }
+    GlobRecords.push_back(Record);
+  }
+
+  uint64_t MetaSize = sizeof(FileHeader);
+  for (const auto &Records : TabRecords) {
+    MetaSize += sizeof(uint64_t) + Records.size() * sizeof(RefRecord);
+  }
+  MetaSize += GlobRecords.size() * sizeof(GlobalRecord);
+  MetaSize += Mems.size() * sizeof(MemoryRecord);
+
+  std::vector<MemoryRecord> MemRecords;
+  MemRecords.reserve(Mems.size());
+  uint64_t DataOffset = (MetaSize + kDataAlign - 1) / kDataAlign * kDataAlign;
+  for (const auto *Mem : Mems) {
+    MemRecords.push_back({Mem->getPageSize(), DataOffset});
+    DataOffset += Mem->getPageSize() * MemoryInstance::kPageSize;
+  }
+
+  std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+  if (!File) {
+    spdlog::error("Snapshot: cannot create {}."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+  FileHeader Header{};
+  Header.Magic = kMagic;
+  Header.Version = kVersion;
+  Header.MemoryCount = static_cast<uint32_t>(Mems.size());
+  Header.Fingerprint = fingerprint(ModInst);
+  Header.TableCount = static_cast<uint32_t>(Tabs.size());
+  Header.GlobalCount = static_cast<uint32_t>(GlobRecords.size());
+  writeRecord(File, Header);
+  for (const auto &Records : TabRecords) {
+    writeRecord(File, static_cast<uint64_t>(Records.size()));
+    File.write(
+        reinterpret_cast<const char *>(Records.data()),
+        static_cast<std::streamsize>(Records.size() * sizeof(RefRecord)));
+  }
+  for (const auto &Record : GlobRecords) {
+    writeRecord(File, Record);
+  }
+  for (const auto &Record : MemRecords) {
+    writeRecord(File, Record);
+  }
+  for (size_t I = 0; I < Mems.size(); ++I) {
+    File.seekp(static_cast<std::streamoff>(MemRecords[I].DataOffset));
+    File.write(reinterpret_cast<const char *>(Mems[I]->getDataPtr()),
+               static_cast<std::streamsize>(Mems[I]->getSize()));
+  }
+  if (!File.flush()) {
+    spdlog::error("Snapshot: failed to write {}."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+  return {};
+}
+
+Expect<void>
+Snapshot::restore(Runtime::Instance::ModuleInstance &ModInst,
+                  const std::filesystem::path &Path) noexcept {
+  std::unique_lock Lock(ModInst.Mutex);
+  std::error_code EC;
+  const uint64_t FileSize = std::filesystem::file_size(Path, EC);
+  std::ifstream File(Path, std::ios::binary);
+  if (EC || !File) {
+    spdlog::error("Snapshot: cannot open {}."sv, Path.u8string());
+    return Unexpect(ErrCode::Value::IllegalPath);
+  }
+  // Bytes left after the current read position. Every size read from the file
+  // is checked against it before anything is allocated.
+  auto Remaining = [&File, FileSize]() -> uint64_t {
+    const auto Pos = static_cast<uint64_t>(File.tellg());
+    return Pos <= FileSize ? FileSize - Pos : 0;
+  };
+
+  FileHeader Header;
+  if (!readRecord(File, Header)) {
+    return Unexpect(ErrCode::Value::UnexpectedEnd);
+  }
+  if (Header.Magic != kMagic) {
+    return Unexpect(ErrCode::Value::MalformedMagic);
+  }
+  if (Header.Version != kVersion) {
+    return Unexpect(ErrCode::Value::MalformedVersion);
+  }
+  const auto &Tabs = ModInst.TabInsts;
+  const auto &Globs = ModInst.GlobInsts;
+  const auto &Mems = ModInst.MemInsts;
+  if (Header.Fingerprint != fingerprint(ModInst) ||
+      Header.TableCount != Tabs.size() || Header.MemoryCount != Mems.size() ||
+      Header.GlobalCount > Globs.size()) {
+    spdlog::error("Snapshot: {} was not taken from this module."sv,
+                  Path.u8string());
+    return Unexpect(ErrCode::Value::RuntimeError);
+  }
+
+  // Decode and check the whole file into staging state first, so that a
+  // malformed snapshot leaves the instance untouched.
+  std::vector<std::vector<RefVariant>> TabRefs;
+  TabRefs.reserve(Tabs.size());
+  for (const auto *Tab : Tabs) {
+    const ValType &RefType = Tab->getTableType().getRefType();
+    uint64_t Size;
+    if (!readRecord(File, Size) || Size > Remaining() / sizeof(RefRecord)) {
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+    if (Size < Tab->getSize()) {
+      spdlog::error("Snapshot: cannot resize table to {} elements."sv, Size);
+      return Unexpect(ErrCode::Value::TableOutOfBounds);
+    }
+    std::vector<RefRecord> Records(Size);
+    if (!File.read(reinterpret_cast<char *>(Records.data()),
+                   static_cast<std::streamsize>(Size * sizeof(RefRecord)))) {
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+    auto &Refs = TabRefs.emplace_back();
+    Refs.reserve(Size);
+    for (const auto &Record : Records) {
+      EXPECTED_TRY(auto Ref, decodeRef(Record, ModInst));
+      if (unlikely(!matchRef(ModInst, RefType, Ref))) {
+        spdlog::error("Snapshot: table reference of another type."sv);
+        return Unexpect(ErrCode::Value::MalformedValType);
+      }
+      Refs.push_back(Ref);
+    }
+  }
+
+  std::vector<std::pair<Runtime::Instance::GlobalInstance *, ValVariant>>
+      GlobVals;
+  GlobVals.reserve(Header.GlobalCount);
+  for (uint32_t I = 0; I < Header.GlobalCount; ++I) {
+    GlobalRecord Record;
+    if (!readRecord(File, Record)) {
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+    if (unlikely(Record.Index >= Globs.size() ||
+                 Globs[Record.Index]->getGlobalType().getValMut() !=
+                     ValMut::Var)) {
+      spdlog::error("Snapshot: invalid global index {}."sv, Record.Index);
+      return Unexpect(ErrCode::Value::RuntimeError);
+    }
+    const ValType &GlobType =
+        Globs[Record.Index]->getGlobalType().getValType();
+    if (unlikely(Record.IsRef != (GlobType.isRefType() ? 1U : 0U))) {
+      spdlog::error("Snapshot: global {} has another type."sv, Record.Index);
+      return Unexpect(ErrCode::Value::MalformedValType);
+    }
+    if (Record.IsRef) {
+      RefRecord Ref{};
+      Ref.Type = Record.Type;
+      Ref.FuncIdx = static_cast<uint32_t>(Record.Value);
+      Ref.IsNull = static_cast<uint32_t>(Record.Value >> 64);
+      EXPECTED_TRY(auto Val, decodeRef(Ref, ModInst));
+      if (unlikely(!matchRef(ModInst, GlobType, Val))) {
+        spdlog::error("Snapshot: global {} has another type."sv,
+                      Record.Index);
+        return Unexpect(ErrCode::Value::MalformedValType);
+      }
+      GlobVals.emplace_back(Globs[Record.Index], Val);
+    } else if (unlikely(Record.Type != rawType(GlobType))) {
+      spdlog::error("Snapshot: global {} has another type."sv, Record.Index);
+      return Unexpect(ErrCode::Value::MalformedValType);
+    } else {
+      GlobVals.emplace_back(Globs[Record.Index], Record.Value);
+    }
+  }
+
+  std::vector<MemoryRecord> MemRecords(Mems.size());
+  for (size_t I = 0; I < Mems.size(); ++I) {
+    auto &Record = MemRecords[I];
+    if (!readRecord(File, Record)) {
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+    if (Record.PageCount < Mems[I]->getPageSize()) {
+      spdlog::error("Snapshot: cannot resize memory to {} pages."sv,
+                    Record.PageCount);
+      return Unexpect(ErrCode::Value::MemoryOutOfBounds);
+    }
+    if (Record.DataOffset % kDataAlign != 0 || Record.DataOffset > FileSize ||
+        Record.PageCount >
+            (FileSize - Record.DataOffset) / MemoryInstance::kPageSize) {
+      spdlog::error("Snapshot: memory {} is out of the file range."sv, I);
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+  }
+
+  // Grow everything before writing any contents, a failed growth keeps the
+  // previous state of the instance.
+  for (size_t I = 0; I < Tabs.size(); ++I) {
+    const uint64_t Size = TabRefs[I].size();
+    if (!Tabs[I]->growTable(Size - Tabs[I]->getSize())) {
+      spdlog::error("Snapshot: cannot resize table to {} elements."sv, Size);
+      return Unexpect(ErrCode::Value::TableOutOfBounds);
+    }
+  }
+  for (size_t I = 0; I < Mems.size(); ++I) {
+    const uint64_t PageCount = MemRecords[I].PageCount;
+    if (!Mems[I]->growPage(PageCount - Mems[I]->getPageSize())) {
+      spdlog::error("Snapshot: cannot resize memory to {} pages."sv,
+                    PageCount);
+      return Unexpect(ErrCode::Value::MemoryOutOfBounds);
+    }
+  }
+
+  for (size_t I = 0; I < Mems.size(); ++I) {
+    auto *Mem = Mems[I];
+    if (!loadMemory(Path, File, Mem->getDataPtr(), Mem->getSize(),
+                    MemRecords[I].DataOffset,
+                    Mem->getMemoryType().getLimit().isShared())) {
+      return Unexpect(ErrCode::Value::UnexpectedEnd);
+    }
+  }
+  for (size_t I = 0; I < Tabs.size(); ++I) {
+    EXPECTED_TRY(Tabs[I]->setRefs(TabRefs[I], 0, 0, TabRefs[I].size()));
+  }
+  for (const auto &[Glob, Val] : GlobVals) {
+    Glob->setValue(Val);
+  }
+  return {};
+}
+
+} // namespace VM
+} // namespace WasmEdge
@@ -4,6 +4,7 @@
 #include "vm/vm.h"
 
 #include "plugin_modules.h"
+#include "vm/snapshot.h"
 
 #include "ast/module.h"
 #include "common/errcode.h"
@@ -40,15 +41,24 @@ void VM::unsafeInitVM() {
   unsafeLoadBuiltInHosts();
   unsafeLoadPlugInHosts();
 
-  // Set up the lazy JIT engine if lazy JIT mode is enabled.
+  // Set up the lazy JIT engine if lazy JIT or tiered mode is enabled.
 #ifdef WASMEDGE_USE_LLVM
-  if (Conf.getRuntimeConfigure().getRunMode() == RunMode::LazyJIT) {
+  if (Conf.getRuntimeConfigure().getRunMode() == RunMode::LazyJIT ||
+      Conf.getRuntimeConfigure().getRunMode() == RunMode::Tiered) {
     spdlog::warn(
         "Lazy JIT is an alpha and experimental feature, which is not ready for production use."sv);
-    LazyEngine = std::make_unique<LLVM::LazyJITEngine>(Conf);
+    LazyEngine = std::make_unique<LLVM::LazyJITEngine>(Conf, &Stat);
     ExecutorEngine.registerLazyCompilationCallback(
         [this](const Runtime::Instance::FunctionInstance *FuncInst)
             -> Expect<void> { return LazyEngine->compileOnDemand(FuncInst); });
+    if (Conf.getRuntimeConfigure().getRunMode() == RunMode::Tiered) {
+      // The background compilation only requests the tier-up, which the
+      // executor applies at the next function call.
+      LazyEngine->setTierUpNotifier(
+          [this]() { ExecutorEngine.requestTierUp(); });
+      ExecutorEngine.registerTierUpCallback(
+          [this]() { LazyEngine->applyTierUp(); });
+    }
   }
 #endif
 
@@ -62,8 +72,10 @@ void VM::unsafeLoadBuiltInHosts() {
   // TODO: This will be extended for versioned WASI in the future.
   cleanupModInstContainer(BuiltInModInsts);
   if (Conf.hasHostRegistration(HostRegistration::Wasi)) {
+    // Share the host function bodies of the WASI template instead of
+    // allocating them for every VM.
     std::unique_ptr<Runtime::Instance::ModuleInstance> WasiMod =
-        std::make_unique<Host::WasiModule>();
+        Host::WasiModule::createShared();
     BuiltInModInsts.insert({HostRegistration::Wasi, std::move(WasiMod)});
   }
 }
@@ -393,7 +405,8 @@ Expect<void> VM::unsafeValidate() {
 
 Expect<void> VM::unsafeLoadJITExecutable() {
   if ((Conf.getRuntimeConfigure().getRunMode() != RunMode::JIT &&
-       Conf.getRuntimeConfigure().getRunMode() != RunMode::LazyJIT) ||
+       Conf.getRuntimeConfigure().getRunMode() != RunMode::LazyJIT &&
+       Conf.getRuntimeConfigure().getRunMode() != RunMode::Tiered) ||
       Mod->getSymbol()) {
     return {};
   }
@@ -403,6 +416,16 @@ Expect<void> VM::unsafeLoadJITExecutable() {
     EXPECTED_TRY(LoaderEngine.loadExecutable(*Mod, std::move(Exec)));
     return {};
   }
+  LLVM::JIT JIT(Conf,
+                std::make_shared<const LLVM::ObjectCache>(Conf, *Mod, &Stat));
+  // A cached machine code object of the module skips its compilation.
+  if (auto Exec = JIT.loadCached()) {
+    if (LoaderEngine.loadExecutable(*Mod, std::move(Exec))) {
+      return {};
+    }
+    spdlog::warn("Loading the cached JIT object failed, compiling the module "
+                 "instead."sv);
+  }
   LLVM::Compiler Compiler(Conf);
   Compiler.checkConfigure()
       .map_error([](uint32_t Err) {
@@ -422,10 +445,7 @@ Expect<void> VM::unsafeLoadJITExecutable() {
         }
         return ErrCode::Value::Success;
       })
-      .and_then([&](auto LLModule) {
-        LLVM::JIT JIT(Conf);
-        return JIT.load(std::move(LLModule));
-      })
+      .and_then([&](auto LLModule) { return JIT.load(std::move(LLModule)); })
       .map_error([](uint32_t Err) {
         if (Err != ErrCode::Value::Success) {
           spdlog::warn(
@@ -489,6 +509,25 @@ Expect<void> VM::unsafeInstantiate() {
   return Unexpect(ErrCode::Value::WrongVMWorkflow);
 }
 
+Expect<void>
+VM::unsafeSaveSnapshot(const std::filesystem::path &Path) const {
+  if (Stage < VMStage::Instantiated || !ActiveModInst) {
+    // Only an instantiated module has a state to save.
+    spdlog::error(ErrCode::Value::WrongVMWorkflow);
+    return Unexpect(ErrCode::Value::WrongVMWorkflow);
+  }
+  return Snapshot::save(*ActiveModInst, Path);
+}
+
+Expect<void> VM::unsafeRestoreSnapshot(const std::filesystem::path &Path) {
+  if (Stage < VMStage::Instantiated || !ActiveModInst) {
+    // The snapshot is restored onto an instantiated module.
+    spdlog::error(ErrCode::Value::WrongVMWorkflow);
+    return Unexpect(ErrCode::Value::WrongVMWorkflow);
+  }
+  return Snapshot::restore(*ActiveModInst, Path);
+}
+
 Expect<std::vector<std::pair<ValVariant, ValType>>>
 VM::unsafeExecute(std::string_view Func, Span<const ValVariant> Params,
                   Span<const ValType> ParamTypes) {
@@ -192,6 +192,12 @@ public:
   WasiCryptoExpect<void>
   symmetricStateRatchet(__wasi_symmetric_state_t StateHandle) noexcept;
 
+  WasiCryptoExpect<void>
+  symmetricAeadBatch(__wasi_symmetric_key_t KeyHandle,
+                     Span<const Symmetric::AeadBatchItem> Items,
+                     Span<__wasi_crypto_errno_e_t> Results,
+                     bool Encrypt) noexcept;
+
   WasiCryptoExpect<size_t>
   symmetricTagLen(__wasi_symmetric_tag_t TagHandle) noexcept;
 
@@ -330,6 +336,10 @@ public:
   WasiCryptoExpect<void> signatureVerificationStateClose(
       __wasi_signature_verification_state_t StateHandle) noexcept;
 
+  WasiCryptoExpect<void>
+  signatureVerifyBatch(Span<const Signatures::VerifyBatchItem> Items,
+                       Span<__wasi_crypto_errno_e_t> Results) noexcept;
+
 private:
   Context() noexcept {}
 
@@ -6,6 +6,8 @@
 #include "signatures/signstate.h"
 #include "signatures/verificationstate.h"
 
+#include <optional>
+
 namespace WasmEdge {
 namespace Host {
 namespace WasiCrypto {
@@ -119,6 +121,45 @@ WasiCryptoExpect<void> Context::signatureVerificationStateVerify(
   return Signatures::verificationStateVerify(*Verification, *Sig);
 }
 
+WasiCryptoExpect<void>
+Context::signatureVerifyBatch(Span<const Signatures::VerifyBatchItem> Items,
+                              Span<__wasi_crypto_errno_e_t> Results) noexcept {
+  ensureOrReturn(Items.size() == Results.size(),
+                 __WASI_CRYPTO_ERRNO_INVALID_LENGTH);
+
+  // The verification states are not registered as handles, and consecutive
+  // records with the same public key look it up once.
+  std::optional<__wasi_publickey_t> LastPkHandle;
+  std::optional<WasiCryptoExpect<Signatures::PkVariant>> Pk;
+  for (size_t I = 0; I < Items.size(); ++I) {
+    const auto &Item = Items[I];
+    if (LastPkHandle != Item.PkHandle) {
+      Pk.emplace(PublicKeyManager.getAs<Signatures::PkVariant>(Item.PkHandle));
+      LastPkHandle = Item.PkHandle;
+    }
+    auto Res =
+        Pk->and_then([](const auto &PkVariant) noexcept {
+            return Signatures::verificationStateOpen(PkVariant);
+          })
+            .and_then([this, &Item](auto &&VerificationState) noexcept
+                      -> WasiCryptoExpect<void> {
+              if (auto UpdateRes = Signatures::verificationStateUpdate(
+                      VerificationState, Item.Msg);
+                  !UpdateRes) {
+                return UpdateRes;
+              }
+              auto Sig = SignatureManager.get(Item.SigHandle);
+              if (!Sig) {
+                return WasiCryptoUnexpect(Sig);
+              }
+              return Signatures::verificationStateVerify(VerificationState,
+                                                         *Sig);
+            });
+    Results[I] = Res ? __WASI_CRYPTO_ERRNO_SUCCESS : Res.error();
+  }
+  return {};
+}
+
 WasiCryptoExpect<void> Context::signatureVerificationStateClose(
     __wasi_signature_verification_state_t VerificationHandle) noexcept {
   return VerificationStateManager.close(VerificationHandle);
@@ -93,6 +93,7 @@ Ecdsa<CurveNid>::SignState::sign() noexcept {
 
   std::vector<uint8_t> Res(Size);
   opensslCheck(EVP_DigestSignFinal(Ctx->RawCtx.get(), Res.data(), &Size));
+  Res.resize(Size);
 
   return Res;
 }
@@ -111,7 +112,7 @@ WasiCryptoExpect<void>
 Ecdsa<CurveNid>::VerificationState::verify(const Signature &Sig) noexcept {
   std::scoped_lock Lock{Ctx->Mutex};
   ensureOrReturn(EVP_DigestVerifyFinal(Ctx->RawCtx.get(), Sig.ref().data(),
-                                       Sig.ref().size()),
+                                       Sig.ref().size()) == 1,
                  __WASI_CRYPTO_ERRNO_VERIFICATION_FAILED);
   return {};
 }
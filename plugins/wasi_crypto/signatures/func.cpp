@@ -3,6 +3,8 @@
 
 #include "signatures/func.h"
 
+#include <vector>
+
 namespace WasmEdge {
 namespace Host {
 namespace WasiCrypto {
@@ -212,6 +214,48 @@ Expect<uint32_t> VerificationStateClose::body(const Runtime::CallingFrame &,
   return __WASI_CRYPTO_ERRNO_SUCCESS;
 }
 
+namespace {
+/// Layout of a batched verification record in the guest memory.
+struct WasiVerifyBatchRecord {
+  __wasi_publickey_t PkHandle;
+  uint32_t MsgPtr;
+  __wasi_size_t MsgLen;
+  __wasi_signature_t SigHandle;
+};
+static_assert(sizeof(WasiVerifyBatchRecord) == 16);
+} // namespace
+
+Expect<uint32_t> VerifyBatch::body(const Runtime::CallingFrame &Frame,
+                                   uint32_t ItemsPtr, uint32_t ItemsLen,
+                                   uint32_t /* Out */ ResultsPtr) {
+  auto *MemInst = Frame.getMemoryByIndex(0);
+  checkExist(MemInst);
+
+  const __wasi_size_t WasiItemsLen = ItemsLen;
+  const auto Records =
+      MemInst->getSpan<const WasiVerifyBatchRecord>(ItemsPtr, WasiItemsLen);
+  checkRangeExist(Records, WasiItemsLen);
+
+  const auto Results =
+      MemInst->getSpan<__wasi_crypto_errno_e_t>(ResultsPtr, WasiItemsLen);
+  checkRangeExist(Results, WasiItemsLen);
+
+  std::vector<VerifyBatchItem> Items;
+  Items.reserve(Records.size());
+  for (const auto &Record : Records) {
+    const auto Msg =
+        MemInst->getSpan<const uint8_t>(Record.MsgPtr, Record.MsgLen);
+    checkRangeExist(Msg, Record.MsgLen);
+    Items.push_back({Record.PkHandle, Msg, Record.SigHandle});
+  }
+
+  if (auto Res = Ctx.signatureVerifyBatch(Items, Results); unlikely(!Res)) {
+    return Res.error();
+  }
+
+  return __WASI_CRYPTO_ERRNO_SUCCESS;
+}
+
 Expect<uint32_t> Close::body(const Runtime::CallingFrame &, int32_t SigHandle) {
   if (auto Res = Ctx.signatureClose(SigHandle); unlikely(!Res)) {
     return Res.error();
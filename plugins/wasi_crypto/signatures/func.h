@@ -99,6 +99,17 @@ public:
                         int32_t VerificationStateHandle);
 };
 
+/// Verify a batch of signatures. Each record in the guest memory is four u32
+/// values: the public key handle, the message pointer and length, and the
+/// signature handle. The errno of each record is written to the u16 array at
+/// ResultsPtr.
+class VerifyBatch : public HostFunction<VerifyBatch> {
+public:
+  using HostFunction::HostFunction;
+  Expect<uint32_t> body(const Runtime::CallingFrame &Frame, uint32_t ItemsPtr,
+                        uint32_t ItemsLen, uint32_t /* Out */ ResultsPtr);
+};
+
 class Close : public HostFunction<Close> {
 public:
   using HostFunction::HostFunction;
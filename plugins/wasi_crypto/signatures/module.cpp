@@ -37,6 +37,8 @@ WasiCryptoSignaturesModule::WasiCryptoSignaturesModule(
   addHostFunc("signature_verification_state_close",
               std::make_unique<Signatures::VerificationStateClose>(*Ctx));
   addHostFunc("signature_close", std::make_unique<Signatures::Close>(*Ctx));
+  addHostFunc("signature_verify_batch",
+              std::make_unique<Signatures::VerifyBatch>(*Ctx));
 }
 
 } // namespace Host
@@ -362,7 +362,7 @@ WasiCryptoExpect<void> Rsa<PadMode, KeyBits, ShaNid>::VerificationState::verify(
     const Signature &Sig) noexcept {
   std::scoped_lock Lock{Ctx->Mutex};
   ensureOrReturn(EVP_DigestVerifyFinal(Ctx->RawCtx.get(), Sig.ref().data(),
-                                       Sig.ref().size()),
+                                       Sig.ref().size()) == 1,
                  __WASI_CRYPTO_ERRNO_VERIFICATION_FAILED);
 
   return {};
@@ -37,6 +37,13 @@ WasiCryptoExpect<void>
 verificationStateUpdate(VerificationStateVariant &VerificationStateVariant,
                         Span<const uint8_t> Input) noexcept;
 
+/// One record of a batched verification.
+struct VerifyBatchItem {
+  __wasi_publickey_t PkHandle;
+  Span<const uint8_t> Msg;
+  __wasi_signature_t SigHandle;
+};
+
 WasiCryptoExpect<void>
 verificationStateVerify(VerificationStateVariant &VerificationStateVariant,
                         const SigVariant &SigVariant) noexcept;
@@ -55,6 +55,91 @@ Cipher<CipherNid>::Key::import(Span<const uint8_t> Raw) noexcept {
   return SecretVec{Raw};
 }
 
+template <int CipherNid>
+WasiCryptoExpect<void>
+Cipher<CipherNid>::Key::batch(Span<const AeadBatchItem> Items,
+                              Span<__wasi_crypto_errno_e_t> Results,
+                              bool Encrypt) const noexcept {
+  ensureOrReturn(getKeySize() == Data.size(),
+                 __WASI_CRYPTO_ERRNO_INVALID_HANDLE);
+  ensureOrReturn(Items.size() == Results.size(),
+                 __WASI_CRYPTO_ERRNO_INVALID_LENGTH);
+
+  EvpCipherCtxPtr Ctx{EVP_CIPHER_CTX_new()};
+  opensslCheck(EVP_CipherInit_ex(Ctx.get(), EVP_get_cipherbynid(CipherNid),
+                                 nullptr, Data.data(), nullptr,
+                                 Encrypt ? Mode::Encrypt : Mode::Decrypt));
+
+  for (size_t I = 0; I < Items.size(); ++I) {
+    auto Res = batchOne(Ctx.get(), Items[I], Encrypt);
+    Results[I] = Res ? __WASI_CRYPTO_ERRNO_SUCCESS : Res.error();
+  }
+  return {};
+}
+
+template <int CipherNid>
+WasiCryptoExpect<void>
+Cipher<CipherNid>::batchOne(EVP_CIPHER_CTX *Ctx, const AeadBatchItem &Item,
+                            bool Encrypt) noexcept {
+  ensureOrReturn(Item.Nonce.size() == NonceSize,
+                 __WASI_CRYPTO_ERRNO_INVALID_NONCE);
+  ensureOrReturn(Item.AdditionalData.size() <=
+                         static_cast<size_t>(std::numeric_limits<int>::max()) &&
+                     Item.Data.size() <=
+                         static_cast<size_t>(std::numeric_limits<int>::max()),
+                 __WASI_CRYPTO_ERRNO_ALGORITHM_FAILURE);
+
+  // Only set the nonce, the key schedule is kept in the context.
+  opensslCheck(EVP_CipherInit_ex(Ctx, nullptr, nullptr, nullptr,
+                                 Item.Nonce.data(), Mode::Unchanged));
+
+  int ActualAbsorbSize;
+  const int AdSize = static_cast<int>(Item.AdditionalData.size());
+  opensslCheck(EVP_CipherUpdate(Ctx, nullptr, &ActualAbsorbSize,
+                                Item.AdditionalData.data(), AdSize));
+
+  if (Encrypt) {
+    ensureOrReturn(Item.Out.size() == Item.Data.size() + getTagSize(),
+                   __WASI_CRYPTO_ERRNO_INVALID_LENGTH);
+    int ActualUpdateSize;
+    opensslCheck(EVP_CipherUpdate(Ctx, Item.Out.data(), &ActualUpdateSize,
+                                  Item.Data.data(),
+                                  static_cast<int>(Item.Data.size())));
+    int ActualFinalSize;
+    ensureOrReturn(EVP_CipherFinal_ex(Ctx, nullptr, &ActualFinalSize),
+                   __WASI_CRYPTO_ERRNO_INTERNAL_ERROR);
+    ensureOrReturn(static_cast<size_t>(ActualUpdateSize + ActualFinalSize) ==
+                       Item.Data.size(),
+                   __WASI_CRYPTO_ERRNO_ALGORITHM_FAILURE);
+    opensslCheck(EVP_CIPHER_CTX_ctrl(
+        Ctx, EVP_CTRL_AEAD_GET_TAG, static_cast<int>(getTagSize()),
+        Item.Out.last(getTagSize()).data()));
+    return {};
+  }
+
+  ensureOrReturn(Item.Data.size() >= getTagSize() &&
+                     Item.Out.size() == Item.Data.size() - getTagSize(),
+                 __WASI_CRYPTO_ERRNO_INVALID_LENGTH);
+  const auto Encrypted = Item.Data.first(Item.Out.size());
+  const auto RawTag = Item.Data.last(getTagSize());
+  int ActualUpdateSize;
+  opensslCheck(EVP_CipherUpdate(Ctx, Item.Out.data(), &ActualUpdateSize,
+                                Encrypted.data(),
+                                static_cast<int>(Encrypted.size())));
+  opensslCheck(EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_AEAD_SET_TAG,
+                                   static_cast<int>(getTagSize()),
+                                   const_cast<uint8_t *>(RawTag.data())));
+  int ActualFinalSize;
+  if (!EVP_CipherFinal_ex(Ctx, nullptr, &ActualFinalSize)) {
+    OPENSSL_cleanse(Item.Out.data(), Item.Out.size());
+    return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_TAG);
+  }
+  ensureOrReturn(static_cast<size_t>(ActualUpdateSize + ActualFinalSize) ==
+                     Encrypted.size(),
+                 __WASI_CRYPTO_ERRNO_ALGORITHM_FAILURE);
+  return {};
+}
+
 template <int CipherNid>
 WasiCryptoExpect<typename Cipher<CipherNid>::State>
 Cipher<CipherNid>::State::open(const Key &Key,
@@ -53,6 +53,15 @@ public:
   }
 };
 
+/// One record of a batched AEAD operation. A sealed record is the ciphertext
+/// followed by the tag, as the output of State::encrypt().
+struct AeadBatchItem {
+  Span<const uint8_t> Nonce;
+  Span<const uint8_t> AdditionalData;
+  Span<const uint8_t> Data;
+  Span<uint8_t> Out;
+};
+
 template <int CipherNid> class Cipher {
   static inline constexpr size_t NonceSize = 12;
 
@@ -70,6 +79,14 @@ public:
 
     const SecretVec &ref() const noexcept { return Data; }
 
+    /// Seal (\p Encrypt) or open every record with this key through one
+    /// cipher context. The key schedule is computed once, and only the nonce
+    /// is set for each record. The result of the i-th record is written to
+    /// `Results[i]`, and a failed record does not stop the others.
+    WasiCryptoExpect<void>
+    batch(Span<const AeadBatchItem> Items,
+          Span<__wasi_crypto_errno_e_t> Results, bool Encrypt) const noexcept;
+
   private:
     SecretVec Data;
   };
@@ -172,6 +189,10 @@ public:
 private:
   enum Mode { Unchanged = -1, Decrypt = 0, Encrypt = 1 };
 
+  static WasiCryptoExpect<void> batchOne(EVP_CIPHER_CTX *Ctx,
+                                         const AeadBatchItem &Item,
+                                         bool Encrypt) noexcept;
+
   constexpr static size_t getKeySize() noexcept;
 
   constexpr static size_t getTagSize() noexcept;
@@ -162,6 +162,17 @@ Context::symmetricStateDecrypt(__wasi_symmetric_state_t StateHandle,
       });
 }
 
+WasiCryptoExpect<void>
+Context::symmetricAeadBatch(__wasi_symmetric_key_t KeyHandle,
+                            Span<const Symmetric::AeadBatchItem> Items,
+                            Span<__wasi_crypto_errno_e_t> Results,
+                            bool Encrypt) noexcept {
+  return SymmetricKeyManager.get(KeyHandle).and_then(
+      [=](auto &&Key) noexcept {
+        return Symmetric::keyAeadBatch(Key, Items, Results, Encrypt);
+      });
+}
+
 WasiCryptoExpect<size_t> Context::symmetricStateDecryptDetached(
     __wasi_symmetric_state_t StateHandle, Span<uint8_t> Out,
     Span<const uint8_t> Data, Span<const uint8_t> RawTag) noexcept {
@@ -3,6 +3,8 @@
 
 #include "symmetric/func.h"
 
+#include <vector>
+
 namespace WasmEdge {
 namespace Host {
 namespace WasiCrypto {
@@ -603,6 +605,77 @@ Expect<uint32_t> StateDecryptDetached::body(
   return __WASI_CRYPTO_ERRNO_SUCCESS;
 }
 
+namespace {
+/// Layout of a batched AEAD record in the guest memory.
+struct WasiAeadBatchRecord {
+  uint32_t NoncePtr;
+  __wasi_size_t NonceLen;
+  uint32_t AdPtr;
+  __wasi_size_t AdLen;
+  uint32_t DataPtr;
+  __wasi_size_t DataLen;
+  uint32_t OutPtr;
+  __wasi_size_t OutLen;
+};
+static_assert(sizeof(WasiAeadBatchRecord) == 32);
+
+Expect<uint32_t> aeadBatch(Context &Ctx, const Runtime::CallingFrame &Frame,
+                           int32_t KeyHandle, uint32_t ItemsPtr,
+                           uint32_t ItemsLen, uint32_t ResultsPtr,
+                           bool Encrypt) {
+  auto *MemInst = Frame.getMemoryByIndex(0);
+  checkExist(MemInst);
+
+  const __wasi_size_t WasiItemsLen = ItemsLen;
+  const auto Records =
+      MemInst->getSpan<const WasiAeadBatchRecord>(ItemsPtr, WasiItemsLen);
+  checkRangeExist(Records, WasiItemsLen);
+
+  const auto Results =
+      MemInst->getSpan<__wasi_crypto_errno_e_t>(ResultsPtr, WasiItemsLen);
+  checkRangeExist(Results, WasiItemsLen);
+
+  std::vector<Symmetric::AeadBatchItem> Items;
+  Items.reserve(Records.size());
+  for (const auto &Record : Records) {
+    const auto Nonce =
+        MemInst->getSpan<const uint8_t>(Record.NoncePtr, Record.NonceLen);
+    checkRangeExist(Nonce, Record.NonceLen);
+    const auto Ad = MemInst->getSpan<const uint8_t>(Record.AdPtr, Record.AdLen);
+    checkRangeExist(Ad, Record.AdLen);
+    const auto Data =
+        MemInst->getSpan<const uint8_t>(Record.DataPtr, Record.DataLen);
+    checkRangeExist(Data, Record.DataLen);
+    const auto Out = MemInst->getSpan<uint8_t>(Record.OutPtr, Record.OutLen);
+    checkRangeExist(Out, Record.OutLen);
+    Items.push_back({Nonce, Ad, Data, Out});
+  }
+
+  if (auto Res = Ctx.symmetricAeadBatch(KeyHandle, Items, Results, Encrypt);
+      unlikely(!Res)) {
+    return Res.error();
+  }
+
+  return __WASI_CRYPTO_ERRNO_SUCCESS;
+}
+} // namespace
+
+Expect<uint32_t> AeadSealBatch::body(const Runtime::CallingFrame &Frame,
+                                     int32_t KeyHandle, uint32_t ItemsPtr,
+                                     uint32_t ItemsLen,
+                                     uint32_t /* Out */ ResultsPtr) {
+  return aeadBatch(Ctx, Frame, KeyHandle, ItemsPtr, ItemsLen, ResultsPtr,
+                   true);
+}
+
+Expect<uint32_t> AeadOpenBatch::body(const Runtime::CallingFrame &Frame,
+                                     int32_t KeyHandle, uint32_t ItemsPtr,
+                                     uint32_t ItemsLen,
+                                     uint32_t /* Out */ ResultsPtr) {
+  return aeadBatch(Ctx, Frame, KeyHandle, ItemsPtr, ItemsLen, ResultsPtr,
+                   false);
+}
+
 Expect<uint32_t> StateRatchet::body(const Runtime::CallingFrame &,
                                     int32_t StateHandle) {
   if (auto Res = Ctx.symmetricStateRatchet(StateHandle); unlikely(!Res)) {
@@ -201,6 +201,28 @@ public:
                         uint32_t RawTagLen, uint32_t /* Out */ SizePtr);
 };
 
+/// Seal a batch of AEAD records with one key. Each record in the guest memory
+/// is eight u32 values: the nonce, the additional data, the plaintext and the
+/// output as pointer and length pairs. The errno of each record is written to
+/// the u16 array at ResultsPtr.
+class AeadSealBatch : public HostFunction<AeadSealBatch> {
+public:
+  using HostFunction::HostFunction;
+  Expect<uint32_t> body(const Runtime::CallingFrame &Frame, int32_t KeyHandle,
+                        uint32_t ItemsPtr, uint32_t ItemsLen,
+                        uint32_t /* Out */ ResultsPtr);
+};
+
+/// Open a batch of AEAD records with one key, in the same layout as
+/// AeadSealBatch with the ciphertext and the tag as the data.
+class AeadOpenBatch : public HostFunction<AeadOpenBatch> {
+public:
+  using HostFunction::HostFunction;
+  Expect<uint32_t> body(const Runtime::CallingFrame &Frame, int32_t KeyHandle,
+                        uint32_t ItemsPtr, uint32_t ItemsLen,
+                        uint32_t /* Out */ ResultsPtr);
+};
+
 class StateRatchet : public HostFunction<StateRatchet> {
 public:
   using HostFunction::HostFunction;
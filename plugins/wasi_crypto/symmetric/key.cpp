@@ -4,11 +4,21 @@
 #include "symmetric/key.h"
 #include "utils/error.h"
 
+#include <type_traits>
+
 namespace WasmEdge {
 namespace Host {
 namespace WasiCrypto {
 namespace Symmetric {
 
+namespace {
+template <typename KeyType, typename = void>
+struct HasBatch : std::false_type {};
+template <typename KeyType>
+struct HasBatch<KeyType, std::void_t<decltype(&KeyType::batch)>>
+    : std::true_type {};
+} // namespace
+
 WasiCryptoExpect<KeyVariant> importKey(Algorithm Alg,
                                        Span<const uint8_t> Data) noexcept {
   return std::visit(
@@ -38,6 +48,22 @@ SecretVec keyExportData(const KeyVariant &KeyVariant) noexcept {
                     KeyVariant);
 }
 
+WasiCryptoExpect<void> keyAeadBatch(const KeyVariant &KeyVariant,
+                                    Span<const AeadBatchItem> Items,
+                                    Span<__wasi_crypto_errno_e_t> Results,
+                                    bool Encrypt) noexcept {
+  return std::visit(
+      [Items, Results,
+       Encrypt](const auto &Key) noexcept -> WasiCryptoExpect<void> {
+        if constexpr (HasBatch<std::decay_t<decltype(Key)>>::value) {
+          return Key.batch(Items, Results, Encrypt);
+        } else {
+          return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_OPERATION);
+        }
+      },
+      KeyVariant);
+}
+
 } // namespace Symmetric
 } // namespace WasiCrypto
 } // namespace Host
@@ -36,6 +36,12 @@ generateKey(Algorithm Alg, OptionalRef<const Options> OptOptions) noexcept;
 /// Get the inner represent.
 SecretVec keyExportData(const KeyVariant &Key) noexcept;
 
+/// Seal or open a batch of AEAD records. Only the AEAD keys support it.
+WasiCryptoExpect<void> keyAeadBatch(const KeyVariant &Key,
+                                    Span<const AeadBatchItem> Items,
+                                    Span<__wasi_crypto_errno_e_t> Results,
+                                    bool Encrypt) noexcept;
+
 } // namespace Symmetric
 } // namespace WasiCrypto
 } // namespace Host
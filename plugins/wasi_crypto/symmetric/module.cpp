@@ -67,6 +67,10 @@ WasiCryptoSymmetricModule::WasiCryptoSymmetricModule(
               std::make_unique<Symmetric::TagVerify>(*Ctx));
   addHostFunc("symmetric_tag_close",
               std::make_unique<Symmetric::TagClose>(*Ctx));
+  addHostFunc("symmetric_aead_seal_batch",
+              std::make_unique<Symmetric::AeadSealBatch>(*Ctx));
+  addHostFunc("symmetric_aead_open_batch",
+              std::make_unique<Symmetric::AeadOpenBatch>(*Ctx));
 }
 
 } // namespace Host
@@ -17,13 +17,16 @@
 
 #include "utils/error.h"
 
-#include <algorithm>
+#include <array>
 #include <cstddef>
-#include <limits>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
+#include <variant>
+#include <vector>
 
 namespace WasmEdge {
 namespace Host {
@@ -36,6 +39,12 @@ namespace detail {
 /// @tparam ManagerType The managed content type.
 ///
 /// HandlesManager uses a handle as the index to represent the managed contents.
+/// The handle numbers are handed out in order and wrap around at 2^24, so a
+/// closed handle is only reused after all other numbers were handed out. A
+/// lookup indexes the slot of the number directly. The slots are allocated in
+/// chunks when the numbers reach them, and a chunk is freed once all of its
+/// handles are closed. The slots never move, so references to the contents
+/// stay valid until the handle is closed.
 ///
 /// Referenced from:
 /// https://github.com/WebAssembly/wasi-crypto/blob/main/implementations/hostcalls/rust/src/handles.rs
@@ -47,15 +56,22 @@ public:
   BaseHandlesManager &operator=(BaseHandlesManager &&) noexcept = delete;
 
   /// @param TypeID A unique number
-  explicit BaseHandlesManager(uint8_t TypeID) noexcept
-      : LastHandle{TypeID, 0} {}
+  explicit BaseHandlesManager(uint8_t TypeID) noexcept : TypeID(TypeID) {}
 
   WasiCryptoExpect<void> close(HandleType Handle) noexcept {
     std::unique_lock<std::shared_mutex> Lock{Mutex};
 
-    if (!Map.erase(HandleWrapper(Handle)))
+    auto *const S = findSlot(Handle);
+    if (!S) {
       return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_CLOSED);
-
+    }
+    S->reset();
+    const uint32_t ChunkIndex = HandleWrapper(Handle).CurrentNumber / ChunkSize;
+    // The chunk of the last handed out number is still being filled.
+    if (--Chunks[ChunkIndex]->LiveCount == 0 &&
+        ChunkIndex != LastNumber / ChunkSize) {
+      Chunks[ChunkIndex].reset();
+    }
     return {};
   }
 
@@ -64,27 +80,39 @@ public:
   WasiCryptoExpect<HandleType> registerManager(Args &&...Manager) noexcept {
     std::unique_lock<std::shared_mutex> Lock{Mutex};
 
-    // Find an available handle and emplace it.
-    // Assume that LastHandle is 0x01000000, NextHandle is 0x01000001.
-    auto NextHandle = LastHandle.nextHandle();
-    while (true) {
-      // Try to emplace NextHandle.
-      if (Map.try_emplace(NextHandle, std::forward<Args>(Manager)...).second) {
-        // If this succeeds, the emplacement indicates that NextHandle does not
-        // exist in the managed content. Update the last handle and return it.
-        LastHandle = NextHandle;
-        return LastHandle.Handle;
+    // Find the next available number after the last handed out one. Number 0
+    // is never used, which keeps the handle numbers non-zero. If the numbers
+    // wrap around to the last handle again, all of them are in use.
+    for (uint32_t Number = (LastNumber + 1) & NumberMask; Number != LastNumber;
+         Number = (Number + 1) & NumberMask) {
+      if (Number == 0) {
+        continue;
+      }
+      const uint32_t ChunkIndex = Number / ChunkSize;
+      if (ChunkIndex >= Chunks.size()) {
+        Chunks.resize(ChunkIndex + 1);
+      }
+      auto &C = Chunks[ChunkIndex];
+      if (!C) {
+        C = std::make_unique<Chunk>();
+      }
+      auto &S = C->Slots[Number % ChunkSize];
+      if (S) {
+        continue;
       }
-      // Otherwise, the NextHandle map already contains content. Advance
-      // NextHandle and loop.
-      NextHandle = NextHandle.nextHandle();
-
-      // If, after looping many times (2^24 - 1), we get 0x01000000 again, the
-      // hash map is full.
-      if (NextHandle == LastHandle) {
-        return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_TOO_MANY_HANDLES);
+      S.emplace(std::forward<Args>(Manager)...);
+      ++C->LiveCount;
+
+      // Free the chunk left behind if all of its handles are closed.
+      const uint32_t LastChunkIndex = LastNumber / ChunkSize;
+      LastNumber = Number;
+      if (LastChunkIndex != ChunkIndex && Chunks[LastChunkIndex] &&
+          Chunks[LastChunkIndex]->LiveCount == 0) {
+        Chunks[LastChunkIndex].reset();
       }
+      return HandleWrapper(TypeID, Number).Handle;
     }
+    return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_TOO_MANY_HANDLES);
   }
 
 protected:
@@ -95,20 +123,6 @@ protected:
         : TypeID(TypeID), CurrentNumber(CurrentNumber) {}
     explicit HandleWrapper(HandleType Handle) : Handle(Handle) {}
 
-    HandleWrapper nextHandle() noexcept {
-      return {TypeID, static_cast<uint32_t>(CurrentNumber + 1)};
-    }
-
-    struct Hash {
-      size_t operator()(const HandleWrapper &Wrapper) const noexcept {
-        return static_cast<size_t>(Wrapper.Handle);
-      }
-    };
-
-    bool operator==(const HandleWrapper &Wrapper) const noexcept {
-      return Wrapper.Handle == this->Handle;
-    }
-
     struct {
       uint8_t TypeID : 8;
       uint32_t CurrentNumber : 24;
@@ -116,10 +130,32 @@ protected:
     HandleType Handle;
   };
 
+  static inline constexpr uint32_t NumberMask = (UINT32_C(1) << 24) - 1;
+  static inline constexpr uint32_t ChunkSize = 256;
+
+  using Slot = std::optional<ManagerType>;
+  struct Chunk {
+    std::array<Slot, ChunkSize> Slots;
+    uint32_t LiveCount = 0;
+  };
+
+  /// Find the slot of an open handle. The caller must hold the mutex.
+  Slot *findSlot(HandleType Handle) noexcept {
+    const HandleWrapper Wrapper(Handle);
+    const uint32_t Number = Wrapper.CurrentNumber;
+    const uint32_t ChunkIndex = Number / ChunkSize;
+    if (Wrapper.TypeID != TypeID || ChunkIndex >= Chunks.size() ||
+        !Chunks[ChunkIndex]) {
+      return nullptr;
+    }
+    auto &S = Chunks[ChunkIndex]->Slots[Number % ChunkSize];
+    return S ? &S : nullptr;
+  }
+
   std::shared_mutex Mutex;
-  HandleWrapper LastHandle;
-  std::unordered_map<HandleWrapper, ManagerType, typename HandleWrapper::Hash>
-      Map;
+  const uint8_t TypeID;
+  uint32_t LastNumber = 0;
+  std::vector<std::unique_ptr<Chunk>> Chunks;
 };
 
 template <typename T, typename VariantType> struct IsVariantMember;
@@ -135,10 +171,6 @@ template <typename HandleType, typename ManagerType,
               false>
 class RcHandlesManager
     : public detail::BaseHandlesManager<HandleType, ManagerType> {
-  using HandleWrapper =
-      typename detail::BaseHandlesManager<HandleType,
-                                          ManagerType>::HandleWrapper;
-
 public:
   using detail::BaseHandlesManager<HandleType, ManagerType>::BaseHandlesManager;
 
@@ -146,11 +178,11 @@ public:
   WasiCryptoExpect<ManagerType> get(HandleType Handle) noexcept {
     std::shared_lock<std::shared_mutex> Lock{this->Mutex};
 
-    auto HandleValue = this->Map.find(HandleWrapper(Handle));
-    if (HandleValue == this->Map.end()) {
+    auto *const S = this->findSlot(Handle);
+    if (!S) {
       return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_HANDLE);
     }
-    return HandleValue->second;
+    return **S;
   }
 
   /// Get as different variant type.
@@ -158,8 +190,8 @@ public:
   WasiCryptoExpect<RequiredVariantType> getAs(HandleType Handle) noexcept {
     std::shared_lock<std::shared_mutex> Lock{this->Mutex};
 
-    auto HandleValue = this->Map.find(HandleWrapper(Handle));
-    if (HandleValue == this->Map.end()) {
+    auto *const S = this->findSlot(Handle);
+    if (!S) {
       return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_HANDLE);
     }
     return std::visit(
@@ -173,7 +205,7 @@ public:
             return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_HANDLE);
           }
         },
-        HandleValue->second);
+        **S);
   }
 };
 
@@ -181,10 +213,6 @@ public:
 template <typename HandleType, typename ManagerType>
 class RefHandlesManager
     : public detail::BaseHandlesManager<HandleType, ManagerType> {
-  using HandleWrapper =
-      typename detail::BaseHandlesManager<HandleType,
-                                          ManagerType>::HandleWrapper;
-
 public:
   using detail::BaseHandlesManager<HandleType, ManagerType>::BaseHandlesManager;
 
@@ -193,11 +221,11 @@ public:
   get(HandleType Handle) noexcept {
     std::shared_lock<std::shared_mutex> Lock{this->Mutex};
 
-    auto HandleValue = this->Map.find(HandleWrapper(Handle));
-    if (HandleValue == this->Map.end()) {
+    auto *const S = this->findSlot(Handle);
+    if (!S) {
       return WasiCryptoUnexpect(__WASI_CRYPTO_ERRNO_INVALID_HANDLE);
     }
-    return HandleValue->second;
+    return **S;
   }
 };
 
@@ -5,15 +5,20 @@
 
 #include "common/span.h"
 #include "common/spdlog.h"
+#include "common/workerpool.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include <stb_image_resize2.h>
 
+#include <array>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace WasmEdge {
@@ -22,6 +27,57 @@ namespace WasmEdgeImage {
 
 namespace {
 
+/// Loaded image data, freed by `stbi_image_free`.
+template <typename T> struct StbiDeleter {
+  void operator()(T *Ptr) const noexcept { stbi_image_free(Ptr); }
+};
+template <typename T> using StbiImagePtr = std::unique_ptr<T, StbiDeleter<T>>;
+
+/// Table of the same conversion as `stbi_loadf` applies to the LDR images,
+/// which linearizes the 8-bit channels with its default gamma and scale.
+/// stb_image is C, so its `pow` takes the float operands as double.
+const std::array<float, 256> &getLdrToFloatTable() noexcept {
+  static const std::array<float, 256> Table = []() noexcept {
+    std::array<float, 256> T;
+    for (uint32_t I = 0; I < T.size(); ++I) {
+      T[I] = static_cast<float>(
+          std::pow(static_cast<double>(static_cast<float>(I) / 255.0f),
+                   static_cast<double>(2.2f)) *
+          1.0f);
+    }
+    return T;
+  }();
+  return Table;
+}
+
+/// Convert the RGB pixels from \p Src into \p Dst, swapping the R and B
+/// channels if \p Swap. The pixels are independent, which lets the compilers
+/// vectorize the loop. \p Src and \p Dst may be the same buffer.
+template <bool Swap, typename TIn, typename TOut, typename ConvT>
+void convertPixels(const TIn *Src, TOut *Dst, uint64_t NumPixels,
+                   ConvT &&Conv) noexcept {
+  for (uint64_t I = 0; I < NumPixels; ++I) {
+    const TOut C0 = Conv(Src[I * 3]);
+    const TOut C1 = Conv(Src[I * 3 + 1]);
+    const TOut C2 = Conv(Src[I * 3 + 2]);
+    Dst[I * 3] = Swap ? C2 : C0;
+    Dst[I * 3 + 1] = C1;
+    Dst[I * 3 + 2] = Swap ? C0 : C2;
+  }
+}
+
+template <typename TIn, typename TOut, typename ConvT>
+void convertPixels(const TIn *Src, TOut *Dst, uint64_t NumPixels, bool Swap,
+                   ConvT &&Conv) noexcept {
+  if (Swap) {
+    convertPixels<true>(Src, Dst, NumPixels, std::forward<ConvT>(Conv));
+  } else {
+    convertPixels<false>(Src, Dst, NumPixels, std::forward<ConvT>(Conv));
+  }
+}
+
+constexpr auto Identity = [](auto V) noexcept { return V; };
+
 bool decodeImgToSize(Span<const uint8_t> Buf, uint32_t W, uint32_t H,
                      DataType OutType, Span<uint8_t> DstBuf) noexcept {
   // Specify the target data format.
@@ -68,62 +124,91 @@ bool decodeImgToSize(Span<const uint8_t> Buf, uint32_t W, uint32_t H,
                   DstBuf.size(), W, H, BytesPerPixel);
     return false;
   }
+  uint8_t *DstU8 = DstBuf.data();
+  float *DstF32 = reinterpret_cast<float *>(DstBuf.data());
+  const int BufLen = static_cast<int>(Buf.size());
+  const int OW = static_cast<int>(W);
+  const int OH = static_cast<int>(H);
 
-  // Load and decode the image from buffer.
-  union RawImagePtr {
-    uint8_t *U8;
-    float *F32;
-  };
-  RawImagePtr RawImg;
-  RawImg.U8 = nullptr;
+  // Load and decode the image from buffer. Only the HDR images are decoded
+  // in float. The float output of the LDR images is converted from the 8-bit
+  // decoding, instead of decoding the whole image again.
   int IW, IH, IC;
-  if (IsU8) {
-    RawImg.U8 = stbi_load_from_memory(Buf.data(), static_cast<int>(Buf.size()),
-                                      &IW, &IH, &IC, 3);
-  } else {
-    RawImg.F32 = stbi_loadf_from_memory(
-        Buf.data(), static_cast<int>(Buf.size()), &IW, &IH, &IC, 3);
+  if (!IsU8 && stbi_is_hdr_from_memory(Buf.data(), BufLen)) {
+    StbiImagePtr<float> RawImg(
+        stbi_loadf_from_memory(Buf.data(), BufLen, &IW, &IH, &IC, 3));
+    if (RawImg == nullptr) {
+      spdlog::error("[WasmEdge-Image] Load image failed."sv);
+      return false;
+    }
+    if (IW == OW && IH == OH) {
+      convertPixels(RawImg.get(), DstF32, NumPixels, !IsRGB, Identity);
+      return true;
+    }
+    if (unlikely(stbir_resize_float_linear(RawImg.get(), IW, IH, 0, DstF32,
+                                           OW, OH, 0, STBIR_RGB) == nullptr)) {
+      spdlog::error("[WasmEdge-Image] Resize image failed."sv);
+      return false;
+    }
+    if (!IsRGB) {
+      convertPixels<true>(DstF32, DstF32, NumPixels, Identity);
+    }
+    return true;
   }
-  if (RawImg.U8 == nullptr) {
+
+  StbiImagePtr<uint8_t> RawImg(
+      stbi_load_from_memory(Buf.data(), BufLen, &IW, &IH, &IC, 3));
+  if (RawImg == nullptr) {
     spdlog::error("[WasmEdge-Image] Load image failed."sv);
     return false;
   }
+  const uint64_t RawPixels = static_cast<uint64_t>(IW) * IH;
 
-  // Resize.
-  bool Resized = false;
   if (IsU8) {
-    Resized = stbir_resize_uint8_linear(
-                  RawImg.U8, IW, IH, 0, DstBuf.data(), static_cast<int>(W),
-                  static_cast<int>(H), 0, STBIR_RGB) != nullptr;
-  } else {
-    Resized =
-        stbir_resize_float_linear(
-            RawImg.F32, IW, IH, 0, reinterpret_cast<float *>(DstBuf.data()),
-            static_cast<int>(W), static_cast<int>(H), 0, STBIR_RGB) != nullptr;
+    // Without resizing, swizzle the decoded image straight into the output.
+    if (IW == OW && IH == OH) {
+      convertPixels(RawImg.get(), DstU8, NumPixels, !IsRGB, Identity);
+      return true;
+    }
+    if (unlikely(stbir_resize_uint8_linear(RawImg.get(), IW, IH, 0, DstU8, OW,
+                                           OH, 0, STBIR_RGB) == nullptr)) {
+      spdlog::error("[WasmEdge-Image] Resize image failed."sv);
+      return false;
+    }
+    if (!IsRGB) {
+      convertPixels<true>(DstU8, DstU8, NumPixels, Identity);
+    }
+    return true;
+  }
+
+  // The float channels are converted by table lookups, swizzled in the same
+  // pass, and then resized straight into the output.
+  const auto &Table = getLdrToFloatTable();
+  const auto ToFloat = [&Table](uint8_t V) noexcept { return Table[V]; };
+  if (IW == OW && IH == OH) {
+    convertPixels(RawImg.get(), DstF32, NumPixels, !IsRGB, ToFloat);
+    return true;
   }
-  stbi_image_free(RawImg.U8);
-  if (unlikely(!Resized)) {
+  std::vector<float> FloatImg(RawPixels * 3);
+  convertPixels(RawImg.get(), FloatImg.data(), RawPixels, !IsRGB, ToFloat);
+  RawImg.reset();
+  if (unlikely(stbir_resize_float_linear(FloatImg.data(), IW, IH, 0, DstF32,
+                                         OW, OH, 0, STBIR_RGB) == nullptr)) {
     spdlog::error("[WasmEdge-Image] Resize image failed."sv);
     return false;
   }
-
-  // Handle BGR case.
-  if (!IsRGB) {
-    if (IsU8) {
-      for (uint64_t I = 0; I < NumPixels; I++) {
-        std::swap(DstBuf[I * 3], DstBuf[I * 3 + 2]);
-      }
-    } else {
-      auto F32DstBuf = Span<float>(reinterpret_cast<float *>(DstBuf.data()),
-                                   DstBuf.size() / sizeof(float));
-      for (uint64_t I = 0; I < NumPixels; I++) {
-        std::swap(F32DstBuf[I * 3], F32DstBuf[I * 3 + 2]);
-      }
-    }
-  }
   return true;
 }
 
+/// Layout of a batched image record in the guest memory.
+struct ImageBatchRecord {
+  uint32_t InImgBufPtr;
+  uint32_t InImgBufLen;
+  uint32_t OutBufPtr;
+  uint32_t OutBufLen;
+};
+static_assert(sizeof(ImageBatchRecord) == 16);
+
 #define MEMINST_CHECK(Out, CallFrame, Index)                                   \
   auto *Out = CallFrame.getMemoryByIndex(Index);                               \
   if (unlikely(Out == nullptr)) {                                              \
@@ -209,6 +294,48 @@ Expect<uint32_t> LoadImage::body(const Runtime::CallingFrame &Frame,
   return static_cast<uint32_t>(ErrNo::Success);
 }
 
+Expect<uint32_t> LoadImageBatch::body(const Runtime::CallingFrame &Frame,
+                                      uint32_t ItemsPtr, uint32_t ItemsLen,
+                                      uint32_t OutImgW, uint32_t OutImgH,
+                                      uint32_t OutType, uint32_t ResultsPtr) {
+  // Check memory instance from module.
+  MEMINST_CHECK(MemInst, Frame, 0)
+
+  // Check the batch records and the result array.
+  MEM_SPAN_CHECK(Records, MemInst, const ImageBatchRecord, ItemsPtr, ItemsLen,
+                 "Failed when accessing the image batch records memory."sv)
+  MEM_SPAN_CHECK(Results, MemInst, uint32_t, ResultsPtr, ItemsLen,
+                 "Failed when accessing the image batch results memory."sv)
+
+  // Resolve all the buffers before decoding, so the workers only touch the
+  // checked spans.
+  struct Item {
+    Span<const uint8_t> In;
+    Span<uint8_t> Out;
+  };
+  std::vector<Item> Items(Records.size());
+  for (size_t I = 0; I < Records.size(); ++I) {
+    const auto &Record = Records[I];
+    MEM_SPAN_CHECK(In, MemInst, const uint8_t, Record.InImgBufPtr,
+                   Record.InImgBufLen,
+                   "Failed when accessing the input image buffer memory."sv)
+    MEM_SPAN_CHECK(Out, MemInst, uint8_t, Record.OutBufPtr, Record.OutBufLen,
+                   "Failed when accessing the output image data buffer "sv
+                   "memory."sv)
+    Items[I] = {In, Out};
+  }
+
+  // The images are independent, decode them on the shared worker threads.
+  WorkerPool::shared().parallelFor(Items.size(), [&](size_t I) noexcept {
+    Results[I] = static_cast<uint32_t>(
+        decodeImgToSize(Items[I].In, OutImgW, OutImgH,
+                        static_cast<DataType>(OutType), Items[I].Out)
+            ? ErrNo::Success
+            : ErrNo::Fail);
+  });
+  return static_cast<uint32_t>(ErrNo::Success);
+}
+
 } // namespace WasmEdgeImage
 } // namespace Host
 } // namespace WasmEdge
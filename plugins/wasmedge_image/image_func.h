@@ -38,6 +38,17 @@ public:
                         uint32_t OutBufPtr, uint32_t OutBufLen);
 };
 
+/// Decode a batch of images into the same size and data type. The records
+/// are `{InImgBufPtr, InImgBufLen, OutBufPtr, OutBufLen}` of 4 `u32`, and the
+/// error number of every image is written into the `u32` results array.
+class LoadImageBatch : public Func<LoadImageBatch> {
+public:
+  LoadImageBatch(ImgEnv &HostEnv) : Func(HostEnv) {}
+  Expect<uint32_t> body(const Runtime::CallingFrame &Frame, uint32_t ItemsPtr,
+                        uint32_t ItemsLen, uint32_t OutImgW, uint32_t OutImgH,
+                        uint32_t OutType, uint32_t ResultsPtr);
+};
+
 } // namespace WasmEdgeImage
 } // namespace Host
 } // namespace WasmEdge
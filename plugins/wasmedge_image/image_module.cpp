@@ -14,6 +14,8 @@ WasmEdgeImageModule::WasmEdgeImageModule()
   addHostFunc("load_jpg", std::make_unique<WasmEdgeImage::LoadJPG>(Env));
   addHostFunc("load_png", std::make_unique<WasmEdgeImage::LoadPNG>(Env));
   addHostFunc("load_image", std::make_unique<WasmEdgeImage::LoadImage>(Env));
+  addHostFunc("load_image_batch",
+              std::make_unique<WasmEdgeImage::LoadImageBatch>(Env));
 }
 
 } // namespace Host
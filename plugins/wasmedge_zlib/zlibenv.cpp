@@ -4,9 +4,45 @@
 #include "zlibenv.h"
 #include "zlibmodule.h"
 
+#include <cstddef>
+#include <cstdlib>
+
 namespace WasmEdge {
 namespace Host {
 
+namespace {
+/// Header of an allocation of the zlib internal state, which records its size
+/// for the release.
+struct alignas(std::max_align_t) AllocHeader {
+  uint64_t Bytes;
+};
+} // namespace
+
+voidpf WasmEdgeZlibEnvironment::allocate(voidpf Opaque, uInt Items,
+                                         uInt Size) noexcept {
+  const auto &Env = *static_cast<WasmEdgeZlibEnvironment *>(Opaque);
+  const uint64_t Bytes = static_cast<uint64_t>(Items) * Size;
+  if (!Env.Mod.chargeMemory(MemoryCategory::Host, Bytes)) {
+    return Z_NULL;
+  }
+  auto *Header = static_cast<AllocHeader *>(
+      std::malloc(sizeof(AllocHeader) + static_cast<size_t>(Bytes)));
+  if (Header == nullptr) {
+    Env.Mod.releaseMemory(MemoryCategory::Host, Bytes);
+    return Z_NULL;
+  }
+  Header->Bytes = Bytes;
+  return Header + 1;
+}
+
+void WasmEdgeZlibEnvironment::deallocate(voidpf Opaque,
+                                         voidpf Address) noexcept {
+  const auto &Env = *static_cast<WasmEdgeZlibEnvironment *>(Opaque);
+  auto *Header = static_cast<AllocHeader *>(Address) - 1;
+  Env.Mod.releaseMemory(MemoryCategory::Host, Header->Bytes);
+  std::free(Header);
+}
+
 namespace {
 
 Runtime::Instance::ModuleInstance *
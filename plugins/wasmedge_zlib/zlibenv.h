@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include "common/errcode.h"
 #include "plugin/plugin.h"
+#include "runtime/instance/module.h"
 
 #include <cstdint>
 #include <memory>
@@ -82,14 +84,56 @@ class WasmEdgeZlibEnvironment {
 public:
   using GZFile = std::remove_pointer_t<gzFile>;
 
+  WasmEdgeZlibEnvironment(const Runtime::Instance::ModuleInstance &Mod) noexcept
+      : Mod(Mod) {}
+
+  /// Set the allocator of a host stream, which charges the internal state of
+  /// the stream to the memory account of the module instance.
+  void setAllocator(z_stream &ZStream) noexcept {
+    ZStream.zalloc = allocate;
+    ZStream.zfree = deallocate;
+    ZStream.opaque = this;
+  }
+
   struct GZStore {
     uint32_t WasmGZHeaderOffset;
     std::unique_ptr<gz_header> HostGZHeader;
   };
 
+  /// Look up the host stream of a guest z_stream. Guests usually drive a
+  /// single stream through a deflate/inflate loop, so the last hit is cached
+  /// to skip the hash lookup.
+  z_stream *findZStream(uint32_t ZStreamPtr) noexcept {
+    if (likely(CachedZStream != nullptr && CachedZStreamPtr == ZStreamPtr)) {
+      return CachedZStream;
+    }
+    const auto It = ZStreamMap.find(ZStreamPtr);
+    if (It == ZStreamMap.end()) {
+      return nullptr;
+    }
+    CachedZStreamPtr = ZStreamPtr;
+    CachedZStream = It->second.get();
+    return CachedZStream;
+  }
+
+  void eraseZStream(uint32_t ZStreamPtr) noexcept {
+    if (CachedZStreamPtr == ZStreamPtr) {
+      CachedZStream = nullptr;
+    }
+    ZStreamMap.erase(ZStreamPtr);
+  }
+
   std::unordered_map<uint32_t, std::unique_ptr<z_stream>> ZStreamMap;
   std::map<uint32_t, std::unique_ptr<GZFile>, std::greater<uint32_t>> GZFileMap;
   std::unordered_map<uint32_t, GZStore> GZHeaderMap;
+
+private:
+  static voidpf allocate(voidpf Opaque, uInt Items, uInt Size) noexcept;
+  static void deallocate(voidpf Opaque, voidpf Address) noexcept;
+
+  const Runtime::Instance::ModuleInstance &Mod;
+  uint32_t CachedZStreamPtr = 0;
+  z_stream *CachedZStream = nullptr;
 };
 
 } // namespace Host
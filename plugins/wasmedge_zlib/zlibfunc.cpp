@@ -3,7 +3,13 @@
 
 #include "zlibfunc.h"
 
+#include "common/workerpool.h"
+
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <optional>
+#include <vector>
 
 namespace WasmEdge {
 namespace Host {
@@ -22,6 +28,144 @@ constexpr bool CheckSize(int32_t StreamSize) {
 
 static constexpr uint32_t WasmGZFileStart = sizeof(gzFile);
 
+namespace {
+
+/// One-shot compression of inputs at least this large is split across
+/// threads.
+constexpr uLong ParallelCompressThreshold = 4 * 1024 * 1024;
+/// Input size of a single compression job.
+constexpr uLong ParallelBlockSize = 128 * 1024;
+/// Every block is primed with the tail of the previous one, so the ratio is
+/// close to the serial one.
+constexpr uLong ParallelDictSize = 32 * 1024;
+
+/// Compress a large input into a zlib stream on the shared worker threads,
+/// pigz style: the input is cut into blocks which are raw-deflated
+/// independently, every block but the last ends on a byte boundary by a sync
+/// flush, and the block checksums are merged by `adler32_combine`. Returns
+/// `std::nullopt` if the serial path should be used instead, which is also
+/// the case when the output does not fit, so the `Z_BUF_ERROR` semantics stay
+/// with zlib.
+std::optional<int> parallelCompress(Bytef *Dest, uLongf *DestLen,
+                                    const Bytef *Source, uLong SourceLen,
+                                    int Level) {
+  if (SourceLen < ParallelCompressThreshold || Level == 0 ||
+      Level < Z_DEFAULT_COMPRESSION || Level > 9) {
+    return std::nullopt;
+  }
+  auto &Pool = WorkerPool::shared();
+  if (Pool.getThreadCount() == 0) {
+    return std::nullopt;
+  }
+  const size_t BlockCount =
+      (SourceLen + ParallelBlockSize - 1) / ParallelBlockSize;
+
+  // The output of every block is bounded by `compressBound`, which is larger
+  // than the raw deflate bound. The sync flush marker and bit padding may
+  // exceed it by a few bytes. All the buffers are allocated here, so the
+  // workers do not allocate.
+  const uLong BlockCapacity = compressBound(ParallelBlockSize) + 16;
+  struct Block {
+    uLong Size;
+    uLong Adler;
+  };
+  std::vector<Bytef> Buffer(BlockCount * BlockCapacity);
+  std::vector<Block> Blocks(BlockCount);
+  std::atomic<bool> Failed = false;
+
+  Pool.parallelFor(BlockCount, [&](size_t I) noexcept {
+    if (Failed.load(std::memory_order_relaxed)) {
+      return;
+    }
+    const uLong Begin = I * ParallelBlockSize;
+    const uLong Len = std::min(ParallelBlockSize, SourceLen - Begin);
+    const bool Last = I + 1 == BlockCount;
+    auto &B = Blocks[I];
+    B.Adler =
+        adler32(adler32(0, Z_NULL, 0), Source + Begin, static_cast<uInt>(Len));
+
+    z_stream Strm{};
+    if (deflateInit2(&Strm, Level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      Failed = true;
+      return;
+    }
+    if (Begin > 0) {
+      const uLong DictLen = std::min(ParallelDictSize, Begin);
+      deflateSetDictionary(&Strm, Source + Begin - DictLen,
+                           static_cast<uInt>(DictLen));
+    }
+    Strm.next_in = const_cast<Bytef *>(Source + Begin);
+    Strm.avail_in = static_cast<uInt>(Len);
+    Strm.next_out = Buffer.data() + I * BlockCapacity;
+    Strm.avail_out = static_cast<uInt>(BlockCapacity);
+    const int ZRes = deflate(&Strm, Last ? Z_FINISH : Z_SYNC_FLUSH);
+    if (ZRes != (Last ? Z_STREAM_END : Z_OK) || Strm.avail_in != 0 ||
+        Strm.avail_out == 0) {
+      Failed = true;
+    }
+    B.Size = Strm.total_out;
+    deflateEnd(&Strm);
+  });
+  if (Failed) {
+    return std::nullopt;
+  }
+
+  // Same header as `deflateInit` writes for a 32K window.
+  uint32_t LevelFlags;
+  if (Level == 1) {
+    LevelFlags = 0;
+  } else if (Level > 1 && Level < 6) {
+    LevelFlags = 1;
+  } else if (Level == 6 || Level == Z_DEFAULT_COMPRESSION) {
+    LevelFlags = 2;
+  } else {
+    LevelFlags = 3;
+  }
+  uint32_t Header = (Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8;
+  Header |= LevelFlags << 6;
+  Header += 31 - Header % 31;
+
+  uLong Total = 2 + 4;
+  for (const auto &B : Blocks) {
+    Total += B.Size;
+  }
+  if (Total > *DestLen) {
+    return std::nullopt;
+  }
+
+  Bytef *Out = Dest;
+  *Out++ = static_cast<Bytef>(Header >> 8);
+  *Out++ = static_cast<Bytef>(Header);
+  uLong Adler = Blocks[0].Adler;
+  for (size_t I = 0; I < BlockCount; ++I) {
+    const Bytef *BlockOut = Buffer.data() + I * BlockCapacity;
+    Out = std::copy(BlockOut, BlockOut + Blocks[I].Size, Out);
+    if (I > 0) {
+      const uLong Len =
+          std::min(ParallelBlockSize, SourceLen - I * ParallelBlockSize);
+      Adler = adler32_combine(Adler, Blocks[I].Adler,
+                              static_cast<z_off_t>(Len));
+    }
+  }
+  *Out++ = static_cast<Bytef>(Adler >> 24);
+  *Out++ = static_cast<Bytef>(Adler >> 16);
+  *Out++ = static_cast<Bytef>(Adler >> 8);
+  *Out++ = static_cast<Bytef>(Adler);
+  *DestLen = Total;
+  return Z_OK;
+}
+
+int oneShotCompress(Bytef *Dest, uLongf *DestLen, const Bytef *Source,
+                    uLong SourceLen, int Level) {
+  if (auto Res = parallelCompress(Dest, DestLen, Source, SourceLen, Level)) {
+    return *Res;
+  }
+  return compress2(Dest, DestLen, Source, SourceLen, Level);
+}
+
+} // namespace
+
 template <typename T>
 auto SyncRun(const std::string_view &Msg, WasmEdgeZlibEnvironment &Env,
              uint32_t ZStreamPtr, const Runtime::CallingFrame &Frame,
@@ -30,15 +174,19 @@ auto SyncRun(const std::string_view &Msg, WasmEdgeZlibEnvironment &Env,
   MEMINST_CHECK(MemInst, Frame, 0)
   WasmZStream *ModuleZStream = MemInst->getPointer<WasmZStream *>(ZStreamPtr);
 
-  const auto HostZStreamIt = Env.ZStreamMap.find(ZStreamPtr);
-  if (HostZStreamIt == Env.ZStreamMap.end()) {
+  auto *HostZStream = Env.findZStream(ZStreamPtr);
+  if (unlikely(HostZStream == nullptr)) {
     spdlog::error("[WasmEdge-Zlib] [{}-SyncRun] "sv
                   "Invalid ZStreamPtr received."sv,
                   Msg);
     return Unexpect(ErrCode::Value::HostFuncError);
   }
-  auto HostZStream = HostZStreamIt->second.get();
-  const auto GZHeaderStoreIt = Env.GZHeaderMap.find(ZStreamPtr);
+  // The stream buffers are used in place in the guest memory, only the
+  // bookkeeping fields are synchronized. Most streams have no gzip header, so
+  // skip the second lookup when none is registered.
+  const auto GZHeaderStoreIt = Env.GZHeaderMap.empty()
+                                   ? Env.GZHeaderMap.end()
+                                   : Env.GZHeaderMap.find(ZStreamPtr);
 
   HostZStream->next_in =
       MemInst->getPointer<unsigned char *>(ModuleZStream->NextIn);
@@ -150,21 +298,17 @@ WasmEdgeZlibDeflateInit::body(const Runtime::CallingFrame &Frame,
                               uint32_t ZStreamPtr, int32_t Level) {
 
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes = SyncRun(
       "WasmEdgeZlibDeflateInit", Env, ZStreamPtr, Frame,
       [&](z_stream *HostZStream) { return deflateInit(HostZStream, Level); });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -185,7 +329,7 @@ Expect<int32_t> WasmEdgeZlibDeflateEnd::body(const Runtime::CallingFrame &Frame,
               [&](z_stream *HostZStream) { return deflateEnd(HostZStream); });
 
   if (ZRes == Z_OK)
-    Env.ZStreamMap.erase(ZStreamPtr);
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -195,21 +339,17 @@ WasmEdgeZlibInflateInit::body(const Runtime::CallingFrame &Frame,
                               uint32_t ZStreamPtr) {
 
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateInit", Env, ZStreamPtr, Frame,
               [&](z_stream *HostZStream) { return inflateInit(HostZStream); });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -229,7 +369,7 @@ Expect<int32_t> WasmEdgeZlibInflateEnd::body(const Runtime::CallingFrame &Frame,
       SyncRun("WasmEdgeZlibInflateEnd", Env, ZStreamPtr, Frame,
               [&](z_stream *HostZStream) { return inflateEnd(HostZStream); });
 
-  Env.ZStreamMap.erase(ZStreamPtr);
+  Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -239,14 +379,10 @@ Expect<int32_t> WasmEdgeZlibDeflateInit2::body(
     int32_t Method, int32_t WindowBits, int32_t MemLevel, int32_t Strategy) {
 
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibDeflateInit2", Env, ZStreamPtr, Frame,
@@ -255,8 +391,8 @@ Expect<int32_t> WasmEdgeZlibDeflateInit2::body(
                                     MemLevel, Strategy);
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -310,14 +446,16 @@ WasmEdgeZlibDeflateCopy::body(const Runtime::CallingFrame &Frame,
 
   auto NewZStream = std::make_unique<z_stream>();
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(DestPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(DestPtr, std::move(NewZStream)).second;
 
   const auto Res = SyncRun("WasmEdgeZlibDeflateCopy", Env, DestPtr, Frame,
                            [&](z_stream *) { return 0; });
-  if (!Res.has_value())
+  if (!Res.has_value()) {
+    if (Inserted)
+      Env.eraseZStream(DestPtr);
     return Res;
+  }
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibDeflateCopy", Env, DestPtr, Frame,
@@ -325,8 +463,8 @@ WasmEdgeZlibDeflateCopy::body(const Runtime::CallingFrame &Frame,
                 return deflateCopy(DestZStream, SourceZStreamIt->second.get());
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(DestPtr);
 
   return ZRes;
 }
@@ -406,13 +544,10 @@ WasmEdgeZlibDeflateSetHeader::body(const Runtime::CallingFrame &Frame,
   auto HostGZHeader = std::make_unique<gz_header>();
   auto HostGZHeaderPtr = HostGZHeader.get();
 
-  auto It = Env.GZHeaderMap
-                .emplace(std::pair<uint32_t, WasmEdgeZlibEnvironment::GZStore>{
-                    ZStreamPtr,
-                    WasmEdgeZlibEnvironment::GZStore{
-                        .WasmGZHeaderOffset = HeadPtr,
-                        .HostGZHeader = std::move(HostGZHeader)}})
-                .second;
+  Env.GZHeaderMap.emplace(
+      ZStreamPtr, WasmEdgeZlibEnvironment::GZStore{
+                      .WasmGZHeaderOffset = HeadPtr,
+                      .HostGZHeader = std::move(HostGZHeader)});
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibDeflateSetHeader", Env, ZStreamPtr, Frame,
@@ -421,7 +556,7 @@ WasmEdgeZlibDeflateSetHeader::body(const Runtime::CallingFrame &Frame,
               });
 
   if (ZRes != Z_OK)
-    Env.GZHeaderMap.erase(It);
+    Env.GZHeaderMap.erase(ZStreamPtr);
 
   return ZRes;
 }
@@ -430,22 +565,18 @@ Expect<int32_t>
 WasmEdgeZlibInflateInit2::body(const Runtime::CallingFrame &Frame,
                                uint32_t ZStreamPtr, int32_t WindowBits) {
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes = SyncRun("WasmEdgeZlibInflateInit2", Env, ZStreamPtr, Frame,
                             [&](z_stream *HostZStream) {
                               return inflateInit2(HostZStream, WindowBits);
                             });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -502,14 +633,16 @@ WasmEdgeZlibInflateCopy::body(const Runtime::CallingFrame &Frame,
 
   auto NewZStream = std::make_unique<z_stream>();
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(DestPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(DestPtr, std::move(NewZStream)).second;
 
   const auto Res = SyncRun("WasmEdgeZlibInflateCopy", Env, DestPtr, Frame,
                            [&](z_stream *) { return 0; });
-  if (!Res.has_value())
+  if (!Res.has_value()) {
+    if (Inserted)
+      Env.eraseZStream(DestPtr);
     return Res;
+  }
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateCopy", Env, DestPtr, Frame,
@@ -517,8 +650,8 @@ WasmEdgeZlibInflateCopy::body(const Runtime::CallingFrame &Frame,
                 return inflateCopy(DestZStream, SourceZStreamIt->second.get());
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(DestPtr);
 
   return ZRes;
 }
@@ -569,13 +702,10 @@ WasmEdgeZlibInflateGetHeader::body(const Runtime::CallingFrame &Frame,
   auto HostGZHeader = std::make_unique<gz_header>();
   auto HostGZHeaderPtr = HostGZHeader.get();
 
-  auto It = Env.GZHeaderMap
-                .emplace(std::pair<uint32_t, WasmEdgeZlibEnvironment::GZStore>{
-                    ZStreamPtr,
-                    WasmEdgeZlibEnvironment::GZStore{
-                        .WasmGZHeaderOffset = HeadPtr,
-                        .HostGZHeader = std::move(HostGZHeader)}})
-                .second;
+  Env.GZHeaderMap.emplace(
+      ZStreamPtr, WasmEdgeZlibEnvironment::GZStore{
+                      .WasmGZHeaderOffset = HeadPtr,
+                      .HostGZHeader = std::move(HostGZHeader)});
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateGetHeader", Env, ZStreamPtr, Frame,
@@ -584,7 +714,7 @@ WasmEdgeZlibInflateGetHeader::body(const Runtime::CallingFrame &Frame,
               });
 
   if (ZRes != Z_OK)
-    Env.GZHeaderMap.erase(It);
+    Env.GZHeaderMap.erase(ZStreamPtr);
 
   return ZRes;
 }
@@ -594,18 +724,14 @@ WasmEdgeZlibInflateBackInit::body(const Runtime::CallingFrame &Frame,
                                   uint32_t ZStreamPtr, int32_t WindowBits,
                                   uint32_t WindowPtr) {
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
   MEMINST_CHECK(MemInst, Frame, 0)
 
   auto *Window = MemInst->getPointer<unsigned char *>(WindowPtr);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateBackInit", Env, ZStreamPtr, Frame,
@@ -613,8 +739,8 @@ WasmEdgeZlibInflateBackInit::body(const Runtime::CallingFrame &Frame,
                 return inflateBackInit(HostZStream, WindowBits, Window);
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -627,7 +753,7 @@ WasmEdgeZlibInflateBackEnd::body(const Runtime::CallingFrame &Frame,
       "WasmEdgeZlibInflateBackEnd", Env, ZStreamPtr, Frame,
       [&](z_stream *HostZStream) { return inflateBackEnd(HostZStream); });
 
-  Env.ZStreamMap.erase(ZStreamPtr);
+  Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -650,7 +776,8 @@ Expect<int32_t> WasmEdgeZlibCompress::body(const Runtime::CallingFrame &Frame,
 
   unsigned long HostDestLen;
   HostDestLen = *DestLen;
-  const auto ZRes = compress(Dest, &HostDestLen, Source, SourceLen);
+  const auto ZRes = oneShotCompress(Dest, &HostDestLen, Source, SourceLen,
+                                    Z_DEFAULT_COMPRESSION);
   *DestLen = HostDestLen;
 
   return ZRes;
@@ -669,7 +796,8 @@ Expect<int32_t> WasmEdgeZlibCompress2::body(const Runtime::CallingFrame &Frame,
 
   unsigned long HostDestLen;
   HostDestLen = *DestLen;
-  const auto ZRes = compress2(Dest, &HostDestLen, Source, SourceLen, Level);
+  const auto ZRes =
+      oneShotCompress(Dest, &HostDestLen, Source, SourceLen, Level);
   *DestLen = HostDestLen;
 
   return ZRes;
@@ -1113,16 +1241,10 @@ WasmEdgeZlibDeflateInit_::body(const Runtime::CallingFrame &Frame,
 
   const auto *WasmZlibVersion = MemInst->getPointer<const char *>(VersionPtr);
   auto NewZStream = std::make_unique<z_stream>();
+  Env.setAllocator(*NewZStream);
 
-  // ignore wasm custom allocators
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  // Ignore opaque because zmalloc and zfree are ignored.
-  NewZStream->opaque = Z_NULL;
-
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibDeflateInit_", Env, ZStreamPtr, Frame,
@@ -1131,8 +1253,8 @@ WasmEdgeZlibDeflateInit_::body(const Runtime::CallingFrame &Frame,
                                     sizeof(z_stream));
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -1148,16 +1270,10 @@ WasmEdgeZlibInflateInit_::body(const Runtime::CallingFrame &Frame,
 
   const auto *WasmZlibVersion = MemInst->getPointer<const char *>(VersionPtr);
   auto NewZStream = std::make_unique<z_stream>();
+  Env.setAllocator(*NewZStream);
 
-  // ignore wasm custom allocators
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  // Ignore opaque because zmalloc and zfree are ignored.
-  NewZStream->opaque = Z_NULL;
-
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes = SyncRun("WasmEdgeZlibInflateInit_", Env, ZStreamPtr, Frame,
                             [&](z_stream *HostZStream) {
@@ -1165,8 +1281,8 @@ WasmEdgeZlibInflateInit_::body(const Runtime::CallingFrame &Frame,
                                                   sizeof(z_stream));
                             });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -1182,14 +1298,10 @@ Expect<int32_t> WasmEdgeZlibDeflateInit2_::body(
 
   const auto *WasmZlibVersion = MemInst->getPointer<const char *>(VersionPtr);
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes = SyncRun(
       "WasmEdgeZlibDeflateInit2_", Env, ZStreamPtr, Frame,
@@ -1198,8 +1310,8 @@ Expect<int32_t> WasmEdgeZlibDeflateInit2_::body(
                              Strategy, WasmZlibVersion, sizeof(z_stream));
       });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -1215,14 +1327,10 @@ WasmEdgeZlibInflateInit2_::body(const Runtime::CallingFrame &Frame,
 
   const auto *WasmZlibVersion = MemInst->getPointer<const char *>(VersionPtr);
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateInit2_", Env, ZStreamPtr, Frame,
@@ -1231,8 +1339,8 @@ WasmEdgeZlibInflateInit2_::body(const Runtime::CallingFrame &Frame,
                                      sizeof(z_stream));
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -1248,14 +1356,10 @@ Expect<int32_t> WasmEdgeZlibInflateBackInit_::body(
   const auto *WasmZlibVersion = MemInst->getPointer<const char *>(VersionPtr);
   auto *Window = MemInst->getPointer<unsigned char *>(WindowPtr);
   auto NewZStream = std::make_unique<z_stream>();
-  NewZStream->zalloc = Z_NULL;
-  NewZStream->zfree = Z_NULL;
-  NewZStream->opaque =
-      Z_NULL; // ignore opaque since zmalloc and zfree was ignored
+  Env.setAllocator(*NewZStream);
 
-  auto It =
-      Env.ZStreamMap.emplace(std::make_pair(ZStreamPtr, std::move(NewZStream)))
-          .second;
+  const bool Inserted =
+      Env.ZStreamMap.emplace(ZStreamPtr, std::move(NewZStream)).second;
 
   const auto ZRes =
       SyncRun("WasmEdgeZlibInflateBackInit_", Env, ZStreamPtr, Frame,
@@ -1264,8 +1368,8 @@ Expect<int32_t> WasmEdgeZlibInflateBackInit_::body(
                                         WasmZlibVersion, sizeof(z_stream));
               });
 
-  if (ZRes != Z_OK)
-    Env.ZStreamMap.erase(It);
+  if (ZRes != Z_OK && Inserted)
+    Env.eraseZStream(ZStreamPtr);
 
   return ZRes;
 }
@@ -8,7 +8,8 @@ namespace WasmEdge {
 namespace Host {
 
 /// Register your functions in module.
-WasmEdgeZlibModule::WasmEdgeZlibModule() : ModuleInstance("wasmedge_zlib") {
+WasmEdgeZlibModule::WasmEdgeZlibModule()
+    : ModuleInstance("wasmedge_zlib"), Env(*this) {
   addHostFunc("deflateInit", std::make_unique<WasmEdgeZlibDeflateInit>(Env));
   addHostFunc("deflate", std::make_unique<WasmEdgeZlibDeflate>(Env));
   addHostFunc("deflateEnd", std::make_unique<WasmEdgeZlibDeflateEnd>(Env));
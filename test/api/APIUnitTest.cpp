@@ -769,6 +769,14 @@ TEST(APICoreTest, Configure) {
   EXPECT_EQ(WasmEdge_ConfigureGetRunMode(Conf), WasmEdge_RunMode_Interpreter);
   // Reset to a deterministic mode for the rest of the test.
   WasmEdge_ConfigureSetRunMode(Conf, WasmEdge_RunMode_Interpreter);
+  // The JIT cache directory must be an absolute path.
+  EXPECT_TRUE(isErrMatch(WasmEdge_ErrCode_WrongVMWorkflow,
+                         WasmEdge_ConfigureSetJITCacheDir(ConfNull, "/tmp")));
+  EXPECT_TRUE(isErrMatch(WasmEdge_ErrCode_IllegalPath,
+                         WasmEdge_ConfigureSetJITCacheDir(Conf, "jit")));
+  EXPECT_TRUE(
+      WasmEdge_ResultOK(WasmEdge_ConfigureSetJITCacheDir(Conf, "/tmp/jit")));
+  EXPECT_TRUE(WasmEdge_ResultOK(WasmEdge_ConfigureSetJITCacheDir(Conf, "")));
   // Tests for AOT compiler configurations.
   WasmEdge_ConfigureCompilerSetOptimizationLevel(
       ConfNull, WasmEdge_CompilerOptimizationLevel_Os);
@@ -811,6 +819,10 @@ TEST(APICoreTest, Configure) {
   WasmEdge_ConfigureStatisticsSetTimeMeasuring(Conf, true);
   EXPECT_NE(WasmEdge_ConfigureStatisticsIsTimeMeasuring(ConfNull), true);
   EXPECT_EQ(WasmEdge_ConfigureStatisticsIsTimeMeasuring(Conf), true);
+  WasmEdge_ConfigureStatisticsSetHardwareCounting(ConfNull, true);
+  WasmEdge_ConfigureStatisticsSetHardwareCounting(Conf, true);
+  EXPECT_NE(WasmEdge_ConfigureStatisticsIsHardwareCounting(ConfNull), true);
+  EXPECT_EQ(WasmEdge_ConfigureStatisticsIsHardwareCounting(Conf), true);
   // Test to delete nullptr.
   WasmEdge_ConfigureDelete(ConfNull);
   EXPECT_TRUE(true);
@@ -1674,6 +1686,7 @@ TEST(APICoreTest, ExecutorWithStatistics) {
   WasmEdge_ConfigureStatisticsSetInstructionCounting(Conf, true);
   WasmEdge_ConfigureStatisticsSetCostMeasuring(Conf, true);
   WasmEdge_ConfigureStatisticsSetTimeMeasuring(Conf, true);
+  WasmEdge_ConfigureStatisticsSetHardwareCounting(Conf, true);
 
   // Prepare TPath.
   hexToFile(TestWasm, TPath);
@@ -2052,11 +2065,32 @@ TEST(APICoreTest, ExecutorWithStatistics) {
   EXPECT_GT(WasmEdge_StatisticsGetTotalCost(Stat), 0ULL);
   EXPECT_EQ(WasmEdge_StatisticsGetTotalCost(nullptr), 0ULL);
 
+  // Statistics get JIT cache lookups, which the interpreter never does
+  EXPECT_EQ(WasmEdge_StatisticsGetJITCacheHits(Stat), 0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetJITCacheMisses(Stat), 0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetJITCacheHits(nullptr), 0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetJITCacheMisses(nullptr), 0ULL);
+
+  // Statistics get hardware counters. The counters are only recorded when
+  // perf_event is available.
+  EXPECT_EQ(WasmEdge_StatisticsGetCountedInvocations(nullptr), 0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetWasmHardwareCounter(
+                nullptr, WasmEdge_HardwareCounter_Instructions),
+            0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetHostFuncHardwareCounter(
+                nullptr, WasmEdge_HardwareCounter_Instructions),
+            0ULL);
+  EXPECT_EQ(WasmEdge_StatisticsGetHostFuncHardwareCounterByName(
+                Stat, WasmEdge_StringWrap("none::none", 10),
+                WasmEdge_HardwareCounter_Cycles),
+            0ULL);
+
   // Statistics clear
   WasmEdge_StatisticsClear(Stat);
   EXPECT_TRUE(true);
   WasmEdge_StatisticsClear(nullptr);
   EXPECT_TRUE(true);
+  EXPECT_EQ(WasmEdge_StatisticsGetCountedInvocations(Stat), 0ULL);
 
   WasmEdge_ConfigureDelete(Conf);
   WasmEdge_ExecutorDelete(ExecCxt);
@@ -2070,6 +2104,126 @@ TEST(APICoreTest, ExecutorWithStatistics) {
   WasmEdge_ModuleInstanceDelete(HostModAlias2);
 }
 
+TEST(APICoreTest, ExecutorInstancePre) {
+  WasmEdge_ConfigureContext *Conf = WasmEdge_ConfigureCreate();
+  WasmEdge_StoreContext *Store = WasmEdge_StoreCreate();
+  WasmEdge_ExecutorContext *ExecCxt = WasmEdge_ExecutorCreate(Conf, nullptr);
+  hexToFile(TestWasm, TPath);
+  WasmEdge_ASTModuleContext *Mod = loadModule(Conf, TPath);
+  EXPECT_NE(Mod, nullptr);
+
+  WasmEdge_ModuleInstanceContext *HostMod = createExternModule("extern");
+  WasmEdge_ModuleInstanceContext *HostModWrap =
+      createExternModule("extern-wrap", true);
+  EXPECT_TRUE(WasmEdge_ResultOK(
+      WasmEdge_ExecutorRegisterImport(ExecCxt, Store, HostMod)));
+  EXPECT_TRUE(WasmEdge_ResultOK(
+      WasmEdge_ExecutorRegisterImport(ExecCxt, Store, HostModWrap)));
+
+  // Create the instantiation template
+  WasmEdge_InstancePreContext *PreCxt = nullptr;
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorCreateInstancePre(nullptr, &PreCxt, Store, Mod)));
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorCreateInstancePre(ExecCxt, nullptr, Store, Mod)));
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorCreateInstancePre(ExecCxt, &PreCxt, nullptr, Mod)));
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorCreateInstancePre(ExecCxt, &PreCxt, Store, nullptr)));
+  // Hasn't validated yet
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_NotValidated,
+      WasmEdge_ExecutorCreateInstancePre(ExecCxt, &PreCxt, Store, Mod)));
+  EXPECT_EQ(PreCxt, nullptr);
+  EXPECT_TRUE(validateModule(Conf, Mod));
+  EXPECT_TRUE(WasmEdge_ResultOK(
+      WasmEdge_ExecutorCreateInstancePre(ExecCxt, &PreCxt, Store, Mod)));
+  EXPECT_NE(PreCxt, nullptr);
+
+  // Instantiate from the template
+  WasmEdge_ModuleInstanceContext *ModCxt = nullptr;
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorInstantiatePre(nullptr, &ModCxt, Store, PreCxt)));
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_WrongVMWorkflow,
+      WasmEdge_ExecutorInstantiatePre(ExecCxt, &ModCxt, Store, nullptr)));
+  EXPECT_EQ(ModCxt, nullptr);
+  std::vector<WasmEdge_ModuleInstanceContext *> ModCxts;
+  for (uint32_t I = 0; I < 3; I++) {
+    EXPECT_TRUE(WasmEdge_ResultOK(
+        WasmEdge_ExecutorInstantiatePre(ExecCxt, &ModCxt, Store, PreCxt)));
+    EXPECT_NE(ModCxt, nullptr);
+    ModCxts.push_back(ModCxt);
+    ModCxt = nullptr;
+  }
+
+  // The instances have their own globals and link the same host functions
+  WasmEdge_String GlobName = WasmEdge_StringCreateByCString("glob-mut-i32");
+  WasmEdge_String FuncName = WasmEdge_StringCreateByCString("func-host-add");
+  WasmEdge_GlobalInstanceContext *GlobCxt0 =
+      WasmEdge_ModuleInstanceFindGlobal(ModCxts[0], GlobName);
+  WasmEdge_GlobalInstanceContext *GlobCxt1 =
+      WasmEdge_ModuleInstanceFindGlobal(ModCxts[1], GlobName);
+  EXPECT_NE(GlobCxt0, nullptr);
+  EXPECT_NE(GlobCxt1, nullptr);
+  EXPECT_NE(GlobCxt0, GlobCxt1);
+  EXPECT_EQ(WasmEdge_ValueGetI32(WasmEdge_GlobalInstanceGetValue(GlobCxt0)),
+            WasmEdge_ValueGetI32(WasmEdge_GlobalInstanceGetValue(GlobCxt1)));
+  for (auto *Cxt : ModCxts) {
+    WasmEdge_FunctionInstanceContext *FuncCxt =
+        WasmEdge_ModuleInstanceFindFunction(Cxt, FuncName);
+    EXPECT_NE(FuncCxt, nullptr);
+    uint32_t TestValue = 1234;
+    WasmEdge_Value P[1], R[1];
+    P[0] = WasmEdge_ValueGenI32(4321);
+    WasmEdge_String TabName = WasmEdge_StringCreateByCString("tab-ext");
+    WasmEdge_TableInstanceContext *TabCxt =
+        WasmEdge_ModuleInstanceFindTable(Cxt, TabName);
+    WasmEdge_StringDelete(TabName);
+    EXPECT_NE(TabCxt, nullptr);
+    EXPECT_TRUE(WasmEdge_ResultOK(WasmEdge_TableInstanceSetData(
+        TabCxt, WasmEdge_ValueGenExternRef(&TestValue), 0)));
+    EXPECT_TRUE(WasmEdge_ResultOK(
+        WasmEdge_ExecutorInvoke(ExecCxt, FuncCxt, P, 1, R, 1)));
+    EXPECT_EQ(5555, WasmEdge_ValueGetI32(R[0]));
+  }
+  WasmEdge_StringDelete(GlobName);
+  WasmEdge_StringDelete(FuncName);
+
+  // Deleting a registered module makes the template stale, and the imports are
+  // resolved again
+  WasmEdge_ModuleInstanceContext *OtherMod = createExternModule("other");
+  EXPECT_TRUE(WasmEdge_ResultOK(
+      WasmEdge_ExecutorRegisterImport(ExecCxt, Store, OtherMod)));
+  WasmEdge_ModuleInstanceDelete(OtherMod);
+  EXPECT_TRUE(WasmEdge_ResultOK(
+      WasmEdge_ExecutorInstantiatePre(ExecCxt, &ModCxt, Store, PreCxt)));
+  EXPECT_NE(ModCxt, nullptr);
+  ModCxts.push_back(ModCxt);
+  ModCxt = nullptr;
+  for (auto *Cxt : ModCxts) {
+    WasmEdge_ModuleInstanceDelete(Cxt);
+  }
+  WasmEdge_ModuleInstanceDelete(HostMod);
+  EXPECT_TRUE(isErrMatch(
+      WasmEdge_ErrCode_UnknownImport,
+      WasmEdge_ExecutorInstantiatePre(ExecCxt, &ModCxt, Store, PreCxt)));
+  EXPECT_EQ(ModCxt, nullptr);
+
+  WasmEdge_InstancePreDelete(PreCxt);
+  WasmEdge_InstancePreDelete(nullptr);
+  WasmEdge_ASTModuleDelete(Mod);
+  WasmEdge_ModuleInstanceDelete(HostModWrap);
+  WasmEdge_ExecutorDelete(ExecCxt);
+  WasmEdge_StoreDelete(Store);
+  WasmEdge_ConfigureDelete(Conf);
+}
+
 TEST(APICoreTest, Store) {
   // Create contexts
   WasmEdge_ConfigureContext *Conf = WasmEdge_ConfigureCreate();
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/profile.h"
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using WasmEdge::Profile::Profile;
+
+std::filesystem::path tempPath(const char *Name) {
+  return std::filesystem::temp_directory_path() / Name;
+}
+
+TEST(ProfileTest, Count) {
+  Profile P;
+  P.addFunction(10);
+  P.addBranch(12);
+  EXPECT_TRUE(P.empty());
+  P.countCall(10);
+  P.countCall(10);
+  P.countBranch(12, true);
+  P.countBranch(12, false);
+  P.countBranch(12, false);
+  // Offsets without counters are not recorded.
+  P.countCall(20);
+  P.countBranch(14, true);
+  EXPECT_FALSE(P.empty());
+  EXPECT_EQ(P.getCallCount(10), 2U);
+  EXPECT_EQ(P.getCallCount(20), 0U);
+  const auto Branch = P.getBranchCount(12);
+  ASSERT_TRUE(Branch);
+  EXPECT_EQ(Branch->first, 1U);
+  EXPECT_EQ(Branch->second, 2U);
+  EXPECT_FALSE(P.getBranchCount(14));
+}
+
+TEST(ProfileTest, ConcurrentCount) {
+  Profile P;
+  P.addFunction(10);
+  P.addIndirectCall(30);
+  std::vector<std::thread> Threads;
+  for (uint32_t I = 0; I < 4; ++I) {
+    Threads.emplace_back([&P]() {
+      for (uint32_t J = 0; J < 10000; ++J) {
+        P.countCall(10);
+        P.countIndirectCall(30, 40 + J % 2);
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  EXPECT_EQ(P.getCallCount(10), 40000U);
+  // Neither target takes more than half of the calls.
+  EXPECT_FALSE(P.getIndirectCallTarget(30));
+  P.countIndirectCall(30, 41);
+  const auto Target = P.getIndirectCallTarget(30);
+  ASSERT_TRUE(Target);
+  EXPECT_EQ(Target->first, 41U);
+  EXPECT_EQ(Target->second, 20001U);
+}
+
+TEST(ProfileTest, IndirectCallTarget) {
+  Profile P;
+  P.addIndirectCall(30);
+  EXPECT_FALSE(P.getIndirectCallTarget(30));
+  // The calls beyond the tracked targets are counted as other targets.
+  for (uint32_t I = 0; I < 6; ++I) {
+    P.countIndirectCall(30, 40 + I);
+  }
+  for (uint32_t I = 0; I < 5; ++I) {
+    P.countIndirectCall(30, Profile::kOtherTarget);
+  }
+  EXPECT_FALSE(P.getIndirectCallTarget(30));
+  for (uint32_t I = 0; I < 10; ++I) {
+    P.countIndirectCall(30, 42);
+  }
+  const auto Target = P.getIndirectCallTarget(30);
+  ASSERT_TRUE(Target);
+  EXPECT_EQ(Target->first, 42U);
+  EXPECT_EQ(Target->second, 11U);
+}
+
+TEST(ProfileTest, HotCallThreshold) {
+  Profile P;
+  EXPECT_EQ(P.getHotCallThreshold(), UINT64_MAX);
+  P.addFunction(1);
+  P.addFunction(2);
+  P.addFunction(3);
+  for (uint32_t I = 0; I < 90; ++I) {
+    P.countCall(1);
+  }
+  for (uint32_t I = 0; I < 9; ++I) {
+    P.countCall(2);
+  }
+  P.countCall(3);
+  // The function at offset 1 alone makes up 90% of the calls.
+  EXPECT_EQ(P.getHotCallThreshold(), 90U);
+}
+
+TEST(ProfileTest, SaveAndMerge) {
+  const auto Path = tempPath("wasmedge-profile-test.txt");
+  {
+    Profile P;
+    P.setModuleHash(1234);
+    P.addFunction(5);
+    P.addBranch(8);
+    P.addIndirectCall(9);
+    P.countCall(5);
+    P.countBranch(8, true);
+    P.countIndirectCall(9, 5);
+    ASSERT_TRUE(P.save(Path));
+  }
+  Profile P;
+  ASSERT_TRUE(P.load(Path));
+  ASSERT_TRUE(P.load(Path));
+  EXPECT_EQ(P.getModuleHash().value_or(0), 1234U);
+  EXPECT_EQ(P.getCallCount(5), 2U);
+  EXPECT_EQ(P.getBranchCount(8)->first, 2U);
+  EXPECT_EQ(P.getBranchCount(8)->second, 0U);
+  const auto Target = P.getIndirectCallTarget(9);
+  ASSERT_TRUE(Target);
+  EXPECT_EQ(Target->first, 5U);
+  EXPECT_EQ(Target->second, 2U);
+
+  // A profile of another module is not merged.
+  Profile Q;
+  Q.setModuleHash(4321);
+  EXPECT_FALSE(Q.load(Path));
+  std::filesystem::remove(Path);
+}
+
+TEST(ProfileTest, Malformed) {
+  const auto Path = tempPath("wasmedge-profile-malformed.txt");
+  Profile P;
+  EXPECT_FALSE(P.load(Path));
+  {
+    std::ofstream File(Path);
+    File << "wasmedge-profile 2\ncall 5\n";
+  }
+  EXPECT_FALSE(P.load(Path));
+  {
+    std::ofstream File(Path);
+    File << "wasmedge-profile 3\n";
+  }
+  EXPECT_FALSE(P.load(Path));
+  std::filesystem::remove(Path);
+}
+
+} // namespace
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <string>
 
 namespace {
 using WasmEdge::OpCode;
@@ -80,4 +81,45 @@ TEST(StatisticsTest, ClearResetsCountersNotLimit) {
   EXPECT_EQ(S.getCostLimit(), UINT64_C(1000));
 }
 
+TEST(StatisticsTest, HostFuncCounters) {
+  WasmEdge::Statistics::HardwareCounterValues Start{}, Stop{};
+  Stop.fill(2);
+  const int F1 = 0, F2 = 0;
+  int Names = 0;
+  auto Name = [&Names](const char *N) {
+    return [&Names, N]() {
+      ++Names;
+      return std::string(N);
+    };
+  };
+  {
+    // A new object must not reuse the cached records of a destroyed one.
+    Statistics Other;
+    Other.addHostFuncCounters(&F1, Name("other"), Start, Stop);
+  }
+  Statistics S;
+  S.addHostFuncCounters(&F1, Name("f1"), Start, Stop);
+  S.addHostFuncCounters(&F1, Name("f1"), Start, Stop);
+  S.addHostFuncCounters(&F2, Name("f2"), Start, Stop);
+  EXPECT_EQ(Names, 3);
+  EXPECT_EQ(S.getHostFuncCounters()[0], UINT64_C(6));
+  auto Records = S.getHostFuncCounterRecords();
+  ASSERT_EQ(Records.size(), 2U);
+  EXPECT_EQ(Records[0].Name, "f1");
+  EXPECT_EQ(Records[0].Calls, UINT64_C(2));
+  EXPECT_EQ(Records[0].Values[0], UINT64_C(4));
+  EXPECT_EQ(Records[1].Name, "f2");
+  EXPECT_EQ(Records[1].Calls, UINT64_C(1));
+
+  S.clear();
+  EXPECT_EQ(S.getHostFuncCounters()[0], UINT64_C(0));
+  EXPECT_TRUE(S.getHostFuncCounterRecords().empty());
+  S.addHostFuncCounters(&F2, Name("f2"), Start, Stop);
+  EXPECT_EQ(Names, 3);
+  Records = S.getHostFuncCounterRecords();
+  ASSERT_EQ(Records.size(), 1U);
+  EXPECT_EQ(Records[0].Name, "f2");
+  EXPECT_EQ(Records[0].Calls, UINT64_C(1));
+}
+
 } // namespace
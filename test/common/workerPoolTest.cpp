@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The WasmEdge Authors
+
+#include "common/workerpool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(WorkerPoolTest, RunsEveryIndexOnce) {
+  WasmEdge::WorkerPool Pool(3);
+  EXPECT_EQ(Pool.getThreadCount(), 3U);
+  std::vector<uint32_t> Hits(1000);
+  Pool.parallelFor(Hits.size(), [&Hits](size_t I) noexcept { ++Hits[I]; });
+  for (const auto Hit : Hits) {
+    EXPECT_EQ(Hit, 1U);
+  }
+}
+
+TEST(WorkerPoolTest, ConcurrentCallersShareTheWorkers) {
+  WasmEdge::WorkerPool Pool(2);
+  std::atomic<uint64_t> Sum = 0;
+  std::vector<std::thread> Callers;
+  for (int C = 0; C < 8; ++C) {
+    Callers.emplace_back([&Pool, &Sum]() {
+      Pool.parallelFor(100, [&Sum](size_t I) noexcept { Sum += I; });
+    });
+  }
+  for (auto &Caller : Callers) {
+    Caller.join();
+  }
+  EXPECT_EQ(Pool.getThreadCount(), 2U);
+  EXPECT_EQ(Sum.load(), 8U * 4950U);
+}
+
+TEST(WorkerPoolTest, WithoutWorkers) {
+  WasmEdge::WorkerPool Pool(0);
+  uint64_t Sum = 0;
+  Pool.parallelFor(10, [&Sum](size_t I) noexcept { Sum += I; });
+  EXPECT_EQ(Sum, 45U);
+}
+
+} // namespace
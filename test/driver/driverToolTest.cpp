@@ -262,6 +262,34 @@ static const std::array<uint8_t, 44> ConsumerWasm{
     0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x72, 0x03, 0x61, 0x64, 0x64,
     0x00, 0x00, 0x07, 0x07, 0x01, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00};
 
+// optimize_test.wasm: exports "hot", "cold" and "unlisted". "hot" and "cold"
+// share a helper, "unlisted" calls a dead function, a table not in use holds
+// one more function, and a passive data segment is never used.
+static const std::array<uint8_t, 148> OptimizeTestWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02,
+    0x60, 0x00, 0x01, 0x7f, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x08,
+    0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01,
+    0x70, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07, 0x19, 0x03,
+    0x03, 0x68, 0x6f, 0x74, 0x00, 0x00, 0x04, 0x63, 0x6f, 0x6c, 0x64,
+    0x00, 0x02, 0x08, 0x75, 0x6e, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x64,
+    0x00, 0x06, 0x09, 0x07, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x05,
+    0x0a, 0x33, 0x07, 0x06, 0x00, 0x41, 0x01, 0x10, 0x01, 0x0b, 0x07,
+    0x00, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x0b, 0x0b, 0x00, 0x41, 0x14,
+    0x10, 0x01, 0x41, 0x02, 0x10, 0x03, 0x6c, 0x0b, 0x07, 0x00, 0x20,
+    0x00, 0x41, 0x00, 0x6a, 0x0b, 0x04, 0x00, 0x41, 0x07, 0x0b, 0x04,
+    0x00, 0x41, 0x09, 0x0b, 0x04, 0x00, 0x10, 0x04, 0x0b, 0x0b, 0x10,
+    0x01, 0x01, 0x0d, 0x70, 0x61, 0x73, 0x73, 0x69, 0x76, 0x65, 0x2d,
+    0x62, 0x79, 0x74, 0x65, 0x73};
+
+// optimize_ref_test.wasm: exports "target" and "get". "get" takes a
+// reference of "target", which only the export declares.
+static const std::array<uint8_t, 52> OptimizeRefTestWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01,
+    0x60, 0x00, 0x01, 0x7f, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07, 0x10,
+    0x02, 0x06, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x00, 0x00, 0x03,
+    0x67, 0x65, 0x74, 0x00, 0x01, 0x0a, 0x0c, 0x02, 0x04, 0x00, 0x41,
+    0x07, 0x0b, 0x05, 0x00, 0xd2, 0x00, 0xd1, 0x0b};
+
 std::string simplePath() {
   static std::string Path;
   if (Path.empty()) {
@@ -333,6 +361,25 @@ std::string tagSectionTestPath() {
   return Path;
 }
 
+std::string optimizeTestPath() {
+  static std::string Path;
+  if (Path.empty()) {
+    Path = writeWasmToFile(OptimizeTestWasm.data(), OptimizeTestWasm.size(),
+                           "optimize_test.wasm");
+  }
+  return Path;
+}
+
+std::string optimizeRefTestPath() {
+  static std::string Path;
+  if (Path.empty()) {
+    Path =
+        writeWasmToFile(OptimizeRefTestWasm.data(), OptimizeRefTestWasm.size(),
+                        "optimize_ref_test.wasm");
+  }
+  return Path;
+}
+
 std::string nonExistPath() { return TestDataPath + "/nonexist.wasm"; }
 
 // ---------------------------------------------------------------------------
@@ -771,6 +818,85 @@ TEST(CompileSubcommand, OutputFormat) {
   std::filesystem::remove(NativeOutput.c_str());
 }
 
+TEST(CompileSubcommand, Batch) {
+  const std::filesystem::path InputDir =
+      std::filesystem::u8path(TestDataPath + "/batch_in");
+  const std::filesystem::path OutputDir =
+      std::filesystem::u8path(TestDataPath + "/batch_out");
+  std::filesystem::create_directories(InputDir / "sub");
+  std::filesystem::copy_file(
+      simplePath(), InputDir / "a.wasm",
+      std::filesystem::copy_options::overwrite_existing);
+  std::filesystem::copy_file(
+      simplePath(), InputDir / "sub" / "b.wasm",
+      std::filesystem::copy_options::overwrite_existing);
+  const auto In = InputDir.u8string();
+  const auto Out = OutputDir.u8string();
+  const auto Summary = (OutputDir / "wasmedgec-summary.json").u8string();
+  auto readSummary = [&]() {
+    std::ifstream File(Summary);
+    return std::string(std::istreambuf_iterator<char>(File),
+                       std::istreambuf_iterator<char>());
+  };
+
+  // Compile a directory, then again with every module skipped.
+  EXPECT_EQ(callCompile({"--batch", "--jobs", "2", In.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_TRUE(std::filesystem::exists(OutputDir /
+                                      ("a" WASMEDGE_LIB_EXTENSION)));
+  EXPECT_TRUE(std::filesystem::exists(OutputDir / "sub" /
+                                      ("b" WASMEDGE_LIB_EXTENSION)));
+  EXPECT_NE(readSummary().find("\"compiled\": 2"), std::string::npos);
+  EXPECT_EQ(callCompile({"--batch", In.c_str(), Out.c_str()}), EXIT_SUCCESS);
+  EXPECT_NE(readSummary().find("\"skipped\": 2"), std::string::npos);
+  // Other options invalidate the cached outputs.
+  EXPECT_EQ(
+      callCompile({"--batch", "--optimize", "0", In.c_str(), Out.c_str()}),
+      EXIT_SUCCESS);
+  EXPECT_NE(readSummary().find("\"compiled\": 2"), std::string::npos);
+
+  // Compile a manifest with an invalid module and an explicit output.
+  const auto Manifest = (InputDir / "manifest.txt").u8string();
+  {
+    std::ofstream File(Manifest);
+    File << "# modules\n"
+         << "a.wasm\ta_aot.wasm\n"
+         << std::filesystem::absolute(invalidPath()).u8string() << "\n";
+  }
+  EXPECT_NE(callCompile({"--batch", Manifest.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_TRUE(std::filesystem::exists(OutputDir / "a_aot.wasm"));
+  const auto Result = readSummary();
+  EXPECT_NE(Result.find("\"compiled\": 1"), std::string::npos);
+  EXPECT_NE(Result.find("\"failed\": 1"), std::string::npos);
+  EXPECT_NE(Result.find("\"error\": \"validate\""), std::string::npos);
+
+  // Inputs of the same name in different directories would have the same
+  // default output, so one of them needs an explicit output.
+  std::filesystem::copy_file(
+      simplePath(), InputDir / "sub" / "a.wasm",
+      std::filesystem::copy_options::overwrite_existing);
+  {
+    std::ofstream File(Manifest);
+    File << "a.wasm\n"
+         << "sub/a.wasm\n";
+  }
+  EXPECT_NE(callCompile({"--batch", Manifest.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  {
+    std::ofstream File(Manifest);
+    File << "a.wasm\n"
+         << "sub/a.wasm\tsub_a" WASMEDGE_LIB_EXTENSION "\n";
+  }
+  EXPECT_EQ(callCompile({"--batch", Manifest.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_TRUE(std::filesystem::exists(OutputDir /
+                                      ("sub_a" WASMEDGE_LIB_EXTENSION)));
+
+  std::filesystem::remove_all(InputDir);
+  std::filesystem::remove_all(OutputDir);
+}
+
 TEST(RunSubcommand, RunModeFlagParses) {
   WasmEdge::Driver::DriverToolOptions Opt;
   WasmEdge::PO::ArgumentParser Parser;
@@ -994,6 +1120,68 @@ TEST(RunSubcommand, GlobalFlags) {
             EXIT_SUCCESS);
 }
 
+// ---------------------------------------------------------------------------
+// OptimizeSubcommand tests
+// ---------------------------------------------------------------------------
+
+TEST(OptimizeSubcommand, DeadCodeElimination) {
+  const auto In = optimizeTestPath();
+  const auto Out = TestDataPath + "/optimize_dce.wasm";
+
+  EXPECT_NE(callUniToolAll({"optimize", In.c_str()}), EXIT_SUCCESS);
+  EXPECT_NE(callUniToolAll({"optimize", "--entry", "nonexist", In.c_str(),
+                            Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_EQ(callUniToolAll({"optimize", "--entry", "hot", "--entry", "cold",
+                            "--rounds", "1", In.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_LT(std::filesystem::file_size(Out), OptimizeTestWasm.size());
+  EXPECT_EQ(callRun({"--reactor", Out.c_str(), "hot"}), EXIT_SUCCESS);
+  EXPECT_EQ(callRun({"--reactor", Out.c_str(), "cold"}), EXIT_SUCCESS);
+  EXPECT_NE(callRun({"--reactor", Out.c_str(), "unlisted"}), EXIT_SUCCESS);
+}
+
+TEST(OptimizeSubcommand, DeadCodeEliminationKeepsRefDeclared) {
+  const auto In = optimizeRefTestPath();
+  const auto Out = TestDataPath + "/optimize_ref.wasm";
+
+  // The export of "target" is removed, so a declarative segment has to
+  // declare its reference.
+  EXPECT_EQ(callRun({"--reactor", In.c_str(), "get"}), EXIT_SUCCESS);
+  EXPECT_EQ(callUniToolAll({"optimize", "--entry", "get", "--rounds", "1",
+                            In.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_EQ(callRun({"--reactor", Out.c_str(), "get"}), EXIT_SUCCESS);
+  EXPECT_NE(callRun({"--reactor", Out.c_str(), "target"}), EXIT_SUCCESS);
+}
+
+TEST(OptimizeSubcommand, SplitColdCode) {
+  const auto In = optimizeTestPath();
+  const auto Out = TestDataPath + "/optimize_split.wasm";
+  const auto Cold = TestDataPath + "/optimize_cold.wasm";
+
+  EXPECT_NE(callUniToolAll({"optimize", "--split-cold", Cold.c_str(),
+                            In.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  EXPECT_EQ(callUniToolAll({"optimize", "--entry", "hot", "--entry", "cold",
+                            "--hot", "hot", "--split-cold", Cold.c_str(),
+                            "--rounds", "1", In.c_str(), Out.c_str()}),
+            EXIT_SUCCESS);
+  ASSERT_TRUE(std::filesystem::exists(Cold));
+
+  // The cold functions are loaded on the first call.
+  EXPECT_EQ(callRun({"--reactor", "--split-module", Cold.c_str(), Out.c_str(),
+                     "hot"}),
+            EXIT_SUCCESS);
+  EXPECT_EQ(callRun({"--reactor", "--split-module", Cold.c_str(), Out.c_str(),
+                     "cold"}),
+            EXIT_SUCCESS);
+  EXPECT_NE(callRun({"--reactor", Out.c_str(), "cold"}), EXIT_SUCCESS);
+  EXPECT_NE(callRun({"--reactor", "--split-module", nonExistPath().c_str(),
+                     Out.c_str(), "cold"}),
+            EXIT_SUCCESS);
+}
+
 TEST(NoSubcommand, FallbackToRun) {
   EXPECT_EQ(
       callUniToolAll({"--reactor", simplePath().c_str(), "add", "3", "5"}),
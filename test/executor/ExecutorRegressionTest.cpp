@@ -19,11 +19,13 @@
 #include <array>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <string_view>
 #include <vector>
 
 namespace {
 
 using namespace WasmEdge;
+using namespace std::literals;
 
 /// Host function that records i32 values for later inspection.
 class Check : public Runtime::HostFunction<Check> {
@@ -673,6 +675,201 @@ std::array<WasmEdge::Byte, 129> TailCallHostImportWasm{
     0x68, 0x01, 0x02, 0x66, 0x32, 0x02, 0x02, 0x66, 0x31};
 // clang-format on
 
+/// Binary Wasm module: call_indirect through table slots rewritten during the
+/// same invocation.
+///
+/// (module
+///   (type $i (func (result i32)))
+///   (type $v (func))
+///   (table 2 funcref)
+///   (elem (i32.const 0) $a $b)
+///   (func $a (type $i) (i32.const 1))
+///   (func $b (type $v))
+///   (func $call (param i32) (result i32)
+///     (call_indirect (type $i) (local.get 0)))
+///   (func (export "run") (result i32)
+///     (call $call (i32.const 0))
+///     (call $call (i32.const 0))
+///     i32.add
+///     (table.set (i32.const 0) (ref.func $b))
+///     (call $call (i32.const 0))
+///     i32.add)
+///   (func (export "poly") (result i32)
+///     (table.set (i32.const 1) (ref.func $a))
+///     (call $call (i32.const 0))
+///     (call $call (i32.const 1))
+///     i32.add
+///     (call $call (i32.const 0))
+///     i32.add
+///     (call $call (i32.const 1))
+///     i32.add))
+std::array<WasmEdge::Byte, 133> CallIndirectTableUpdateWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x03, 0x60,
+    0x00, 0x01, 0x7f, 0x60, 0x00, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03,
+    0x06, 0x05, 0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x04, 0x01, 0x70, 0x00,
+    0x02, 0x07, 0x0e, 0x02, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x03, 0x04, 0x70,
+    0x6f, 0x6c, 0x79, 0x00, 0x04, 0x09, 0x08, 0x01, 0x00, 0x41, 0x00, 0x0b,
+    0x02, 0x00, 0x01, 0x0a, 0x44, 0x05, 0x04, 0x00, 0x41, 0x01, 0x0b, 0x02,
+    0x00, 0x0b, 0x07, 0x00, 0x20, 0x00, 0x11, 0x00, 0x00, 0x0b, 0x16, 0x00,
+    0x41, 0x00, 0x10, 0x02, 0x41, 0x00, 0x10, 0x02, 0x6a, 0x41, 0x00, 0xd2,
+    0x01, 0x26, 0x00, 0x41, 0x00, 0x10, 0x02, 0x6a, 0x0b, 0x1b, 0x00, 0x41,
+    0x01, 0xd2, 0x00, 0x26, 0x00, 0x41, 0x00, 0x10, 0x02, 0x41, 0x01, 0x10,
+    0x02, 0x6a, 0x41, 0x00, 0x10, 0x02, 0x6a, 0x41, 0x01, 0x10, 0x02, 0x6a, 0x0b};
+
+/// Binary Wasm modules: a call_indirect into a table of another module, of
+/// which the type of the callee has a different type index.
+///
+/// (module
+///   (type (func (param i64)))
+///   (type (func (param i32) (result i32)))
+///   (table (export "tab") 2 funcref)
+///   (elem (i32.const 0) $dbl)
+///   (func $dbl (export "dbl") (type 1)
+///     (i32.mul (local.get 0) (i32.const 2))))
+std::array<WasmEdge::Byte, 65> CanonicalTypeLibWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+    0x01, 0x7e, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x01,
+    0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x07, 0x0d, 0x02, 0x03, 0x74, 0x61,
+    0x62, 0x01, 0x00, 0x03, 0x64, 0x62, 0x6c, 0x00, 0x00, 0x09, 0x07, 0x01,
+    0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x09, 0x01, 0x07, 0x00, 0x20,
+    0x00, 0x41, 0x02, 0x6c, 0x0b};
+
+/// (module
+///   (type (func (param i32) (result i32)))
+///   (type (func (result i64)))
+///   (import "lib" "tab" (table 2 funcref))
+///   (func (export "call") (type 0)
+///     (call_indirect (type 0) (local.get 0) (i32.const 0)))
+///   (func (export "bad") (type 1)
+///     (call_indirect (type 1) (i32.const 0))))
+std::array<WasmEdge::Byte, 77> CanonicalTypeUserWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x01, 0x7e, 0x02, 0x0d, 0x01, 0x03,
+    0x6c, 0x69, 0x62, 0x03, 0x74, 0x61, 0x62, 0x01, 0x70, 0x00, 0x02, 0x03,
+    0x03, 0x02, 0x00, 0x01, 0x07, 0x0e, 0x02, 0x04, 0x63, 0x61, 0x6c, 0x6c,
+    0x00, 0x00, 0x03, 0x62, 0x61, 0x64, 0x00, 0x01, 0x0a, 0x13, 0x02, 0x09,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x0b, 0x07, 0x00, 0x41,
+    0x00, 0x11, 0x01, 0x00, 0x0b};
+
+/// Binary Wasm modules: a function of a type used by no other test.
+///
+/// (module
+///   (func (export "a") (param f64 f32 f64)))
+std::array<WasmEdge::Byte, 34> CanonicalTypeFirstWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x60,
+    0x03, 0x7c, 0x7d, 0x7c, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01,
+    0x01, 0x61, 0x00, 0x00, 0x0a, 0x04, 0x01, 0x02, 0x00, 0x0b};
+
+/// (module
+///   (func (export "b") (param f32 f64 f32)))
+std::array<WasmEdge::Byte, 34> CanonicalTypeSecondWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x60,
+    0x03, 0x7d, 0x7c, 0x7d, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01,
+    0x01, 0x62, 0x00, 0x00, 0x0a, 0x04, 0x01, 0x02, 0x00, 0x0b};
+
+/// Module exercising the interpreter call path: recursion, tail calls, zeroed
+/// locals in reused stack slots, and the handlers of the caller frames.
+///
+/// (module
+///   (tag $e)
+///   (func $fib (export "fib") (param i32) (result i64)
+///     (if (result i64) (i32.lt_u (local.get 0) (i32.const 2))
+///       (then (i64.extend_i32_u (local.get 0)))
+///       (else (i64.add (call $fib (i32.sub (local.get 0) (i32.const 1)))
+///                      (call $fib (i32.sub (local.get 0) (i32.const 2)))))))
+///   (func $fib_acc (export "fib_acc") (param i32 i64 i64) (result i64)
+///     (if (i32.eqz (local.get 0)) (then (return (local.get 1))))
+///     (return_call $fib_acc (i32.sub (local.get 0) (i32.const 1))
+///       (local.get 2) (i64.add (local.get 1) (local.get 2))))
+///   (func $ack (export "ack") (param i32 i32) (result i32)
+///     (if (i32.eqz (local.get 0))
+///       (then (return (i32.add (local.get 1) (i32.const 1)))))
+///     (if (i32.eqz (local.get 1))
+///       (then (return_call $ack (i32.sub (local.get 0) (i32.const 1))
+///                               (i32.const 1))))
+///     (return_call $ack (i32.sub (local.get 0) (i32.const 1))
+///       (call $ack (local.get 0) (i32.sub (local.get 1) (i32.const 1)))))
+///   (func $dirty (local i64) (local.set 0 (i64.const -1)))
+///   (func $read (result i64) (local i64) (local.get 0))
+///   (func (export "zero") (result i64) (call $dirty) (call $read))
+///   (func $throw (throw $e))
+///   (func $inner
+///     (block (try_table (catch_all 0)))
+///     (call $throw))
+///   (func (export "handled") (result i32)
+///     (block (try_table (catch_all 0) (call $inner)) (return (i32.const 0)))
+///     (i32.const 1))
+///   (func $mid
+///     (block (try_table (catch_all 0) (return_call $throw)))
+///     (unreachable))
+///   (func (export "tail_handled") (result i32)
+///     (block (try_table (catch_all 0) (call $mid)) (return (i32.const 0)))
+///     (i32.const 1)))
+std::array<WasmEdge::Byte, 317> CallPathWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x06, 0x60,
+    0x01, 0x7f, 0x01, 0x7e, 0x60, 0x03, 0x7f, 0x7e, 0x7e, 0x01, 0x7e, 0x60,
+    0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x00, 0x60, 0x00, 0x01, 0x7e,
+    0x60, 0x00, 0x01, 0x7f, 0x03, 0x0c, 0x0b, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x04, 0x03, 0x03, 0x05, 0x03, 0x05, 0x0d, 0x03, 0x01, 0x00, 0x03, 0x07,
+    0x37, 0x06, 0x03, 0x66, 0x69, 0x62, 0x00, 0x00, 0x07, 0x66, 0x69, 0x62,
+    0x5f, 0x61, 0x63, 0x63, 0x00, 0x01, 0x03, 0x61, 0x63, 0x6b, 0x00, 0x02,
+    0x04, 0x7a, 0x65, 0x72, 0x6f, 0x00, 0x05, 0x07, 0x68, 0x61, 0x6e, 0x64,
+    0x6c, 0x65, 0x64, 0x00, 0x08, 0x0c, 0x74, 0x61, 0x69, 0x6c, 0x5f, 0x68,
+    0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x00, 0x0a, 0x0a, 0xc6, 0x01, 0x0b,
+    0x1d, 0x00, 0x20, 0x00, 0x41, 0x02, 0x49, 0x04, 0x7e, 0x20, 0x00, 0xad,
+    0x05, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x10, 0x00, 0x20, 0x00, 0x41, 0x02,
+    0x6b, 0x10, 0x00, 0x7c, 0x0b, 0x0b, 0x19, 0x00, 0x20, 0x00, 0x45, 0x04,
+    0x40, 0x20, 0x01, 0x0f, 0x0b, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x20, 0x02,
+    0x20, 0x01, 0x20, 0x02, 0x7c, 0x12, 0x01, 0x0b, 0x2d, 0x00, 0x20, 0x00,
+    0x45, 0x04, 0x40, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x0f, 0x0b, 0x20, 0x01,
+    0x45, 0x04, 0x40, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x41, 0x01, 0x12, 0x02,
+    0x0b, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x20, 0x00, 0x20, 0x01, 0x41, 0x01,
+    0x6b, 0x10, 0x02, 0x12, 0x02, 0x0b, 0x08, 0x01, 0x01, 0x7e, 0x42, 0x7f,
+    0x21, 0x00, 0x0b, 0x06, 0x01, 0x01, 0x7e, 0x20, 0x00, 0x0b, 0x06, 0x00,
+    0x10, 0x03, 0x10, 0x04, 0x0b, 0x04, 0x00, 0x08, 0x00, 0x0b, 0x0d, 0x00,
+    0x02, 0x40, 0x1f, 0x40, 0x01, 0x02, 0x00, 0x0b, 0x0b, 0x10, 0x06, 0x0b,
+    0x12, 0x00, 0x02, 0x40, 0x1f, 0x40, 0x01, 0x02, 0x00, 0x10, 0x07, 0x0b,
+    0x41, 0x00, 0x0f, 0x0b, 0x41, 0x01, 0x0b, 0x0e, 0x00, 0x02, 0x40, 0x1f,
+    0x40, 0x01, 0x02, 0x00, 0x12, 0x06, 0x0b, 0x0b, 0x00, 0x0b, 0x12, 0x00,
+    0x02, 0x40, 0x1f, 0x40, 0x01, 0x02, 0x00, 0x10, 0x09, 0x0b, 0x41, 0x00,
+    0x0f, 0x0b, 0x41, 0x01, 0x0b};
+
+/// Module initializing a table from an active and a passive element segment.
+/// ElemOOBWasm is the same module with the active segment at offset 3, which
+/// does not fit in the table.
+///
+/// (module
+///   (table 4 funcref)
+///   (func $f0 (result i32) (i32.const 1))
+///   (func $f1 (result i32) (i32.const 2))
+///   (elem (i32.const 0) func $f0 $f0)
+///   (elem $p funcref (ref.func $f1) (ref.null func))
+///   (func (export "run") (result i32)
+///     (table.init $p (i32.const 1) (i32.const 0) (i32.const 2))
+///     (i32.add (call_indirect (result i32) (i32.const 1))
+///              (call_indirect (result i32) (i32.const 0)))
+///     (i32.add (ref.is_null (table.get (i32.const 2))))))
+std::array<WasmEdge::Byte, 98> ElemInitWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7f, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01,
+    0x70, 0x00, 0x04, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x02,
+    0x09, 0x11, 0x02, 0x00, 0x41, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x05, 0x70,
+    0x02, 0xd2, 0x01, 0x0b, 0xd0, 0x70, 0x0b, 0x0a, 0x29, 0x03, 0x04, 0x00,
+    0x41, 0x01, 0x0b, 0x04, 0x00, 0x41, 0x02, 0x0b, 0x1d, 0x00, 0x41, 0x01,
+    0x41, 0x00, 0x41, 0x02, 0xfc, 0x0c, 0x01, 0x00, 0x41, 0x01, 0x11, 0x00,
+    0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x6a, 0x41, 0x02, 0x25, 0x00, 0xd1,
+    0x6a, 0x0b};
+std::array<WasmEdge::Byte, 98> ElemOOBWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7f, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01,
+    0x70, 0x00, 0x04, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x02,
+    0x09, 0x11, 0x02, 0x00, 0x41, 0x03, 0x0b, 0x02, 0x00, 0x00, 0x05, 0x70,
+    0x02, 0xd2, 0x01, 0x0b, 0xd0, 0x70, 0x0b, 0x0a, 0x29, 0x03, 0x04, 0x00,
+    0x41, 0x01, 0x0b, 0x04, 0x00, 0x41, 0x02, 0x0b, 0x1d, 0x00, 0x41, 0x01,
+    0x41, 0x00, 0x41, 0x02, 0xfc, 0x0c, 0x01, 0x00, 0x41, 0x01, 0x11, 0x00,
+    0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x6a, 0x41, 0x02, 0x25, 0x00, 0xd1,
+    0x6a, 0x0b};
+
 /// Regression test for ref.test on externalized nullable references.
 ///
 /// The bug: runRefTestOp always created non-nullable types for externalized
@@ -1285,6 +1482,193 @@ TEST(ExecutorRegression, TailCallToHostImport) {
   }
 }
 
+/// Regression test for the call_indirect inline cache.
+///
+/// The type check result of a call site is cached per callee, so replacing a
+/// table slot with a function of another type in the same invocation must
+/// still trap, and a call site with several callees must call each of them.
+TEST(ExecutorRegression, CallIndirectTableUpdate) {
+  Configure Conf;
+  VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(CallIndirectTableUpdateWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+
+  auto Res = VM.execute("poly");
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint32_t>(), 4);
+
+  Res = VM.execute("run");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::IndirectCallTypeMismatch);
+
+  // The slot 0 now holds the function of another type.
+  Res = VM.execute("poly");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::IndirectCallTypeMismatch);
+}
+
+/// Regression test for the canonical type IDs.
+///
+/// Equivalent function types get the same canonical ID in every module, so a
+/// call_indirect into another module matches the callee without comparing
+/// the type structures, while a callee of another type must still trap.
+TEST(ExecutorRegression, CanonicalTypeIDs) {
+  Configure Conf;
+  VM::VM VM(Conf);
+  ASSERT_TRUE(VM.registerModule("lib"sv, CanonicalTypeLibWasm));
+  ASSERT_TRUE(VM.loadWasm(CanonicalTypeUserWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+
+  const auto *LibMod = VM.getStoreManager().findModule("lib"sv);
+  ASSERT_NE(LibMod, nullptr);
+  const auto *Dbl = LibMod->findFuncExports("dbl"sv);
+  const auto *Call = VM.getActiveModule()->findFuncExports("call"sv);
+  const auto *Bad = VM.getActiveModule()->findFuncExports("bad"sv);
+  ASSERT_NE(Dbl, nullptr);
+  ASSERT_NE(Call, nullptr);
+  ASSERT_NE(Bad, nullptr);
+  EXPECT_NE(Dbl->getCanonicalTypeID(), 0U);
+  EXPECT_NE(Dbl->getTypeIndex(), Call->getTypeIndex());
+  EXPECT_EQ(Dbl->getCanonicalTypeID(), Call->getCanonicalTypeID());
+  EXPECT_NE(Dbl->getCanonicalTypeID(), Bad->getCanonicalTypeID());
+
+  std::array<ValVariant, 1> Params = {UINT32_C(21)};
+  std::array<ValType, 1> ParamTypes = {ValType(TypeCode::I32)};
+  auto Res = VM.execute("call", Params, ParamTypes);
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint32_t>(), 42);
+
+  Res = VM.execute("bad");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::IndirectCallTypeMismatch);
+}
+
+/// Regression test for the release of the canonical type IDs.
+///
+/// The IDs of a type are held by the module instances using it. When the last
+/// one is destroyed, the ID is released and reused by the next new type, so
+/// the IDs do not run out in a long running process.
+TEST(ExecutorRegression, CanonicalTypeIDsReleased) {
+  auto GetID = [](VM::VM &VM, std::string_view Name) -> uint32_t {
+    const auto *Func = VM.getActiveModule()->findFuncExports(Name);
+    return Func ? Func->getCanonicalTypeID() : 0;
+  };
+  Configure Conf;
+  uint32_t FirstID = 0;
+  {
+    VM::VM VM1(Conf);
+    ASSERT_TRUE(VM1.loadWasm(CanonicalTypeFirstWasm));
+    ASSERT_TRUE(VM1.validate());
+    ASSERT_TRUE(VM1.instantiate());
+    FirstID = GetID(VM1, "a"sv);
+    ASSERT_NE(FirstID, 0U);
+    {
+      // An equivalent type shares the ID while both modules are alive.
+      VM::VM VM2(Conf);
+      ASSERT_TRUE(VM2.loadWasm(CanonicalTypeFirstWasm));
+      ASSERT_TRUE(VM2.validate());
+      ASSERT_TRUE(VM2.instantiate());
+      EXPECT_EQ(GetID(VM2, "a"sv), FirstID);
+    }
+    VM::VM VM3(Conf);
+    ASSERT_TRUE(VM3.loadWasm(CanonicalTypeSecondWasm));
+    ASSERT_TRUE(VM3.validate());
+    ASSERT_TRUE(VM3.instantiate());
+    EXPECT_NE(GetID(VM3, "b"sv), FirstID);
+  }
+  VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(CanonicalTypeSecondWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+  EXPECT_EQ(GetID(VM, "b"sv), FirstID);
+}
+
+/// Regression test for the interpreter call path.
+///
+/// The arguments become the locals of the callee in place, the returns move
+/// only their values, and the handlers of all frames share one stack. The
+/// results of deep recursion and tail calls must be kept, a callee must see
+/// its number locals zeroed in the stack slots of a previous callee, and the
+/// handlers pushed by a callee or dropped by a tail call must not disturb the
+/// handlers of the caller.
+TEST(ExecutorRegression, CallPath) {
+  Configure Conf;
+  VM::VM VM(Conf);
+  ASSERT_TRUE(VM.loadWasm(CallPathWasm));
+  ASSERT_TRUE(VM.validate());
+  ASSERT_TRUE(VM.instantiate());
+
+  std::array<ValVariant, 1> FibParams = {UINT32_C(20)};
+  std::array<ValType, 1> FibTypes = {ValType(TypeCode::I32)};
+  auto Res = VM.execute("fib", FibParams, FibTypes);
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint64_t>(), UINT64_C(6765));
+
+  std::array<ValVariant, 3> AccParams = {UINT32_C(90), UINT64_C(0),
+                                         UINT64_C(1)};
+  std::array<ValType, 3> AccTypes = {ValType(TypeCode::I32),
+                                     ValType(TypeCode::I64),
+                                     ValType(TypeCode::I64)};
+  Res = VM.execute("fib_acc", AccParams, AccTypes);
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint64_t>(), UINT64_C(2880067194370816120));
+
+  std::array<ValVariant, 2> AckParams = {UINT32_C(2), UINT32_C(3)};
+  std::array<ValType, 2> AckTypes = {ValType(TypeCode::I32),
+                                     ValType(TypeCode::I32)};
+  Res = VM.execute("ack", AckParams, AckTypes);
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint32_t>(), UINT32_C(9));
+
+  Res = VM.execute("zero");
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1);
+  EXPECT_EQ(Res->at(0).first.get<uint64_t>(), UINT64_C(0));
+
+  for (const auto Name : {"handled"sv, "tail_handled"sv}) {
+    Res = VM.execute(Name);
+    ASSERT_TRUE(Res) << Name;
+    ASSERT_EQ(Res->size(), 1);
+    EXPECT_EQ(Res->at(0).first.get<uint32_t>(), UINT32_C(1)) << Name;
+  }
+}
+
+/// Regression test for the table initialization.
+///
+/// The active element segments are evaluated into the tables directly when
+/// initializing them, and the passive segments when instantiating. Both must
+/// fill the same references, and an active segment that does not fit must
+/// trap without evaluating into the table.
+TEST(ExecutorRegression, ElemSegmentInit) {
+  {
+    Configure Conf;
+    VM::VM VM(Conf);
+    ASSERT_TRUE(VM.loadWasm(ElemInitWasm));
+    ASSERT_TRUE(VM.validate());
+    ASSERT_TRUE(VM.instantiate());
+    auto Res = VM.execute("run");
+    ASSERT_TRUE(Res);
+    ASSERT_EQ(Res->size(), 1);
+    EXPECT_EQ(Res->at(0).first.get<uint32_t>(), UINT32_C(4));
+  }
+  {
+    Configure Conf;
+    VM::VM VM(Conf);
+    ASSERT_TRUE(VM.loadWasm(ElemOOBWasm));
+    ASSERT_TRUE(VM.validate());
+    auto Res = VM.instantiate();
+    ASSERT_FALSE(Res);
+    EXPECT_EQ(Res.error(), ErrCode::Value::TableOutOfBounds);
+  }
+}
+
 } // namespace
 
 GTEST_API_ int main(int argc, char **argv) {
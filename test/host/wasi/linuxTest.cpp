@@ -2,7 +2,13 @@
 #include <gtest/gtest.h>
 #if WASMEDGE_OS_LINUX
 
+#if WASMEDGE_WASI_IO_URING
+#include "../../../lib/host/wasi/iouring.h"
+#endif
 #include "../../../lib/host/wasi/linux.h"
+#if WASMEDGE_WASI_IO_URING
+#include <poll.h>
+#endif
 
 using namespace WasmEdge::Host::WASI::detail;
 
@@ -282,4 +288,54 @@ TEST(LinuxTest, toAddressFamily) {
   EXPECT_EQ(toAddressFamily(__WASI_ADDRESS_FAMILY_INET4), PF_INET);
   EXPECT_EQ(toAddressFamily(__WASI_ADDRESS_FAMILY_INET6), PF_INET6);
 }
+
+#if WASMEDGE_WASI_IO_URING
+TEST(LinuxTest, IOUring) {
+  auto Ring = IOUring::create(2);
+  if (!Ring) {
+    GTEST_SKIP() << "io_uring is not available";
+  }
+  uint64_t UserData;
+  int32_t Res;
+
+  int Pipe[2];
+  ASSERT_EQ(::pipe(Pipe), 0);
+  // Polls beyond the ring size are submitted in several batches.
+  EXPECT_TRUE(Ring->pollAdd(Pipe[0], POLLIN, 1));
+  EXPECT_TRUE(Ring->pollAdd(Pipe[1], POLLOUT, 2));
+  EXPECT_TRUE(Ring->pollAdd(Pipe[0], POLLIN, 3));
+  EXPECT_EQ(Ring->submit(1), 0);
+  ASSERT_TRUE(Ring->popCompletion(UserData, Res));
+  EXPECT_EQ(UserData, 2U);
+  EXPECT_TRUE(Res & POLLOUT);
+  EXPECT_FALSE(Ring->popCompletion(UserData, Res));
+
+  // A write completes both pending polls of the read end.
+  ASSERT_EQ(::write(Pipe[1], "x", 1), 1);
+  EXPECT_EQ(Ring->submit(2), 0);
+  uint64_t Completed = 0;
+  while (Ring->popCompletion(UserData, Res)) {
+    EXPECT_TRUE(Res & POLLIN);
+    Completed |= UINT64_C(1) << UserData;
+  }
+  EXPECT_EQ(Completed, (UINT64_C(1) << 1) | (UINT64_C(1) << 3));
+
+  // A cancelled poll completes with ECANCELED.
+  char Buffer;
+  ASSERT_EQ(::read(Pipe[0], &Buffer, 1), 1);
+  EXPECT_TRUE(Ring->pollAdd(Pipe[0], POLLIN, 4));
+  EXPECT_TRUE(Ring->pollRemove(4));
+  EXPECT_EQ(Ring->submit(2), 0);
+  bool Cancelled = false;
+  while (Ring->popCompletion(UserData, Res)) {
+    if (UserData == 4) {
+      EXPECT_EQ(Res, -ECANCELED);
+      Cancelled = true;
+    }
+  }
+  EXPECT_TRUE(Cancelled);
+  ::close(Pipe[0]);
+  ::close(Pipe[1]);
+}
+#endif
 #endif
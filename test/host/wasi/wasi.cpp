@@ -5,6 +5,7 @@
 #include "common/types.h"
 #include "host/wasi/wasibase.h"
 #include "host/wasi/wasifunc.h"
+#include "host/wasi/wasimodule.h"
 #include "runtime/instance/module.h"
 #include "system/winapi.h"
 #include <algorithm>
@@ -2651,6 +2652,43 @@ TEST(WasiTest, PollOneoffSocketV2RWPoll) {
 }
 
 #if !WASMEDGE_OS_WINDOWS
+
+TEST(WasiTest, PollOneoffReusedFd) {
+  WasmEdge::Host::WASI::Environ Env;
+  Env.init({}, "test"s, {}, {});
+  std::array<__wasi_event_t, 2> Events;
+  auto Poll = Env.acquirePoller(Events);
+  ASSERT_TRUE(Poll);
+  auto &Poller = *Poll;
+  // Wait for the socket to be writable, with a timeout.
+  auto PollWrite = [&](__wasi_fd_t Fd) {
+    if (!Poller.prepare(Events)) {
+      return false;
+    }
+    Poller.clock(__WASI_CLOCKID_MONOTONIC, UINT64_C(1000000000), 0,
+                 static_cast<__wasi_subclockflags_t>(0), 1);
+    Poller.write(Fd, WasmEdge::Host::WASI::TriggerType::Level, 2);
+    Poller.wait();
+    const auto NEvents = Poller.result();
+    Poller.reset();
+    return NEvents == 1 && Events[0].userdata == 2 &&
+           Events[0].error == __WASI_ERRNO_SUCCESS;
+  };
+
+  auto Fd = Env.sockOpen(__WASI_ADDRESS_FAMILY_INET4,
+                         __WASI_SOCK_TYPE_SOCK_DGRAM);
+  ASSERT_TRUE(Fd);
+  EXPECT_TRUE(PollWrite(*Fd));
+  // Close the socket while the poller is in use, so the next socket reuses
+  // its host file descriptor.
+  ASSERT_TRUE(Env.fdClose(*Fd));
+  Fd = Env.sockOpen(__WASI_ADDRESS_FAMILY_INET4, __WASI_SOCK_TYPE_SOCK_DGRAM);
+  ASSERT_TRUE(Fd);
+  EXPECT_TRUE(PollWrite(*Fd));
+
+  Env.releasePoller(std::move(Poller));
+  Env.fini();
+}
 TEST(WasiTest, EpollOneoffSocketV1) {
   std::atomic<ServerAction> Action(ServerAction::Start);
   std::atomic_bool ActionDone(false);
@@ -3778,6 +3816,63 @@ TEST(WasiTest, ProcExit) {
   Env.fini();
 }
 
+TEST(WasiTest, SharedModule) {
+  auto WasiMod1 = WasmEdge::Host::WasiModule::createShared();
+  auto WasiMod2 = WasmEdge::Host::WasiModule::createShared();
+  WasmEdge::Host::WasiModule BoundMod;
+
+  // The shared modules have their own function instances, which share the
+  // host function bodies.
+  EXPECT_EQ(WasiMod1->getFuncExportNum(), BoundMod.getFuncExportNum());
+  auto *FuncInst1 = WasiMod1->findFuncExports("args_sizes_get");
+  auto *FuncInst2 = WasiMod2->findFuncExports("args_sizes_get");
+  ASSERT_TRUE(FuncInst1 != nullptr);
+  ASSERT_TRUE(FuncInst2 != nullptr);
+  EXPECT_NE(FuncInst1, FuncInst2);
+  EXPECT_EQ(FuncInst1->getModule(), WasiMod1.get());
+  EXPECT_EQ(&FuncInst1->getHostFunc(), &FuncInst2->getHostFunc());
+  EXPECT_NE(&FuncInst1->getHostFunc(),
+            &BoundMod.findFuncExports("args_sizes_get")->getHostFunc());
+
+  // The shared body uses the environment of the module owning the called
+  // function instance, whichever module calls it.
+  std::array<WasmEdge::ValVariant, 1> Errno;
+  WasiMod1->init({}, "test"s, {"abc"s}, {});
+  WasiMod2->init({}, "test"s, {}, {});
+  WasmEdge::Runtime::Instance::ModuleInstance Mod("");
+  Mod.addHostMemory(
+      "memory", std::make_unique<WasmEdge::Runtime::Instance::MemoryInstance>(
+                    WasmEdge::AST::MemoryType(1)));
+  auto *MemInstPtr = Mod.findMemoryExports("memory");
+  ASSERT_TRUE(MemInstPtr != nullptr);
+  auto &MemInst = *MemInstPtr;
+  for (const auto *FuncInst : {FuncInst1, FuncInst2}) {
+    WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod, FuncInst);
+
+    writeDummyMemoryContent(MemInst);
+    EXPECT_TRUE(FuncInst->getHostFunc().run(
+        CallFrame,
+        std::initializer_list<WasmEdge::ValVariant>{UINT32_C(0), UINT32_C(4)},
+        Errno));
+    EXPECT_EQ(Errno[0].get<int32_t>(), __WASI_ERRNO_SUCCESS);
+    EXPECT_EQ(
+        WasmEdge::EndianValue(*MemInst.getPointer<const uint32_t *>(0)).le(),
+        FuncInst == FuncInst1 ? UINT32_C(2) : UINT32_C(1));
+  }
+
+  // Without the called function instance, the shared body has no
+  // environment.
+  {
+    WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod);
+    auto Res = FuncInst1->getHostFunc().run(
+        CallFrame,
+        std::initializer_list<WasmEdge::ValVariant>{UINT32_C(0), UINT32_C(4)},
+        Errno);
+    ASSERT_FALSE(Res);
+    EXPECT_EQ(Res.error(), WasmEdge::ErrCode::Value::HostFuncError);
+  }
+}
+
 TEST(WasiTest, Random) {
   WasmEdge::Host::WASI::Environ Env;
   WasmEdge::Runtime::Instance::ModuleInstance Mod("");
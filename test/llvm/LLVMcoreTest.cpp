@@ -15,6 +15,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "common/defines.h"
+#include "common/profile.h"
 #include "common/spdlog.h"
 #include "executor/executor.h"
 #include "loader/loader.h"
@@ -100,8 +101,9 @@ const std::array<WasmEdge::Byte, 183> CrossModuleCallerWasm{
 // Parse, validate, compile, and attach compiled symbols. The Loader gets the
 // executor's intrinsics table so loadExecutable can patch the code's intrinsics
 // global; without it, intrinsic calls jump through a null table.
-std::shared_ptr<AST::Module> compileToJIT(const Configure &Conf,
-                                          Span<const Byte> Bytes) {
+std::shared_ptr<AST::Module>
+compileToJIT(const Configure &Conf, Span<const Byte> Bytes,
+             const Profile::Profile *Prof = nullptr) {
   Loader::Loader LoaderEngine(Conf, &Executor::Executor::Intrinsics);
   Validator::Validator ValidatorEngine(Conf);
   auto ModOrErr = LoaderEngine.parseModule(Bytes);
@@ -116,6 +118,7 @@ std::shared_ptr<AST::Module> compileToJIT(const Configure &Conf,
   if (!Compiler.checkConfigure()) {
     return nullptr;
   }
+  Compiler.setProfile(Prof);
   auto Data = Compiler.compile(*Mod);
   if (!Data) {
     return nullptr;
@@ -967,6 +970,76 @@ TEST(AOTCrossModule, CompiledFramelessTrapAttributedToCallee) {
       << "frameless cross-module trap was not attributed to the callee module";
 }
 
+// The profiled call_indirect callee is promoted to a direct call, which must
+// still only be taken when the table slot holds that callee.
+//   (type $t (func (param i32) (result i32)))
+//   (table 2 funcref) (elem (i32.const 0) $inc $dbl)
+//   (func $inc (type $t) (i32.add (local.get 0) (i32.const 1)))
+//   (func $dbl (type $t) (i32.mul (local.get 0) (i32.const 2)))
+//   (func (export "call") (param i32 i32) (result i32)
+//     (call_indirect (type $t) (local.get 0) (local.get 1)))
+const std::array<WasmEdge::Byte, 83> IndirectCallProfileWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x02, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x03, 0x04,
+    0x03, 0x00, 0x00, 0x01, 0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x07, 0x08,
+    0x01, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x02, 0x09, 0x08, 0x01, 0x00,
+    0x41, 0x00, 0x0b, 0x02, 0x00, 0x01, 0x0a, 0x1b, 0x03, 0x07, 0x00, 0x20,
+    0x00, 0x41, 0x01, 0x6a, 0x0b, 0x07, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6c,
+    0x0b, 0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0x11, 0x00, 0x00, 0x0b};
+
+TEST(ProfileGuidedOptimization, PromotedCallIndirect) {
+  Configure Conf;
+  const std::array<ValType, 2> ParamTypes{ValType(TypeCode::I32),
+                                          ValType(TypeCode::I32)};
+
+  // Record the profile in the interpreter: slot 0 takes 8 of the 10 calls.
+  Profile::Profile Prof;
+  uint32_t SiteOffset = 0;
+  {
+    auto Mod = loadModule(Conf, IndirectCallProfileWasm);
+    ASSERT_NE(Mod, nullptr);
+    Executor::Executor ExecEngine(Conf);
+    Runtime::StoreManager Store;
+    auto InstOrErr = ExecEngine.instantiateModule(Store, *Mod);
+    ASSERT_TRUE(InstOrErr);
+    auto Inst = std::move(*InstOrErr);
+    ExecEngine.setProfile(&Prof, Inst.get());
+    const auto *Call = Inst->findFuncExports("call");
+    ASSERT_NE(Call, nullptr);
+    SiteOffset = Call->getInstrs()[2].getOffset();
+    for (uint32_t I = 0; I < 10; ++I) {
+      const std::array<ValVariant, 2> Params{ValVariant(I),
+                                             ValVariant(I % 5 == 4 ? 1U : 0U)};
+      ASSERT_TRUE(ExecEngine.invoke(Call, Params, ParamTypes));
+    }
+    ExecEngine.setProfile(nullptr, nullptr);
+  }
+  const auto Target = Prof.getIndirectCallTarget(SiteOffset);
+  ASSERT_TRUE(Target);
+  EXPECT_EQ(Target->second, 8U);
+
+  auto Mod = compileToJIT(Conf, IndirectCallProfileWasm, &Prof);
+  ASSERT_NE(Mod, nullptr);
+  Executor::Executor ExecEngine(Conf);
+  Runtime::StoreManager Store;
+  auto InstOrErr = ExecEngine.instantiateModule(Store, *Mod);
+  ASSERT_TRUE(InstOrErr);
+  auto Inst = std::move(*InstOrErr);
+  const auto *Call = Inst->findFuncExports("call");
+  ASSERT_NE(Call, nullptr);
+  ASSERT_TRUE(Call->isCompiledFunction());
+  // Both the promoted callee and the other one are called.
+  for (const auto &[Slot, Expected] :
+       {std::pair<uint32_t, uint32_t>{0, 6}, {1, 10}}) {
+    const std::array<ValVariant, 2> Params{ValVariant(UINT32_C(5)),
+                                           ValVariant(Slot)};
+    auto Res = ExecEngine.invoke(Call, Params, ParamTypes);
+    ASSERT_TRUE(Res);
+    ASSERT_EQ(Res->size(), 1u);
+    EXPECT_EQ((*Res)[0].first.get<uint32_t>(), Expected);
+  }
+}
+
 TEST_P(NativeCoreTest, TestSuites) {
   auto [Proposal, Conf, UnitName] = T.resolve(GetParam());
   // Native AOT spec test: explicitly opt into RunMode::AOT so the runtime
@@ -17,14 +17,19 @@
 //===----------------------------------------------------------------------===//
 
 #include "common/configure.h"
+#include "common/filesystem.h"
 #include "common/spdlog.h"
 #include "common/types.h"
+#include "loader/loader.h"
 #include "runtime/callingframe.h"
 #include "runtime/instance/module.h"
 #include "vm/vm.h"
 #include "llvm/compiler.h"
 #include "llvm/jit.h"
+#include "llvm/objcache.h"
 #include <gtest/gtest.h>
+#include <random>
+#include <string>
 #include <thread>
 
 namespace {
@@ -108,6 +113,34 @@ std::vector<uint8_t> IntrinsicsWasm = {
     0x77, 0x00, 0x01, 0x0a, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x0b, 0x06,
     0x00, 0x20, 0x00, 0x40, 0x00, 0x0b};
 
+// Library module with "dbl" (i32)->i32 of type index 1 in an exported table:
+//   (type (func (param i64)))
+//   (type (func (param i32) (result i32)))
+//   (table (export "tab") 2 funcref)
+//   (elem (i32.const 0) $dbl)
+//   export "dbl" -> i32.mul (local.get 0) (i32.const 2)
+std::vector<uint8_t> TableLibWasm = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+    0x01, 0x7e, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x01,
+    0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x07, 0x0d, 0x02, 0x03, 0x74, 0x61,
+    0x62, 0x01, 0x00, 0x03, 0x64, 0x62, 0x6c, 0x00, 0x00, 0x09, 0x07, 0x01,
+    0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x09, 0x01, 0x07, 0x00, 0x20,
+    0x00, 0x41, 0x02, 0x6c, 0x0b};
+
+// Consumer module importing the table of "lib" as "lib"."tab":
+//   (type (func (param i32) (result i32)))
+//   (type (func (result i64)))
+//   export "call" -> call_indirect (type 0) of slot 0
+//   export "bad"  -> call_indirect (type 1) of slot 0, which traps
+std::vector<uint8_t> TableUserWasm = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x01, 0x7e, 0x02, 0x0d, 0x01, 0x03,
+    0x6c, 0x69, 0x62, 0x03, 0x74, 0x61, 0x62, 0x01, 0x70, 0x00, 0x02, 0x03,
+    0x03, 0x02, 0x00, 0x01, 0x07, 0x0e, 0x02, 0x04, 0x63, 0x61, 0x6c, 0x6c,
+    0x00, 0x00, 0x03, 0x62, 0x61, 0x64, 0x00, 0x01, 0x0a, 0x13, 0x02, 0x09,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x11, 0x00, 0x00, 0x0b, 0x07, 0x00, 0x41,
+    0x00, 0x11, 0x01, 0x00, 0x0b};
+
 class HostAdd : public Runtime::HostFunction<HostAdd> {
 public:
   Expect<uint32_t> body(const Runtime::CallingFrame &, uint32_t A, uint32_t B) {
@@ -378,6 +411,140 @@ TEST_F(LazyJITTest, LazyJITMultipleInstantiations) {
   }
 }
 
+TEST_F(LazyJITTest, TieredSwapsInCompiledCode) {
+  Configure Conf;
+  Conf.getRuntimeConfigure().setRunMode(RunMode::Tiered);
+  Conf.getCompilerConfigure().setOptimizationLevel(
+      CompilerConfigure::OptimizationLevel::O1);
+  auto VM = std::make_unique<VM::VM>(Conf);
+
+  ASSERT_TRUE(VM->loadWasm(FibonacciWasm));
+  ASSERT_TRUE(VM->validate());
+  ASSERT_TRUE(VM->instantiate());
+
+  // The results stay correct while the calls move from the interpreter to
+  // the background-compiled code.
+  std::vector<ValType> Types = {ValType(TypeCode::I32)};
+  std::vector<ValVariant> Params = {UINT32_C(15)};
+  for (uint32_t I = 0; I < 1000 && VM->getLazyCompiledFuncCount() == 0;
+       ++I) {
+    auto Result = VM->execute("fib", Params, Types);
+    ASSERT_TRUE(Result);
+    EXPECT_EQ((*Result)[0].first.get<uint32_t>(), 987U);
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(VM->getLazyCompiledFuncCount(), 1U);
+
+  auto Result = VM->execute("fib", Params, Types);
+  ASSERT_TRUE(Result);
+  EXPECT_EQ((*Result)[0].first.get<uint32_t>(), 987U);
+  VM->cleanup();
+}
+
+/// Temporary JIT cache directory of a test, removed with the object.
+class TempJITCacheDir {
+public:
+  TempJITCacheDir()
+      : Path(std::filesystem::temp_directory_path() /
+             ("wasmedge-jit-cache-" + std::to_string(std::random_device{}()))) {
+  }
+  ~TempJITCacheDir() noexcept {
+    std::error_code EC;
+    std::filesystem::remove_all(Path, EC);
+  }
+  const std::filesystem::path Path;
+};
+
+TEST_F(LazyJITTest, JITCacheHitOnSecondRun) {
+  const TempJITCacheDir CacheDir;
+  const auto Run = [&CacheDir](RunMode Mode, uint64_t &Hits,
+                               uint64_t &Misses) {
+    Configure Conf;
+    Conf.getRuntimeConfigure().setRunMode(Mode);
+    Conf.getRuntimeConfigure().setEnableJITCache(true);
+    ASSERT_TRUE(Conf.getRuntimeConfigure().setJITCacheDir(CacheDir.Path));
+    Conf.getCompilerConfigure().setOptimizationLevel(
+        CompilerConfigure::OptimizationLevel::O1);
+    VM::VM VM(Conf);
+    ASSERT_TRUE(VM.loadWasm(SimpleWasm));
+    ASSERT_TRUE(VM.validate());
+    ASSERT_TRUE(VM.instantiate());
+    std::vector<ValVariant> Params = {6U, 7U};
+    std::vector<ValType> Types = {ValType(TypeCode::I32),
+                                  ValType(TypeCode::I32)};
+    auto Result = VM.execute("mul", Params, Types);
+    ASSERT_TRUE(Result);
+    EXPECT_EQ((*Result)[0].first.get<uint32_t>(), 42U);
+    Hits = VM.getStatistics().getJITCacheHits();
+    Misses = VM.getStatistics().getJITCacheMisses();
+  };
+
+  for (const auto Mode : {RunMode::JIT, RunMode::LazyJIT}) {
+    // The first run compiles and stores the objects, the second one loads
+    // them without compiling.
+    const auto Before = LLVM::getJITCacheStatistics();
+    uint64_t Hits = 0, Misses = 0;
+    Run(Mode, Hits, Misses);
+    EXPECT_EQ(Hits, 0U);
+    EXPECT_GT(Misses, 0U);
+    Run(Mode, Hits, Misses);
+    EXPECT_GT(Hits, 0U);
+    EXPECT_EQ(Misses, 0U);
+    // The process-wide counters sum up the lookups of all the VMs.
+    const auto After = LLVM::getJITCacheStatistics();
+    EXPECT_EQ(After.Hits - Before.Hits, Hits);
+  }
+  EXPECT_FALSE(std::filesystem::is_empty(CacheDir.Path));
+}
+
+TEST_F(LazyJITTest, JITCacheDirMustBeAbsolute) {
+  const TempJITCacheDir CacheDir;
+  Configure Conf;
+  ASSERT_TRUE(Conf.getRuntimeConfigure().setJITCacheDir(CacheDir.Path));
+  auto Res = Conf.getRuntimeConfigure().setJITCacheDir("relative/jit");
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::IllegalPath);
+  // The rejected path keeps the previous directory.
+  EXPECT_EQ(Conf.getRuntimeConfigure().getJITCacheDir(), CacheDir.Path);
+  EXPECT_TRUE(Conf.getRuntimeConfigure().setJITCacheDir({}));
+  EXPECT_TRUE(Conf.getRuntimeConfigure().getJITCacheDir().empty());
+}
+
+TEST_F(LazyJITTest, JITCacheKeyedByConfigure) {
+  const TempJITCacheDir CacheDir;
+  Configure Conf;
+  Conf.getRuntimeConfigure().setEnableJITCache(true);
+  ASSERT_TRUE(Conf.getRuntimeConfigure().setJITCacheDir(CacheDir.Path));
+  Loader::Loader Load(Conf);
+  auto Module = Load.parseModule(SimpleWasm);
+  ASSERT_TRUE(Module);
+  Configure O2Conf(Conf);
+  O2Conf.getCompilerConfigure().setOptimizationLevel(
+      CompilerConfigure::OptimizationLevel::O2);
+  Configure GenericConf(Conf);
+  GenericConf.getCompilerConfigure().setGenericBinary(true);
+  // The default run mode is the interpreter, which the force interpreter
+  // option selects.
+  Configure JITConf(Conf);
+  JITConf.getRuntimeConfigure().setRunMode(RunMode::JIT);
+  Configure DisabledConf;
+
+  LLVM::ObjectCache Cache(Conf, **Module);
+  LLVM::ObjectCache O2Cache(O2Conf, **Module);
+  LLVM::ObjectCache GenericCache(GenericConf, **Module);
+  LLVM::ObjectCache JITCache(JITConf, **Module);
+  LLVM::ObjectCache DisabledCache(DisabledConf, **Module);
+  ASSERT_TRUE(Cache.enabled());
+  EXPECT_FALSE(DisabledCache.enabled());
+  const uint32_t Batch[] = {1, 2};
+  EXPECT_EQ(Cache.getPath("module"sv).parent_path(), CacheDir.Path);
+  EXPECT_EQ(Cache.getPath("module"sv), Cache.getPath("module"sv));
+  EXPECT_NE(Cache.getPath("module"sv), O2Cache.getPath("module"sv));
+  EXPECT_NE(Cache.getPath("module"sv), GenericCache.getPath("module"sv));
+  EXPECT_NE(Cache.getPath("module"sv), JITCache.getPath("module"sv));
+  EXPECT_NE(Cache.getPath("module"sv), Cache.getPath("batch"sv, Batch));
+}
+
 TEST_F(LazyJITTest, LazyJITReinstantiateSameVM) {
   auto VM = createLazyJITVM();
 
@@ -567,6 +734,32 @@ TEST_F(LazyJITTest, LazyJITWasmImportsWasm) {
   VM->cleanup();
 }
 
+TEST_F(LazyJITTest, CallIndirectIntoOtherModule) {
+  // The callee of another module with an equivalent type of another index is
+  // called directly with the module context of its own module once compiled.
+  // The eager JIT VM interprets the registered library, so its calls resolve
+  // through the runtime and fall back to the interpreter.
+  std::unique_ptr<VM::VM> VMs[] = {createEagerJITVM(), createLazyJITVM()};
+  for (auto &VM : VMs) {
+    ASSERT_TRUE(VM->registerModule("lib", TableLibWasm));
+    ASSERT_TRUE(VM->loadWasm(TableUserWasm));
+    ASSERT_TRUE(VM->validate());
+    ASSERT_TRUE(VM->instantiate());
+
+    std::vector<ValType> Types = {ValType(TypeCode::I32)};
+    for (const uint32_t Value : {21U, 50U}) {
+      std::vector<ValVariant> Params = {Value};
+      auto Result = VM->execute("call", Params, Types);
+      ASSERT_TRUE(Result);
+      EXPECT_EQ((*Result)[0].first.get<uint32_t>(), Value * 2);
+    }
+    auto Result = VM->execute("bad");
+    ASSERT_FALSE(Result);
+    EXPECT_EQ(Result.error(), ErrCode::Value::IndirectCallTypeMismatch);
+    VM->cleanup();
+  }
+}
+
 TEST_F(LazyJITTest, LazyJITReferenceModuleNotReleasedOnCleanup) {
   bool Destroyed = false;
   auto Deleter = [&Destroyed](AST::Module *M) {
@@ -282,6 +282,33 @@ TEST(ModuleTest, LoadNativeLibraryMagicNotInAOTMode) {
   }
 }
 
+TEST(ModuleTest, LoadUnusableAOTVariants) {
+  WasmEdge::Configure AOTConf;
+  AOTConf.getRuntimeConfigure().setRunMode(WasmEdge::RunMode::AOT);
+  WasmEdge::Loader::Loader AOTLdr(AOTConf);
+
+  // 10. Test load module with malformed and unknown AOT code variants. The
+  // variants are skipped and the module falls back to the interpreter.
+  std::vector<uint8_t> Vec = {
+      0x00U, 0x61U, 0x73U, 0x6DU, // Magic
+      0x01U, 0x00U, 0x00U, 0x00U, // Version
+      // Custom section "wasmedge.x86-64-v2" with a truncated content
+      0x00U, 0x15U, 0x12U, 'w', 'a', 's', 'm', 'e', 'd', 'g', 'e', '.', 'x',
+      '8', '6', '-', '6', '4', '-', 'v', '2', 0x01U, 0x02U,
+      // Custom section "wasmedge.cpu" for an unknown CPU
+      0x00U, 0x0EU, 0x0CU, 'w', 'a', 's', 'm', 'e', 'd', 'g', 'e', '.', 'c',
+      'p', 'u', 0x00U,
+      // Type section
+      0x01U, 0x04U, 0x01U, 0x60U, 0x00U, 0x00U,
+      // Function section
+      0x03U, 0x02U, 0x01U, 0x00U,
+      // Code section
+      0x0AU, 0x04U, 0x01U, 0x02U, 0x00U, 0x0BU};
+  auto Res = AOTLdr.parseModule(Vec);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ((*Res)->getCodeSection().getContent().size(), 1U);
+}
+
 } // namespace
 
 GTEST_API_ int main(int argc, char **argv) {
@@ -123,6 +123,97 @@ TEST_F(WasiCryptoTest, Aeads) {
   AeadsTest("CHACHA20-POLY1305"sv, std::vector<uint8_t>(12, 42), 16, "test"_u8);
 }
 
+TEST_F(WasiCryptoTest, AeadsBatch) {
+  auto AeadsBatchTest = [this](std::string_view Name) {
+    SCOPED_TRACE(Name);
+
+    WASI_CRYPTO_EXPECT_SUCCESS(KeyHandle,
+                               symmetricKeyGenerate(Name, std::nullopt));
+    const std::vector<std::vector<uint8_t>> Nonces{
+        std::vector<uint8_t>(12, 1), std::vector<uint8_t>(12, 2),
+        std::vector<uint8_t>(12, 3)};
+    const std::vector<std::vector<uint8_t>> Msgs{"first"_u8, ""_u8,
+                                                 "third message"_u8};
+    const auto Ad = "ad"_u8;
+
+    std::vector<std::vector<uint8_t>> Sealed;
+    std::vector<Symmetric::AeadBatchItem> Items;
+    for (size_t I = 0; I < Msgs.size(); ++I) {
+      Sealed.emplace_back(Msgs[I].size() + 16);
+    }
+    for (size_t I = 0; I < Msgs.size(); ++I) {
+      Items.push_back({Nonces[I], Ad, Msgs[I], Sealed[I]});
+    }
+    WASI_CRYPTO_EXPECT_SUCCESS(SealResults,
+                               symmetricAeadBatch(KeyHandle, Items, true));
+    EXPECT_EQ(SealResults, std::vector<__wasi_crypto_errno_e_t>(
+                               Msgs.size(), __WASI_CRYPTO_ERRNO_SUCCESS));
+
+    // A batch-sealed record opens with a single state.
+    {
+      WASI_CRYPTO_EXPECT_SUCCESS(OptionsHandle,
+                                 optionsOpen(__WASI_ALGORITHM_TYPE_SYMMETRIC));
+      WASI_CRYPTO_EXPECT_TRUE(optionsSet(OptionsHandle, "nonce"sv, Nonces[2]));
+      WASI_CRYPTO_EXPECT_SUCCESS(
+          StateHandle, symmetricStateOpen(Name, KeyHandle, OptionsHandle));
+      WASI_CRYPTO_EXPECT_TRUE(symmetricStateAbsorb(StateHandle, Ad));
+      std::vector<uint8_t> Msg(Msgs[2].size());
+      WASI_CRYPTO_EXPECT_TRUE(
+          symmetricStateDecrypt(StateHandle, Msg, Sealed[2]));
+      EXPECT_EQ(Msg, Msgs[2]);
+      WASI_CRYPTO_EXPECT_TRUE(symmetricStateClose(StateHandle));
+      WASI_CRYPTO_EXPECT_TRUE(optionsClose(OptionsHandle));
+    }
+
+    // A tampered record fails alone.
+    Sealed[0][0] ^= 1;
+    std::vector<std::vector<uint8_t>> Opened;
+    for (size_t I = 0; I < Msgs.size(); ++I) {
+      Opened.emplace_back(Msgs[I].size());
+    }
+    Items.clear();
+    for (size_t I = 0; I < Msgs.size(); ++I) {
+      Items.push_back({Nonces[I], Ad, Sealed[I], Opened[I]});
+    }
+    WASI_CRYPTO_EXPECT_SUCCESS(OpenResults,
+                               symmetricAeadBatch(KeyHandle, Items, false));
+    EXPECT_EQ(OpenResults, (std::vector<__wasi_crypto_errno_e_t>{
+                               __WASI_CRYPTO_ERRNO_INVALID_TAG,
+                               __WASI_CRYPTO_ERRNO_SUCCESS,
+                               __WASI_CRYPTO_ERRNO_SUCCESS}));
+    EXPECT_EQ(Opened[1], Msgs[1]);
+    EXPECT_EQ(Opened[2], Msgs[2]);
+
+    // A wrong nonce size fails alone.
+    Items[1].Nonce = Span<const uint8_t>(Nonces[1]).first(8);
+    WASI_CRYPTO_EXPECT_SUCCESS(NonceResults,
+                               symmetricAeadBatch(KeyHandle, Items, false));
+    EXPECT_EQ(NonceResults[1], __WASI_CRYPTO_ERRNO_INVALID_NONCE);
+    EXPECT_EQ(NonceResults[2], __WASI_CRYPTO_ERRNO_SUCCESS);
+
+    WASI_CRYPTO_EXPECT_TRUE(symmetricKeyClose(KeyHandle));
+
+    // A closed handle stays invalid after its slot is reused.
+    WASI_CRYPTO_EXPECT_SUCCESS(NewKeyHandle,
+                               symmetricKeyGenerate(Name, std::nullopt));
+    EXPECT_NE(NewKeyHandle, KeyHandle);
+    WASI_CRYPTO_EXPECT_FAILURE(symmetricAeadBatch(KeyHandle, Items, false),
+                               __WASI_CRYPTO_ERRNO_INVALID_HANDLE);
+    WASI_CRYPTO_EXPECT_TRUE(symmetricKeyClose(NewKeyHandle));
+  };
+
+  AeadsBatchTest("AES-128-GCM"sv);
+  AeadsBatchTest("AES-256-GCM"sv);
+  AeadsBatchTest("CHACHA20-POLY1305"sv);
+
+  // Only the AEAD keys support the batch.
+  WASI_CRYPTO_EXPECT_SUCCESS(
+      KeyHandle, symmetricKeyGenerate("HMAC/SHA-256"sv, std::nullopt));
+  WASI_CRYPTO_EXPECT_FAILURE(symmetricAeadBatch(KeyHandle, {}, true),
+                             __WASI_CRYPTO_ERRNO_INVALID_OPERATION);
+  WASI_CRYPTO_EXPECT_TRUE(symmetricKeyClose(KeyHandle));
+}
+
 } // namespace WasiCrypto
 } // namespace Host
 } // namespace WasmEdge
@@ -737,6 +737,56 @@ WasiCryptoTest::symmetricStateRatchet(__wasi_symmetric_state_t StateHandle) {
   return {};
 }
 
+WasiCryptoExpect<std::vector<__wasi_crypto_errno_e_t>>
+WasiCryptoTest::symmetricAeadBatch(__wasi_symmetric_key_t KeyHandle,
+                                   Span<const Symmetric::AeadBatchItem> Items,
+                                   bool Encrypt) {
+  writeDummyMemoryContent();
+  // Layout: the records, the results, then the contents of the records.
+  const uint32_t ItemsLen = static_cast<uint32_t>(Items.size());
+  const uint32_t ResultsPtr = ItemsLen * 8 * sizeof(uint32_t);
+  uint32_t Ptr = ResultsPtr + ItemsLen * sizeof(__wasi_crypto_errno_e_t);
+  std::vector<uint32_t> Records;
+  std::vector<uint32_t> OutPtrs;
+  for (const auto &Item : Items) {
+    for (auto Content : {Item.Nonce, Item.AdditionalData, Item.Data}) {
+      writeSpan(Content, Ptr);
+      Records.push_back(Ptr);
+      Records.push_back(static_cast<uint32_t>(Content.size()));
+      Ptr += static_cast<uint32_t>(Content.size());
+    }
+    OutPtrs.push_back(Ptr);
+    Records.push_back(Ptr);
+    Records.push_back(static_cast<uint32_t>(Item.Out.size()));
+    Ptr += static_cast<uint32_t>(Item.Out.size());
+  }
+  std::copy(Records.begin(), Records.end(),
+            MemInst->getPointer<uint32_t *>(0));
+
+  Runtime::HostFunctionBase *Func;
+  if (Encrypt) {
+    Func = getHostFunc<Symmetric::AeadSealBatch>(WasiCryptoSymmMod,
+                                                 "symmetric_aead_seal_batch");
+  } else {
+    Func = getHostFunc<Symmetric::AeadOpenBatch>(WasiCryptoSymmMod,
+                                                 "symmetric_aead_open_batch");
+  }
+  EXPECT_NE(Func, nullptr);
+  EXPECT_TRUE(Func->run(CallFrame,
+                        std::initializer_list<WasmEdge::ValVariant>{
+                            KeyHandle, 0, ItemsLen, ResultsPtr},
+                        Errno));
+  ensureOrReturnOnTest(Errno[0].get<int32_t>());
+
+  for (size_t I = 0; I < Items.size(); ++I) {
+    std::copy_n(MemInst->getPointer<uint8_t *>(OutPtrs[I]),
+                Items[I].Out.size(), Items[I].Out.begin());
+  }
+  const auto *Results =
+      MemInst->getPointer<__wasi_crypto_errno_e_t *>(ResultsPtr);
+  return std::vector<__wasi_crypto_errno_e_t>(Results, Results + ItemsLen);
+}
+
 WasiCryptoExpect<__wasi_size_t>
 WasiCryptoTest::symmetricMaxTagLen(__wasi_symmetric_tag_t TagHandle) {
   writeDummyMemoryContent();
@@ -1411,6 +1461,40 @@ WasiCryptoExpect<void> WasiCryptoTest::signatureVerificationStateClose(
   return {};
 }
 
+WasiCryptoExpect<std::vector<__wasi_crypto_errno_e_t>>
+WasiCryptoTest::signatureVerifyBatch(
+    Span<const Signatures::VerifyBatchItem> Items) {
+  writeDummyMemoryContent();
+  // Layout: the records, the results, then the messages.
+  const uint32_t ItemsLen = static_cast<uint32_t>(Items.size());
+  const uint32_t ResultsPtr = ItemsLen * 4 * sizeof(uint32_t);
+  uint32_t Ptr = ResultsPtr + ItemsLen * sizeof(__wasi_crypto_errno_e_t);
+  std::vector<uint32_t> Records;
+  for (const auto &Item : Items) {
+    writeSpan(Item.Msg, Ptr);
+    Records.push_back(Item.PkHandle);
+    Records.push_back(Ptr);
+    Records.push_back(static_cast<uint32_t>(Item.Msg.size()));
+    Records.push_back(Item.SigHandle);
+    Ptr += static_cast<uint32_t>(Item.Msg.size());
+  }
+  std::copy(Records.begin(), Records.end(),
+            MemInst->getPointer<uint32_t *>(0));
+
+  auto *Func = getHostFunc<Signatures::VerifyBatch>(WasiCryptoSignMod,
+                                                    "signature_verify_batch");
+  EXPECT_NE(Func, nullptr);
+  EXPECT_TRUE(Func->run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{0, ItemsLen, ResultsPtr},
+      Errno));
+  ensureOrReturnOnTest(Errno[0].get<int32_t>());
+
+  const auto *Results =
+      MemInst->getPointer<__wasi_crypto_errno_e_t *>(ResultsPtr);
+  return std::vector<__wasi_crypto_errno_e_t>(Results, Results + ItemsLen);
+}
+
 // WasiCryptoExpect<__wasi_secretkey_t> WasiCryptoTest::secretkeyImport(
 //     __wasi_algorithm_type_e_t AlgType, std::string_view AlgStr,
 //     Span<const uint8_t> Encoded, __wasi_secretkey_encoding_e_t Encoding) {
@@ -245,6 +245,10 @@ protected:
   WasiCryptoExpect<void>
   symmetricStateRatchet(__wasi_symmetric_state_t StateHandle);
 
+  WasiCryptoExpect<std::vector<__wasi_crypto_errno_e_t>>
+  symmetricAeadBatch(__wasi_symmetric_key_t KeyHandle,
+                     Span<const Symmetric::AeadBatchItem> Items, bool Encrypt);
+
   WasiCryptoExpect<__wasi_size_t>
   symmetricMaxTagLen(__wasi_symmetric_tag_t TagHandle);
 
@@ -382,6 +386,9 @@ protected:
   WasiCryptoExpect<void> signatureVerificationStateClose(
       __wasi_signature_verification_state_t StateHandle);
 
+  WasiCryptoExpect<std::vector<__wasi_crypto_errno_e_t>>
+  signatureVerifyBatch(Span<const Signatures::VerifyBatchItem> Items);
+
   int32_t InvaildHandle = 9999;
 
   // Create the calling frame with memory instance.
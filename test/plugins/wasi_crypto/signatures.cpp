@@ -142,6 +142,50 @@ TEST_F(WasiCryptoTest, Signatures) {
         "00bc0ec320711b211fde92e57feb9013c3609342495ec0d7cabdec21e54acc38"_u8v}});
 }
 
+TEST_F(WasiCryptoTest, SignaturesVerifyBatch) {
+  auto VerifyBatchTest = [this](std::string_view Alg) {
+    SCOPED_TRACE(Alg);
+    const std::vector<std::vector<uint8_t>> Msgs{"first"_u8, "second"_u8,
+                                                 "third"_u8};
+    WASI_CRYPTO_EXPECT_SUCCESS(
+        KpHandle,
+        keypairGenerate(__WASI_ALGORITHM_TYPE_SIGNATURES, Alg, std::nullopt));
+    WASI_CRYPTO_EXPECT_SUCCESS(PkHandle, keypairPublickey(KpHandle));
+    std::vector<__wasi_signature_t> SigHandles;
+    for (const auto &Msg : Msgs) {
+      WASI_CRYPTO_EXPECT_SUCCESS(StateHandle, signatureStateOpen(KpHandle));
+      WASI_CRYPTO_EXPECT_TRUE(signatureStateUpdate(StateHandle, Msg));
+      WASI_CRYPTO_EXPECT_SUCCESS(SigHandle, signatureStateSign(StateHandle));
+      WASI_CRYPTO_EXPECT_TRUE(signatureStateClose(StateHandle));
+      SigHandles.push_back(SigHandle);
+    }
+
+    // The second record is signed for another message, and the third
+    // record has an invalid public key handle.
+    const std::vector<Signatures::VerifyBatchItem> Items{
+        {PkHandle, Msgs[0], SigHandles[0]},
+        {PkHandle, Msgs[1], SigHandles[2]},
+        {PkHandle, Msgs[2], SigHandles[2]},
+        {static_cast<__wasi_publickey_t>(InvaildHandle), Msgs[2],
+         SigHandles[2]}};
+    WASI_CRYPTO_EXPECT_SUCCESS(Results, signatureVerifyBatch(Items));
+    EXPECT_EQ(Results, (std::vector<__wasi_crypto_errno_e_t>{
+                           __WASI_CRYPTO_ERRNO_SUCCESS,
+                           __WASI_CRYPTO_ERRNO_VERIFICATION_FAILED,
+                           __WASI_CRYPTO_ERRNO_SUCCESS,
+                           __WASI_CRYPTO_ERRNO_INVALID_HANDLE}));
+
+    for (auto SigHandle : SigHandles) {
+      WASI_CRYPTO_EXPECT_TRUE(signatureClose(SigHandle));
+    }
+    WASI_CRYPTO_EXPECT_TRUE(publickeyClose(PkHandle));
+    WASI_CRYPTO_EXPECT_TRUE(keypairClose(KpHandle));
+  };
+  VerifyBatchTest("ECDSA_P256_SHA256"sv);
+  VerifyBatchTest("Ed25519"sv);
+  VerifyBatchTest("RSA_PSS_2048_SHA256"sv);
+}
+
 } // namespace WasiCrypto
 } // namespace Host
 } // namespace WasmEdge
@@ -8,8 +8,13 @@
 #include "runtime/instance/module.h"
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -224,6 +229,71 @@ TEST(WasiLoggingTests, func_log_oob) {
       {}));
 }
 
+TEST(WasiLoggingTests, func_log_async) {
+  using namespace std::literals::string_view_literals;
+  constexpr uint32_t ThreadCount = 8;
+  constexpr uint32_t LogCount = 1000;
+  std::remove("async.log");
+  {
+    auto WasiLoggingMod = createModule();
+    ASSERT_TRUE(WasiLoggingMod);
+    // A small queue makes the guest threads wait for the writer.
+    WasiLoggingMod->getEnv().enableAsync(16, false);
+    EXPECT_TRUE(WasiLoggingMod->getEnv().isAsync());
+
+    WasmEdge::Runtime::Instance::ModuleInstance Mod("");
+    Mod.addHostMemory(
+        "memory", std::make_unique<WasmEdge::Runtime::Instance::MemoryInstance>(
+                      WasmEdge::AST::MemoryType(1)));
+    auto *MemInstPtr = Mod.findMemoryExports("memory");
+    ASSERT_NE(MemInstPtr, nullptr);
+    auto &MemInst = *MemInstPtr;
+    WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod);
+    fillMemContent(MemInst, 0, 256);
+    fillMemContent(MemInst, 0, "async.log"sv);
+    fillMemContent(MemInst, 128, "This is log message"sv);
+
+    auto *FuncInst = WasiLoggingMod->findFuncExports("log");
+    ASSERT_NE(FuncInst, nullptr);
+    auto &HostFuncInst = FuncInst->getHostFunc();
+
+    // Open the log file before the guest threads log concurrently.
+    EXPECT_TRUE(HostFuncInst.run(
+        CallFrame,
+        std::initializer_list<WasmEdge::ValVariant>{
+            UINT32_C(2), UINT32_C(0), UINT32_C(9), UINT32_C(128),
+            UINT32_C(19)},
+        {}));
+    std::vector<std::thread> Threads;
+    for (uint32_t T = 0; T < ThreadCount; ++T) {
+      Threads.emplace_back([&]() {
+        for (uint32_t I = 0; I < LogCount; ++I) {
+          EXPECT_TRUE(HostFuncInst.run(
+              CallFrame,
+              std::initializer_list<WasmEdge::ValVariant>{
+                  UINT32_C(2), UINT32_C(0), UINT32_C(9), UINT32_C(128),
+                  UINT32_C(19)},
+              {}));
+        }
+      });
+    }
+    for (auto &Thread : Threads) {
+      Thread.join();
+    }
+    // Nothing is dropped when the guest threads wait on a full queue.
+    EXPECT_EQ(WasiLoggingMod->getEnv().getDroppedCount(), 0U);
+  }
+
+  // All the queued records are written out when the module is destroyed.
+  std::ifstream File("async.log");
+  uint32_t Lines = 0;
+  for (std::string Line; std::getline(File, Line);) {
+    EXPECT_NE(Line.find("This is log message"), std::string::npos);
+    ++Lines;
+  }
+  EXPECT_EQ(Lines, ThreadCount * LogCount + 1);
+}
+
 GTEST_API_ int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -140,10 +140,11 @@ TEST(WasmEdgeImageTest, Module) {
   // Create the wasmedge_image module instance.
   auto ImgMod = createModule();
   ASSERT_TRUE(ImgMod);
-  EXPECT_EQ(ImgMod->getFuncExportNum(), 3U);
+  EXPECT_EQ(ImgMod->getFuncExportNum(), 4U);
   EXPECT_NE(ImgMod->findFuncExports("load_jpg"), nullptr);
   EXPECT_NE(ImgMod->findFuncExports("load_png"), nullptr);
   EXPECT_NE(ImgMod->findFuncExports("load_image"), nullptr);
+  EXPECT_NE(ImgMod->findFuncExports("load_image_batch"), nullptr);
 }
 
 TEST(WasmEdgeImageTest, LoadJPG) {
@@ -640,6 +641,119 @@ TEST(WasmEdgeImageTest, InvalidParams) {
   EXPECT_EQ(Errno[0].get<uint32_t>(), static_cast<uint32_t>(ErrNo::Fail));
 }
 
+TEST(WasmEdgeImageTest, LoadImageBatch) {
+  // Create the wasmedge_image module instance.
+  auto ImgMod = createModule();
+  ASSERT_TRUE(ImgMod);
+
+  // Create the calling frame with memory instance.
+  WasmEdge::Runtime::Instance::ModuleInstance Mod("");
+  Mod.addHostMemory(
+      "memory", std::make_unique<WasmEdge::Runtime::Instance::MemoryInstance>(
+                    WasmEdge::AST::MemoryType(1)));
+  auto *MemInstPtr = Mod.findMemoryExports("memory");
+  ASSERT_TRUE(MemInstPtr != nullptr);
+  auto &MemInst = *MemInstPtr;
+  WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod);
+  std::array<WasmEdge::ValVariant, 1> Errno = {UINT32_C(0)};
+
+  // Keep the original 30x30 size, so the images are not resized.
+  uint32_t TargetW = 30, TargetH = 30;
+  uint32_t TargetSize = TargetW * TargetH * 3;
+  // Assume the pixel position (10, 20).
+  uint32_t Position = 20 * TargetW + 10;
+  // Input payload offsets.
+  uint32_t JPGOffset = 0, PNGOffset = 1024;
+  // Batch records and results offsets.
+  uint32_t ItemsOffset = 2048, ResultsOffset = 2560;
+  // Output image data offsets.
+  std::array<uint32_t, 3> OutOffsets = {4096, 16384, 28672};
+
+  // Get the function "load_image_batch".
+  auto *FuncInst = ImgMod->findFuncExports("load_image_batch");
+  EXPECT_NE(FuncInst, nullptr);
+  EXPECT_TRUE(FuncInst->isHostFunction());
+  auto &HostFuncInst = FuncInst->getHostFunc();
+
+  // Clear the memory[0, 65536].
+  fillMemContent(MemInst, 0, 65536);
+  fillMemContent(MemInst, JPGOffset, TestRedJPG);
+  fillMemContent(MemInst, PNGOffset, TestRedPNG);
+  // The third record has an empty payload and fails alone.
+  auto *Items = MemInst.getPointer<uint32_t *>(ItemsOffset);
+  const std::array<uint32_t, 12> Records = {
+      JPGOffset, static_cast<uint32_t>(TestRedJPG.size()),
+      OutOffsets[0], TargetSize * static_cast<uint32_t>(sizeof(float)),
+      PNGOffset, static_cast<uint32_t>(TestRedPNG.size()),
+      OutOffsets[1], TargetSize * static_cast<uint32_t>(sizeof(float)),
+      PNGOffset, 0U,
+      OutOffsets[2], TargetSize * static_cast<uint32_t>(sizeof(float))};
+  std::copy(Records.begin(), Records.end(), Items);
+  auto Results = MemInst.getSpan<const uint32_t>(ResultsOffset, 3);
+
+  // Test: Load the batch into 30x30 BGR u8 format.
+  EXPECT_TRUE(HostFuncInst.run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{
+          ItemsOffset,      // Records offset.
+          3U,               // Records count.
+          TargetW, TargetH, // Target width and height.
+          1U,               // Target type: BGR8.
+          ResultsOffset     // Results offset.
+      },
+      Errno));
+  EXPECT_EQ(Errno[0].get<uint32_t>(), static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[0], static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[1], static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[2], static_cast<uint32_t>(ErrNo::Fail));
+  auto OutJPGU8 = MemInst.getSpan<const uint8_t>(OutOffsets[0], TargetSize);
+  // Note: Due to the JPG compression, the R is 254, not 255 here.
+  EXPECT_EQ(OutJPGU8[Position * 3], UINT8_C(0));
+  EXPECT_EQ(OutJPGU8[Position * 3 + 1], UINT8_C(0));
+  EXPECT_EQ(OutJPGU8[Position * 3 + 2], UINT8_C(254));
+  auto OutPNGU8 = MemInst.getSpan<const uint8_t>(OutOffsets[1], TargetSize);
+  EXPECT_EQ(OutPNGU8[Position * 3], UINT8_C(0));
+  EXPECT_EQ(OutPNGU8[Position * 3 + 1], UINT8_C(0));
+  EXPECT_EQ(OutPNGU8[Position * 3 + 2], UINT8_C(255));
+
+  // Test: Load the batch into 30x30 BGR f32 format.
+  EXPECT_TRUE(HostFuncInst.run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{
+          ItemsOffset,      // Records offset.
+          3U,               // Records count.
+          TargetW, TargetH, // Target width and height.
+          3U,               // Target type: BGR32F.
+          ResultsOffset     // Results offset.
+      },
+      Errno));
+  EXPECT_EQ(Errno[0].get<uint32_t>(), static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[0], static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[1], static_cast<uint32_t>(ErrNo::Success));
+  EXPECT_EQ(Results[2], static_cast<uint32_t>(ErrNo::Fail));
+  auto OutJPGF32 = MemInst.getSpan<const float>(OutOffsets[0], TargetSize);
+  EXPECT_TRUE(std::fabs(OutJPGF32[Position * 3] - 0.0f) < 0.01f);
+  EXPECT_TRUE(std::fabs(OutJPGF32[Position * 3 + 1] - 0.0f) < 0.01f);
+  EXPECT_TRUE(std::fabs(OutJPGF32[Position * 3 + 2] - 1.0f) < 0.01f);
+  auto OutPNGF32 = MemInst.getSpan<const float>(OutOffsets[1], TargetSize);
+  EXPECT_EQ(OutPNGF32[Position * 3], 0.0f);
+  EXPECT_EQ(OutPNGF32[Position * 3 + 1], 0.0f);
+  EXPECT_EQ(OutPNGF32[Position * 3 + 2], 1.0f);
+
+  // Test: Records out of the memory should fail.
+  EXPECT_TRUE(HostFuncInst.run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{
+          65528U,           // Records offset.
+          3U,               // Records count.
+          TargetW, TargetH, // Target width and height.
+          0U,               // Target type: RGB8.
+          ResultsOffset     // Results offset.
+      },
+      Errno));
+  EXPECT_EQ(Errno[0].get<uint32_t>(), static_cast<uint32_t>(ErrNo::Fail));
+}
+
 GTEST_API_ int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -254,6 +254,144 @@ TEST(WasmEdgeZlibTest, DeflateInflateCycle) {
                          MemInst.getPointer<uint8_t *>(WasmData)));
 }
 
+TEST(WasmEdgeZlibTest, CompressUncompress) {
+  auto ZlibMod = createModule();
+  ASSERT_TRUE(ZlibMod);
+
+  // Create the calling frame with memory instance.
+  WasmEdge::Runtime::Instance::ModuleInstance Mod("");
+  Mod.addHostMemory(
+      "memory", std::make_unique<WasmEdge::Runtime::Instance::MemoryInstance>(
+                    WasmEdge::AST::MemoryType(16 * 64, 16 * 64)));
+  auto *MemInstPtr = Mod.findMemoryExports("memory");
+  ASSERT_TRUE(MemInstPtr != nullptr);
+  auto &MemInst = *MemInstPtr;
+  WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod);
+
+  auto *FuncInst = ZlibMod->findFuncExports("compressBound");
+  ASSERT_NE(FuncInst, nullptr);
+  auto &CompressBound = FuncInst->getHostFunc();
+  FuncInst = ZlibMod->findFuncExports("compress2");
+  ASSERT_NE(FuncInst, nullptr);
+  auto &Compress2 = FuncInst->getHostFunc();
+  FuncInst = ZlibMod->findFuncExports("uncompress");
+  ASSERT_NE(FuncInst, nullptr);
+  auto &Uncompress = FuncInst->getHostFunc();
+
+  std::array<WasmEdge::ValVariant, 1> RetVal;
+
+  // Large enough to take the multi-threaded path on multi-core hosts.
+  const uint32_t LargeDataSize = 12 * DataSize + 123;
+  for (const uint32_t Size : {uint32_t(DataSize), LargeDataSize}) {
+    for (const int32_t Level : {Z_DEFAULT_COMPRESSION, 1, 9}) {
+      uint32_t WasmHP = 1;
+      const uint32_t WasmData = WasmHP;
+      std::generate_n(MemInst.getPointer<char *>(WasmData), Size, RandChar);
+      WasmHP += Size;
+
+      EXPECT_TRUE(CompressBound.run(
+          CallFrame, std::initializer_list<WasmEdge::ValVariant>{Size},
+          RetVal));
+      const uint32_t Bound = RetVal[0].get<int32_t>();
+      EXPECT_GE(Bound, Size);
+
+      const uint32_t WasmDestLen = WasmHP;
+      WasmHP += sizeof(uint32_t);
+      const uint32_t WasmCompressedData = WasmHP;
+      WasmHP += Bound;
+      *MemInst.getPointer<uint32_t *>(WasmDestLen) = Bound;
+      EXPECT_TRUE(Compress2.run(CallFrame,
+                                std::initializer_list<WasmEdge::ValVariant>{
+                                    WasmCompressedData, WasmDestLen, WasmData,
+                                    Size, Level},
+                                RetVal));
+      EXPECT_EQ(RetVal[0].get<int32_t>(), Z_OK);
+      const uint32_t CompressedSize =
+          *MemInst.getPointer<uint32_t *>(WasmDestLen);
+      EXPECT_LE(CompressedSize, Bound);
+
+      const uint32_t WasmDecompressedData = WasmHP;
+      *MemInst.getPointer<uint32_t *>(WasmDestLen) = Size;
+      EXPECT_TRUE(Uncompress.run(CallFrame,
+                                 std::initializer_list<WasmEdge::ValVariant>{
+                                     WasmDecompressedData, WasmDestLen,
+                                     WasmCompressedData, CompressedSize},
+                                 RetVal));
+      EXPECT_EQ(RetVal[0].get<int32_t>(), Z_OK);
+      EXPECT_EQ(*MemInst.getPointer<uint32_t *>(WasmDestLen), Size);
+      EXPECT_TRUE(
+          std::equal(MemInst.getPointer<uint8_t *>(WasmDecompressedData),
+                     MemInst.getPointer<uint8_t *>(WasmDecompressedData + Size),
+                     MemInst.getPointer<uint8_t *>(WasmData)));
+
+      // Too small output buffer.
+      *MemInst.getPointer<uint32_t *>(WasmDestLen) = CompressedSize / 2;
+      EXPECT_TRUE(Compress2.run(CallFrame,
+                                std::initializer_list<WasmEdge::ValVariant>{
+                                    WasmCompressedData, WasmDestLen, WasmData,
+                                    Size, Level},
+                                RetVal));
+      EXPECT_EQ(RetVal[0].get<int32_t>(), Z_BUF_ERROR);
+    }
+  }
+}
+
+TEST(WasmEdgeZlibTest, MemoryAccount) {
+  auto ZlibMod = createModule();
+  ASSERT_TRUE(ZlibMod);
+  WasmEdge::Statistics::Statistics Stat;
+  ASSERT_TRUE(ZlibMod->attachMemoryAccount(Stat.getMemoryAccount()));
+
+  // Create the calling frame with memory instance.
+  WasmEdge::Runtime::Instance::ModuleInstance Mod("");
+  Mod.addHostMemory(
+      "memory", std::make_unique<WasmEdge::Runtime::Instance::MemoryInstance>(
+                    WasmEdge::AST::MemoryType(1)));
+  auto *MemInstPtr = Mod.findMemoryExports("memory");
+  ASSERT_TRUE(MemInstPtr != nullptr);
+  auto &MemInst = *MemInstPtr;
+  WasmEdge::Runtime::CallingFrame CallFrame(nullptr, &Mod);
+
+  auto *FuncInst = ZlibMod->findFuncExports("deflateInit_");
+  ASSERT_NE(FuncInst, nullptr);
+  auto &DeflateInit_ = FuncInst->getHostFunc();
+  FuncInst = ZlibMod->findFuncExports("deflateEnd");
+  ASSERT_NE(FuncInst, nullptr);
+  auto &DeflateEnd = FuncInst->getHostFunc();
+
+  const uint32_t WasmZlibVersion = 1;
+  std::snprintf(MemInst.getPointer<char *>(WasmZlibVersion),
+                std::strlen(ZLIB_VERSION) + 1, ZLIB_VERSION);
+  const uint32_t ModuleZStream = 64;
+  std::array<WasmEdge::ValVariant, 1> RetVal;
+  const auto Host = WasmEdge::MemoryCategory::Host;
+
+  // The internal state of the stream is charged until the stream ends.
+  EXPECT_TRUE(DeflateInit_.run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{
+          ModuleZStream, INT32_C(-1), WasmZlibVersion, sizeof(WasmZStream)},
+      RetVal));
+  EXPECT_EQ(RetVal[0].get<int32_t>(), Z_OK);
+  EXPECT_GT(Stat.getMemoryUsage(Host), 0U);
+  EXPECT_TRUE(DeflateEnd.run(
+      CallFrame, std::initializer_list<WasmEdge::ValVariant>{ModuleZStream},
+      RetVal));
+  EXPECT_EQ(RetVal[0].get<int32_t>(), Z_OK);
+  EXPECT_EQ(Stat.getMemoryUsage(Host), 0U);
+  EXPECT_GT(Stat.getMemoryPeak(Host), 0U);
+
+  // The allocation exceeding the limit fails as out of memory.
+  Stat.setMemoryLimit(Host, 1024U);
+  EXPECT_TRUE(DeflateInit_.run(
+      CallFrame,
+      std::initializer_list<WasmEdge::ValVariant>{
+          ModuleZStream, INT32_C(-1), WasmZlibVersion, sizeof(WasmZStream)},
+      RetVal));
+  EXPECT_EQ(RetVal[0].get<int32_t>(), Z_MEM_ERROR);
+  EXPECT_EQ(Stat.getMemoryUsage(Host), 0U);
+}
+
 TEST(WasmEdgeZlibTest, Module) {
   // Create the wasmedge_zlib module instance.
   auto ZlibMod = createModule();
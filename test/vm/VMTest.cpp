@@ -13,17 +13,31 @@
 ///
 //===----------------------------------------------------------------------===//
 
+#include "vm/eventloop.h"
+#include "vm/scheduler.h"
 #include "vm/vm.h"
 
 #include "common/configure.h"
 #include "common/errcode.h"
+#include "common/filesystem.h"
 #include "common/spdlog.h"
 #include "common/types.h"
+#include "host/wasi/wasimodule.h"
+#include "runtime/hostfunc.h"
+#include "runtime/instance/module.h"
 
 #include <gtest/gtest.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -38,6 +52,167 @@ static const std::array<WasmEdge::Byte, 34> ConstFuncWasm{
     0x00, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01, 0x01, 0x66,
     0x00, 0x00, 0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x07, 0x0b};
 
+// Wasm module with:
+//   (memory 1)
+//   (global $g (mut i32) (i32.const 0))
+//   (table 2 funcref)
+//   (elem (i32.const 0) $seven)
+//   (func $seven (result i32) i32.const 7)
+//   (func (export "init")
+//     (i32.store (i32.const 100) (i32.const 42))
+//     (global.set $g (i32.const 1))
+//     (drop (memory.grow (i32.const 1)))
+//     (i32.store (i32.const 70000) (i32.const 5))
+//     (table.set (i32.const 1) (table.get (i32.const 0))))
+//   (func (export "get") (result i32)
+//     (i32.add (i32.add (i32.add (i32.load (i32.const 100))
+//                                (i32.load (i32.const 70000)))
+//                       (i32.mul (global.get $g) (i32.const 1000)))
+//              (call_indirect (result i32) (i32.const 1))))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 143> StatefulWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
+    0x00, 0x01, 0x7f, 0x60, 0x00, 0x00, 0x03, 0x04, 0x03, 0x00, 0x01, 0x00,
+    0x04, 0x04, 0x01, 0x70, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x06,
+    0x06, 0x01, 0x7f, 0x01, 0x41, 0x00, 0x0b, 0x07, 0x0e, 0x02, 0x04, 0x69,
+    0x6e, 0x69, 0x74, 0x00, 0x01, 0x03, 0x67, 0x65, 0x74, 0x00, 0x02, 0x09,
+    0x07, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x49, 0x03, 0x04,
+    0x00, 0x41, 0x07, 0x0b, 0x24, 0x00, 0x41, 0xe4, 0x00, 0x41, 0x2a, 0x36,
+    0x02, 0x00, 0x41, 0x01, 0x24, 0x00, 0x41, 0x01, 0x40, 0x00, 0x1a, 0x41,
+    0xf0, 0xa2, 0x04, 0x41, 0x05, 0x36, 0x02, 0x00, 0x41, 0x01, 0x41, 0x00,
+    0x25, 0x00, 0x26, 0x00, 0x0b, 0x1d, 0x00, 0x41, 0xe4, 0x00, 0x28, 0x02,
+    0x00, 0x41, 0xf0, 0xa2, 0x04, 0x28, 0x02, 0x00, 0x6a, 0x23, 0x00, 0x41,
+    0xe8, 0x07, 0x6c, 0x6a, 0x41, 0x01, 0x11, 0x00, 0x00, 0x6a, 0x0b};
+
+// Wasm module with:
+//   (func (export "spin") (param $n i32) (result i32) (local $c i32)
+//     (block (loop
+//       (br_if 1 (i32.eqz (local.get $n)))
+//       (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+//       (local.set $c (i32.add (local.get $c) (i32.const 1)))
+//       (br 0)))
+//     (local.get $c))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 67> SpinWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x08, 0x01, 0x04,
+    0x73, 0x70, 0x69, 0x6e, 0x00, 0x00, 0x0a, 0x23, 0x01, 0x21, 0x01, 0x01,
+    0x7f, 0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0d, 0x01, 0x20, 0x00,
+    0x41, 0x01, 0x6b, 0x21, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01,
+    0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x01, 0x0b};
+
+// Wasm module with:
+//   (import "async" "wait" (func $wait (param i32)))
+//   (func (export "run") (param i32) (result i32)
+//     (call $wait (local.get 0)) (local.get 0))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 61> AwaitWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+    0x01, 0x7f, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x02, 0x0e, 0x01, 0x05,
+    0x61, 0x73, 0x79, 0x6e, 0x63, 0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x00,
+    0x03, 0x02, 0x01, 0x01, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00,
+    0x01, 0x0a, 0x0a, 0x01, 0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00,
+    0x0b};
+
+// Wasm module with:
+//   (memory 1)
+//   (func (export "grow") (param i32) (result i32)
+//     (memory.grow (local.get 0)))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 45> GrowWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00,
+    0x01, 0x07, 0x08, 0x01, 0x04, 0x67, 0x72, 0x6f, 0x77, 0x00, 0x00, 0x0a,
+    0x08, 0x01, 0x06, 0x00, 0x20, 0x00, 0x40, 0x00, 0x0b};
+
+// Wasm module with:
+//   (memory 1)
+//   (func (export "drop") (data.drop 1))
+//   (data (i32.const 0) "abcd")
+//   (data "xyz")
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 62> SegmentWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x60,
+    0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07,
+    0x08, 0x01, 0x04, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x00, 0x0c, 0x01, 0x02,
+    0x0a, 0x07, 0x01, 0x05, 0x00, 0xfc, 0x09, 0x01, 0x0b, 0x0b, 0x0f, 0x02,
+    0x00, 0x41, 0x00, 0x0b, 0x04, 0x61, 0x62, 0x63, 0x64, 0x01, 0x03, 0x78,
+    0x79, 0x7a};
+
+// Wasm module with:
+//   (import "wasi_snapshot_preview1" "args_sizes_get"
+//     (func $sizes (param i32 i32) (result i32)))
+//   (export "sizes" (func $sizes))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 71> WasiReexportWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x60,
+    0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x02, 0x29, 0x01, 0x16, 0x77, 0x61, 0x73,
+    0x69, 0x5f, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x5f, 0x70,
+    0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x31, 0x0e, 0x61, 0x72, 0x67, 0x73,
+    0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x00,
+    0x07, 0x09, 0x01, 0x05, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00};
+
+// Wasm module with:
+//   (import "reexp" "sizes" (func $sizes (param i32 i32) (result i32)))
+//   (memory 1)
+//   (func (export "argc") (result i32)
+//     (drop (call $sizes (i32.const 0) (i32.const 4)))
+//     (i32.load (i32.const 0)))
+// Generated by manual binary encoding.
+static const std::array<WasmEdge::Byte, 75> WasiReexportUserWasm{
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x02, 0x60,
+    0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x01, 0x7f, 0x02, 0x0f, 0x01,
+    0x05, 0x72, 0x65, 0x65, 0x78, 0x70, 0x05, 0x73, 0x69, 0x7a, 0x65, 0x73,
+    0x00, 0x00, 0x03, 0x02, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07,
+    0x08, 0x01, 0x04, 0x61, 0x72, 0x67, 0x63, 0x00, 0x01, 0x0a, 0x10, 0x01,
+    0x0e, 0x00, 0x41, 0x00, 0x41, 0x04, 0x10, 0x00, 0x1a, 0x41, 0x00, 0x28,
+    0x02, 0x00, 0x0b};
+
+/// Host function awaiting a timer of the given milliseconds, or completing
+/// at once for 0.
+class AsyncWait : public Runtime::HostFunction<AsyncWait> {
+public:
+  ~AsyncWait() noexcept override {
+    for (auto &Timer : Timers) {
+      Timer.join();
+    }
+  }
+  Expect<void> body(const Runtime::CallingFrame &Frame, uint32_t Millis) {
+    Frame.getExecutor()->awaitHost(
+        [this, Millis](std::function<void()> Done) {
+          if (Millis == 0) {
+            Done();
+            return;
+          }
+          std::unique_lock Lock(Mutex);
+          Timers.emplace_back([Millis, Done = std::move(Done)]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(Millis));
+            Done();
+          });
+        });
+    ++Awaits;
+    return {};
+  }
+  std::atomic_uint32_t Awaits = 0;
+
+private:
+  std::mutex Mutex;
+  std::vector<std::thread> Timers;
+};
+
+class AsyncModule : public Runtime::Instance::ModuleInstance {
+public:
+  AsyncModule() : ModuleInstance("async") {
+    auto FP = std::make_unique<AsyncWait>();
+    F = FP.get();
+    addHostFunc("wait", std::move(FP));
+  }
+  uint32_t getAwaits() const noexcept { return F->Awaits; }
+
+private:
+  AsyncWait *F = nullptr;
+};
+
 /// Helper: drive the VM through load, validate, and instantiate.
 void instantiateFixture(VM::VM &TestVM) {
   ASSERT_TRUE(TestVM.loadWasm(ConstFuncWasm));
@@ -161,6 +336,34 @@ TEST(VMPluginTest, WasiImportModulePresence) {
   EXPECT_EQ(PlainVM.getImportModule(HostRegistration::Wasi), nullptr);
 }
 
+TEST(VMPluginTest, WasiReexportedFunction) {
+  Configure Conf;
+  Conf.addHostRegistration(HostRegistration::Wasi);
+  VM::VM TestVM(Conf);
+  auto *WasiMod = dynamic_cast<Host::WasiModule *>(
+      TestVM.getImportModule(HostRegistration::Wasi));
+  ASSERT_NE(WasiMod, nullptr);
+  const std::array<std::string, 2> Args = {"a", "b"};
+  WasiMod->init({}, "test", Args, {});
+
+  // The module calling the re-exported function does not import the WASI
+  // module itself, but the function still uses the WASI module of this VM.
+  ASSERT_TRUE(TestVM.registerModule("reexp", WasiReexportWasm));
+  ASSERT_TRUE(TestVM.loadWasm(WasiReexportUserWasm));
+  ASSERT_TRUE(TestVM.validate());
+  ASSERT_TRUE(TestVM.instantiate());
+  auto Res = TestVM.execute("argc");
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1U);
+  EXPECT_EQ((*Res)[0].first.get<uint32_t>(), 3U);
+
+  // So does a direct invocation.
+  Res = TestVM.execute("wasi_snapshot_preview1", "sched_yield");
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1U);
+  EXPECT_EQ((*Res)[0].first.get<int32_t>(), __WASI_ERRNO_SUCCESS);
+}
+
 TEST(VMCleanupTest, VMIsReusableAfterCleanup) {
   Configure Conf;
   VM::VM TestVM(Conf);
@@ -186,6 +389,328 @@ TEST(VMCleanupTest, CleanupRestoresBuiltinHosts) {
   EXPECT_NE(TestVM.getStoreManager().findModule("wasi_ephemeral_nn"), nullptr);
 }
 
+TEST(VMSnapshotTest, SaveAndRestore) {
+  Configure Conf;
+  const auto Path = std::filesystem::temp_directory_path() /
+                    std::filesystem::u8path("wasmedge_vm_snapshot_test.snap");
+
+  VM::VM InitVM(Conf);
+  ASSERT_TRUE(InitVM.loadWasm(StatefulWasm));
+  ASSERT_TRUE(InitVM.validate());
+  ASSERT_TRUE(InitVM.instantiate());
+  ASSERT_TRUE(InitVM.execute("init"));
+  ASSERT_TRUE(InitVM.saveSnapshot(Path));
+
+  VM::VM RestoredVM(Conf);
+  ASSERT_TRUE(RestoredVM.loadWasm(StatefulWasm));
+  ASSERT_TRUE(RestoredVM.validate());
+  ASSERT_TRUE(RestoredVM.instantiate());
+  // Table slot 1 is only set by the initialization.
+  ASSERT_FALSE(RestoredVM.execute("get"));
+  ASSERT_TRUE(RestoredVM.restoreSnapshot(Path));
+  auto Res = RestoredVM.execute("get");
+  ASSERT_TRUE(Res);
+  ASSERT_EQ(Res->size(), 1U);
+  EXPECT_EQ((*Res)[0].first.get<uint32_t>(), 42U + 5U + 1000U + 7U);
+  EXPECT_EQ(RestoredVM.getActiveModule()->getMemoryInstances()[0]->getPageSize(),
+            2U);
+
+  // A snapshot only applies to the module it was taken from.
+  VM::VM OtherVM(Conf);
+  instantiateFixture(OtherVM);
+  EXPECT_FALSE(OtherVM.restoreSnapshot(Path));
+
+  std::filesystem::remove(Path);
+}
+
+TEST(VMSnapshotTest, MalformedSnapshotKeepsState) {
+  Configure Conf;
+  const auto Path = std::filesystem::temp_directory_path() /
+                    std::filesystem::u8path("wasmedge_vm_snapshot_bad.snap");
+
+  VM::VM InitVM(Conf);
+  ASSERT_TRUE(InitVM.loadWasm(StatefulWasm));
+  ASSERT_TRUE(InitVM.validate());
+  ASSERT_TRUE(InitVM.instantiate());
+  ASSERT_TRUE(InitVM.execute("init"));
+
+  VM::VM RestoredVM(Conf);
+  ASSERT_TRUE(RestoredVM.loadWasm(StatefulWasm));
+  ASSERT_TRUE(RestoredVM.validate());
+  ASSERT_TRUE(RestoredVM.instantiate());
+  const auto *Mem = RestoredVM.getActiveModule()->getMemoryInstances()[0];
+  const auto PageSize = Mem->getPageSize();
+
+  // The memory contents are cut off.
+  ASSERT_TRUE(InitVM.saveSnapshot(Path));
+  std::filesystem::resize_file(Path,
+                               std::filesystem::file_size(Path) - UINT64_C(1));
+  auto Res = RestoredVM.restoreSnapshot(Path);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::UnexpectedEnd);
+
+  // The size of the first table is far beyond the file.
+  ASSERT_TRUE(InitVM.saveSnapshot(Path));
+  {
+    std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+    const uint64_t Size = UINT64_C(1) << 60;
+    File.seekp(32);
+    File.write(reinterpret_cast<const char *>(&Size), sizeof(Size));
+  }
+  Res = RestoredVM.restoreSnapshot(Path);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::UnexpectedEnd);
+
+  // The second table slot holds an i32 instead of a function reference.
+  ASSERT_TRUE(InitVM.saveSnapshot(Path));
+  {
+    std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+    auto Type = ValType(TypeCode::I32).getRawData();
+    Type[0] = 0;
+    File.seekp(56);
+    File.write(reinterpret_cast<const char *>(Type.data()), Type.size());
+  }
+  Res = RestoredVM.restoreSnapshot(Path);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::MalformedValType);
+
+  // The i32 global is stored as a reference.
+  ASSERT_TRUE(InitVM.saveSnapshot(Path));
+  {
+    std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+    const uint32_t IsRef = 1;
+    File.seekp(76);
+    File.write(reinterpret_cast<const char *>(&IsRef), sizeof(IsRef));
+  }
+  Res = RestoredVM.restoreSnapshot(Path);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::MalformedValType);
+
+  // Nothing of the failed restores is applied.
+  EXPECT_EQ(Mem->getPageSize(), PageSize);
+  EXPECT_FALSE(RestoredVM.execute("get"));
+
+  std::filesystem::remove(Path);
+}
+
+TEST(VMSnapshotTest, SnapshotWithoutInstanceFails) {
+  Configure Conf;
+  VM::VM TestVM(Conf);
+  auto Res = TestVM.saveSnapshot(std::filesystem::temp_directory_path() /
+                                 std::filesystem::u8path("unused.snap"));
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::WrongVMWorkflow);
+}
+
+TEST(VMSchedulerTest, TimeSlicedTenants) {
+  Configure Conf;
+  VM::VM FirstVM(Conf), SecondVM(Conf);
+  VM::VM *VMs[2] = {&FirstVM, &SecondVM};
+  for (auto *TestVM : VMs) {
+    ASSERT_TRUE(TestVM->loadWasm(SpinWasm));
+    ASSERT_TRUE(TestVM->validate());
+    ASSERT_TRUE(TestVM->instantiate());
+  }
+
+  // One worker and short slices, so the tenants take turns.
+  VM::Scheduler Sched(1, std::chrono::microseconds(500));
+  const uint32_t Tenants[2] = {Sched.addTenant(), Sched.addTenant()};
+  const std::array<ValVariant, 1> Params{ValVariant(uint32_t(2000000))};
+  const std::array<ValType, 1> ParamTypes{ValType(TypeCode::I32)};
+  std::vector<std::future<VM::Scheduler::Result>> Futures;
+  for (uint32_t I = 0; I < 2; ++I) {
+    for (uint32_t J = 0; J < 2; ++J) {
+      Futures.push_back(
+          Sched.submit(Tenants[I], *VMs[I], "spin", Params, ParamTypes));
+    }
+  }
+  for (auto &Future : Futures) {
+    auto Res = Future.get();
+    ASSERT_TRUE(Res);
+    ASSERT_EQ(Res->size(), 1U);
+    EXPECT_EQ((*Res)[0].first.get<uint32_t>(), 2000000U);
+  }
+  for (const auto Tenant : Tenants) {
+    const auto Stat = Sched.getStatistics(Tenant);
+    EXPECT_EQ(Stat.Submitted, 2U);
+    EXPECT_EQ(Stat.Completed, 2U);
+    EXPECT_EQ(Stat.Slices, Stat.Completed + Stat.Yields);
+    EXPECT_GT(Stat.Yields, 0U);
+  }
+
+  // The function not found is reported through the future.
+  auto Res = Sched.submit(Tenants[0], FirstVM, "unknown").get();
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::FuncNotFound);
+}
+
+TEST(VMSchedulerTest, DestructionInterruptsTasks) {
+  Configure Conf;
+  VM::VM TestVM(Conf);
+  ASSERT_TRUE(TestVM.loadWasm(SpinWasm));
+  ASSERT_TRUE(TestVM.validate());
+  ASSERT_TRUE(TestVM.instantiate());
+
+  const std::array<ValVariant, 1> Params{ValVariant(uint32_t(UINT32_MAX))};
+  const std::array<ValType, 1> ParamTypes{ValType(TypeCode::I32)};
+  std::future<VM::Scheduler::Result> Running, Pending;
+  {
+    VM::Scheduler Sched(1, std::chrono::microseconds(500));
+    const uint32_t Tenant = Sched.addTenant();
+    Running = Sched.submit(Tenant, TestVM, "spin", Params, ParamTypes);
+    Pending = Sched.submit(Tenant, TestVM, "spin", Params, ParamTypes);
+    while (Sched.getStatistics(Tenant).Yields == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  for (auto *Future : {&Running, &Pending}) {
+    auto Res = Future->get();
+    ASSERT_FALSE(Res);
+    EXPECT_EQ(Res.error(), ErrCode::Value::Interrupted);
+  }
+}
+
+TEST(VMEventLoopTest, AwaitingHostFunctions) {
+  Configure Conf;
+  AsyncModule HostMod;
+  VM::VM FirstVM(Conf), SecondVM(Conf);
+  VM::VM *VMs[2] = {&FirstVM, &SecondVM};
+  for (auto *TestVM : VMs) {
+    ASSERT_TRUE(TestVM->registerModule(HostMod));
+    ASSERT_TRUE(TestVM->loadWasm(AwaitWasm));
+    ASSERT_TRUE(TestVM->validate());
+    ASSERT_TRUE(TestVM->instantiate());
+  }
+
+  // The executions of both VMs wait for their timers on this thread at the
+  // same time, and the executions of the same VM interleave.
+  VM::EventLoop Loop;
+  std::vector<std::pair<uint32_t, std::future<VM::EventLoop::Result>>> Futures;
+  for (uint32_t I = 0; I < 32; ++I) {
+    const uint32_t Millis = (I % 4 == 0) ? 0 : 100;
+    const std::array<ValVariant, 1> Params{ValVariant(Millis)};
+    const std::array<ValType, 1> ParamTypes{ValType(TypeCode::I32)};
+    Futures.emplace_back(Millis, Loop.spawn(*VMs[I % 2], "run", Params,
+                                            ParamTypes));
+  }
+  EXPECT_EQ(Loop.getPendingCount(), 32U);
+  const auto Start = std::chrono::steady_clock::now();
+  Loop.run();
+  // The 24 timers would take 2.4s one after another.
+  EXPECT_LT(std::chrono::steady_clock::now() - Start, std::chrono::seconds(1));
+  EXPECT_EQ(Loop.getPendingCount(), 0U);
+  for (auto &[Millis, Future] : Futures) {
+    auto Res = Future.get();
+    ASSERT_TRUE(Res);
+    ASSERT_EQ(Res->size(), 1U);
+    EXPECT_EQ((*Res)[0].first.get<uint32_t>(), Millis);
+  }
+  EXPECT_EQ(HostMod.getAwaits(), 32U);
+
+  // Outside the loop, the host function blocks the thread instead.
+  auto Res = FirstVM.execute(
+      "run", std::array<ValVariant, 1>{ValVariant(uint32_t(1))},
+      std::array<ValType, 1>{ValType(TypeCode::I32)});
+  ASSERT_TRUE(Res);
+  EXPECT_EQ((*Res)[0].first.get<uint32_t>(), 1U);
+  EXPECT_EQ(HostMod.getAwaits(), 33U);
+}
+
+TEST(VMMemoryAccountingTest, LinearMemoryLimit) {
+  Configure Conf;
+  VM::VM TestVM(Conf);
+  auto &Stat = TestVM.getStatistics();
+  ASSERT_TRUE(TestVM.loadWasm(GrowWasm));
+  ASSERT_TRUE(TestVM.validate());
+  ASSERT_TRUE(TestVM.instantiate());
+  EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::LinearMemory), 65536U);
+
+  // Allow one more page.
+  Stat.setMemoryLimit(Stat.getTotalMemoryUsage() + 65536U);
+  const std::array<ValType, 1> ParamTypes{ValType(TypeCode::I32)};
+  const std::array<ValVariant, 1> Params{ValVariant(uint32_t(1))};
+  auto Res = TestVM.execute("grow", Params, ParamTypes);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ((*Res)[0].first.get<uint32_t>(), 1U);
+  Res = TestVM.execute("grow", Params, ParamTypes);
+  ASSERT_TRUE(Res);
+  EXPECT_EQ((*Res)[0].first.get<uint32_t>(), UINT32_MAX);
+  EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::LinearMemory), 131072U);
+  EXPECT_EQ(Stat.getMemoryPeak(MemoryCategory::LinearMemory), 131072U);
+  EXPECT_GT(Stat.getMemoryPeak(MemoryCategory::Stack), 0U);
+  EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::Stack), 0U);
+
+  // The memory is released with the module instance.
+  TestVM.cleanup();
+  EXPECT_EQ(Stat.getTotalMemoryUsage(), 0U);
+
+  // The instantiation exceeding the limit fails.
+  Stat.setMemoryLimit(65535U);
+  ASSERT_TRUE(TestVM.loadWasm(GrowWasm));
+  ASSERT_TRUE(TestVM.validate());
+  auto InstRes = TestVM.instantiate();
+  ASSERT_FALSE(InstRes);
+  EXPECT_EQ(InstRes.error(), ErrCode::Value::MemoryLimitExceeded);
+  EXPECT_EQ(Stat.getTotalMemoryUsage(), 0U);
+}
+
+TEST(VMMemoryAccountingTest, PassiveSegmentsOnly) {
+  Configure Conf;
+  VM::VM TestVM(Conf);
+  auto &Stat = TestVM.getStatistics();
+  ASSERT_TRUE(TestVM.loadWasm(SegmentWasm));
+  ASSERT_TRUE(TestVM.validate());
+  ASSERT_TRUE(TestVM.instantiate());
+  // The active segment is dropped after the memory initialization.
+  EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::Segment), 3U);
+  ASSERT_TRUE(TestVM.execute("drop"));
+  EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::Segment), 0U);
+  TestVM.cleanup();
+  EXPECT_EQ(Stat.getTotalMemoryUsage(), 0U);
+}
+
+TEST(VMMemoryAccountingTest, HostModule) {
+  Configure Conf;
+  auto HostMod = std::make_unique<Runtime::Instance::ModuleInstance>("host");
+  HostMod->addHostMemory("memory",
+                         std::make_unique<Runtime::Instance::MemoryInstance>(
+                             AST::MemoryType(2)));
+  std::shared_ptr<Statistics::MemoryAccount> Account;
+  {
+    VM::VM TestVM(Conf);
+    auto &Stat = TestVM.getStatistics();
+    // The stack is only sampled, so its limit cannot be set.
+    Stat.setMemoryLimit(MemoryCategory::Stack, 1U);
+    EXPECT_EQ(Stat.getMemoryLimit(MemoryCategory::Stack), UINT64_MAX);
+
+    // The memories of a host module are charged on the registration.
+    ASSERT_TRUE(TestVM.registerModule(*HostMod));
+    EXPECT_EQ(Stat.getMemoryUsage(MemoryCategory::LinearMemory), 131072U);
+    Account = Stat.getMemoryAccount();
+  }
+
+  // The account outlives the VM and its statistics while the host module
+  // instance charged to it is alive.
+  EXPECT_EQ(HostMod->getMemoryAccount(), Account);
+  EXPECT_EQ(Account->getUsage(MemoryCategory::LinearMemory), 131072U);
+  HostMod.reset();
+  EXPECT_EQ(Account->getTotalUsage(), 0U);
+
+  // The registration exceeding the limit fails.
+  HostMod = std::make_unique<Runtime::Instance::ModuleInstance>("host");
+  HostMod->addHostMemory("memory",
+                         std::make_unique<Runtime::Instance::MemoryInstance>(
+                             AST::MemoryType(2)));
+  VM::VM TestVM(Conf);
+  auto &Stat = TestVM.getStatistics();
+  Stat.setMemoryLimit(MemoryCategory::LinearMemory, 65536U);
+  auto Res = TestVM.registerModule(*HostMod);
+  ASSERT_FALSE(Res);
+  EXPECT_EQ(Res.error(), ErrCode::Value::MemoryLimitExceeded);
+  EXPECT_EQ(Stat.getTotalMemoryUsage(), 0U);
+  EXPECT_EQ(HostMod->getMemoryAccount(), nullptr);
+}
+
 } // namespace
 
 GTEST_API_ int main(int argc, char **argv) {